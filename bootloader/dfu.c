@@ -26,8 +26,13 @@
 #include "usb_dev.h"
 #include "dfu.h"
 
-// Internal flash-programming state machine
+// Internal flash-programming state machine. A block spans several flash
+// sectors; fl_staging_offset tracks how much of it has been copied out of
+// the staging buffer into FlexRAM so far.
 static unsigned fl_current_addr = 0;
+static unsigned fl_block_length = 0;
+static unsigned fl_staging_offset = 0;
+static unsigned fl_chunk_bytes = 0;
 static enum {
     flsIDLE = 0,
     flsERASING,
@@ -38,8 +43,22 @@ static dfu_state_t dfu_state = dfuIDLE;
 static dfu_status_t dfu_status = OK;
 static unsigned dfu_poll_timeout = 1;
 
-// Programming buffer in MK20DX128 FlexRAM, where the flash controller can quickly access it.
-static __attribute__ ((section(".flexram"))) uint8_t dfu_buffer[DFU_TRANSFER_SIZE];
+// A completed block waiting for the flash controller to finish the one
+// before it. We never busy-wait on flash inside the USB interrupt, since a
+// sector erase outlasts the 10ms watchdog; the DFU status poll launches the
+// deferred block instead.
+static bool block_pending = false;
+static unsigned pending_block_num;
+static unsigned pending_block_length;
+
+// Staging buffer in main SRAM. Incoming packets land here, so reception of
+// the next block can overlap flash programming of the previous one.
+static uint8_t dfu_staging[DFU_TRANSFER_SIZE];
+
+// Section program buffer in MK20DX128 FlexRAM. The Program Section command
+// reads its data from the start of FlexRAM, so each sector's worth is copied
+// here from staging just before it's programmed.
+static __attribute__ ((section(".flexram"))) uint8_t dfu_buffer[DFU_SECTOR_SIZE];
 
 static void *memcpy(void *dst, const void *src, size_t cnt) {
     uint8_t *dst8 = dst;
@@ -103,7 +122,31 @@ static void ftfl_begin_program_section(uint32_t address, uint32_t numLWords)
 
 static uint32_t address_for_block(unsigned blockNum)
 {
-    return 0x1000 + (blockNum << 10);
+    return 0x1000 + blockNum * DFU_TRANSFER_SIZE;
+}
+
+static void fl_begin_sector()
+{
+    // Copy the next sector's worth of the block out of staging and start
+    // erasing its flash sector. The program command is launched from
+    // fl_state_poll() once the erase completes.
+    fl_chunk_bytes = fl_block_length - fl_staging_offset;
+    if (fl_chunk_bytes > DFU_SECTOR_SIZE) {
+        fl_chunk_bytes = DFU_SECTOR_SIZE;
+    }
+    memcpy(dfu_buffer, dfu_staging + fl_staging_offset, fl_chunk_bytes);
+    fl_staging_offset += fl_chunk_bytes;
+
+    fl_state = flsERASING;
+    ftfl_begin_erase_sector(fl_current_addr);
+}
+
+static void fl_begin_block(unsigned blockNum, unsigned blockLength)
+{
+    fl_current_addr = address_for_block(blockNum);
+    fl_block_length = blockLength;
+    fl_staging_offset = 0;
+    fl_begin_sector();
 }
 
 void dfu_init()
@@ -130,7 +173,7 @@ bool dfu_download(unsigned blockNum, unsigned blockLength,
     }
 
     // Store more data...
-    memcpy(dfu_buffer + packetOffset, data, packetLength);
+    memcpy(dfu_staging + packetOffset, data, packetLength);
 
     if (packetOffset + packetLength != blockLength) {
         // Still waiting for more data.
@@ -144,24 +187,23 @@ bool dfu_download(unsigned blockNum, unsigned blockLength,
         return false;
     }
 
-    if (ftfl_busy() || fl_state != flsIDLE) {
-        // Flash controller shouldn't be busy now!
-        dfu_state = dfuERROR;
-        dfu_status = errUNKNOWN;
-        return false;       
-    }
-
     if (!blockLength) {
-        // End of download
+        // End of download. Any outstanding programming finishes before the
+        // manifest phase is reported; see dfu_getstatus().
         dfu_state = dfuMANIFEST_SYNC;
         dfu_status = OK;
         return true;
     }
 
-    // Start programming a block by erasing the corresponding flash sector
-    fl_state = flsERASING;
-    fl_current_addr = address_for_block(blockNum);
-    ftfl_begin_erase_sector(fl_current_addr);
+    if (ftfl_busy() || fl_state != flsIDLE) {
+        // The previous block is still being programmed. Defer this one; the
+        // status poll launches it once the flash controller is free.
+        block_pending = true;
+        pending_block_num = blockNum;
+        pending_block_length = blockLength;
+    } else {
+        fl_begin_block(blockNum, blockLength);
+    }
 
     dfu_state = dfuDNLOAD_SYNC;
     dfu_status = OK;
@@ -225,14 +267,23 @@ static void fl_state_poll()
             if (!fl_handle_status(fstat, errERASE)) {
                 // Done! Move on to programming the sector.
                 fl_state = flsPROGRAMMING;
-                ftfl_begin_program_section(fl_current_addr, DFU_TRANSFER_SIZE/4);
+                ftfl_begin_program_section(fl_current_addr, (fl_chunk_bytes + 3) / 4);
             }
             break;
 
         case flsPROGRAMMING:
             if (!fl_handle_status(fstat, errVERIFY)) {
-                // Done!
-                fl_state = flsIDLE;
+                // Done with this sector. Move on to the block's next sector,
+                // or to a whole block that was deferred while we were busy.
+                fl_current_addr += fl_chunk_bytes;
+                if (fl_staging_offset < fl_block_length) {
+                    fl_begin_sector();
+                } else if (block_pending) {
+                    block_pending = false;
+                    fl_begin_block(pending_block_num, pending_block_length);
+                } else {
+                    fl_state = flsIDLE;
+                }
             }
             break;
     }
@@ -249,7 +300,10 @@ bool dfu_getstatus(uint8_t *status)
 
             if (dfu_state == dfuERROR) {
                 // An error occurred inside fl_state_poll();
-            } else if (fl_state == flsIDLE) {
+            } else if (!block_pending && fl_staging_offset >= fl_block_length) {
+                // Every byte of the block has been copied out of staging, so
+                // the host can start streaming the next block while the tail
+                // of this one is still being programmed from FlexRAM.
                 dfu_state = dfuDNLOAD_IDLE;
             } else {
                 dfu_state = dfuDNBUSY;
@@ -257,6 +311,16 @@ bool dfu_getstatus(uint8_t *status)
             break;
 
         case dfuMANIFEST_SYNC:
+            // Let any outstanding programming finish before declaring the
+            // image complete.
+            fl_state_poll();
+            if (dfu_state == dfuERROR) {
+                break;
+            }
+            if (fl_state != flsIDLE) {
+                break;
+            }
+
             // Ready to reboot. The main thread will take care of this. Also let the DFU tool
             // know to leave us alone until this happens.
             dfu_state = dfuMANIFEST;
@@ -282,7 +346,9 @@ bool dfu_clrstatus()
     switch (dfu_state) {
 
         case dfuERROR:
-            // Clear an error
+            // Clear an error, dropping any block that was deferred behind
+            // the operation that failed.
+            block_pending = false;
             dfu_state = dfuIDLE;
             dfu_status = OK;
             return true;
@@ -297,6 +363,7 @@ bool dfu_clrstatus()
 
 bool dfu_abort()
 {
+    block_pending = false;
     dfu_state = dfuIDLE;
     dfu_status = OK;
     return true;
@@ -60,7 +60,11 @@ typedef enum {
 
 #define DFU_INTERFACE             0
 #define DFU_DETACH_TIMEOUT        10000     // 10 second timer
-#define DFU_TRANSFER_SIZE         1024      // Flash sector size
+#define DFU_SECTOR_SIZE           1024      // Flash sector size
+#define DFU_TRANSFER_SIZE         4096      // Four flash sectors per DFU block.
+                                            // Staged in main SRAM; the 16K part
+                                            // has plenty of headroom beyond the
+                                            // bootloader's code and stack.
 
 // Main thread
 void dfu_init();
@@ -63,6 +63,12 @@ constexpr Timings timingsSK6812 { 800000, 100, 60, 176 };
 constexpr Timings timingsSK6812Fast { 900000, 100, 44, 150 };
 constexpr Timings timingsSK6812Extreme { 960000, 80, 50, 160 };
 
+// First-generation WS2811 parts clocked at 400 kHz. The high-time fractions
+// are unchanged since the waveform scales with the cycle; only the bitrate
+// halves. Lets one firmware image serve installations that mix 400 kHz and
+// 800 kHz strips, selected per device through the configuration packet.
+constexpr Timings timingsWS2811Slow { 400000, 300, 60, 176 };
+
 struct NamedTimings {
     const char* name;
     const Timings timings;
@@ -72,6 +78,7 @@ constexpr NamedTimings namedTimings[] = {
     { "sk6812", timingsSK6812 },
     { "sk6812-fast", timingsSK6812Fast },
     { "sk6812-extreme", timingsSK6812Extreme },
+    { "ws2811-400khz", timingsWS2811Slow },
 };
 
 inline const Timings* timingsByName(const char* name) {
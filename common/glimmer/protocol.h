@@ -22,6 +22,8 @@ enum class PacketType : uint8_t {
     config = controlFlag | 0x00,
     // A debugging packet.
     debug = controlFlag | 0x01,
+    // A delta frame header, announcing a partial frame.
+    frameDelta = controlFlag | 0x02,
 };
 constexpr bool isControlPacket(PacketType type) {
     return static_cast<uint8_t>(type) & static_cast<uint8_t>(PacketType::controlFlag);
@@ -40,12 +42,15 @@ struct FramePacket {
 enum class ColorFormat : uint8_t {
     R8G8B8 = 0,     // 24-bit color
     R11G11B11 = 1,  // 33-bit color, blue LSBs are packed into a separate word
+    R5G6B5 = 2,     // 16-bit color, little-endian words after one padding byte
 };
 
 // Computes the number of pixels that can be stored in a USB packet, taking
-// into account protocol overhead (1 header byte).
+// into account protocol overhead (1 header byte; R5G6B5 also skips a padding
+// byte so its pixel words stay 16-bit aligned).
 constexpr size_t pixelsPerPacket(ColorFormat fmt) {
-    return fmt == ColorFormat::R8G8B8 ? 21 : 15;
+    return fmt == ColorFormat::R8G8B8 ? 21 :
+            fmt == ColorFormat::R5G6B5 ? 31 : 15;
 }
 
 // Computes the number of packets per frame.
@@ -56,6 +61,21 @@ constexpr size_t packetsPerFrame(size_t ledStrips, size_t ledsPerStrip, ColorFor
 // Maximum number of packets per frame.
 constexpr size_t maxPacketsPerFrame = framePacketMaxIndex + 1;
 
+// Size of a bitmap with one bit per frame packet index.
+constexpr size_t frameDeltaBitmapBytes = maxPacketsPerFrame / 8;
+
+// Header announcing a partial (delta) frame. The host sends this packet
+// first, followed by only the frame packets whose bits are set in |bitmap|,
+// in ascending index order. The frame commits once every announced packet
+// has arrived; packets absent from the bitmap keep their contents from the
+// previously committed frame. Sending a full set of frame packets without
+// a header remains valid and commits when the last packet arrives.
+struct FrameDeltaPacket {
+    PacketType type;   // set to |PacketType::frameDelta|
+    uint8_t reserved;  // set to 0
+    uint8_t bitmap[frameDeltaBitmapBytes];  // bit (i & 7) of byte (i >> 3) covers packet i
+};
+
 // The type of dither to apply to each pixel.
 enum class DitherMode : uint8_t {
     NONE = 0,
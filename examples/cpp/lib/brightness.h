@@ -54,8 +54,12 @@ public:
     virtual bool endFrame(const FrameInfo& f);
     virtual void debug(const DebugInfo& f);
     virtual void shader(Vec3& rgb, const PixelInfo& p) const;
+    virtual void shaderBlock(Vec3* out, const PixelInfo* pixels, size_t count) const;
 
 private:
+    // Average simulated linear brightness of the stored frame at 'scale'
+    float measureAverage(const FrameInfo& f, float scale, unsigned count) const;
+
     Effect &next;
     float lowerLimit, upperLimit;
     float currentScale;
@@ -124,6 +128,49 @@ inline float Brightness::getTotalBrightnessDelta() const
     return totalBrightnessDelta;
 }
 
+inline float Brightness::measureAverage(const FrameInfo& f, float scale, unsigned count) const
+{
+    float total = 0;
+
+    std::vector<Vec3>::const_iterator ci = nextColors->begin();
+    std::vector<Vec3>::const_iterator ce = nextColors->end();
+    PixelInfoIter pi = f.pixels.begin();
+
+#ifdef VL_SIMD
+    // Scale and clamp all three channels at once; only the gamma table
+    // lookups stay scalar. The fourth lane is Vec3 padding, clamped along
+    // with the rest and never read back.
+    const VlFloat4 vzero = vl_splat4(0.0f);
+    const VlFloat4 vmax = vl_splat4(float(gammaTableSize - 1));
+    const VlFloat4 vscale = vl_splat4(scale * float(gammaTableSize - 1));
+
+    for (;ci != ce; ++ci, ++pi) {
+        if (pi->isMapped()) {
+            VlFloat4 v = vl_mul4(vl_load4(ci->Ref()), vscale);
+            v = vl_min4(vl_max4(v, vzero), vmax);
+
+            float index[4];
+            vl_store4(index, v);
+            total += gammaTable[(int)index[0]]
+                   + gammaTable[(int)index[1]]
+                   + gammaTable[(int)index[2]];
+        }
+    }
+#else
+    for (;ci != ce; ++ci, ++pi) {
+        if (pi->isMapped()) {
+            for (unsigned i = 0; i < 3; i++) {
+                // Simulated linear brightness, using current scale
+                float c = (*ci)[i] * scale;
+                total += gammaTable[std::max<int>(0, std::min<int>(gammaTableSize - 1, c * float(gammaTableSize - 1)))];
+            }
+        }
+    }
+#endif
+
+    return total / count;
+}
+
 inline void Brightness::beginFrame(const FrameInfo& f)
 {
     next.beginFrame(f);
@@ -187,28 +234,14 @@ inline void Brightness::beginFrame(const FrameInfo& f)
 
     unsigned iter = 0;
     float avg;
-    float scale = 1.0;
 
-    for (; iter < maxIters; iter++) {
+    // Start from the last frame's converged scale. Consecutive frames are
+    // nearly identical, so this usually converges on the first iteration.
+    float scale = currentScale;
 
-        std::vector<Vec3>::iterator ci = nextColors->begin();
-        std::vector<Vec3>::iterator ce = nextColors->end();
-        PixelInfoIter pi = f.pixels.begin();
-        avg = 0;
-
-        for (;ci != ce; ++ci, ++pi) {
-            Vec3& rgb = *ci;
-
-            // Simulated linear brightness, using current scale
-            if (pi->isMapped()) {
-                for (unsigned i = 0; i < 3; i++) {
-                    float c = rgb[i] * scale;
-                    avg += gammaTable[std::max<int>(0, std::min<int>(gammaTableSize - 1, c * float(gammaTableSize - 1)))];
-                }
-            }
-        }
+    for (; iter < maxIters; iter++) {
 
-        avg /= count;
+        avg = measureAverage(f, scale, count);
 
         float adjustment;
         if (avg < lowerLimit) {
@@ -256,3 +289,14 @@ inline void Brightness::shader(Vec3& rgb, const PixelInfo& p) const
 {
     rgb = (*nextColors)[p.index] * currentScale;
 }
+
+inline void Brightness::shaderBlock(Vec3* out, const PixelInfo* pixels, size_t count) const
+{
+    // Fused scale pass over a whole chunk. Unmapped pixels keep their
+    // zeroed entries in the color buffer, so no per-pixel test is needed.
+    const Vec3 *colors = &(*nextColors)[0];
+
+    for (size_t i = 0; i < count; i++) {
+        out[i] = colors[pixels[i].index] * currentScale;
+    }
+}
@@ -6,6 +6,20 @@
 
 #include "svl/SVL.h"
 
+/*
+ * Hue sector table: for each of the six hue sectors, which of
+ * { v, q, p, t } lands in each RGB channel. Selecting through the table
+ * replaces the per-pixel sector switch with a pair of loads.
+ */
+static const unsigned char HSV_SECTOR[6][3] = {
+    { 0, 3, 2 },    // v t p
+    { 1, 0, 2 },    // q v p
+    { 2, 0, 3 },    // p v t
+    { 2, 1, 0 },    // p q v
+    { 3, 2, 0 },    // t p v
+    { 0, 2, 1 },    // v p q
+};
+
 static inline void hsv2rgb(Vec3 &rgb, float h, float s, float v)
 {
     /*
@@ -23,22 +37,112 @@ static inline void hsv2rgb(Vec3 &rgb, float h, float s, float v)
     if (h < 0) h += 6.0f;
 
     int i = h;
+    if (i >= 6) i = 0;  // h can round up to exactly 6.0f
     float f = h - i;
-    float p = v * (1 - s);
-    float q = v * (1 - f * s);
-    float t = v * (1 - (1 - f) * s);
-
-    switch (i) {
-        case 0: rgb[0] = v; rgb[1] = t; rgb[2] = p; break;
-        case 1: rgb[0] = q; rgb[1] = v; rgb[2] = p; break;
-        case 2: rgb[0] = p; rgb[1] = v; rgb[2] = t; break;
-        case 3: rgb[0] = p; rgb[1] = q; rgb[2] = v; break;
-        case 4: rgb[0] = t; rgb[1] = p; rgb[2] = v; break;
-        case 5: rgb[0] = v; rgb[1] = p; rgb[2] = q; break;
-    }
+
+    float vals[4] = {
+        v,                          // v
+        v * (1 - f * s),            // q
+        v * (1 - s),                // p
+        v * (1 - (1 - f) * s),      // t
+    };
+
+    const unsigned char *sel = HSV_SECTOR[i];
+    rgb[0] = vals[sel[0]];
+    rgb[1] = vals[sel[1]];
+    rgb[2] = vals[sel[2]];
 }
 
 static inline void hsv2rgb(Vec3 &rgb, Vec3 hsv)
 {
     return hsv2rgb(rgb, hsv[0], hsv[1], hsv[2]);
 }
+
+/*
+ * Batch HSV to RGB conversion, for effects that shade whole blocks at a
+ * time. With SSE or NEON available the hue wrap, sector split, and the
+ * p/q/t products run four pixels per pass; only the final table-driven
+ * channel selection is scalar. Falls back to the single-pixel conversion
+ * otherwise. Results match hsv2rgb().
+ */
+
+#if (defined(VL_SIMD_SSE) && (defined(__SSE2__) || defined(_M_X64))) || defined(VL_SIMD_NEON)
+#define COLOR_SIMD 1
+
+#ifdef VL_SIMD_SSE
+#include <emmintrin.h>
+
+static inline VlFloat4 color_floor4(VlFloat4 v)
+{
+    // Truncate toward zero, then fix up the negative non-integers
+    VlFloat4 ft = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+    return _mm_sub_ps(ft, _mm_and_ps(_mm_cmplt_ps(v, ft), _mm_set1_ps(1.0f)));
+}
+
+#else  // VL_SIMD_NEON
+
+static inline VlFloat4 color_floor4(VlFloat4 v)
+{
+    // Truncate toward zero, then fix up the negative non-integers
+    VlFloat4 ft = vcvtq_f32_s32(vcvtq_s32_f32(v));
+    uint32x4_t lt = vcltq_f32(v, ft);
+    return vsubq_f32(ft, vreinterpretq_f32_u32(
+        vandq_u32(lt, vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))));
+}
+
+#endif
+#endif  // COLOR_SIMD
+
+static inline void hsv2rgb_batch(Vec3 *rgb, const Vec3 *hsv, size_t count)
+{
+#ifdef COLOR_SIMD
+    const VlFloat4 one = vl_splat4(1.0f);
+    const VlFloat4 six = vl_splat4(6.0f);
+
+    size_t n = count & ~(size_t) 3;
+    for (size_t b = 0; b < n; b += 4) {
+        float ah[4], as[4], av[4];
+        for (int l = 0; l < 4; l++) {
+            ah[l] = hsv[b + l][0];
+            as[l] = hsv[b + l][1];
+            av[l] = hsv[b + l][2];
+        }
+
+        VlFloat4 h = vl_load4(ah);
+        VlFloat4 s = vl_load4(as);
+        VlFloat4 v = vl_load4(av);
+
+        // Wrap hue into [0, 1) and split into sector and fraction
+        VlFloat4 h6 = vl_mul4(vl_sub4(h, color_floor4(h)), six);
+        VlFloat4 sector = color_floor4(h6);
+        VlFloat4 f = vl_sub4(h6, sector);
+
+        VlFloat4 p = vl_mul4(v, vl_sub4(one, s));
+        VlFloat4 q = vl_mul4(v, vl_sub4(one, vl_mul4(f, s)));
+        VlFloat4 t = vl_mul4(v, vl_sub4(one, vl_mul4(vl_sub4(one, f), s)));
+
+        float fi[4], vals[4][4];
+        vl_store4(fi, sector);
+        vl_store4(vals[0], v);
+        vl_store4(vals[1], q);
+        vl_store4(vals[2], p);
+        vl_store4(vals[3], t);
+
+        for (int l = 0; l < 4; l++) {
+            int i = (int) fi[l];
+            if (i >= 6) i = 0;  // h6 can round up to exactly 6.0f
+            const unsigned char *sel = HSV_SECTOR[i];
+            rgb[b + l][0] = vals[sel[0]][l];
+            rgb[b + l][1] = vals[sel[1]][l];
+            rgb[b + l][2] = vals[sel[2]][l];
+        }
+    }
+    for (size_t b = n; b < count; b++) {
+        hsv2rgb(rgb[b], hsv[b]);
+    }
+#else
+    for (size_t b = 0; b < count; b++) {
+        hsv2rgb(rgb[b], hsv[b]);
+    }
+#endif
+}
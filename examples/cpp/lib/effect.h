@@ -30,8 +30,13 @@
 #include <cmath>
 #include <unistd.h>
 #include <vector>
+#include <list>
+#include <algorithm>
+#include <utility>
 #include <cstring>
 #include <cstdlib>
+#include <cstdio>
+#include <stdint.h>
 
 #include "nanoflann.h"  // Tiny KD-tree library
 #include "svl/SVL.h"
@@ -61,6 +66,23 @@ public:
      */
     virtual void shader(Vec3& rgb, const PixelInfo& p) const = 0;
 
+    /*
+     * Batch form of shader(). Calculates 'count' consecutive pixels, writing
+     * one RGB value per pixel to 'out'. Unmapped pixels must produce
+     * (0, 0, 0).
+     *
+     * The default implementation just loops over shader(), so effects only
+     * need this if they can do better: shading a whole block per virtual
+     * call lets simple effects amortize the dispatch overhead, keep state
+     * in registers, or use vectorized kernels. The same rules as shader()
+     * apply: blocks may run in parallel and must not have side-effects.
+     *
+     * Implementations that want contiguous coordinate data can keep the
+     * FrameInfo pointer from beginFrame() and use PixelInfo::index into
+     * its structure-of-arrays members (pointX/pointY/pointZ, pixelMapped).
+     */
+    virtual void shaderBlock(Vec3* out, const PixelInfo* pixels, size_t count) const;
+
     /*
      * Serialized post-processing on one pixel. This runs after shader(), once
      * per mapped pixel, with the ability to modify Effect data. This shoudln't
@@ -69,6 +91,35 @@ public:
      */
     virtual void postProcess(const Vec3& rgb, const PixelInfo& p);
 
+    /*
+     * Optional GPU variant of shader(), as OpenGL ES 3.1 compute GLSL.
+     * Effects whose shader has no per-pixel layout lookups can return a
+     * snippet defining
+     *
+     *     vec3 shade(vec3 p)
+     *
+     * and the runner will evaluate whole frames on the GPU when built
+     * with USE_GL_COMPUTE and started with -gpu; see gpu_shader.h. The
+     * snippet sees uniforms 'time' (seconds since the program started)
+     * and 'timeDelta', plus GLSL ports of hsv2rgb() and noise3() (the
+     * noise matches in range and character, not bit-for-bit). Effect
+     * state computed in beginFrame() goes through gpuUniforms(). The
+     * default returns NULL, keeping the effect on the CPU path; the
+     * result should visually match shader(), which also remains the
+     * fallback when no GPU is available.
+     */
+    virtual const char* gpuShader() const;
+
+    // Scalar uniform sink for gpuUniforms(), implemented by the backend
+    class GPUUniforms {
+    public:
+        virtual void set(const char *name, float value) = 0;
+    };
+
+    // Per-frame uniforms for the gpuShader() variant, called after
+    // beginFrame() with the program bound.
+    virtual void gpuUniforms(GPUUniforms &u) const;
+
     // Optional begin/end frame callbacks
     virtual void beginFrame(const FrameInfo& f);
     virtual bool endFrame(const FrameInfo& f);
@@ -83,6 +134,9 @@ public:
     public:
         PixelInfo(unsigned index, const rapidjson::Value* layout);
 
+        // Construct with an already-known point, skipping the JSON lookup
+        PixelInfo(unsigned index, const rapidjson::Value* layout, const Vec3 &p);
+
         // Point coordinates
         Vec3 point;
 
@@ -112,12 +166,42 @@ public:
         FrameInfo();
         void init(const rapidjson::Value &layout);
 
+        /*
+         * Binary layout cache. Everything init() computes from the layout
+         * (coordinates, SoA mirror, Morton order, bounding box, k-d tree)
+         * can be serialized, so subsequent runs skip the per-pixel JSON
+         * traversal and the tree build. The caller owns the stream and
+         * any header identifying the layout; initFromCache() returns
+         * false if the stream doesn't match 'layout' or is short, and the
+         * caller should fall back to init().
+         */
+        bool initFromCache(const rapidjson::Value &layout, FILE *cache);
+        void saveCache(FILE *cache) const;
+
         // Seconds passed since the last frame
         float timeDelta;
 
         // Info for every pixel
         PixelInfoVec pixels;
 
+        /*
+         * Structure-of-arrays mirror of the pixel data, rebuilt by init().
+         * Batch shaders can walk these contiguous arrays instead of
+         * striding over the PixelInfo records and their layout pointers.
+         * All are indexed by framebuffer index, like 'pixels'; unmapped
+         * pixels have zero coordinates and a zero pixelMapped flag.
+         */
+        std::vector<float> pointX, pointY, pointZ;
+        std::vector<unsigned char> pixelMapped;
+
+        /*
+         * Pixel indices sorted along a Morton (Z-order) curve over the
+         * model bounding box. Effects that traverse pixels spatially can
+         * walk this permutation instead of framebuffer order, so that
+         * neighboring pixels land on warm cache lines.
+         */
+        std::vector<unsigned> mortonOrder;
+
         // Model axis-aligned bounding box
         Vec3 modelMin, modelMax;
 
@@ -139,8 +223,38 @@ public:
 
         void radiusSearch(ResultSet_t& hits, Vec3 point, float radius) const;
 
+        /*
+         * Precomputed per-pixel neighbor lists for a fixed search radius,
+         * stored CSR-style: the neighbors of pixel i are
+         * neighbor[offsets[i]] through neighbor[offsets[i+1]], with the
+         * matching squared distances in distSqr.
+         */
+        struct NeighborTable {
+            float radius;
+            std::vector<unsigned> offsets;
+            std::vector<unsigned> neighbor;
+            std::vector<float> distSqr;
+        };
+
+        /*
+         * The layout never changes after init(), so effects that search
+         * the same radius around every pixel each frame repeat identical
+         * tree descents. This returns a NeighborTable for 'radius',
+         * building it on first use and reusing it afterwards, turning the
+         * per-frame neighborhood walk into an array scan.
+         *
+         * Call it from beginFrame(), not from shaders: the first call for
+         * a radius mutates the cache. The returned reference stays valid
+         * for the lifetime of the FrameInfo.
+         */
+        const NeighborTable& pixelNeighbors(float radius) const;
+
         IndexTree tree;
 
+        // Cached neighbor tables, one per registered radius. A list keeps
+        // the references handed out by pixelNeighbors() stable.
+        mutable std::list<NeighborTable> neighborTables;
+
         // Adapter functions for the K-D tree implementation
 
         inline size_t kdtree_get_point_count() const {
@@ -194,6 +308,10 @@ inline Effect::PixelInfo::PixelInfo(unsigned index, const rapidjson::Value* layo
     point = isMapped() ? getVec3("point") : Vec3(0, 0, 0);
 }
 
+inline Effect::PixelInfo::PixelInfo(unsigned index, const rapidjson::Value* layout, const Vec3 &p)
+    : point(p), index(index), layout(layout)
+{}
+
 inline bool Effect::PixelInfo::isMapped() const
 {
     return layout && layout->IsObject();
@@ -239,6 +357,16 @@ inline Effect::FrameInfo::FrameInfo()
     : timeDelta(0), tree(3, *this)
 {}
 
+static inline uint32_t mortonSpread3(uint32_t x)
+{
+    // Space out the low 10 bits of x, two zero bits between each
+    x = (x | (x << 16)) & 0x030000FF;
+    x = (x | (x << 8))  & 0x0300F00F;
+    x = (x | (x << 4))  & 0x030C30C3;
+    x = (x | (x << 2))  & 0x09249249;
+    return x;
+}
+
 inline void Effect::FrameInfo::init(const rapidjson::Value &layout)
 {
     timeDelta = 0;
@@ -268,11 +396,109 @@ inline void Effect::FrameInfo::init(const rapidjson::Value &layout)
         modelRadius = std::max(modelRadius, len(pixels[i].point - modelCenter()));
     }
 
+    // Build the structure-of-arrays mirror of the pixel data
+
+    pointX.resize(pixels.size());
+    pointY.resize(pixels.size());
+    pointZ.resize(pixels.size());
+    pixelMapped.resize(pixels.size());
+    for (unsigned i = 0; i < pixels.size(); i++) {
+        pointX[i] = pixels[i].point[0];
+        pointY[i] = pixels[i].point[1];
+        pointZ[i] = pixels[i].point[2];
+        pixelMapped[i] = pixels[i].isMapped();
+    }
+
+    // Sort the pixel indices along a Morton curve over the bounding box,
+    // quantizing each axis to 10 bits.
+
+    Vec3 size = modelSize();
+    std::vector<std::pair<uint32_t, unsigned> > codes(pixels.size());
+    for (unsigned i = 0; i < pixels.size(); i++) {
+        uint32_t code = 0;
+        for (unsigned j = 0; j < 3; j++) {
+            float extent = size[j] > 0 ? size[j] : 1.0f;
+            float u = (pixels[i].point[j] - modelMin[j]) / extent;
+            u = std::min(1.0f, std::max(0.0f, u));
+            code |= mortonSpread3(uint32_t(u * 1023.0f + 0.5f)) << j;
+        }
+        codes[i] = std::make_pair(code, i);
+    }
+    std::sort(codes.begin(), codes.end());
+    mortonOrder.resize(pixels.size());
+    for (unsigned i = 0; i < pixels.size(); i++) {
+        mortonOrder[i] = codes[i].second;
+    }
+
     // Build K-D Tree index, for fast spatial lookups later
 
     tree.buildIndex();
 }
 
+inline bool Effect::FrameInfo::initFromCache(const rapidjson::Value &layout, FILE *cache)
+{
+    uint32_t count = 0;
+    if (fread(&count, sizeof count, 1, cache) != 1 ||
+        count == 0 || count != layout.Size()) {
+        return false;
+    }
+
+    timeDelta = 0;
+    neighborTables.clear();
+
+    pointX.resize(count);
+    pointY.resize(count);
+    pointZ.resize(count);
+    pixelMapped.resize(count);
+    mortonOrder.resize(count);
+
+    float box[7];
+    if (fread(&pointX[0], sizeof(float), count, cache) != count ||
+        fread(&pointY[0], sizeof(float), count, cache) != count ||
+        fread(&pointZ[0], sizeof(float), count, cache) != count ||
+        fread(&pixelMapped[0], sizeof(unsigned char), count, cache) != count ||
+        fread(&mortonOrder[0], sizeof(unsigned), count, cache) != count ||
+        fread(box, sizeof(float), 7, cache) != 7) {
+        return false;
+    }
+
+    modelMin = Vec3(box[0], box[1], box[2]);
+    modelMax = Vec3(box[3], box[4], box[5]);
+    modelRadius = box[6];
+
+    pixels.clear();
+    pixels.reserve(count);
+    for (unsigned i = 0; i < count; i++) {
+        pixels.push_back(PixelInfo(i, &layout[i],
+            Vec3(pointX[i], pointY[i], pointZ[i])));
+    }
+
+    tree.loadIndex(cache);
+    return true;
+}
+
+inline void Effect::FrameInfo::saveCache(FILE *cache) const
+{
+    uint32_t count = pixels.size();
+    fwrite(&count, sizeof count, 1, cache);
+    fwrite(&pointX[0], sizeof(float), count, cache);
+    fwrite(&pointY[0], sizeof(float), count, cache);
+    fwrite(&pointZ[0], sizeof(float), count, cache);
+    fwrite(&pixelMapped[0], sizeof(unsigned char), count, cache);
+    fwrite(&mortonOrder[0], sizeof(unsigned), count, cache);
+
+    float box[7] = {
+        float(modelMin[0]), float(modelMin[1]), float(modelMin[2]),
+        float(modelMax[0]), float(modelMax[1]), float(modelMax[2]),
+        float(modelRadius)
+    };
+    fwrite(box, sizeof(float), 7, cache);
+
+    // saveIndex stores only the tree structure; the points themselves
+    // come back through the adaptor when the index is reloaded.
+    const_cast<IndexTree&>(tree).saveIndex(cache);
+}
+
 inline Vec3 Effect::FrameInfo::modelCenter() const
 {
     return (modelMin + modelMax) * 0.5;
@@ -302,6 +528,35 @@ inline void Effect::FrameInfo::radiusSearch(ResultSet_t& hits, Vec3 point, float
     tree.radiusSearch(&point[0], radius * radius, hits, params);
 }
 
+inline const Effect::FrameInfo::NeighborTable& Effect::FrameInfo::pixelNeighbors(float radius) const
+{
+    for (std::list<NeighborTable>::const_iterator it = neighborTables.begin();
+         it != neighborTables.end(); ++it) {
+        if (it->radius == radius) {
+            return *it;
+        }
+    }
+
+    neighborTables.push_back(NeighborTable());
+    NeighborTable &table = neighborTables.back();
+    table.radius = radius;
+    table.offsets.reserve(pixels.size() + 1);
+    table.offsets.push_back(0);
+
+    ResultSet_t hits;
+    for (unsigned i = 0; i < pixels.size(); i++) {
+        hits.clear();
+        radiusSearch(hits, pixels[i].point, radius);
+        for (unsigned h = 0; h < hits.size(); h++) {
+            table.neighbor.push_back(hits[h].first);
+            table.distSqr.push_back(hits[h].second);
+        }
+        table.offsets.push_back(table.neighbor.size());
+    }
+
+    return table;
+}
+
 inline Effect::DebugInfo::DebugInfo(EffectRunner &runner)
     : runner(runner) {}
 
@@ -322,6 +577,23 @@ inline bool Effect::endFrame( const FrameInfo & )
 inline void Effect::debug( const DebugInfo & ) {}
 inline void Effect::postProcess( const Vec3&, const PixelInfo& ) {}
 
+inline const char* Effect::gpuShader() const
+{
+    return 0;
+}
+
+inline void Effect::gpuUniforms( GPUUniforms & ) const {}
+
+inline void Effect::shaderBlock(Vec3* out, const PixelInfo* pixels, size_t count) const
+{
+    for (size_t i = 0; i < count; i++) {
+        out[i] = Vec3(0, 0, 0);
+        if (pixels[i].isMapped()) {
+            shader(out[i], pixels[i]);
+        }
+    }
+}
+
 
 static inline float sq(float a)
 {
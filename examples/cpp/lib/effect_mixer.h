@@ -61,6 +61,7 @@ public:
     void setConcurrency(unsigned numThreads);
 
     virtual void shader(Vec3& rgb, const PixelInfo& p) const;
+    virtual void shaderBlock(Vec3* out, const PixelInfo* pixels, size_t count) const;
     virtual void postProcess(const Vec3& rgb, const PixelInfo& p);
     virtual void beginFrame(const FrameInfo& f);
     virtual bool endFrame(const FrameInfo& f);
@@ -210,6 +211,29 @@ inline void EffectMixer::shader(Vec3& rgb, const PixelInfo& p) const
     rgb = total;
 }
 
+inline void EffectMixer::shaderBlock(Vec3* out, const PixelInfo* pixels, size_t count) const
+{
+    // Chunk-wise version of the mix above: one pass per active channel
+    // keeps the weighted accumulation in a tight loop over the chunk,
+    // instead of re-walking the channel list for every pixel. Channels
+    // with their fader at zero are skipped entirely; they were never
+    // shaded this frame.
+
+    for (size_t i = 0; i < count; i++) {
+        out[i] = Vec3(0, 0, 0);
+    }
+
+    for (std::vector<Channel>::const_iterator it = channels.begin(), e = channels.end(); it != e; ++it) {
+        float f = it->fader;
+        if (f) {
+            const Vec3 *colors = &it->colors[0];
+            for (size_t i = 0; i < count; i++) {
+                out[i] += colors[pixels[i].index] * f;
+            }
+        }
+    }
+}
+
 inline void EffectMixer::postProcess(const Vec3& rgb, const PixelInfo& p)
 {
     // Allow all channels to post-process their result, without parallelism.
@@ -358,19 +382,15 @@ inline void EffectMixer::worker(ThreadContext &context)
         tasks.pop();
         taskLock.unlock();
 
-        // Process a block of pixels
+        // Process a block of pixels. shaderBlock() amortizes the virtual
+        // dispatch over the whole batch, and lets effects with vectorized
+        // kernels use them; unmapped pixels come back as (0, 0, 0).
 
         Channel &c = *currentTask.channel;
-        Effect *effect = c.effect;
-
-        for (unsigned i = currentTask.begin; i != currentTask.end; ++i) {
-            const Effect::PixelInfo &p = currentTask.pixelInfo[i];
-            if (p.isMapped()) {
-                Vec3 color(0, 0, 0);
-                effect->shader(color, p);
-                c.colors[i] = color;
-            }
-        }
+
+        c.effect->shaderBlock(&c.colors[currentTask.begin],
+            &currentTask.pixelInfo[currentTask.begin],
+            currentTask.end - currentTask.begin);
 
         // Completion notification
         completeLock.lock();
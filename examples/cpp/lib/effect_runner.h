@@ -31,14 +31,18 @@
 #include <unistd.h>
 #include <algorithm>
 #include <vector>
+#include <string>
 #include <sys/time.h>
 #include <cstdio>
 #include <cstring>
 #include <cstdlib>
 #include <ctime>
+#include <cerrno>
 
 #include "effect.h"
+#include "gpu_shader.h"
 #include "opc_client.h"
+#include "tinythread.h"
 #include "svl/SVL.h"
 #include "rapidjson/rapidjson.h"
 #include "rapidjson/filestream.h"
@@ -48,6 +52,7 @@
 class EffectRunner {
 public:
     EffectRunner();
+    ~EffectRunner();
 
     bool setServer(const char *hostport);
     bool setLayout(const char *filename);
@@ -115,6 +120,156 @@ private:
     float jitterStatsMin;
     float jitterStatsMax;
 
+    // Absolute frame schedule, on the monotonic clock. Each deadline
+    // advances by exactly minTimeDelta; see the pacing notes in doFrame().
+    struct timespec frameDeadline;
+    bool frameDeadlineValid;
+    unsigned missedDeadlines;
+
+    /*
+     * Worker pool for shader evaluation. Effect::shader() is documented as
+     * side-effect-free and safe to run in parallel, so each frame the pixels
+     * are partitioned into one chunk per core; the workers and the main
+     * thread shade their chunks concurrently into shaderColors, then the
+     * main thread runs postProcess() serially as that contract requires.
+     * Workers are started on the first frame and park on a condition
+     * variable between frames.
+     */
+    struct WorkerArg {
+        EffectRunner *runner;
+        unsigned share;
+    };
+    std::vector<tthread::thread*> workers;
+    std::vector<Vec3> shaderColors;
+    tthread::mutex workMutex;
+    tthread::condition_variable workBegin;
+    tthread::condition_variable workDone;
+    unsigned workGeneration;
+    unsigned workersBusy;
+    bool workersExit;
+    bool workersStarted;
+
+    void startWorkers();
+    void runShaders();
+    void shaderChunk(unsigned share, unsigned numShares);
+    static void workerThreadFunc(void *arg);
+
+    /*
+     * Writer thread, overlapping socket I/O with shading. doFrame()
+     * hands the finished frame to the writer with a buffer swap and
+     * immediately starts shading the next frame into the other buffer,
+     * so a TCP stall doesn't freeze rendering. At most one frame is in
+     * flight: if the socket stays stalled, submitFrame() blocks rather
+     * than queueing frames.
+     *
+     * The writer owns the socket while a frame is in flight. The main
+     * thread only reconnects when the client is disconnected, and a
+     * disconnected client means the writer's last write already failed
+     * and the writer is idle, so the two threads never touch the socket
+     * concurrently.
+     */
+    std::vector<uint8_t> txBuffer;
+    std::vector<uint8_t> *frontBuffer;  // Most recently shaded, for getPixel()
+    tthread::thread *writer;
+    tthread::mutex writerMutex;
+    tthread::condition_variable writerBegin;
+    tthread::condition_variable writerDone;
+    bool framePending;
+    bool writerExit;
+
+    void submitFrame();
+    static void writerThreadFunc(void *arg);
+
+    /*
+     * Binary layout cache. The computed layout data (coordinates, Morton
+     * order, k-d tree) is cached in a versioned file next to the layout
+     * JSON, keyed by a hash of the JSON bytes, so repeated starts skip
+     * the per-pixel JSON traversal and the tree build. See
+     * Effect::FrameInfo::initFromCache().
+     */
+    static const uint32_t LAYOUT_CACHE_VERSION = 1;
+    static const uint32_t LAYOUT_CACHE_TRAILER = 0x434C4346;
+
+    bool loadLayoutCache(const char *path, uint64_t jsonHash);
+    void saveLayoutCache(const char *path, uint64_t jsonHash);
+    static uint64_t fnv1a64(const void *data, size_t len);
+
+    /*
+     * Offline benchmark mode, from the -bench flag. Runs the current
+     * effect for a fixed number of frames with a synthetic timeDelta,
+     * no socket and no sleeping, and reports per-phase timings so an
+     * effect change can be measured repeatably.
+     */
+    unsigned benchFrames;
+    void runBenchmark();
+
+    /*
+     * Distributed rendering, from the -span flag. Each cooperating
+     * process shades only its assigned pixel range; shader() purity makes
+     * the partition safe. Pair it with a channel-tagged -server shard
+     * pointing at an opc_merge process, which reassembles the slices and
+     * forwards whole frames to fcserver. Zero spanCount means the whole
+     * layout.
+     */
+    unsigned spanFirst;
+    unsigned spanCount;
+    void getSpan(unsigned &begin, unsigned &end) const;
+
+    /*
+     * 16-bit output, from the -16bit flag. Frames go out as the
+     * FCSetPixelColors16 SysEx command instead of SetPixelColors, so
+     * shader precision reaches the server -- and, through Glimmer's wider
+     * pixel formats, the firmware's dithering -- without being quantized
+     * to 8 bits here first.
+     */
+    bool deepColor;
+    void initFrameBuffers();
+
+    /*
+     * GPU shading, from the -gpu flag (needs a USE_GL_COMPUTE build;
+     * see gpu_shader.h). Effects providing a gpuShader() variant are
+     * dispatched as a compute kernel and read back into shaderColors;
+     * everything after the shader phase -- postProcess(), quantization,
+     * the writer thread -- is unchanged. Any backend failure falls back
+     * permanently to the CPU worker pool.
+     */
+    bool gpuEnabled;
+    bool gpuFailed;
+    GPUShaderBackend gpu;
+    const Effect *gpuProgramEffect;
+
+    /*
+     * Adaptive level of detail, from the -lod flag. When the shader phase
+     * can't hold the -fps budget, only a stratified subset of pixels is
+     * shaded each frame -- every Nth pixel along the Morton order, so the
+     * subset stays spatially uniform -- and the rest are filled by
+     * inverse-distance interpolation from their nearest shaded neighbors,
+     * precomputed from the k-d tree. The shaded fraction tracks measured
+     * busy time, so a too-slow effect degrades to softened spatial detail
+     * at full frame rate instead of collapsing to a lower one. The
+     * stratum rotates, so every pixel is freshly shaded at least every N
+     * frames.
+     */
+    static const unsigned LOD_NEIGHBORS = 8;
+    bool lodEnabled;
+    float lodFraction;          // Controller output: fraction of pixels to shade
+    unsigned lodPhase;          // Rotating stratum selector
+    bool lodActive;             // This frame shades lodPixels, not the span
+    std::vector<Effect::PixelInfo> lodPixels;   // Gathered stratified subset
+    std::vector<Vec3> lodColors;                // Subset shader output
+    std::vector<unsigned char> lodShadedFlags;  // Per-pixel: shaded this frame
+    std::vector<unsigned> lodNeighbors;         // K nearest per pixel
+    std::vector<float> lodNeighborWeights;      // Matching 1/distance^2 weights
+
+    unsigned lodStride() const;
+    void buildLodNeighbors();
+    void interpolateLod();
+    void adjustLod();
+
+    bool runShadersGPU();
+    static float benchPercentile(const std::vector<float> &sorted, float fraction);
+    static void benchReport(const char *phase, std::vector<float> &samples);
+
     void usage(const char *name);
     void debug();
 };
@@ -139,7 +294,30 @@ inline EffectRunner::EffectRunner()
       speed(1.0),
       verbose(false),
       jitterStatsMin(1),
-      jitterStatsMax(0)
+      jitterStatsMax(0),
+      frameDeadlineValid(false),
+      missedDeadlines(0),
+      workGeneration(0),
+      workersBusy(0),
+      workersExit(false),
+      workersStarted(false),
+      txBuffer(),
+      frontBuffer(&frameBuffer),
+      writer(0),
+      framePending(false),
+      writerExit(false),
+      benchFrames(0),
+      spanFirst(0),
+      spanCount(0),
+      deepColor(false),
+      gpuEnabled(false),
+      gpuFailed(false),
+      gpu(),
+      gpuProgramEffect(0),
+      lodEnabled(false),
+      lodFraction(1.0f),
+      lodPhase(0),
+      lodActive(false)
 {
     lastTime.tv_sec = 0;
     lastTime.tv_usec = 0;
@@ -149,9 +327,38 @@ inline EffectRunner::EffectRunner()
     setServer("localhost");
 }
 
+inline EffectRunner::~EffectRunner()
+{
+    if (writer) {
+        writerMutex.lock();
+        while (framePending) {
+            writerDone.wait(writerMutex);
+        }
+        writerExit = true;
+        writerBegin.notify_all();
+        writerMutex.unlock();
+
+        writer->join();
+        delete writer;
+    }
+
+    if (!workers.empty()) {
+        workMutex.lock();
+        workersExit = true;
+        workBegin.notify_all();
+        workMutex.unlock();
+
+        for (unsigned i = 0; i < workers.size(); i++) {
+            workers[i]->join();
+            delete workers[i];
+        }
+    }
+}
+
 inline void EffectRunner::setMaxFrameRate(float fps)
 {
     minTimeDelta = 1.0 / fps;
+    frameDeadlineValid = false;
 }
 
 inline void EffectRunner::setVerbose(bool verbose)
@@ -161,19 +368,64 @@ inline void EffectRunner::setVerbose(bool verbose)
 
 inline bool EffectRunner::setServer(const char *hostport)
 {
+    /*
+     * A "/FIRST-LAST" suffix registers the server as a shard owning that
+     * inclusive pixel range; -server can then be repeated to spread one
+     * frame across several fcserver hosts. An optional "@CHANNEL" tags
+     * the shard's messages for an opc_merge process. Without a suffix
+     * this sets the single server, as before.
+     */
+    if (!strncmp(hostport, "shm:", 4)) {
+        // Shared memory transport; the path's slashes aren't a shard range
+        return opc.resolve(hostport);
+    }
+
+    const char *slash = strchr(hostport, '/');
+    if (slash) {
+        unsigned first, last;
+        int channel = -1;
+        const char *at = strchr(slash, '@');
+
+        if (at) {
+            channel = atoi(at + 1);
+        }
+        if (sscanf(slash + 1, "%u-%u", &first, &last) != 2 || last < first) {
+            fprintf(stderr, "Invalid pixel range in %s\n", hostport);
+            return false;
+        }
+
+        std::string host(hostport, slash - hostport);
+        return opc.addShard(host.c_str(), first, last - first + 1, channel);
+    }
+
     return opc.resolve(hostport);
 }
 
 inline bool EffectRunner::setLayout(const char *filename)
 {
-    FILE *f = fopen(filename, "r");
+    FILE *f = fopen(filename, "rb");
     if (!f) {
         return false;
     }
 
-    rapidjson::FileStream istr(f);
-    layout.ParseStream<0>(istr);
+    // Read the whole file up front; we need the raw bytes for the cache key
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (size <= 0) {
+        fclose(f);
+        return false;
+    }
+
+    std::vector<char> text(size + 1);
+    size_t bytesRead = fread(&text[0], 1, size, f);
     fclose(f);
+    if (bytesRead != (size_t)size) {
+        return false;
+    }
+    text[size] = '\0';
+
+    layout.Parse<0>(&text[0]);
 
     if (layout.HasParseError()) {
         return false;
@@ -182,17 +434,103 @@ inline bool EffectRunner::setLayout(const char *filename)
         return false;
     }
 
-    // Set up an empty framebuffer, with OPC packet header
-    int frameBytes = layout.Size() * 3;
-    frameBuffer.resize(sizeof(OPCClient::Header) + frameBytes);
-    OPCClient::Header::view(frameBuffer).init(0, opc.SET_PIXEL_COLORS, frameBytes);
+    // Set up empty framebuffers with OPC packet headers. Two buffers,
+    // so the writer thread can transmit one frame while the next shades.
+    initFrameBuffers();
 
-    // Init pixel info
-    frameInfo.init(layout);
+    // Init pixel info, from the binary cache next to the layout when one
+    // matches this JSON. Cache failures are never fatal; worst case we
+    // rebuild from the JSON every run, as before.
+    uint64_t jsonHash = fnv1a64(&text[0], size);
+    std::string cachePath(filename);
+    cachePath += ".cache";
+
+    if (!loadLayoutCache(cachePath.c_str(), jsonHash)) {
+        frameInfo.init(layout);
+        saveLayoutCache(cachePath.c_str(), jsonHash);
+    }
 
     return true;
 }
 
+inline void EffectRunner::initFrameBuffers()
+{
+    if (!hasLayout()) {
+        return;
+    }
+
+    if (deepColor) {
+        unsigned frameBytes = OPCClient::SYSEX_ID_BYTES + layout.Size() * 6;
+        frameBuffer.resize(sizeof(OPCClient::Header) + frameBytes);
+        OPCClient::initSysEx16(frameBuffer, 0, layout.Size());
+    } else {
+        unsigned frameBytes = layout.Size() * 3;
+        frameBuffer.resize(sizeof(OPCClient::Header) + frameBytes);
+        OPCClient::Header::view(frameBuffer).init(0, opc.SET_PIXEL_COLORS, frameBytes);
+    }
+
+    txBuffer = frameBuffer;
+    frontBuffer = &frameBuffer;
+}
+
+inline bool EffectRunner::loadLayoutCache(const char *path, uint64_t jsonHash)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return false;
+    }
+
+    // The trailer is written last, so its absence means a truncated cache
+    char magic[4];
+    uint32_t version = 0, trailer = 0;
+    uint64_t hash = 0;
+
+    bool ok =
+        fseek(f, -(long)sizeof trailer, SEEK_END) == 0 &&
+        fread(&trailer, sizeof trailer, 1, f) == 1 &&
+        trailer == LAYOUT_CACHE_TRAILER &&
+        fseek(f, 0, SEEK_SET) == 0 &&
+        fread(magic, 1, 4, f) == 4 &&
+        memcmp(magic, "FCLC", 4) == 0 &&
+        fread(&version, sizeof version, 1, f) == 1 &&
+        version == LAYOUT_CACHE_VERSION &&
+        fread(&hash, sizeof hash, 1, f) == 1 &&
+        hash == jsonHash &&
+        frameInfo.initFromCache(layout, f);
+
+    fclose(f);
+    return ok;
+}
+
+inline void EffectRunner::saveLayoutCache(const char *path, uint64_t jsonHash)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        return;
+    }
+
+    uint32_t version = LAYOUT_CACHE_VERSION;
+    uint32_t trailer = LAYOUT_CACHE_TRAILER;
+
+    fwrite("FCLC", 1, 4, f);
+    fwrite(&version, sizeof version, 1, f);
+    fwrite(&jsonHash, sizeof jsonHash, 1, f);
+    frameInfo.saveCache(f);
+    fwrite(&trailer, sizeof trailer, 1, f);
+    fclose(f);
+}
+
+inline uint64_t EffectRunner::fnv1a64(const void *data, size_t len)
+{
+    const unsigned char *p = (const unsigned char*) data;
+    uint64_t h = 14695981039346656037ULL;
+
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ p[i]) * 1099511628211ULL;
+    }
+    return h;
+}
+
 inline const rapidjson::Document& EffectRunner::getLayout() const
 {
     return layout;
@@ -298,21 +636,36 @@ inline EffectRunner::FrameStatus EffectRunner::doFrame(float timeDelta)
 
             uint8_t *dest = OPCClient::Header::view(frameBuffer).data();
 
-            for (Effect::PixelInfoIter i = frameInfo.pixels.begin(), e = frameInfo.pixels.end(); i != e; ++i) {
-                Vec3 rgb(0, 0, 0);
-                const Effect::PixelInfo &p = *i;
+            // Shade every pixel in our span across the worker pool, then
+            // post-process serially; see the worker pool notes above.
+            runShaders();
+
+            unsigned spanBegin, spanEnd;
+            getSpan(spanBegin, spanEnd);
+
+            for (unsigned i = spanBegin; i < spanEnd; i++) {
+                const Effect::PixelInfo &p = frameInfo.pixels[i];
+                const Vec3 &rgb = shaderColors[i];
 
                 if (p.isMapped()) {
-                    effect->shader(rgb, p);
                     effect->postProcess(rgb, p);
                 }
 
-                for (unsigned i = 0; i < 3; i++) {
-                    *(dest++) = std::min<int>(255, std::max<int>(0, rgb[i] * 255 + 0.5));
+                if (deepColor) {
+                    uint8_t *out = dest + OPCClient::SYSEX_ID_BYTES + i * 6;
+                    for (unsigned c = 0; c < 3; c++) {
+                        int v = std::min<int>(65535, std::max<int>(0, rgb[c] * 65535 + 0.5));
+                        out[c * 2] = v >> 8;
+                        out[c * 2 + 1] = (uint8_t) v;
+                    }
+                } else {
+                    for (unsigned c = 0; c < 3; c++) {
+                        dest[i * 3 + c] = std::min<int>(255, std::max<int>(0, rgb[c] * 255 + 0.5));
+                    }
                 }
             }
 
-            opc.write(frameBuffer);
+            submitFrame();
         }
 
         frameStatus.lastFrame = effect->endFrame(frameInfo);
@@ -322,15 +675,6 @@ inline EffectRunner::FrameStatus EffectRunner::doFrame(float timeDelta)
     const float filterGain = 0.05;
     filteredTimeDelta += (timeDelta - filteredTimeDelta) * filterGain;
 
-    // Negative feedback loop to adjust the delay until we hit a target frame rate.
-    // This lets us hit the target rate smoothly, without a lot of jitter between frames.
-    // If we calculated a new delay value on each frame, we'd easily end up alternating
-    // between too-long and too-short frame delays.
-    currentDelay += (minTimeDelta - timeDelta) * filterGain;
-
-    // Make sure filteredTimeDelta >= currentDelay. (The "busy time" estimate will be >= 0)
-    filteredTimeDelta = std::max(filteredTimeDelta, currentDelay);
-
     // Periodically output debug info, if we're in verbose mode
     if (verbose) {
         const float debugInterval = 1.0f;
@@ -341,14 +685,373 @@ inline EffectRunner::FrameStatus EffectRunner::doFrame(float timeDelta)
         }
     }
 
-    // Add the extra delay, if we have one. This is how we throttle down the frame rate.
-    if (currentDelay > 0) {
-        usleep(currentDelay * 1e6);
+    /*
+     * Pace frames against an absolute schedule rather than a relative
+     * delay: each deadline advances by exactly minTimeDelta, so oversleep
+     * on one frame comes out of the next and the delivered cadence
+     * doesn't drift. When we're already past a deadline, the frame
+     * counts as missed and the schedule resynchronizes to now instead of
+     * rushing out catch-up frames.
+     */
+    struct timespec nowMono;
+    clock_gettime(CLOCK_MONOTONIC, &nowMono);
+
+    if (!frameDeadlineValid) {
+        frameDeadline = nowMono;
+        frameDeadlineValid = true;
+    }
+
+    frameDeadline.tv_nsec += (long)(minTimeDelta * 1e9);
+    while (frameDeadline.tv_nsec >= 1000000000L) {
+        frameDeadline.tv_nsec -= 1000000000L;
+        frameDeadline.tv_sec++;
+    }
+
+    float remaining = (frameDeadline.tv_sec - nowMono.tv_sec)
+        + 1e-9f * (frameDeadline.tv_nsec - nowMono.tv_nsec);
+
+    if (remaining > 0) {
+#ifdef __linux__
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &frameDeadline, 0) == EINTR);
+#else
+        usleep(remaining * 1e6);
+#endif
+    } else {
+        missedDeadlines++;
+        frameDeadline = nowMono;
+        remaining = 0;
+    }
+
+    // Keep a filtered idle-time estimate, for the busy/idle statistics
+    currentDelay += (remaining - currentDelay) * filterGain;
+    filteredTimeDelta = std::max(filteredTimeDelta, currentDelay);
+
+    if (lodEnabled) {
+        adjustLod();
     }
 
     return frameStatus;
 }
 
+inline void EffectRunner::submitFrame()
+{
+    if (!writer) {
+        writer = new tthread::thread(writerThreadFunc, this);
+    }
+
+    writerMutex.lock();
+
+    // Wait out a stalled transmission; at most one frame is in flight
+    while (framePending) {
+        writerDone.wait(writerMutex);
+    }
+
+    frameBuffer.swap(txBuffer);
+    frontBuffer = &txBuffer;
+    framePending = true;
+    writerBegin.notify_all();
+    writerMutex.unlock();
+}
+
+inline void EffectRunner::writerThreadFunc(void *arg)
+{
+    EffectRunner *self = (EffectRunner*) arg;
+
+    self->writerMutex.lock();
+    for (;;) {
+        while (!self->framePending && !self->writerExit) {
+            self->writerBegin.wait(self->writerMutex);
+        }
+        if (self->writerExit) {
+            break;
+        }
+        self->writerMutex.unlock();
+
+        self->opc.write(self->txBuffer);
+
+        self->writerMutex.lock();
+        self->framePending = false;
+        self->writerDone.notify_all();
+    }
+    self->writerMutex.unlock();
+}
+
+inline void EffectRunner::startWorkers()
+{
+    workersStarted = true;
+
+    // The main thread takes one share, so extra threads are only worth
+    // starting when there's more than one core to run them on.
+    unsigned cores = tthread::thread::hardware_concurrency();
+    unsigned extra = cores > 1 ? cores - 1 : 0;
+
+    for (unsigned i = 0; i < extra; i++) {
+        WorkerArg *wa = new WorkerArg;
+        wa->runner = this;
+        wa->share = i + 1;
+        workers.push_back(new tthread::thread(workerThreadFunc, wa));
+    }
+}
+
+inline void EffectRunner::runShaders()
+{
+    if (gpuEnabled && !gpuFailed && effect->gpuShader()) {
+        if (runShadersGPU()) {
+            return;
+        }
+        gpuFailed = true;
+        fprintf(stderr, "GPU shading unavailable, falling back to CPU\n");
+    }
+
+    if (!workersStarted) {
+        startWorkers();
+    }
+
+    shaderColors.resize(frameInfo.pixels.size());
+
+    unsigned stride = lodEnabled ? lodStride() : 1;
+    lodActive = stride > 1;
+
+    if (lodActive) {
+        // Gather every Nth span pixel along the Morton order, so the
+        // shaded subset is spatially uniform over the model.
+        if (lodNeighbors.empty()) {
+            buildLodNeighbors();
+        }
+
+        unsigned spanBegin, spanEnd;
+        getSpan(spanBegin, spanEnd);
+
+        lodPixels.clear();
+        lodShadedFlags.assign(frameInfo.pixels.size(), 0);
+
+        for (unsigned r = lodPhase; r < frameInfo.mortonOrder.size(); r += stride) {
+            unsigned i = frameInfo.mortonOrder[r];
+            if (i < spanBegin || i >= spanEnd) {
+                continue;
+            }
+            lodPixels.push_back(frameInfo.pixels[i]);
+            lodShadedFlags[i] = 1;
+        }
+        lodPhase = (lodPhase + 1) % stride;
+        lodColors.resize(lodPixels.size());
+    }
+
+    if (workers.empty()) {
+        // Single core; shade everything right here
+        shaderChunk(0, 1);
+    } else {
+        workMutex.lock();
+        workGeneration++;
+        workersBusy = workers.size();
+        workBegin.notify_all();
+        workMutex.unlock();
+
+        // Shade the main thread's share while the workers run theirs
+        shaderChunk(0, workers.size() + 1);
+
+        workMutex.lock();
+        while (workersBusy) {
+            workDone.wait(workMutex);
+        }
+        workMutex.unlock();
+    }
+
+    if (lodActive) {
+        lodActive = false;
+        interpolateLod();
+    }
+}
+
+inline bool EffectRunner::runShadersGPU()
+{
+    if (gpuProgramEffect != effect) {
+        if (!gpu.init(frameInfo) || !gpu.setProgram(effect->gpuShader())) {
+            return false;
+        }
+        gpuProgramEffect = effect;
+    }
+
+    // The kernel shades the whole layout; -span only restricts which
+    // pixels the output loop packs, same as the CPU path.
+    return gpu.run(frameInfo.timeDelta, effect, shaderColors);
+}
+
+inline unsigned EffectRunner::lodStride() const
+{
+    // Quantize the controller's fraction to a stride, so the Morton-order
+    // stratification stays uniform. With the fraction floored at 1/4, at
+    // least a quarter of the pixels are shaded every frame.
+    unsigned stride = unsigned(1.0f / lodFraction + 0.5f);
+    return std::min(4u, std::max(1u, stride));
+}
+
+inline void EffectRunner::buildLodNeighbors()
+{
+    // The layout never changes after init, so each pixel's interpolation
+    // sources -- its K nearest mapped neighbors and their inverse-square
+    // distance weights -- are computed from the k-d tree once. Unfilled
+    // slots keep zero weight and are skipped at interpolation time.
+    unsigned count = frameInfo.pixels.size();
+    lodNeighbors.assign(count * LOD_NEIGHBORS, 0);
+    lodNeighborWeights.assign(count * LOD_NEIGHBORS, 0.0f);
+
+    // One extra result, since the query pixel itself always comes back
+    size_t indices[LOD_NEIGHBORS + 1];
+    Real distSqr[LOD_NEIGHBORS + 1];
+
+    for (unsigned i = 0; i < count; i++) {
+        if (!frameInfo.pixels[i].isMapped()) {
+            continue;
+        }
+
+        for (unsigned k = 0; k < LOD_NEIGHBORS + 1; k++) {
+            indices[k] = i;
+            distSqr[k] = 0;
+        }
+
+        Vec3 p = frameInfo.pixels[i].point;
+        frameInfo.tree.knnSearch(&p[0], LOD_NEIGHBORS + 1, indices, distSqr);
+
+        unsigned out = 0;
+        for (unsigned k = 0; k < LOD_NEIGHBORS + 1 && out < LOD_NEIGHBORS; k++) {
+            unsigned n = indices[k];
+            if (n == i || !frameInfo.pixels[n].isMapped()) {
+                continue;
+            }
+            lodNeighbors[i * LOD_NEIGHBORS + out] = n;
+            lodNeighborWeights[i * LOD_NEIGHBORS + out] = 1.0f / (float(distSqr[k]) + 1e-6f);
+            out++;
+        }
+    }
+}
+
+inline void EffectRunner::interpolateLod()
+{
+    // Scatter the subset's results back to framebuffer order
+    for (unsigned j = 0; j < lodPixels.size(); j++) {
+        shaderColors[lodPixels[j].index] = lodColors[j];
+    }
+
+    unsigned spanBegin, spanEnd;
+    getSpan(spanBegin, spanEnd);
+
+    for (unsigned i = spanBegin; i < spanEnd; i++) {
+        if (lodShadedFlags[i] || !frameInfo.pixels[i].isMapped()) {
+            continue;
+        }
+
+        const unsigned *nb = &lodNeighbors[i * LOD_NEIGHBORS];
+        const float *wt = &lodNeighborWeights[i * LOD_NEIGHBORS];
+        Vec3 sum(0, 0, 0);
+        float weight = 0;
+
+        for (unsigned k = 0; k < LOD_NEIGHBORS; k++) {
+            if (wt[k] <= 0) {
+                break;      // Weights are packed; zero marks the end
+            }
+            if (lodShadedFlags[nb[k]]) {
+                sum += shaderColors[nb[k]] * wt[k];
+                weight += wt[k];
+            }
+        }
+
+        if (weight > 0) {
+            shaderColors[i] = sum / weight;
+        }
+        // No shaded neighbor in range: the pixel keeps the color from
+        // the last frame that shaded it, at most lodStride() frames old.
+    }
+}
+
+inline void EffectRunner::adjustLod()
+{
+    // Track the shader load against the -fps budget: shrink the shaded
+    // fraction quickly when busy time nears the whole frame period, and
+    // grow it back slowly once there's real headroom. The gap between the
+    // two thresholds keeps the controller from oscillating at a boundary.
+    if (minTimeDelta <= 0) {
+        return;
+    }
+
+    float busy = getBusyTimePerFrame();
+    if (busy > minTimeDelta * 0.85f) {
+        lodFraction *= 0.9f;
+    } else if (busy < minTimeDelta * 0.5f) {
+        lodFraction *= 1.05f;
+    }
+    lodFraction = std::min(1.0f, std::max(0.25f, lodFraction));
+}
+
+inline void EffectRunner::getSpan(unsigned &begin, unsigned &end) const
+{
+    unsigned size = frameInfo.pixels.size();
+    if (spanCount) {
+        begin = std::min<unsigned>(size, spanFirst);
+        end = std::min<unsigned>(size, spanFirst + spanCount);
+    } else {
+        begin = 0;
+        end = size;
+    }
+}
+
+inline void EffectRunner::shaderChunk(unsigned share, unsigned numShares)
+{
+    if (lodActive) {
+        // LOD frame: the shares divide the gathered subset instead
+        unsigned size = lodPixels.size();
+        unsigned begin = size * share / numShares;
+        unsigned end = size * (share + 1) / numShares;
+
+        if (begin != end) {
+            effect->shaderBlock(&lodColors[begin], &lodPixels[begin], end - begin);
+        }
+        return;
+    }
+
+    unsigned spanBegin, spanEnd;
+    getSpan(spanBegin, spanEnd);
+
+    unsigned size = spanEnd - spanBegin;
+    unsigned begin = spanBegin + size * share / numShares;
+    unsigned end = spanBegin + size * (share + 1) / numShares;
+
+    if (begin != end) {
+        // One virtual call per chunk; the default shaderBlock() loops over
+        // shader(), and effects with batch kernels override it.
+        effect->shaderBlock(&shaderColors[begin], &frameInfo.pixels[begin], end - begin);
+    }
+}
+
+inline void EffectRunner::workerThreadFunc(void *arg)
+{
+    WorkerArg *wa = static_cast<WorkerArg*>(arg);
+    EffectRunner *self = wa->runner;
+    unsigned lastGeneration = 0;
+
+    self->workMutex.lock();
+    for (;;) {
+        while (!self->workersExit && self->workGeneration == lastGeneration) {
+            self->workBegin.wait(self->workMutex);
+        }
+        if (self->workersExit) {
+            break;
+        }
+        lastGeneration = self->workGeneration;
+        self->workMutex.unlock();
+
+        self->shaderChunk(wa->share, self->workers.size() + 1);
+
+        self->workMutex.lock();
+        if (--self->workersBusy == 0) {
+            self->workDone.notify_one();
+        }
+    }
+    self->workMutex.unlock();
+
+    delete wa;
+}
+
 inline OPCClient& EffectRunner::getClient()
 {
     return opc;
@@ -361,14 +1064,23 @@ inline const Effect::PixelInfoVec& EffectRunner::getPixelInfo() const
 
 inline const uint8_t* EffectRunner::getPixel(unsigned index) const
 {
-    return OPCClient::Header::view(frameBuffer).data() + index * 3;
+    // In -16bit mode this points at six bytes of big-endian uint16 RGB;
+    // getPixelColor() handles both encodings.
+    const uint8_t *data = OPCClient::Header::view(*frontBuffer).data();
+    return deepColor ? data + OPCClient::SYSEX_ID_BYTES + index * 6
+                     : data + index * 3;
 }
 
 inline void EffectRunner::getPixelColor(unsigned index, Vec3 &rgb) const
 {
     const uint8_t *byte = getPixel(index);
     for (unsigned i = 0; i < 3; i++) {
-        rgb[i] = *(byte++) / 255.0f;
+        if (deepColor) {
+            rgb[i] = ((byte[0] << 8) | byte[1]) / 65535.0f;
+            byte += 2;
+        } else {
+            rgb[i] = *(byte++) / 255.0f;
+        }
     }
 }
 
@@ -395,6 +1107,16 @@ inline int EffectRunner::main(int argc, char **argv, bool loop)
         return 1;
     }
 
+    if (benchFrames) {
+        // Benchmark each effect once; no streaming, no looping
+        for (std::vector<Effect*>::iterator i(effects.begin());
+             i != effects.end(); ++i) {
+            effect = *i;
+            runBenchmark();
+        }
+        return 0;
+    }
+
     do
     {
        for( std::vector<Effect*>::iterator i( effects.begin() );
@@ -417,15 +1139,21 @@ inline void EffectRunner::usage(const char *name)
 
 inline void EffectRunner::debug()
 {
-    fprintf(stderr, " %7.2f FPS -- %6.2f%% CPU [%.3fms busy, %.3fms idle, %.3fms jitter]\n",
+    fprintf(stderr, " %7.2f FPS -- %6.2f%% CPU [%.3fms busy, %.3fms idle, %.3fms jitter, %u missed]\n",
         getFrameRate(),
         getPercentBusy(),
         1e3f * getBusyTimePerFrame(),
         1e3f * getIdleTimePerFrame(),
-        1e3f * (jitterStatsMax - jitterStatsMin));
+        1e3f * (jitterStatsMax - jitterStatsMin),
+        missedDeadlines);
 
     jitterStatsMax = 0;
     jitterStatsMin = 1e10;
+    missedDeadlines = 0;
+
+    if (lodEnabled) {
+        fprintf(stderr, "    LOD: shading 1/%u of pixels per frame\n", lodStride());
+    }
 
     if (effect) {
         Effect::DebugInfo d(*this);
@@ -433,6 +1161,91 @@ inline void EffectRunner::debug()
     }
 }
 
+inline float EffectRunner::benchPercentile(const std::vector<float> &sorted, float fraction)
+{
+    unsigned i = (unsigned)(fraction * (sorted.size() - 1) + 0.5f);
+    return sorted[i];
+}
+
+inline void EffectRunner::benchReport(const char *phase, std::vector<float> &samples)
+{
+    double mean = 0;
+    for (unsigned i = 0; i < samples.size(); i++) {
+        mean += samples[i];
+    }
+    mean /= samples.size();
+
+    std::sort(samples.begin(), samples.end());
+    fprintf(stderr, "  %-12s %8.3f %8.3f %8.3f %8.3f %8.3f\n",
+        phase, mean,
+        benchPercentile(samples, 0.50f),
+        benchPercentile(samples, 0.90f),
+        benchPercentile(samples, 0.99f),
+        samples.back());
+}
+
+inline void EffectRunner::runBenchmark()
+{
+    // A fixed timestep makes runs repeatable; -fps and -speed still apply
+    float timeDelta = (minTimeDelta ? minTimeDelta : 1.0f / 60.0f) * speed;
+    frameInfo.timeDelta = timeDelta;
+
+    uint8_t *dest = OPCClient::Header::view(frameBuffer).data();
+
+    std::vector<float> tBegin(benchFrames), tShader(benchFrames);
+    std::vector<float> tPost(benchFrames), tEnd(benchFrames), tTotal(benchFrames);
+
+    // Let effect state, the worker pool and the caches settle first
+    const unsigned warmupFrames = 16;
+
+    for (unsigned frame = 0; frame < warmupFrames + benchFrames; frame++) {
+        struct timespec t0, t1, t2, t3, t4;
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        effect->beginFrame(frameInfo);
+
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        runShaders();
+
+        clock_gettime(CLOCK_MONOTONIC, &t2);
+        for (unsigned i = 0; i < frameInfo.pixels.size(); i++) {
+            const Effect::PixelInfo &p = frameInfo.pixels[i];
+            const Vec3 &rgb = shaderColors[i];
+
+            if (p.isMapped()) {
+                effect->postProcess(rgb, p);
+            }
+
+            for (unsigned c = 0; c < 3; c++) {
+                dest[i * 3 + c] = std::min<int>(255, std::max<int>(0, rgb[c] * 255 + 0.5));
+            }
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &t3);
+        effect->endFrame(frameInfo);
+        clock_gettime(CLOCK_MONOTONIC, &t4);
+
+        if (frame >= warmupFrames) {
+            unsigned s = frame - warmupFrames;
+            tBegin[s]  = (t1.tv_sec - t0.tv_sec) * 1e3f + (t1.tv_nsec - t0.tv_nsec) * 1e-6f;
+            tShader[s] = (t2.tv_sec - t1.tv_sec) * 1e3f + (t2.tv_nsec - t1.tv_nsec) * 1e-6f;
+            tPost[s]   = (t3.tv_sec - t2.tv_sec) * 1e3f + (t3.tv_nsec - t2.tv_nsec) * 1e-6f;
+            tEnd[s]    = (t4.tv_sec - t3.tv_sec) * 1e3f + (t4.tv_nsec - t3.tv_nsec) * 1e-6f;
+            tTotal[s]  = (t4.tv_sec - t0.tv_sec) * 1e3f + (t4.tv_nsec - t0.tv_nsec) * 1e-6f;
+        }
+    }
+
+    fprintf(stderr, "benchmark: %d pixels, %u frames, timeDelta %.3f ms\n",
+        (int)frameInfo.pixels.size(), benchFrames, timeDelta * 1e3f);
+    fprintf(stderr, "  %-12s %8s %8s %8s %8s %8s  (ms)\n",
+        "phase", "mean", "p50", "p90", "p99", "max");
+    benchReport("beginFrame", tBegin);
+    benchReport("shader", tShader);
+    benchReport("postProcess", tPost);
+    benchReport("endFrame", tEnd);
+    benchReport("total", tTotal);
+}
+
 inline bool EffectRunner::parseArgument(int &i, int &argc, char **argv)
 {
     if (!strcmp(argv[i], "-v")) {
@@ -475,6 +1288,47 @@ inline bool EffectRunner::parseArgument(int &i, int &argc, char **argv)
         return true;
     }
 
+    if (!strcmp(argv[i], "-span") && (i+1 < argc)) {
+        unsigned first, last;
+        if (sscanf(argv[++i], "%u-%u", &first, &last) != 2 || last < first) {
+            fprintf(stderr, "Invalid pixel span\n");
+            return false;
+        }
+        spanFirst = first;
+        spanCount = last - first + 1;
+        return true;
+    }
+
+    if (!strcmp(argv[i], "-16bit")) {
+        deepColor = true;
+        initFrameBuffers();     // Re-init if -layout came first
+        return true;
+    }
+
+    if (!strcmp(argv[i], "-lod")) {
+        lodEnabled = true;
+        return true;
+    }
+
+    if (!strcmp(argv[i], "-gpu")) {
+        if (!GPUShaderBackend::supported()) {
+            fprintf(stderr, "Not built with USE_GL_COMPUTE; see the Makefile\n");
+            return false;
+        }
+        gpuEnabled = true;
+        return true;
+    }
+
+    if (!strcmp(argv[i], "-bench") && (i+1 < argc)) {
+        int frames = atoi(argv[++i]);
+        if (frames <= 0) {
+            fprintf(stderr, "Invalid frame count\n");
+            return false;
+        }
+        benchFrames = frames;
+        return true;
+    }
+
     return false;
 }
 
@@ -490,5 +1344,5 @@ inline bool EffectRunner::validateArguments()
 
 inline void EffectRunner::argumentUsage()
 {
-    fprintf(stderr, "[-v] [-fps LIMIT] [-speed MULTIPLIER] [-layout FILE.json] [-server HOST[:port]]");
+    fprintf(stderr, "[-v] [-fps LIMIT] [-speed MULTIPLIER] [-layout FILE.json] [-server HOST[:port][/FIRST-LAST[@CHANNEL]]]... [-span FIRST-LAST] [-bench FRAMES] [-gpu] [-lod] [-16bit]");
 }
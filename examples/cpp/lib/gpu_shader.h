@@ -0,0 +1,467 @@
+/*
+ * Optional GPU shading backend for the LED Effect Framework.
+ *
+ * Shading is embarrassingly parallel -- shader() is documented as
+ * side-effect-free -- so on boards with a capable GPU (the Pi's
+ * VideoCore, desktop Mesa) a compute shader can outrun every CPU core
+ * combined. Effects opt in by returning GLSL from Effect::gpuShader();
+ * the backend uploads the layout once as a point buffer, dispatches the
+ * effect's kernel each frame, and reads the colors back for the normal
+ * postProcess() and OPC output path.
+ *
+ * The backend needs EGL and OpenGL ES 3.1 (compute shaders). It is
+ * compiled in only when USE_GL_COMPUTE is defined; see the Makefile.
+ * Without it, or when context setup fails at runtime, EffectRunner
+ * falls back to the CPU shader path.
+ *
+ * Copyright (c) 2014 Micah Elizabeth Scott <micah@scanlime.org>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "effect.h"
+#include "svl/SVL.h"
+
+#ifdef USE_GL_COMPUTE
+#include <EGL/egl.h>
+#include <GLES3/gl31.h>
+#endif
+
+
+class GPUShaderBackend : public Effect::GPUUniforms {
+public:
+    GPUShaderBackend();
+    ~GPUShaderBackend();
+
+    // Was the backend compiled in?
+    static bool supported();
+
+    /*
+     * One-time setup: create a headless EGL context and upload the
+     * layout's point buffer. Safe to call again; later calls are
+     * no-ops. Returns false if no usable GPU context is available,
+     * with details on stderr.
+     */
+    bool init(const Effect::FrameInfo &frame);
+
+    /*
+     * Compile and link an effect's shade() source against the common
+     * prelude. Returns false on compile errors, with the GLSL log on
+     * stderr.
+     */
+    bool setProgram(const char *source);
+
+    /*
+     * Dispatch one frame and read the results back into 'colors',
+     * which is resized to the pixel count. Calls the effect's
+     * gpuUniforms() hook after binding the program, so named uniforms
+     * set there land on the current frame.
+     */
+    bool run(float timeDelta, const Effect *effect, std::vector<Vec3> &colors);
+
+    // Effect::GPUUniforms, valid during the effect's gpuUniforms() hook
+    virtual void set(const char *name, float value);
+
+#ifdef USE_GL_COMPUTE
+private:
+    EGLDisplay display;
+    EGLContext context;
+    EGLSurface surface;
+    GLuint program;
+    GLuint pointBuffer;
+    GLuint colorBuffer;
+    unsigned pixelCount;
+    float timeAccum;
+    bool initialized;
+    bool initFailed;
+
+    static const char *prelude();
+    static const char *postlude();
+    bool makeCurrent();
+#endif
+};
+
+
+/*****************************************************************************************
+ *                                   Implementation
+ *****************************************************************************************/
+
+
+#ifdef USE_GL_COMPUTE
+
+inline GPUShaderBackend::GPUShaderBackend()
+    : display(EGL_NO_DISPLAY),
+      context(EGL_NO_CONTEXT),
+      surface(EGL_NO_SURFACE),
+      program(0),
+      pointBuffer(0),
+      colorBuffer(0),
+      pixelCount(0),
+      timeAccum(0),
+      initialized(false),
+      initFailed(false)
+{}
+
+inline GPUShaderBackend::~GPUShaderBackend()
+{
+    if (display != EGL_NO_DISPLAY) {
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (context != EGL_NO_CONTEXT) {
+            eglDestroyContext(display, context);
+        }
+        if (surface != EGL_NO_SURFACE) {
+            eglDestroySurface(display, surface);
+        }
+        eglTerminate(display);
+    }
+}
+
+inline bool GPUShaderBackend::supported()
+{
+    return true;
+}
+
+inline const char *GPUShaderBackend::prelude()
+{
+    /*
+     * Common environment for effect kernels: the layout as vec4 points
+     * (w is the mapped flag), the output colors, the frame clock, and
+     * GLSL counterparts of the lib helpers effects lean on. The noise
+     * is Ian McEwan's hash-based simplex noise (MIT licensed, from
+     * github.com/ashima/webgl-noise), range-matched to lib/noise.h's
+     * noise3() but not bit-exact with its permutation table.
+     */
+    return
+        "#version 310 es\n"
+        "precision highp float;\n"
+        "layout(local_size_x = 64) in;\n"
+        "layout(std430, binding = 0) readonly buffer Points { vec4 fc_point[]; };\n"
+        "layout(std430, binding = 1) writeonly buffer Colors { vec4 fc_color[]; };\n"
+        "uniform float time;\n"
+        "uniform float timeDelta;\n"
+        "uniform uint pixelCount;\n"
+        "\n"
+        "vec3 hsv2rgb(float h, float s, float v)\n"
+        "{\n"
+        "    h = fract(h) * 6.0;\n"
+        "    int i = int(h);\n"
+        "    float f = h - float(i);\n"
+        "    float p = v * (1.0 - s);\n"
+        "    float q = v * (1.0 - f * s);\n"
+        "    float t = v * (1.0 - (1.0 - f) * s);\n"
+        "    if (i == 0) return vec3(v, t, p);\n"
+        "    if (i == 1) return vec3(q, v, p);\n"
+        "    if (i == 2) return vec3(p, v, t);\n"
+        "    if (i == 3) return vec3(p, q, v);\n"
+        "    if (i == 4) return vec3(t, p, v);\n"
+        "    return vec3(v, p, q);\n"
+        "}\n"
+        "\n"
+        "vec3 fc_mod289(vec3 x) { return x - floor(x * (1.0 / 289.0)) * 289.0; }\n"
+        "vec4 fc_mod289(vec4 x) { return x - floor(x * (1.0 / 289.0)) * 289.0; }\n"
+        "vec4 fc_permute(vec4 x) { return fc_mod289(((x * 34.0) + 1.0) * x); }\n"
+        "vec4 fc_taylorInvSqrt(vec4 r) { return 1.79284291400159 - 0.85373472095314 * r; }\n"
+        "\n"
+        "float noise3(vec3 v)\n"
+        "{\n"
+        "    const vec2 C = vec2(1.0 / 6.0, 1.0 / 3.0);\n"
+        "    const vec4 D = vec4(0.0, 0.5, 1.0, 2.0);\n"
+        "    vec3 i = floor(v + dot(v, C.yyy));\n"
+        "    vec3 x0 = v - i + dot(i, C.xxx);\n"
+        "    vec3 g = step(x0.yzx, x0.xyz);\n"
+        "    vec3 l = 1.0 - g;\n"
+        "    vec3 i1 = min(g.xyz, l.zxy);\n"
+        "    vec3 i2 = max(g.xyz, l.zxy);\n"
+        "    vec3 x1 = x0 - i1 + C.xxx;\n"
+        "    vec3 x2 = x0 - i2 + C.yyy;\n"
+        "    vec3 x3 = x0 - D.yyy;\n"
+        "    i = fc_mod289(i);\n"
+        "    vec4 p = fc_permute(fc_permute(fc_permute(\n"
+        "        i.z + vec4(0.0, i1.z, i2.z, 1.0))\n"
+        "        + i.y + vec4(0.0, i1.y, i2.y, 1.0))\n"
+        "        + i.x + vec4(0.0, i1.x, i2.x, 1.0));\n"
+        "    float n_ = 0.142857142857;\n"
+        "    vec3 ns = n_ * D.wyz - D.xzx;\n"
+        "    vec4 j = p - 49.0 * floor(p * ns.z * ns.z);\n"
+        "    vec4 x_ = floor(j * ns.z);\n"
+        "    vec4 y_ = floor(j - 7.0 * x_);\n"
+        "    vec4 x = x_ * ns.x + ns.yyyy;\n"
+        "    vec4 y = y_ * ns.x + ns.yyyy;\n"
+        "    vec4 h = 1.0 - abs(x) - abs(y);\n"
+        "    vec4 b0 = vec4(x.xy, y.xy);\n"
+        "    vec4 b1 = vec4(x.zw, y.zw);\n"
+        "    vec4 s0 = floor(b0) * 2.0 + 1.0;\n"
+        "    vec4 s1 = floor(b1) * 2.0 + 1.0;\n"
+        "    vec4 sh = -step(h, vec4(0.0));\n"
+        "    vec4 a0 = b0.xzyw + s0.xzyw * sh.xxyy;\n"
+        "    vec4 a1 = b1.xzyw + s1.xzyw * sh.zzww;\n"
+        "    vec3 p0 = vec3(a0.xy, h.x);\n"
+        "    vec3 p1 = vec3(a0.zw, h.y);\n"
+        "    vec3 p2 = vec3(a1.xy, h.z);\n"
+        "    vec3 p3 = vec3(a1.zw, h.w);\n"
+        "    vec4 norm = fc_taylorInvSqrt(vec4(dot(p0, p0), dot(p1, p1), dot(p2, p2), dot(p3, p3)));\n"
+        "    p0 *= norm.x;\n"
+        "    p1 *= norm.y;\n"
+        "    p2 *= norm.z;\n"
+        "    p3 *= norm.w;\n"
+        "    vec4 m = max(0.6 - vec4(dot(x0, x0), dot(x1, x1), dot(x2, x2), dot(x3, x3)), 0.0);\n"
+        "    m = m * m;\n"
+        "    return 42.0 * dot(m * m, vec4(dot(p0, x0), dot(p1, x1), dot(p2, x2), dot(p3, x3)));\n"
+        "}\n"
+        "\n";
+}
+
+inline const char *GPUShaderBackend::postlude()
+{
+    // One invocation per pixel; unmapped pixels shade to black, like
+    // the default shaderBlock().
+    return
+        "\n"
+        "void main()\n"
+        "{\n"
+        "    uint i = gl_GlobalInvocationID.x;\n"
+        "    if (i >= pixelCount) return;\n"
+        "    vec4 p = fc_point[i];\n"
+        "    vec3 rgb = p.w != 0.0 ? shade(p.xyz) : vec3(0.0);\n"
+        "    fc_color[i] = vec4(rgb, 0.0);\n"
+        "}\n";
+}
+
+inline bool GPUShaderBackend::makeCurrent()
+{
+    return eglMakeCurrent(display, surface, surface, context);
+}
+
+inline bool GPUShaderBackend::init(const Effect::FrameInfo &frame)
+{
+    if (initialized) {
+        return true;
+    }
+    if (initFailed) {
+        return false;
+    }
+    initFailed = true;
+
+    display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, 0, 0)) {
+        fprintf(stderr, "GPU: no EGL display\n");
+        return false;
+    }
+
+    eglBindAPI(EGL_OPENGL_ES_API);
+
+    static const EGLint configAttribs[] = {
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT,
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_NONE
+    };
+    EGLConfig config;
+    EGLint numConfigs = 0;
+    if (!eglChooseConfig(display, configAttribs, &config, 1, &numConfigs) || numConfigs < 1) {
+        fprintf(stderr, "GPU: no ES3 EGL config\n");
+        return false;
+    }
+
+    static const EGLint contextAttribs[] = {
+        EGL_CONTEXT_CLIENT_VERSION, 3,
+        EGL_NONE
+    };
+    context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+    if (context == EGL_NO_CONTEXT) {
+        fprintf(stderr, "GPU: can't create ES3 context\n");
+        return false;
+    }
+
+    // Surfaceless when the implementation allows it, else a 1x1 pbuffer
+    if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+        static const EGLint pbufferAttribs[] = {
+            EGL_WIDTH, 1,
+            EGL_HEIGHT, 1,
+            EGL_NONE
+        };
+        surface = eglCreatePbufferSurface(display, config, pbufferAttribs);
+        if (surface == EGL_NO_SURFACE || !makeCurrent()) {
+            fprintf(stderr, "GPU: can't make context current\n");
+            return false;
+        }
+    }
+
+    // Compute shaders arrived in ES 3.1
+    GLint major = 0, minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    if (major < 3 || (major == 3 && minor < 1)) {
+        fprintf(stderr, "GPU: OpenGL ES %d.%d has no compute shaders\n", major, minor);
+        return false;
+    }
+
+    // Upload the layout once; it never changes after init
+    pixelCount = frame.pixels.size();
+    std::vector<float> points(pixelCount * 4);
+    for (unsigned i = 0; i < pixelCount; i++) {
+        points[i * 4 + 0] = frame.pointX[i];
+        points[i * 4 + 1] = frame.pointY[i];
+        points[i * 4 + 2] = frame.pointZ[i];
+        points[i * 4 + 3] = frame.pixelMapped[i] ? 1.0f : 0.0f;
+    }
+
+    glGenBuffers(1, &pointBuffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, pointBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, points.size() * sizeof(float),
+        &points[0], GL_STATIC_DRAW);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, pointBuffer);
+
+    glGenBuffers(1, &colorBuffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, colorBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, pixelCount * 4 * sizeof(float),
+        0, GL_DYNAMIC_READ);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, colorBuffer);
+
+    if (glGetError() != GL_NO_ERROR) {
+        fprintf(stderr, "GPU: buffer setup failed\n");
+        return false;
+    }
+
+    initFailed = false;
+    initialized = true;
+    return true;
+}
+
+inline bool GPUShaderBackend::setProgram(const char *source)
+{
+    if (!initialized || !makeCurrent()) {
+        return false;
+    }
+
+    if (program) {
+        glDeleteProgram(program);
+        program = 0;
+    }
+
+    const char *sources[] = { prelude(), source, postlude() };
+    GLuint shader = glCreateShader(GL_COMPUTE_SHADER);
+    glShaderSource(shader, 3, sources, 0);
+    glCompileShader(shader);
+
+    GLint ok = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+    if (!ok) {
+        char log[4096];
+        glGetShaderInfoLog(shader, sizeof log, 0, log);
+        fprintf(stderr, "GPU: shader compile failed:\n%s", log);
+        glDeleteShader(shader);
+        return false;
+    }
+
+    program = glCreateProgram();
+    glAttachShader(program, shader);
+    glLinkProgram(program);
+    glDeleteShader(shader);
+
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok) {
+        char log[4096];
+        glGetProgramInfoLog(program, sizeof log, 0, log);
+        fprintf(stderr, "GPU: shader link failed:\n%s", log);
+        glDeleteProgram(program);
+        program = 0;
+        return false;
+    }
+
+    timeAccum = 0;
+    return true;
+}
+
+inline void GPUShaderBackend::set(const char *name, float value)
+{
+    glUniform1f(glGetUniformLocation(program, name), value);
+}
+
+inline bool GPUShaderBackend::run(float timeDelta, const Effect *effect, std::vector<Vec3> &colors)
+{
+    if (!program || !makeCurrent()) {
+        return false;
+    }
+
+    timeAccum += timeDelta;
+
+    glUseProgram(program);
+    glUniform1f(glGetUniformLocation(program, "time"), timeAccum);
+    glUniform1f(glGetUniformLocation(program, "timeDelta"), timeDelta);
+    glUniform1ui(glGetUniformLocation(program, "pixelCount"), pixelCount);
+    effect->gpuUniforms(*this);
+
+    glDispatchCompute((pixelCount + 63) / 64, 1, 1);
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, colorBuffer);
+    const float *result = (const float*) glMapBufferRange(GL_SHADER_STORAGE_BUFFER,
+        0, pixelCount * 4 * sizeof(float), GL_MAP_READ_BIT);
+    if (!result) {
+        return false;
+    }
+
+    colors.resize(pixelCount);
+    for (unsigned i = 0; i < pixelCount; i++) {
+        colors[i] = Vec3(result[i * 4], result[i * 4 + 1], result[i * 4 + 2]);
+    }
+    glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+
+    return glGetError() == GL_NO_ERROR;
+}
+
+#else  // !USE_GL_COMPUTE
+
+// Stub; EffectRunner stays on the CPU shader path.
+
+inline GPUShaderBackend::GPUShaderBackend() {}
+inline GPUShaderBackend::~GPUShaderBackend() {}
+
+inline bool GPUShaderBackend::supported()
+{
+    return false;
+}
+
+inline bool GPUShaderBackend::init(const Effect::FrameInfo &)
+{
+    return false;
+}
+
+inline bool GPUShaderBackend::setProgram(const char *)
+{
+    return false;
+}
+
+inline bool GPUShaderBackend::run(float, const Effect *, std::vector<Vec3> &)
+{
+    return false;
+}
+
+inline void GPUShaderBackend::set(const char *, float) {}
+
+#endif  // USE_GL_COMPUTE
@@ -30,6 +30,7 @@
 
 #include <math.h>
 #include <float.h>
+#include <stdint.h>
 
 #include "svl/SVL.h"
 
@@ -99,6 +100,88 @@ const unsigned char SIMPLEX[][4] = {
 
 #define fastfloor(n) (int)(n) - (((n) < 0.0f) & ((n) != (int)(n)))
 
+/*
+ * Optional gradient cache. Effects animate their noise coordinates a
+ * little at a time, so consecutive frames revisit most of the same
+ * lattice cells; memoizing the chained PERM lookups per lattice point
+ * turns the common case into a single table probe. The tables are
+ * direct-mapped and every entry is a single machine word, so shader
+ * threads can share them without locking: a racing update at worst
+ * misses and recomputes.
+ *
+ * The PERM table itself is small enough to live in L1, so on desktop
+ * CPUs the raw chain tends to win; the cache pays off where loads are
+ * expensive relative to arithmetic. It is opt-in: define
+ * NOISE_GRADIENT_CACHE to enable it. Results are identical either way.
+ */
+
+#ifdef NOISE_GRADIENT_CACHE
+
+// 4096 entries: 16 kB for the 3D table, 32 kB for 4D
+#define NOISE_CACHE_SIZE 4096
+#define NOISE_CACHE_HASH(key) (((key) * 2654435761u) >> 20)
+
+static uint32_t noise_cache3[NOISE_CACHE_SIZE];
+
+static inline int noise_gradient3(int li, int lj, int lk)
+{
+    li &= 255; lj &= 255; lk &= 255;
+    uint32_t key = ((uint32_t)li << 16) | (lj << 8) | lk;
+    uint32_t &slot = noise_cache3[NOISE_CACHE_HASH(key)];
+    uint32_t entry = slot;
+    uint32_t tag = 0x10000000u | (key << 4);
+
+    if ((entry & ~(uint32_t)15) == tag) {
+        return entry & 15;
+    }
+
+    int g = PERM[li + PERM[lj + PERM[lk]]] % 12;
+    slot = tag | g;
+    return g;
+}
+
+#if defined(__LP64__) || defined(_M_X64) || defined(__aarch64__)
+// A 4D entry needs the full 32-bit key plus the gradient, so these
+// single-word entries only work out on 64-bit targets.
+#define NOISE_GRADIENT_CACHE_4D 1
+
+static uint64_t noise_cache4[NOISE_CACHE_SIZE];
+
+static inline int noise_gradient4(int li, int lj, int lk, int ll)
+{
+    li &= 255; lj &= 255; lk &= 255; ll &= 255;
+    uint32_t key = ((uint32_t)li << 24) | (lj << 16) | (lk << 8) | ll;
+    uint64_t &slot = noise_cache4[NOISE_CACHE_HASH(key)];
+    uint64_t entry = slot;
+    uint64_t tag = ((uint64_t)1 << 37) | ((uint64_t)key << 5);
+
+    if ((entry & ~(uint64_t)31) == tag) {
+        return (int)(entry & 31);
+    }
+
+    int g = PERM[li + PERM[lj + PERM[lk + PERM[ll]]]] & 0x1f;
+    slot = tag | g;
+    return g;
+}
+#endif
+#endif  // NOISE_GRADIENT_CACHE
+
+#ifndef NOISE_GRADIENT_CACHE
+static inline int noise_gradient3(int li, int lj, int lk)
+{
+    li &= 255; lj &= 255; lk &= 255;
+    return PERM[li + PERM[lj + PERM[lk]]] % 12;
+}
+#endif
+
+#ifndef NOISE_GRADIENT_CACHE_4D
+static inline int noise_gradient4(int li, int lj, int lk, int ll)
+{
+    li &= 255; lj &= 255; lk &= 255; ll &= 255;
+    return PERM[li + PERM[lj + PERM[lk + PERM[ll]]]] & 0x1f;
+}
+#endif
+
 // Fast sine/cosine functions from
 // http://devmaster.net/forums/topic/4648-fast-and-accurate-sinecosine/page__st__80
 // Note the input to these functions is not radians
@@ -260,10 +343,10 @@ noise3(float x, float y, float z)
   I = (int) i & 255; 
   J = (int) j & 255; 
   K = (int) k & 255;
-  g[0] = PERM[I + PERM[J + PERM[K]]] % 12;
-  g[1] = PERM[I + o1[0] + PERM[J + o1[1] + PERM[o1[2] + K]]] % 12;
-  g[2] = PERM[I + o2[0] + PERM[J + o2[1] + PERM[o2[2] + K]]] % 12;
-  g[3] = PERM[I + 1 + PERM[J + 1 + PERM[K + 1]]] % 12; 
+  g[0] = noise_gradient3(I, J, K);
+  g[1] = noise_gradient3(I + o1[0], J + o1[1], K + o1[2]);
+  g[2] = noise_gradient3(I + o2[0], J + o2[1], K + o2[2]);
+  g[3] = noise_gradient3(I + 1, J + 1, K + 1);
 
   for (c = 0; c <= 3; c++) {
     f[c] = 0.6f - pos[c][0]*pos[c][0] - pos[c][1]*pos[c][1] - pos[c][2]*pos[c][2];
@@ -306,6 +389,233 @@ fbm_noise3(Vec3 v, int octaves, float persistence = 0.5, float lacunarity = 2.0)
   return fbm_noise3(v[0], v[1], v[2], octaves, persistence, lacunarity);
 }
 
+/*
+ * Four-wide SIMD noise3, built on the VlFloat4 primitives from svl/Basics.h.
+ * Evaluates four independent points per call: the skew, corner offsets and
+ * falloff run vectorized across lanes, with the usual branches turned into
+ * lane masks; only the permutation-table hashing and gradient lookups stay
+ * scalar. Results match the scalar noise3 to within rounding. Requires SSE2
+ * on x86 for the float-to-int conversions; NEON always has them.
+ */
+
+#if (defined(VL_SIMD_SSE) && (defined(__SSE2__) || defined(_M_X64))) || defined(VL_SIMD_NEON)
+#define NOISE_SIMD 1
+
+#ifdef VL_SIMD_SSE
+#include <emmintrin.h>
+
+typedef __m128 NoiseMask;
+#define noise_ge(a, b)      _mm_cmpge_ps(a, b)
+#define noise_gt(a, b)      _mm_cmpgt_ps(a, b)
+#define noise_mand(a, b)    _mm_and_ps(a, b)
+#define noise_mor(a, b)     _mm_or_ps(a, b)
+#define noise_mnot(a)       _mm_andnot_ps(a, _mm_cmpeq_ps(_mm_setzero_ps(), _mm_setzero_ps()))
+#define noise_maskf(m, v)   _mm_and_ps(m, v)
+
+static inline VlFloat4 noise_floor4(VlFloat4 v)
+{
+    // Truncate toward zero, then fix up the negative non-integers
+    VlFloat4 ft = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+    return _mm_sub_ps(ft, _mm_and_ps(_mm_cmplt_ps(v, ft), _mm_set1_ps(1.0f)));
+}
+
+#else  // VL_SIMD_NEON
+
+typedef uint32x4_t NoiseMask;
+#define noise_ge(a, b)      vcgeq_f32(a, b)
+#define noise_gt(a, b)      vcgtq_f32(a, b)
+#define noise_mand(a, b)    vandq_u32(a, b)
+#define noise_mor(a, b)     vorrq_u32(a, b)
+#define noise_mnot(a)       vmvnq_u32(a)
+#define noise_maskf(m, v)   vreinterpretq_f32_u32(vandq_u32(m, vreinterpretq_u32_f32(v)))
+
+static inline VlFloat4 noise_floor4(VlFloat4 v)
+{
+    // Truncate toward zero, then fix up the negative non-integers
+    VlFloat4 ft = vcvtq_f32_s32(vcvtq_s32_f32(v));
+    return vsubq_f32(ft, noise_maskf(vcltq_f32(v, ft), vdupq_n_f32(1.0f)));
+}
+
+#endif
+
+// 1.0f in the lanes where the mask is set
+#define noise_mask1(m)      noise_maskf(m, vl_splat4(1.0f))
+
+static inline VlFloat4
+noise3_x4(VlFloat4 x, VlFloat4 y, VlFloat4 z)
+{
+    const VlFloat4 one = vl_splat4(1.0f);
+    const VlFloat4 vG3 = vl_splat4(G3);
+
+    VlFloat4 skew = vl_mul4(vl_add4(vl_add4(x, y), z), vl_splat4(F3));
+    VlFloat4 i = noise_floor4(vl_add4(x, skew));
+    VlFloat4 j = noise_floor4(vl_add4(y, skew));
+    VlFloat4 k = noise_floor4(vl_add4(z, skew));
+    VlFloat4 t = vl_mul4(vl_add4(vl_add4(i, j), k), vG3);
+
+    VlFloat4 x0 = vl_sub4(x, vl_sub4(i, t));
+    VlFloat4 y0 = vl_sub4(y, vl_sub4(j, t));
+    VlFloat4 z0 = vl_sub4(z, vl_sub4(k, t));
+
+    /*
+     * Corner ordering, as lane masks. o1 marks each lane's largest
+     * coordinate and o2 everything but its smallest, reproducing the
+     * comparison tree in noise3 (including its tie-breaking).
+     */
+    NoiseMask A = noise_ge(x0, y0);
+    NoiseMask B = noise_ge(y0, z0);
+    NoiseMask C = noise_ge(x0, z0);
+
+    VlFloat4 o1x = noise_mask1(noise_mand(A, C));
+    VlFloat4 o1y = noise_mask1(noise_mand(noise_mnot(A), B));
+    VlFloat4 o1z = vl_sub4(vl_sub4(one, o1x), o1y);
+    VlFloat4 o2x = noise_mask1(noise_mor(A, C));
+    VlFloat4 o2y = noise_mask1(noise_mor(noise_mnot(A), B));
+    VlFloat4 o2z = noise_mask1(noise_mnot(noise_mand(B, C)));
+
+    VlFloat4 px[4], py[4], pz[4];
+    px[0] = x0;
+    py[0] = y0;
+    pz[0] = z0;
+    px[1] = vl_add4(vl_sub4(x0, o1x), vG3);
+    py[1] = vl_add4(vl_sub4(y0, o1y), vG3);
+    pz[1] = vl_add4(vl_sub4(z0, o1z), vG3);
+    px[2] = vl_add4(vl_sub4(x0, o2x), vl_splat4(2.0f * G3));
+    py[2] = vl_add4(vl_sub4(y0, o2y), vl_splat4(2.0f * G3));
+    pz[2] = vl_add4(vl_sub4(z0, o2z), vl_splat4(2.0f * G3));
+    px[3] = vl_add4(vl_sub4(x0, one), vl_splat4(3.0f * G3));
+    py[3] = vl_add4(vl_sub4(y0, one), vl_splat4(3.0f * G3));
+    pz[3] = vl_add4(vl_sub4(z0, one), vl_splat4(3.0f * G3));
+
+    // Gradient hashing stays scalar; the permutation table walk is
+    // a chain of dependent byte loads with no vector equivalent here.
+    float fi[4], fj[4], fk[4];
+    float f1x[4], f1y[4], f1z[4], f2x[4], f2y[4], f2z[4];
+    vl_store4(fi, i);
+    vl_store4(fj, j);
+    vl_store4(fk, k);
+    vl_store4(f1x, o1x);
+    vl_store4(f1y, o1y);
+    vl_store4(f1z, o1z);
+    vl_store4(f2x, o2x);
+    vl_store4(f2y, o2y);
+    vl_store4(f2z, o2z);
+
+    int g[4][4];
+    for (int l = 0; l < 4; l++) {
+        int I = (int) fi[l] & 255;
+        int J = (int) fj[l] & 255;
+        int K = (int) fk[l] & 255;
+        int i1 = (int) f1x[l], j1 = (int) f1y[l], k1 = (int) f1z[l];
+        int i2 = (int) f2x[l], j2 = (int) f2y[l], k2 = (int) f2z[l];
+
+        g[0][l] = noise_gradient3(I, J, K);
+        g[1][l] = noise_gradient3(I + i1, J + j1, K + k1);
+        g[2][l] = noise_gradient3(I + i2, J + j2, K + k2);
+        g[3][l] = noise_gradient3(I + 1, J + 1, K + 1);
+    }
+
+    VlFloat4 total = vl_splat4(0.0f);
+
+    for (int c = 0; c < 4; c++) {
+        float gx[4], gy[4], gz[4];
+        for (int l = 0; l < 4; l++) {
+            gx[l] = GRAD3[g[c][l]][0];
+            gy[l] = GRAD3[g[c][l]][1];
+            gz[l] = GRAD3[g[c][l]][2];
+        }
+
+        VlFloat4 f = vl_sub4(vl_splat4(0.6f),
+            vl_add4(vl_add4(vl_mul4(px[c], px[c]), vl_mul4(py[c], py[c])),
+                vl_mul4(pz[c], pz[c])));
+        VlFloat4 f2 = vl_mul4(f, f);
+        VlFloat4 d = vl_add4(vl_add4(vl_mul4(vl_load4(gx), px[c]),
+            vl_mul4(vl_load4(gy), py[c])), vl_mul4(vl_load4(gz), pz[c]));
+
+        total = vl_add4(total,
+            noise_maskf(noise_gt(f, vl_splat4(0.0f)), vl_mul4(vl_mul4(f2, f2), d)));
+    }
+
+    return vl_mul4(total, vl_splat4(32.0f));
+}
+
+#endif  // NOISE_SIMD
+
+/*
+ * Batch entry points: evaluate noise for an array of points at once, four
+ * per SIMD pass where the kernel above is available and one at a time
+ * otherwise. Batch shaders (Effect::shaderBlock) can gather their pixel
+ * coordinates into a contiguous array and pay the noise cost four pixels
+ * at a time; fbm_noise3_batch keeps each octave vectorized too.
+ */
+
+static inline void
+noise3_batch(float *out, const Vec3 *points, size_t count)
+{
+#ifdef NOISE_SIMD
+    size_t n = count & ~(size_t) 3;
+    for (size_t b = 0; b < n; b += 4) {
+        float ax[4], ay[4], az[4];
+        for (int l = 0; l < 4; l++) {
+            ax[l] = points[b + l][0];
+            ay[l] = points[b + l][1];
+            az[l] = points[b + l][2];
+        }
+        vl_store4(&out[b], noise3_x4(vl_load4(ax), vl_load4(ay), vl_load4(az)));
+    }
+    for (size_t b = n; b < count; b++) {
+        out[b] = noise3(points[b]);
+    }
+#else
+    for (size_t b = 0; b < count; b++) {
+        out[b] = noise3(points[b]);
+    }
+#endif
+}
+
+static inline void
+fbm_noise3_batch(float *out, const Vec3 *points, size_t count, int octaves,
+    float persistence = 0.5, float lacunarity = 2.0)
+{
+#ifdef NOISE_SIMD
+    size_t n = count & ~(size_t) 3;
+    for (size_t b = 0; b < n; b += 4) {
+        float ax[4], ay[4], az[4];
+        for (int l = 0; l < 4; l++) {
+            ax[l] = points[b + l][0];
+            ay[l] = points[b + l][1];
+            az[l] = points[b + l][2];
+        }
+        VlFloat4 x = vl_load4(ax);
+        VlFloat4 y = vl_load4(ay);
+        VlFloat4 z = vl_load4(az);
+
+        float freq = 1.0f;
+        float amp = 1.0f;
+        float max = 1.0f;
+        VlFloat4 total = noise3_x4(x, y, z);
+
+        for (int i = 1; i < octaves; ++i) {
+            freq *= lacunarity;
+            amp *= persistence;
+            max += amp;
+            VlFloat4 vf = vl_splat4(freq);
+            total = vl_add4(total, vl_mul4(
+                noise3_x4(vl_mul4(x, vf), vl_mul4(y, vf), vl_mul4(z, vf)),
+                vl_splat4(amp)));
+        }
+        vl_store4(&out[b], vl_mul4(total, vl_splat4(1.0f / max)));
+    }
+    for (size_t b = n; b < count; b++) {
+        out[b] = fbm_noise3(points[b], octaves, persistence, lacunarity);
+    }
+#else
+    for (size_t b = 0; b < count; b++) {
+        out[b] = fbm_noise3(points[b], octaves, persistence, lacunarity);
+    }
+#endif
+}
+
 #define dot4(v1, x, y, z, w) ((v1)[0]*(x) + (v1)[1]*(y) + (v1)[2]*(z) + (v1)[3]*(w))
 
 #define F4 0.30901699437494745f /* (sqrt(5.0) - 1.0) / 4.0 */
@@ -362,11 +672,11 @@ noise4(float x, float y, float z, float w) {
     int J = (int)j & 255;
     int K = (int)k & 255;
     int L = (int)l & 255;
-    int gi0 = PERM[I + PERM[J + PERM[K + PERM[L]]]] & 0x1f;
-    int gi1 = PERM[I + i1 + PERM[J + j1 + PERM[K + k1 + PERM[L + l1]]]] & 0x1f; 
-    int gi2 = PERM[I + i2 + PERM[J + j2 + PERM[K + k2 + PERM[L + l2]]]] & 0x1f; 
-    int gi3 = PERM[I + i3 + PERM[J + j3 + PERM[K + k3 + PERM[L + l3]]]] & 0x1f; 
-    int gi4 = PERM[I + 1 + PERM[J + 1 + PERM[K + 1 + PERM[L + 1]]]] & 0x1f;
+    int gi0 = noise_gradient4(I, J, K, L);
+    int gi1 = noise_gradient4(I + i1, J + j1, K + k1, L + l1);
+    int gi2 = noise_gradient4(I + i2, J + j2, K + k2, L + l2);
+    int gi3 = noise_gradient4(I + i3, J + j3, K + k3, L + l3);
+    int gi4 = noise_gradient4(I + 1, J + 1, K + 1, L + 1);
     float t0, t1, t2, t3, t4;
 
     t0 = 0.6f - x0*x0 - y0*y0 - z0*z0 - w0*w0;
@@ -28,23 +28,40 @@
 #pragma once
 
 #include <vector>
+#include <string>
+#include <algorithm>
 #include <stdint.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <string.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <fcntl.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <netdb.h>
 #include <signal.h>
 
+#include "tinythread.h"
+
 
 class OPCClient {
 public:
     OPCClient();
     ~OPCClient();
 
+    /*
+     * Set the server. Normally "host[:port]"; the scheme "shm:PATH"
+     * selects fcserver's shared memory transport instead, naming the
+     * file its "shmListen" key maps. Pixel frames are then published
+     * straight into the mmap'd per-channel slots -- one memcpy, no
+     * socket, no syscalls -- while control messages, 16-bit frames, and
+     * every frame sent while the file isn't mapped by a server fall
+     * back to TCP on localhost transparently.
+     */
     bool resolve(const char *hostport, int defaultPort = 7890);
     bool write(const uint8_t *data, ssize_t length);
     bool write(const std::vector<uint8_t> &data);
@@ -52,6 +69,41 @@ public:
     bool tryConnect();
     bool isConnected();
 
+    /*
+     * Non-blocking mode. write() copies the frame into a pending buffer
+     * and returns immediately; a background thread owns the socket,
+     * transmits the most recent frame, and reconnects when the server
+     * goes away. If the socket backs up, older pending frames are
+     * dropped in favor of the latest one rather than stalling the
+     * caller, so a server restart never freezes the effect process.
+     *
+     * Enable this before streaming starts; in this mode tryConnect()
+     * always reports success, since the connection is managed in the
+     * background and effects should keep rendering regardless.
+     */
+    void setNonBlocking(bool enable = true);
+
+    // Frames dropped so far in non-blocking mode
+    unsigned framesDropped() const;
+
+    /*
+     * Sharded multi-server output, for installations that span several
+     * fcserver hosts. addShard() registers a server along with the range
+     * of framebuffer pixels it owns. Each shard keeps its own socket and
+     * sender thread, so write() just slices the SET_PIXEL_COLORS message
+     * into per-shard messages and the slices go out over all sockets in
+     * parallel; a slow or absent node drops its own frames (latest wins)
+     * without stalling the caller or the other nodes.
+     *
+     * Once any shard is registered, the single resolve()d server is no
+     * longer used and tryConnect() always reports success. Pixels outside
+     * every shard's range are not transmitted. A non-negative 'channel'
+     * retags the shard's messages, for fan-in through an OPC merger;
+     * by default the incoming message's channel is kept.
+     */
+    bool addShard(const char *hostport, unsigned firstPixel, unsigned pixelCount,
+        int channel = -1, int defaultPort = 7890);
+
     struct Header {
         uint8_t channel;
         uint8_t command;
@@ -82,12 +134,90 @@ public:
 
     // Commands
     static const uint8_t SET_PIXEL_COLORS = 0;
+    static const uint8_t SYSTEM_EXCLUSIVE = 0xFF;
+
+    /*
+     * Fadecandy SysEx ID for 16-bit SetPixelColors: the message data is
+     * this ID as four big-endian bytes, then six bytes per pixel (R, G, B
+     * as big-endian uint16). See initSysEx16() for assembling the header.
+     */
+    static const uint32_t FC_SET_PIXEL_COLORS_16 = 0x00010007;
+    static const unsigned SYSEX_ID_BYTES = 4;
+
+    // Write an FC_SET_PIXEL_COLORS_16 header and SysEx ID into 'data',
+    // which must already be sized for the header, ID, and pixels.
+    static void initSysEx16(std::vector<uint8_t> &data, uint8_t channel, unsigned pixels) {
+        Header::view(data).init(channel, SYSTEM_EXCLUSIVE,
+            SYSEX_ID_BYTES + pixels * 6);
+        uint8_t *id = Header::view(data).data();
+        id[0] = uint8_t((FC_SET_PIXEL_COLORS_16 >> 24) & 0xFF);
+        id[1] = uint8_t((FC_SET_PIXEL_COLORS_16 >> 16) & 0xFF);
+        id[2] = uint8_t((FC_SET_PIXEL_COLORS_16 >> 8) & 0xFF);
+        id[3] = uint8_t(FC_SET_PIXEL_COLORS_16 & 0xFF);
+    }
 
 private:
     int fd;
     struct sockaddr_in address;
     bool connectSocket();
     void closeSocket();
+    bool sendAll(const uint8_t *data, ssize_t length);
+
+    // Non-blocking mode: a pending/sending buffer pair, both holding
+    // their capacity after the first frame so steady-state writes don't
+    // allocate. The producer overwrites the pending slot (latest wins)
+    // and the sender thread swaps it out for transmission.
+    bool nonBlocking;
+    tthread::thread *sender;
+    tthread::mutex sendMutex;
+    tthread::condition_variable sendBegin;
+    std::vector<uint8_t> pendingFrame;
+    std::vector<uint8_t> sendingFrame;
+    bool framePending;
+    bool senderExit;
+    unsigned droppedFrames;
+
+    // One per-shard client and pixel range, plus a scratch buffer for
+    // assembling that shard's slice of the frame
+    struct Shard {
+        OPCClient *client;
+        unsigned firstPixel;
+        unsigned pixelCount;
+        int channel;
+        std::vector<uint8_t> message;
+    };
+    std::vector<Shard*> shards;
+
+    /*
+     * Shared memory transport. The file layout must match ShmServer in
+     * server/src/shmserver.h: a header, then one seqlock'd latest-frame
+     * slot per OPC channel. The writer protocol is documented there.
+     */
+    struct ShmHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t channelCount;
+        uint32_t slotBytes;
+    };
+    struct ShmSlot {
+        volatile uint32_t sequence;     // Odd while a writer is mid-update
+        volatile uint32_t frameCount;   // Bumped once per published frame
+        volatile uint32_t length;       // Pixel data bytes in this frame
+        uint32_t reserved;
+        uint8_t data[0xFFFF + 1];
+    };
+    static const uint32_t SHM_MAGIC = 0x46435348;   // "FCSH"
+    static const uint32_t SHM_VERSION = 1;
+
+    std::string shmPath;    // Empty when the transport isn't selected
+    uint8_t *shmBase;
+    size_t shmSize;
+    struct timeval shmRetry;
+
+    bool tryMapShm();
+    bool writeShm(const uint8_t *data, ssize_t length);
+
+    static void senderThreadFunc(void *arg);
 };
 
 
@@ -100,11 +230,39 @@ inline OPCClient::OPCClient()
 {
     fd = -1;
     memset(&address, 0, sizeof address);
+
+    nonBlocking = false;
+    sender = 0;
+    framePending = false;
+    senderExit = false;
+    droppedFrames = 0;
+
+    shmBase = 0;
+    shmSize = 0;
+    memset(&shmRetry, 0, sizeof shmRetry);
 }
 
 inline OPCClient::~OPCClient()
 {
+    if (sender) {
+        sendMutex.lock();
+        senderExit = true;
+        sendBegin.notify_all();
+        sendMutex.unlock();
+
+        sender->join();
+        delete sender;
+    }
     closeSocket();
+
+    if (shmBase) {
+        munmap(shmBase, shmSize);
+    }
+
+    for (unsigned i = 0; i < shards.size(); i++) {
+        delete shards[i]->client;
+        delete shards[i];
+    }
 }
 
 inline void OPCClient::closeSocket()
@@ -117,6 +275,14 @@ inline void OPCClient::closeSocket()
 
 inline bool OPCClient::resolve(const char *hostport, int defaultPort)
 {
+    if (!strncmp(hostport, "shm:", 4)) {
+        // Shared memory transport; TCP to localhost stays resolved as
+        // the fallback and control path.
+        shmPath = hostport + 4;
+        tryMapShm();
+        return resolve("localhost", defaultPort);
+    }
+
     fd = -1;
 
     char *host = strdup(hostport);
@@ -155,15 +321,228 @@ inline bool OPCClient::isConnected()
 
 inline bool OPCClient::tryConnect()
 {
+    if (nonBlocking || !shards.empty()) {
+        // The sender threads own the sockets and reconnect as needed
+        return true;
+    }
+    if (shmBase) {
+        // Pixel frames go through shared memory; the socket is only the
+        // fallback and control path, so don't gate rendering on it.
+        return true;
+    }
     return isConnected() || connectSocket();
 }
 
+inline bool OPCClient::addShard(const char *hostport, unsigned firstPixel,
+    unsigned pixelCount, int channel, int defaultPort)
+{
+    Shard *shard = new Shard;
+    shard->client = new OPCClient;
+    shard->firstPixel = firstPixel;
+    shard->pixelCount = pixelCount;
+    shard->channel = channel;
+
+    if (!shard->client->resolve(hostport, defaultPort)) {
+        delete shard->client;
+        delete shard;
+        return false;
+    }
+
+    // Each shard transmits independently; a stalled node drops its own
+    // frames instead of holding up the rest of the installation.
+    shard->client->setNonBlocking();
+
+    shards.push_back(shard);
+    return true;
+}
+
+inline void OPCClient::setNonBlocking(bool enable)
+{
+    nonBlocking = enable;
+}
+
+inline unsigned OPCClient::framesDropped() const
+{
+    unsigned total = droppedFrames;
+    for (unsigned i = 0; i < shards.size(); i++) {
+        total += shards[i]->client->framesDropped();
+    }
+    return total;
+}
+
 inline bool OPCClient::write(const uint8_t *data, ssize_t length)
 {
+    if (!shmPath.empty() && writeShm(data, length)) {
+        // Published into the shared memory slot; nothing hits the socket
+        return true;
+    }
+
+    if (!shards.empty() && length >= (ssize_t)sizeof(Header) &&
+        data[1] == SET_PIXEL_COLORS) {
+
+        // Slice the frame into one message per shard; each shard's sender
+        // thread writes its socket concurrently with the others.
+        unsigned framePixels = (length - sizeof(Header)) / 3;
+        bool ok = true;
+
+        for (unsigned s = 0; s < shards.size(); s++) {
+            Shard &shard = *shards[s];
+            if (shard.firstPixel >= framePixels) {
+                continue;
+            }
+            unsigned count = std::min(shard.pixelCount, framePixels - shard.firstPixel);
+
+            uint8_t channel = shard.channel >= 0 ? shard.channel : data[0];
+            shard.message.resize(sizeof(Header) + count * 3);
+            Header::view(shard.message).init(channel, SET_PIXEL_COLORS, count * 3);
+            memcpy(Header::view(shard.message).data(),
+                data + sizeof(Header) + shard.firstPixel * 3, count * 3);
+
+            ok &= shard.client->write(shard.message);
+        }
+        return ok;
+    }
+
+    if (!shards.empty() && length >= (ssize_t)(sizeof(Header) + SYSEX_ID_BYTES) &&
+        data[1] == SYSTEM_EXCLUSIVE &&
+        data[4] == uint8_t((FC_SET_PIXEL_COLORS_16 >> 24) & 0xFF) &&
+        data[5] == uint8_t((FC_SET_PIXEL_COLORS_16 >> 16) & 0xFF) &&
+        data[6] == uint8_t((FC_SET_PIXEL_COLORS_16 >> 8) & 0xFF) &&
+        data[7] == uint8_t(FC_SET_PIXEL_COLORS_16 & 0xFF)) {
+
+        // 16-bit frame; same slicing with six-byte pixels and the SysEx
+        // ID repeated in front of every slice.
+        unsigned framePixels = (length - sizeof(Header) - SYSEX_ID_BYTES) / 6;
+        bool ok = true;
+
+        for (unsigned s = 0; s < shards.size(); s++) {
+            Shard &shard = *shards[s];
+            if (shard.firstPixel >= framePixels) {
+                continue;
+            }
+            unsigned count = std::min(shard.pixelCount, framePixels - shard.firstPixel);
+
+            uint8_t channel = shard.channel >= 0 ? shard.channel : data[0];
+            shard.message.resize(sizeof(Header) + SYSEX_ID_BYTES + count * 6);
+            initSysEx16(shard.message, channel, count);
+            memcpy(Header::view(shard.message).data() + SYSEX_ID_BYTES,
+                data + sizeof(Header) + SYSEX_ID_BYTES + shard.firstPixel * 6, count * 6);
+
+            ok &= shard.client->write(shard.message);
+        }
+        return ok;
+    }
+
+    if (nonBlocking) {
+        if (!sender) {
+            sender = new tthread::thread(senderThreadFunc, this);
+        }
+
+        sendMutex.lock();
+        if (framePending) {
+            // Sender hasn't picked up the last frame yet; latest wins
+            droppedFrames++;
+        }
+        pendingFrame.assign(data, data + length);
+        framePending = true;
+        sendBegin.notify_all();
+        sendMutex.unlock();
+        return true;
+    }
+
     if (!tryConnect()) {
         return false;
     }
+    return sendAll(data, length);
+}
+
+inline bool OPCClient::tryMapShm()
+{
+    /*
+     * Map the server's shared memory file, validating its header. The
+     * server creates and initializes the file when it starts, so an
+     * absent file or a zeroed header simply means no server is mapping
+     * it yet and we stay on TCP.
+     */
+
+    int file = open(shmPath.c_str(), O_RDWR);
+    if (file < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(file, &st) < 0 || (size_t)st.st_size < sizeof(ShmHeader)) {
+        close(file);
+        return false;
+    }
+
+    void *mapping = mmap(0, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    close(file);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    ShmHeader *header = (ShmHeader*) mapping;
+    if (header->magic != SHM_MAGIC || header->version != SHM_VERSION ||
+        header->slotBytes != sizeof(ShmSlot) ||
+        sizeof(ShmHeader) + (size_t)header->channelCount * header->slotBytes
+            > (size_t)st.st_size) {
+        munmap(mapping, st.st_size);
+        return false;
+    }
+
+    shmBase = (uint8_t*) mapping;
+    shmSize = st.st_size;
+    return true;
+}
+
+inline bool OPCClient::writeShm(const uint8_t *data, ssize_t length)
+{
+    // Only 8-bit pixel frames fit the slot protocol; anything else goes
+    // over the socket.
+    if (length < (ssize_t)sizeof(Header) || data[1] != SET_PIXEL_COLORS) {
+        return false;
+    }
+
+    if (!shmBase) {
+        // Probe for the server's mapping at most once a second
+        struct timeval now;
+        gettimeofday(&now, 0);
+        if (now.tv_sec == shmRetry.tv_sec) {
+            return false;
+        }
+        shmRetry = now;
+        if (!tryMapShm()) {
+            return false;
+        }
+    }
+
+    ShmHeader *header = (ShmHeader*) shmBase;
+    unsigned channel = data[0];
+    unsigned pixelBytes = ((unsigned)data[2] << 8) | data[3];
+
+    if (channel >= header->channelCount ||
+        (ssize_t)(sizeof(Header) + pixelBytes) > length) {
+        return false;
+    }
+
+    ShmSlot *slot = (ShmSlot*)
+        (shmBase + sizeof(ShmHeader) + (size_t)channel * header->slotBytes);
+
+    // Seqlock writer protocol; see ShmServer in server/src/shmserver.h
+    slot->sequence++;
+    __sync_synchronize();
+    slot->length = pixelBytes;
+    memcpy(slot->data, data + sizeof(Header), pixelBytes);
+    __sync_synchronize();
+    slot->sequence++;
+    slot->frameCount++;
 
+    return true;
+}
+
+inline bool OPCClient::sendAll(const uint8_t *data, ssize_t length)
+{
     while (length > 0) {
         int result = send(fd, data, length, 0);
         if (result <= 0) {
@@ -177,6 +556,33 @@ inline bool OPCClient::write(const uint8_t *data, ssize_t length)
     return true;
 }
 
+inline void OPCClient::senderThreadFunc(void *arg)
+{
+    OPCClient *self = (OPCClient*) arg;
+
+    self->sendMutex.lock();
+    while (!self->senderExit) {
+        if (!self->framePending) {
+            self->sendBegin.wait(self->sendMutex);
+            continue;
+        }
+        self->sendingFrame.swap(self->pendingFrame);
+        self->framePending = false;
+        self->sendMutex.unlock();
+
+        if (self->isConnected() || self->connectSocket()) {
+            self->sendAll(&self->sendingFrame[0], self->sendingFrame.size());
+        } else {
+            // Server's away; don't spin against it. A fresh frame will
+            // be waiting when we retry.
+            usleep(100000);
+        }
+
+        self->sendMutex.lock();
+    }
+    self->sendMutex.unlock();
+}
+
 inline bool OPCClient::write(const std::vector<uint8_t> &data)
 {
     return write(&data[0], data.size());
@@ -28,7 +28,6 @@
 #pragma once
 
 #include "effect.h"
-#include "nanoflann.h"  // Tiny KD-tree library
 
 
 class ParticleEffect : public Effect {
@@ -73,27 +72,51 @@ protected:
     float sampleIntensity(ResultSet_t &hits, Vec3 point) const;
 
     /*
-     * KD-tree as a spatial index for finding particles quickly by location.
-     * This index is rebuilt each frame during ParticleEffect::buildFrame().
-     * The ParticleEffect itself uses this index for calculating pixel values,
-     * but subclasses may also want to use it for phyiscs or interaction.
+     * Uniform spatial hash grid as a spatial index for finding particles
+     * quickly by location. The grid is fixed to the layout's bounding box
+     * the first time beginFrame() runs, and every pixel is bucketed into
+     * its cell at the same time. The per-cell particle lists are rebuilt
+     * each frame in O(particles); each particle lands in every cell its
+     * support sphere touches, so the shader only has to walk the pixel's
+     * own cell. The ParticleEffect itself uses this index for calculating
+     * pixel values, but subclasses may also want to use it for physics
+     * or interaction.
      */
 
-    typedef nanoflann::KDTreeSingleIndexAdaptor<
-        nanoflann::L2_Simple_Adaptor< Real, ParticleEffect >,
-        ParticleEffect, 3> IndexTree;
-
     struct Index {
         Index(ParticleEffect &e);
 
+        // Bind the grid to a layout and bucket every pixel; no-op after the first call
+        void setup(const FrameInfo &f);
+
+        // Rebuild the per-cell particle lists from the current appearance
+        void rebuild();
+
+        // Particles whose centers lie within 'radius' of 'point'
         void radiusSearch(ResultSet_t& hits, Vec3 point, float radius) const;
+
+        // All particles whose support sphere overlaps the cell containing
+        // 'point': a superset of the particles that can affect it, with
+        // distances measured to particle centers. The sampling kernels
+        // reject anything out of range.
         void radiusSearch(ResultSet_t& hits, Vec3 point) const;
+        void cellSearch(ResultSet_t& hits, Vec3 point, int cell) const;
+
+        int cellOf(Vec3 point) const;
 
         Vec3 aabbMin;
         Vec3 aabbMax;
         float radiusMax;
-        IndexTree tree;
-        bool treeIsValid;
+
+        const AppearanceVector &particles;
+        Vec3 gridOrigin;
+        float cellSize, invCellSize;
+        int dims[3];
+        bool gridReady;
+        bool listsValid;
+        std::vector<int> pixelCell;         // Pixel index -> grid cell
+        std::vector<unsigned> cellOffsets;  // CSR offsets, numCells + 1 entries
+        std::vector<unsigned> cellParticles;
     } index;
 
     /*
@@ -109,40 +132,6 @@ protected:
 
     // First derivative of kernel()
     static float kernelDerivative(float q);
-
-public:
-    // Implementation glue for our KD-tree index
-
-    inline size_t kdtree_get_point_count() const
-    {
-        return appearance.size();
-    }
-
-    inline Real kdtree_distance(const Real *p1, const size_t idx_p2, size_t size) const
-    {
-        const ParticleAppearance &a = appearance[idx_p2];
-        Real d0 = p1[0] - a.point[0];
-        Real d1 = p1[1] - a.point[1];
-        Real d2 = p1[2] - a.point[2];
-        return sq(d0) + sq(d1) + sq(d2);
-    }
-
-    Real kdtree_get_pt(const size_t idx, int dim) const
-    {
-        return appearance[idx].point[dim];
-    }
-
-    template <class BBOX>
-    bool kdtree_get_bbox(BBOX &bb) const
-    {
-        bb[0].low  = index.aabbMin[0];
-        bb[1].low  = index.aabbMin[1];
-        bb[2].low  = index.aabbMin[2];
-        bb[0].high = index.aabbMax[0];
-        bb[1].high = index.aabbMax[1];
-        bb[2].high = index.aabbMax[2];
-        return true;
-    }
 };
 
 
@@ -159,24 +148,173 @@ inline ParticleEffect::Index::Index(ParticleEffect& e)
     : aabbMin(0, 0, 0),
       aabbMax(0, 0, 0),
       radiusMax(0),
-      tree(3, e),
-      treeIsValid(false)
-{}
+      particles(e.appearance),
+      gridOrigin(0, 0, 0),
+      cellSize(1),
+      invCellSize(1),
+      gridReady(false),
+      listsValid(false)
+{
+    dims[0] = dims[1] = dims[2] = 1;
+}
 
-inline void ParticleEffect::Index::radiusSearch(ResultSet_t& hits, Vec3 point, float radius) const
+inline void ParticleEffect::Index::setup(const FrameInfo &f)
+{
+    if (gridReady && pixelCell.size() == f.pixels.size()) {
+        return;
+    }
+
+    // Cell size scales with the model; roughly eight cells across the
+    // radius keeps the lists short without ballooning the insertion cost
+    // for large particles.
+    cellSize = std::max<float>(1e-6, f.modelRadius / 8.0f);
+    invCellSize = 1.0f / cellSize;
+    gridOrigin = f.modelMin;
+
+    for (int a = 0; a < 3; a++) {
+        dims[a] = std::max<int>(1, std::min<int>(64,
+            int((f.modelMax[a] - f.modelMin[a]) * invCellSize) + 1));
+    }
+
+    // Bucket every pixel once; the grid never moves after this
+    pixelCell.resize(f.pixels.size());
+    for (unsigned i = 0; i < f.pixels.size(); i++) {
+        pixelCell[i] = cellOf(f.pixels[i].point);
+    }
+
+    cellOffsets.assign(dims[0] * dims[1] * dims[2] + 1, 0);
+    gridReady = true;
+    listsValid = false;
+}
+
+inline int ParticleEffect::Index::cellOf(Vec3 point) const
 {
-    if (treeIsValid) {
-        nanoflann::SearchParams params;
-        params.sorted = false;
-        tree.radiusSearch(&point[0], radius * radius, hits, params);
+    int c[3];
+    for (int a = 0; a < 3; a++) {
+        int i = int((point[a] - gridOrigin[a]) * invCellSize);
+        c[a] = std::max<int>(0, std::min<int>(dims[a] - 1, i));
+    }
+    return (c[2] * dims[1] + c[1]) * dims[0] + c[0];
+}
+
+inline void ParticleEffect::Index::rebuild()
+{
+    listsValid = false;
+    if (!gridReady) {
+        return;
+    }
+
+    std::fill(cellOffsets.begin(), cellOffsets.end(), 0);
+    if (particles.empty()) {
+        cellParticles.clear();
+        return;
+    }
+
+    // Each particle goes in every cell its support sphere touches.
+    // Count first, then prefix-sum into CSR offsets, then fill.
+
+    for (unsigned i = 0; i < particles.size(); i++) {
+        const ParticleAppearance &particle = particles[i];
+        int lo[3], hi[3];
+        for (int a = 0; a < 3; a++) {
+            lo[a] = std::max<int>(0, std::min<int>(dims[a] - 1,
+                int((particle.point[a] - particle.radius - gridOrigin[a]) * invCellSize)));
+            hi[a] = std::max<int>(0, std::min<int>(dims[a] - 1,
+                int((particle.point[a] + particle.radius - gridOrigin[a]) * invCellSize)));
+        }
+        for (int z = lo[2]; z <= hi[2]; z++)
+            for (int y = lo[1]; y <= hi[1]; y++)
+                for (int x = lo[0]; x <= hi[0]; x++)
+                    cellOffsets[(z * dims[1] + y) * dims[0] + x + 1]++;
+    }
+
+    for (unsigned c = 1; c < cellOffsets.size(); c++) {
+        cellOffsets[c] += cellOffsets[c - 1];
+    }
+    cellParticles.resize(cellOffsets.back());
+
+    std::vector<unsigned> fill(cellOffsets.begin(), cellOffsets.end() - 1);
+    for (unsigned i = 0; i < particles.size(); i++) {
+        const ParticleAppearance &particle = particles[i];
+        int lo[3], hi[3];
+        for (int a = 0; a < 3; a++) {
+            lo[a] = std::max<int>(0, std::min<int>(dims[a] - 1,
+                int((particle.point[a] - particle.radius - gridOrigin[a]) * invCellSize)));
+            hi[a] = std::max<int>(0, std::min<int>(dims[a] - 1,
+                int((particle.point[a] + particle.radius - gridOrigin[a]) * invCellSize)));
+        }
+        for (int z = lo[2]; z <= hi[2]; z++)
+            for (int y = lo[1]; y <= hi[1]; y++)
+                for (int x = lo[0]; x <= hi[0]; x++)
+                    cellParticles[fill[(z * dims[1] + y) * dims[0] + x]++] = i;
+    }
+
+    listsValid = true;
+}
+
+inline void ParticleEffect::Index::cellSearch(ResultSet_t& hits, Vec3 point, int cell) const
+{
+    hits.clear();
+    if (!listsValid) {
+        return;
+    }
+
+    for (unsigned j = cellOffsets[cell]; j < cellOffsets[cell + 1]; j++) {
+        unsigned idx = cellParticles[j];
+        hits.push_back(std::make_pair((size_t)idx,
+            (Real)sqrlen(point - particles[idx].point)));
+    }
+}
+
+inline void ParticleEffect::Index::radiusSearch(ResultSet_t& hits, Vec3 point) const
+{
+    if (listsValid) {
+        cellSearch(hits, point, cellOf(point));
     } else {
         hits.clear();
     }
 }
 
-inline void ParticleEffect::Index::radiusSearch(ResultSet_t& hits, Vec3 point) const
+inline void ParticleEffect::Index::radiusSearch(ResultSet_t& hits, Vec3 point, float radius) const
 {
-    radiusSearch(hits, point, radiusMax);
+    hits.clear();
+    if (!listsValid) {
+        return;
+    }
+
+    // Scan every cell the search sphere's box overlaps. Particles can be
+    // listed in several of those cells, so collect, sort and deduplicate
+    // candidates before filtering on the actual distance.
+
+    int lo[3], hi[3];
+    for (int a = 0; a < 3; a++) {
+        lo[a] = std::max<int>(0, std::min<int>(dims[a] - 1,
+            int((point[a] - radius - gridOrigin[a]) * invCellSize)));
+        hi[a] = std::max<int>(0, std::min<int>(dims[a] - 1,
+            int((point[a] + radius - gridOrigin[a]) * invCellSize)));
+    }
+
+    std::vector<unsigned> candidates;
+    for (int z = lo[2]; z <= hi[2]; z++)
+        for (int y = lo[1]; y <= hi[1]; y++)
+            for (int x = lo[0]; x <= hi[0]; x++) {
+                int cell = (z * dims[1] + y) * dims[0] + x;
+                candidates.insert(candidates.end(),
+                    cellParticles.begin() + cellOffsets[cell],
+                    cellParticles.begin() + cellOffsets[cell + 1]);
+            }
+    std::sort(candidates.begin(), candidates.end());
+
+    float r2 = radius * radius;
+    for (unsigned i = 0; i < candidates.size(); i++) {
+        if (i && candidates[i] == candidates[i - 1]) {
+            continue;
+        }
+        float dist2 = sqrlen(point - particles[candidates[i]].point);
+        if (dist2 <= r2) {
+            hits.push_back(std::make_pair((size_t)candidates[i], (Real)dist2));
+        }
+    }
 }
 
 inline float ParticleEffect::kernel(float q)
@@ -199,6 +337,7 @@ inline float ParticleEffect::kernelDerivative(float q)
 
 inline void ParticleEffect::beginFrame(const FrameInfo& f)
 {
+    index.setup(f);
     buildIndex();
 }
 
@@ -209,7 +348,6 @@ inline void ParticleEffect::buildIndex()
         index.aabbMin = Vec3(0, 0, 0);
         index.aabbMax = Vec3(0, 0, 0);
         index.radiusMax = 0;
-        index.treeIsValid = false;
 
     } else {
         // Measure bounding box and largest radius in 'particles'
@@ -218,27 +356,33 @@ inline void ParticleEffect::buildIndex()
         index.radiusMax = appearance[0].radius;
         for (unsigned i = 1; i < appearance.size(); ++i) {
             const ParticleAppearance& particle = appearance[i];
-            
+
             index.aabbMin[0] = std::min(index.aabbMin[0], particle.point[0]);
             index.aabbMin[1] = std::min(index.aabbMin[1], particle.point[1]);
             index.aabbMin[2] = std::min(index.aabbMin[2], particle.point[2]);
-            
+
             index.aabbMax[0] = std::max(index.aabbMax[0], particle.point[0]);
             index.aabbMax[1] = std::max(index.aabbMax[1], particle.point[1]);
             index.aabbMax[2] = std::max(index.aabbMax[2], particle.point[2]);
-            
+
             index.radiusMax = std::max(index.radiusMax, particle.radius);
         }
-
-        // Rebuild KD-tree. Fails if we have zero particles.
-        index.tree.buildIndex();
-        index.treeIsValid = true;
     }
+
+    // Rebuild the per-cell particle lists
+    index.rebuild();
 }
 
 inline void ParticleEffect::shader(Vec3& rgb, const PixelInfo& p) const
 {
-    rgb = sampleColor(p.point);
+    // Use the pixel's statically assigned cell when it has one
+    ResultSet_t hits;
+    if (p.index < index.pixelCell.size()) {
+        index.cellSearch(hits, p.point, index.pixelCell[p.index]);
+    } else {
+        index.radiusSearch(hits, p.point);
+    }
+    rgb = sampleColor(hits);
 }
 
 inline Vec3 ParticleEffect::sampleColor(Vec3 location) const
@@ -332,7 +476,8 @@ inline Vec3 ParticleEffect::sampleIntensityGradient(Vec3 location, float epsilon
 
 inline void ParticleEffect::debug(const DebugInfo& d)
 {
-    fprintf(stderr, "\t[particle] %.1f kB, radiusMax = %.1f\n",
-        index.tree.usedMemory() / 1024.0f,
+    fprintf(stderr, "\t[particle] %d cells, %d entries, radiusMax = %.1f\n",
+        index.dims[0] * index.dims[1] * index.dims[2],
+        (int)index.cellParticles.size(),
         index.radiusMax);
 }
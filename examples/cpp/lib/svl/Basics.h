@@ -20,6 +20,8 @@
                                       are the default.)
                     VL_NO_BOOL      - There is no bool type.
                     VL_NO_TF        - true and false are not predefined.
+                    VL_NO_SIMD      - Use portable scalar code even when
+                                      SSE or NEON is available.
 */
 
 #pragma once
@@ -49,6 +51,69 @@ typedef Float           Real;
 #define SELF (*this)    // A syntactic convenience.
 
 
+// --- SIMD support ------------------------------------------------------------
+
+/*
+    When the target has SSE (x86) or NEON (ARM) and Real is float, the hot
+    Vec3 operations in Vec3.h have vectorized implementations. Vec3 is
+    padded from three to four elements there so whole-register loads and
+    stores stay inside the object; the fourth lane is computed but never
+    observed. Define VL_NO_SIMD to force the scalar code everywhere.
+*/
+
+#ifndef VL_NO_SIMD
+#ifndef VL_DOUBLE
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define VL_SIMD_SSE 1
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define VL_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+#endif
+#endif
+
+#if defined(VL_SIMD_SSE) || defined(VL_SIMD_NEON)
+#define VL_SIMD 1
+
+// Four-lane float primitives shared by the specializations in Vec3.h
+
+#ifdef VL_SIMD_SSE
+typedef __m128 VlFloat4;
+#define vl_load4(p)         _mm_loadu_ps(p)
+#define vl_store4(p, v)     _mm_storeu_ps(p, v)
+#define vl_add4(a, b)       _mm_add_ps(a, b)
+#define vl_sub4(a, b)       _mm_sub_ps(a, b)
+#define vl_mul4(a, b)       _mm_mul_ps(a, b)
+#define vl_min4(a, b)       _mm_min_ps(a, b)
+#define vl_max4(a, b)       _mm_max_ps(a, b)
+#define vl_splat4(s)        _mm_set1_ps(s)
+#else
+typedef float32x4_t VlFloat4;
+#define vl_load4(p)         vld1q_f32(p)
+#define vl_store4(p, v)     vst1q_f32(p, v)
+#define vl_add4(a, b)       vaddq_f32(a, b)
+#define vl_sub4(a, b)       vsubq_f32(a, b)
+#define vl_mul4(a, b)       vmulq_f32(a, b)
+#define vl_min4(a, b)       vminq_f32(a, b)
+#define vl_max4(a, b)       vmaxq_f32(a, b)
+#define vl_splat4(s)        vdupq_n_f32(s)
+#endif
+
+// Sum of the low three lanes, for dot products
+inline Real vl_sum3(VlFloat4 v)
+{
+#ifdef VL_SIMD_SSE
+    __m128 t = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+    t = _mm_add_ss(t, _mm_movehl_ps(v, v));
+    return(_mm_cvtss_f32(t));
+#else
+    return(vgetq_lane_f32(v, 0) + vgetq_lane_f32(v, 1) + vgetq_lane_f32(v, 2));
+#endif
+}
+#endif
+
+
 // --- Boolean type ------------------------------------------------------------
 
 // X11 #defines 'Bool' -- typical.
@@ -77,7 +77,13 @@ public:
 
 protected:
 
+#ifdef VL_SIMD
+    // Padded so whole-register loads and stores stay inside the object;
+    // the fourth element is never observed. See Basics.h.
+    Real elt[4];
+#else
     Real elt[3];
+#endif
 };
 
 
@@ -123,9 +129,13 @@ inline Vec3::Vec3(Real x, Real y, Real z)
 
 inline Vec3::Vec3(const Vec3 &v)
 {
+#ifdef VL_SIMD
+    vl_store4(elt, vl_load4(v.elt));
+#else
     elt[0] = v[0];
     elt[1] = v[1];
     elt[2] = v[2];
+#endif
 }
 
 inline Vec3::Vec3(const Vec2 &v, Real w)
@@ -142,45 +152,65 @@ inline Real *Vec3::Ref() const
 
 inline Vec3 &Vec3::operator = (const Vec3 &v)
 {
+#ifdef VL_SIMD
+    vl_store4(elt, vl_load4(v.elt));
+#else
     elt[0] = v[0];
     elt[1] = v[1];
     elt[2] = v[2];
+#endif
 
     return(SELF);
 }
 
 inline Vec3 &Vec3::operator += (const Vec3 &v)
 {
+#ifdef VL_SIMD
+    vl_store4(elt, vl_add4(vl_load4(elt), vl_load4(v.elt)));
+#else
     elt[0] += v[0];
     elt[1] += v[1];
     elt[2] += v[2];
+#endif
 
     return(SELF);
 }
 
 inline Vec3 &Vec3::operator -= (const Vec3 &v)
 {
+#ifdef VL_SIMD
+    vl_store4(elt, vl_sub4(vl_load4(elt), vl_load4(v.elt)));
+#else
     elt[0] -= v[0];
     elt[1] -= v[1];
     elt[2] -= v[2];
+#endif
 
     return(SELF);
 }
 
 inline Vec3 &Vec3::operator *= (const Vec3 &a)
 {
+#ifdef VL_SIMD
+    vl_store4(elt, vl_mul4(vl_load4(elt), vl_load4(a.elt)));
+#else
     elt[0] *= a[0];
     elt[1] *= a[1];
     elt[2] *= a[2];
+#endif
 
     return(SELF);
 }
 
 inline Vec3 &Vec3::operator *= (Real s)
 {
+#ifdef VL_SIMD
+    vl_store4(elt, vl_mul4(vl_load4(elt), vl_splat4(s)));
+#else
     elt[0] *= s;
     elt[1] *= s;
     elt[2] *= s;
+#endif
 
     return(SELF);
 }
@@ -196,9 +226,15 @@ inline Vec3 &Vec3::operator /= (const Vec3 &a)
 
 inline Vec3 &Vec3::operator /= (Real s)
 {
+#ifdef VL_SIMD
+    // Multiply by the reciprocal: NEON has no lane divide, and with
+    // -ffast-math this is what the scalar code compiles to anyway.
+    vl_store4(elt, vl_mul4(vl_load4(elt), vl_splat4(vl_one / s)));
+#else
     elt[0] /= s;
     elt[1] /= s;
     elt[2] /= s;
+#endif
 
     return(SELF);
 }
@@ -207,9 +243,13 @@ inline Vec3 Vec3::operator + (const Vec3 &a) const
 {
     Vec3 result;
 
+#ifdef VL_SIMD
+    vl_store4(result.elt, vl_add4(vl_load4(elt), vl_load4(a.elt)));
+#else
     result[0] = elt[0] + a[0];
     result[1] = elt[1] + a[1];
     result[2] = elt[2] + a[2];
+#endif
 
     return(result);
 }
@@ -218,9 +258,13 @@ inline Vec3 Vec3::operator - (const Vec3 &a) const
 {
     Vec3 result;
 
+#ifdef VL_SIMD
+    vl_store4(result.elt, vl_sub4(vl_load4(elt), vl_load4(a.elt)));
+#else
     result[0] = elt[0] - a[0];
     result[1] = elt[1] - a[1];
     result[2] = elt[2] - a[2];
+#endif
 
     return(result);
 }
@@ -240,9 +284,13 @@ inline Vec3 Vec3::operator * (const Vec3 &a) const
 {
     Vec3 result;
 
+#ifdef VL_SIMD
+    vl_store4(result.elt, vl_mul4(vl_load4(elt), vl_load4(a.elt)));
+#else
     result[0] = elt[0] * a[0];
     result[1] = elt[1] * a[1];
     result[2] = elt[2] * a[2];
+#endif
 
     return(result);
 }
@@ -251,9 +299,13 @@ inline Vec3 Vec3::operator * (Real s) const
 {
     Vec3 result;
 
+#ifdef VL_SIMD
+    vl_store4(result.elt, vl_mul4(vl_load4(elt), vl_splat4(s)));
+#else
     result[0] = elt[0] * s;
     result[1] = elt[1] * s;
     result[2] = elt[2] * s;
+#endif
 
     return(result);
 }
@@ -273,9 +325,14 @@ inline Vec3 Vec3::operator / (Real s) const
 {
     Vec3 result;
 
+#ifdef VL_SIMD
+    // Reciprocal multiply; see operator /=
+    vl_store4(result.elt, vl_mul4(vl_load4(elt), vl_splat4(vl_one / s)));
+#else
     result[0] = elt[0] / s;
     result[1] = elt[1] / s;
     result[2] = elt[2] / s;
+#endif
 
     return(result);
 }
@@ -363,7 +420,11 @@ inline Bool Vec3::operator >= (const Vec3 &a) const
 
 inline Real dot(const Vec3 &a, const Vec3 &b)
 {
+#ifdef VL_SIMD
+    return(vl_sum3(vl_mul4(vl_load4(a.Ref()), vl_load4(b.Ref()))));
+#else
     return(a[0] * b[0] + a[1] * b[1] + a[2] * b[2]);
+#endif
 }
 
 inline Real len(const Vec3 &v)
@@ -32,8 +32,15 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
+#include <stdint.h>
 #include <vector>
+#include <string>
 #include <algorithm>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include "picopng.h"
 #include "svl/SVL.h"
@@ -43,6 +50,7 @@ class Texture {
 public:
     Texture();
     Texture(const char *filename);
+    ~Texture();
 
     bool load(const char *filename);
     bool load(std::vector<unsigned char> png);
@@ -59,7 +67,33 @@ public:
 private:
     unsigned long width, height;
     std::vector<unsigned char> pixels;
+
+    /*
+     * Sampling reads through this pointer: into 'pixels' after a PNG
+     * decode, or straight into the memory-mapped sidecar cache with no
+     * intermediate copy. The cache is keyed by the PNG's size and
+     * mtime, so an edited texture invalidates it, and on a hit the PNG
+     * is never read or decoded at all.
+     */
+    const unsigned char *pixelData;
+    void *mapBase;
+    size_t mapLength;
+
+    struct CacheHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t width, height;
+        int64_t pngSize, pngMtime;
+    };
+    static const uint32_t CACHE_VERSION = 1;
+
     void init();
+    bool loadCache(const char *path, int64_t pngSize, int64_t pngMtime);
+    void saveCache(const char *path, int64_t pngSize, int64_t pngMtime) const;
+
+    // Not copyable; may own a file mapping
+    Texture(const Texture&);
+    Texture& operator=(const Texture&);
 };
 
 
@@ -70,24 +104,56 @@ private:
 
 inline Texture::Texture()
 {
+    mapBase = 0;
+    mapLength = 0;
+    pixelData = 0;
     init();
 }
 
 inline Texture::Texture(const char *filename)
 {
+    mapBase = 0;
+    mapLength = 0;
+    pixelData = 0;
     load(filename);
 }
 
+inline Texture::~Texture()
+{
+    init();
+}
+
 inline void Texture::init()
 {
+    if (mapBase) {
+        munmap(mapBase, mapLength);
+        mapBase = 0;
+        mapLength = 0;
+    }
     width = 0;
     height = 0;
+    pixelData = 0;
+    pixels.clear();
 }
 
 inline bool Texture::load(const char *filename)
 {
     init();
 
+    struct stat st;
+    if (stat(filename, &st) != 0) {
+        fprintf(stderr, "Can't open texture %s\n", filename);
+        return false;
+    }
+
+    // Look for a pre-decoded sidecar cache first; on a hit the sampler
+    // reads the mapped pixels directly and the PNG is never touched.
+    std::string cachePath(filename);
+    cachePath += ".texcache";
+    if (loadCache(cachePath.c_str(), st.st_size, st.st_mtime)) {
+        return true;
+    }
+
     FILE *f = fopen(filename, "rb");
     if (!f) {
         fprintf(stderr, "Can't open texture %s\n", filename);
@@ -103,8 +169,9 @@ inline bool Texture::load(const char *filename)
         buffer.resize((size_t)size);
         if (fread(&buffer[0], size, 1, f) == 1) {
             if (load(buffer)) {
-                // Success
+                // Success; leave a cache behind for the next run
                 fclose(f);
+                saveCache(cachePath.c_str(), st.st_size, st.st_mtime);
                 return true;
             }
         }
@@ -122,9 +189,71 @@ inline bool Texture::load(std::vector<unsigned char> png)
         return false;
     }
 
+    pixelData = &pixels[0];
+    return true;
+}
+
+inline bool Texture::loadCache(const char *path, int64_t pngSize, int64_t pngMtime)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(CacheHeader)) {
+        close(fd);
+        return false;
+    }
+
+    void *base = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+
+    // The payload length is implied by the dimensions, so a size check
+    // catches truncated files along with everything else.
+    const CacheHeader *h = (const CacheHeader *) base;
+    if (memcmp(h->magic, "FCTX", 4) ||
+        h->version != CACHE_VERSION ||
+        h->pngSize != pngSize ||
+        h->pngMtime != pngMtime ||
+        !h->width || !h->height ||
+        (size_t)st.st_size != sizeof(CacheHeader) + ((size_t)h->width * h->height << 2)) {
+        munmap(base, st.st_size);
+        return false;
+    }
+
+    mapBase = base;
+    mapLength = st.st_size;
+    width = h->width;
+    height = h->height;
+    pixelData = (const unsigned char *) base + sizeof(CacheHeader);
     return true;
 }
 
+inline void Texture::saveCache(const char *path, int64_t pngSize, int64_t pngMtime) const
+{
+    // Best effort; a failed write just means a slow start next time
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        return;
+    }
+
+    CacheHeader h;
+    memcpy(h.magic, "FCTX", 4);
+    h.version = CACHE_VERSION;
+    h.width = width;
+    h.height = height;
+    h.pngSize = pngSize;
+    h.pngMtime = pngMtime;
+
+    fwrite(&h, sizeof h, 1, f);
+    fwrite(&pixels[0], 1, pixels.size(), f);
+    fclose(f);
+}
+
 inline bool Texture::isLoaded() const
 {
     return width && height;
@@ -138,7 +267,7 @@ inline const uint8_t* Texture::sampleIntRGBA32(int x, int y) const
 
     x = std::max<int>(0, std::min<int>(width - 1, x));
     y = std::max<int>(0, std::min<int>(height - 1, y));
-    return &pixels[ (x + y * width) << 2 ];
+    return &pixelData[ (x + y * width) << 2 ];
 }
 
 inline Vec3 Texture::sampleInt(int x, int y) const
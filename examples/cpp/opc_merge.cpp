@@ -0,0 +1,202 @@
+/*
+ * OPC frame merger, for distributed rendering.
+ *
+ * For effects too heavy for one machine, several render nodes each run
+ * the same effect over a slice of the layout (EffectRunner's -span flag)
+ * and stream their slice here, tagged with a distinct OPC channel
+ * (-server HOST/FIRST-LAST@CHANNEL). This tool assembles the slices into
+ * whole frames and forwards them to fcserver on channel 0.
+ *
+ * A frame goes out whenever the lowest-numbered channel delivers a
+ * message, carrying the latest data received from every other node, so
+ * the first node sets the output cadence and a stalled node just
+ * freezes its own slice. Nodes are expected to share an NTP-disciplined
+ * clock so their animations advance in step.
+ *
+ * usage: opc_merge [-port N] [-out HOST[:port]] -pixels COUNT CHANNEL=FIRST ...
+ *
+ * Each CHANNEL=FIRST mapping places that channel's pixels into the
+ * output frame starting at index FIRST.
+ *
+ * Copyright (c) 2014 Micah Elizabeth Scott <micah@scanlime.org>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+#include "lib/opc_client.h"
+
+struct Node {
+    int fd;
+    std::vector<uint8_t> buffer;   // Partial incoming stream
+};
+
+int main(int argc, char **argv)
+{
+    int listenPort = 7891;
+    unsigned totalPixels = 0;
+    int offsets[256];
+    OPCClient out;
+
+    for (int c = 0; c < 256; c++) {
+        offsets[c] = -1;
+    }
+    out.resolve("localhost");
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-port") && (i+1 < argc)) {
+            listenPort = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-out") && (i+1 < argc)) {
+            if (!out.resolve(argv[++i])) {
+                fprintf(stderr, "Can't resolve server name %s\n", argv[i]);
+                return 1;
+            }
+        } else if (!strcmp(argv[i], "-pixels") && (i+1 < argc)) {
+            totalPixels = atoi(argv[++i]);
+        } else {
+            unsigned channel, first;
+            if (sscanf(argv[i], "%u=%u", &channel, &first) != 2 || channel > 255) {
+                fprintf(stderr, "usage: %s [-port N] [-out HOST[:port]] "
+                    "-pixels COUNT CHANNEL=FIRST ...\n", argv[0]);
+                return 1;
+            }
+            offsets[channel] = first;
+        }
+    }
+
+    if (!totalPixels) {
+        fprintf(stderr, "No output frame size specified\n");
+        return 1;
+    }
+
+    // The lowest mapped channel paces the output
+    int primaryChannel = -1;
+    for (int c = 0; c < 256; c++) {
+        if (offsets[c] >= 0) {
+            primaryChannel = c;
+            break;
+        }
+    }
+    if (primaryChannel < 0) {
+        fprintf(stderr, "No channel mappings specified\n");
+        return 1;
+    }
+
+    int listenFd = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP);
+    int flag = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &flag, sizeof flag);
+
+    struct sockaddr_in bindAddr;
+    memset(&bindAddr, 0, sizeof bindAddr);
+    bindAddr.sin_family = AF_INET;
+    bindAddr.sin_addr.s_addr = htonl(INADDR_ANY);
+    bindAddr.sin_port = htons(listenPort);
+
+    if (bind(listenFd, (struct sockaddr*) &bindAddr, sizeof bindAddr) < 0 ||
+        listen(listenFd, 8) < 0) {
+        fprintf(stderr, "Can't listen on port %d\n", listenPort);
+        return 1;
+    }
+
+    // Assembled output frame; slices land in place as they arrive
+    std::vector<uint8_t> frame(sizeof(OPCClient::Header) + totalPixels * 3, 0);
+    OPCClient::Header::view(frame).init(0, OPCClient::SET_PIXEL_COLORS, totalPixels * 3);
+
+    std::vector<Node> nodes;
+
+    for (;;) {
+        fd_set readable;
+        FD_ZERO(&readable);
+        FD_SET(listenFd, &readable);
+        int maxFd = listenFd;
+
+        for (unsigned n = 0; n < nodes.size(); n++) {
+            FD_SET(nodes[n].fd, &readable);
+            if (nodes[n].fd > maxFd) {
+                maxFd = nodes[n].fd;
+            }
+        }
+
+        if (select(maxFd + 1, &readable, 0, 0, 0) < 0) {
+            continue;
+        }
+
+        if (FD_ISSET(listenFd, &readable)) {
+            int fd = accept(listenFd, 0, 0);
+            if (fd >= 0) {
+                Node node;
+                node.fd = fd;
+                nodes.push_back(node);
+            }
+        }
+
+        for (unsigned n = 0; n < nodes.size();) {
+            Node &node = nodes[n];
+            if (!FD_ISSET(node.fd, &readable)) {
+                n++;
+                continue;
+            }
+
+            uint8_t chunk[8192];
+            int result = recv(node.fd, chunk, sizeof chunk, 0);
+            if (result <= 0) {
+                close(node.fd);
+                nodes.erase(nodes.begin() + n);
+                continue;
+            }
+            node.buffer.insert(node.buffer.end(), chunk, chunk + result);
+
+            // Peel complete messages off the front of the stream
+            while (node.buffer.size() >= sizeof(OPCClient::Header)) {
+                const OPCClient::Header &header = OPCClient::Header::view(node.buffer);
+                unsigned length = (header.length[0] << 8) | header.length[1];
+                unsigned total = sizeof(OPCClient::Header) + length;
+
+                if (node.buffer.size() < total) {
+                    break;
+                }
+
+                int offset = offsets[header.channel];
+                if (header.command == OPCClient::SET_PIXEL_COLORS && offset >= 0) {
+                    unsigned count = length / 3;
+                    if (offset + count > totalPixels) {
+                        count = totalPixels - std::min<unsigned>(totalPixels, offset);
+                    }
+                    memcpy(&frame[sizeof(OPCClient::Header) + offset * 3],
+                        header.data(), count * 3);
+
+                    if (header.channel == primaryChannel) {
+                        out.write(frame);
+                    }
+                }
+
+                node.buffer.erase(node.buffer.begin(), node.buffer.begin() + total);
+            }
+            n++;
+        }
+    }
+
+    return 0;
+}
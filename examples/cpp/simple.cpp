@@ -27,6 +27,23 @@ public:
         float wave = sinf(3.0 * distance - cycle) + noise3(p.point);
         hsv2rgb(rgb, 0.2, 0.3, wave);
     }
+
+    // GPU variant of shader(), used with -gpu on USE_GL_COMPUTE builds
+    virtual const char* gpuShader() const
+    {
+        return
+            "uniform float cycle;\n"
+            "vec3 shade(vec3 p)\n"
+            "{\n"
+            "    float wave = sin(3.0 * length(p) - cycle) + noise3(p);\n"
+            "    return hsv2rgb(0.2, 0.3, wave);\n"
+            "}\n";
+    }
+
+    virtual void gpuUniforms(GPUUniforms &u) const
+    {
+        u.set("cycle", cycle);
+    }
 };
 
 int main(int argc, char **argv)
@@ -57,7 +57,7 @@ public:
                       noise2(cyclePos * wanderSpeed, 51.7)) * wanderSize;
     }
 
-    virtual void shader(Vec3& rgb, const PixelInfo &p) const
+    void pixelHSV(Vec3& hsv, const PixelInfo &p) const
     {
         // Vector to center
         Vec3 s = p.point - center;
@@ -67,10 +67,37 @@ public:
 
         float angle = atan2(s[2], s[0]) + spin;
 
-        hsv2rgb(rgb,
+        hsv = Vec3(
             hue + angle * hueShift,
             saturation,
             sq(std::max(0.0f, sinf(angle * 5.0f))) * std::min(0.8f, sqrlen(s))
         );
     }
+
+    virtual void shader(Vec3& rgb, const PixelInfo &p) const
+    {
+        Vec3 hsv;
+        pixelHSV(hsv, p);
+        hsv2rgb(rgb, hsv);
+    }
+
+    virtual void shaderBlock(Vec3* out, const PixelInfo* pixels, size_t count) const
+    {
+        // Compute HSV per pixel, then convert whole batches at once.
+        // Unmapped pixels get zero value, which converts to (0, 0, 0).
+        Vec3 hsv[64];
+
+        for (size_t base = 0; base < count; base += 64) {
+            size_t n = std::min<size_t>(64, count - base);
+
+            for (size_t i = 0; i < n; i++) {
+                if (pixels[base + i].isMapped()) {
+                    pixelHSV(hsv[i], pixels[base + i]);
+                } else {
+                    hsv[i] = Vec3(0, 0, 0);
+                }
+            }
+            hsv2rgb_batch(&out[base], hsv, n);
+        }
+    }
 };
@@ -60,6 +60,14 @@
 // Each unit of length requires 48 bytes (because there are two output buffers).
 #define CONFIG_MAX_LEDS_PER_STRIP (120) // 5760 bytes
 
+// Configures the longest temporal dither sequence that can be precomputed,
+// as a bit depth; the pattern table holds 2^n entries.
+//
+// Each temporal renderer embeds one table (4 bytes per entry).  Dither
+// depths above this are clamped; cycles that long flicker visibly at any
+// practical refresh rate anyway (see RendererOptions::maxDitherBits).
+#define CONFIG_MAX_DITHER_PATTERN_BITS (5) // 128 bytes
+
 /*** Renderer algorithm configuration ***/
 
 // List of tags for the renderers to compile into the firmware.
@@ -75,7 +83,11 @@
         CONFIG_RENDERER(R11G11B11, NONE, NONE), \
         CONFIG_RENDERER(R11G11B11, TEMPORAL, NONE), \
         CONFIG_RENDERER(R11G11B11, NONE, LINEAR), \
-        CONFIG_RENDERER(R11G11B11, TEMPORAL, LINEAR) \
+        CONFIG_RENDERER(R11G11B11, TEMPORAL, LINEAR), \
+        CONFIG_RENDERER(R5G6B5, NONE, NONE), \
+        CONFIG_RENDERER(R5G6B5, TEMPORAL, NONE), \
+        CONFIG_RENDERER(R5G6B5, NONE, LINEAR), \
+        CONFIG_RENDERER(R5G6B5, TEMPORAL, LINEAR) \
 
 /*** USB stack configuration ***/
 
@@ -96,8 +108,8 @@
 // USB descriptor information
 #define CONFIG_VENDOR_ID               0x1d50    // OpenMoko
 #define CONFIG_PRODUCT_ID              0x607a    // Assigned to Fadecandy project
-#define CONFIG_DEVICE_VER              0x0390	  // BCD device version
-#define CONFIG_DEVICE_VER_STRING       "3.90"
+#define CONFIG_DEVICE_VER              0x0391	  // BCD device version
+#define CONFIG_DEVICE_VER_STRING       "3.91"
 #define CONFIG_MANUFACTURER_NAME         {'s','c','a','n','l','i','m','e'}
 #define CONFIG_MANUFACTURER_NAME_LEN     8
 #define CONFIG_PRODUCT_NAME              {'F','a','d','e','c','a','n','d','y'}
@@ -112,6 +124,7 @@ constexpr size_t maxFrameBuffers = CONFIG_MAX_FRAME_BUFFERS;
 constexpr size_t maxPacketsPerDoubleBufferedFrame = CONFIG_MAX_PACKETS_PER_DOUBLE_BUFFERED_FRAME;
 constexpr size_t maxPacketsPerTripleBufferedFrame = CONFIG_MAX_PACKETS_PER_TRIPLE_BUFFERED_FRAME;
 constexpr size_t maxLedsPerStrip = CONFIG_MAX_LEDS_PER_STRIP;
+constexpr size_t maxDitherPatternBits = CONFIG_MAX_DITHER_PATTERN_BITS;
 
 } // glimmer::config
 #endif
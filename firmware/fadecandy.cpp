@@ -76,6 +76,12 @@ FLEXRAM_DATA volatile bool irqReceivedNewFrameSinceLastLoop;
 FLEXRAM_DATA protocol::IndicatorMode paramIndicatorMode;
 FLEXRAM_DATA bool paramPrintStats;
 
+// Duration of one LED output frame in microseconds, derived from the
+// configured strip length and timings. A render pass that takes longer than
+// this can't keep up with the temporal dither cadence; we count those as
+// underruns. Zero until the first valid configuration arrives.
+FLEXRAM_DATA uint32_t paramLedFramePeriodMicros;
+
 // Statistics for debugging.
 struct Stats {
     uint64_t startTime;
@@ -109,6 +115,11 @@ bool handleUsbRxIrq(usb_packet_t* packet, size_t len) {
                 memcpy(&irqDebugPacket, packet->buf, sizeof(irqDebugPacket));
                 irqDebugChangedSinceLastLoop = true;
                 break;
+            case protocol::PacketType::frameDelta:
+                if (irqReceivedNewFrameSinceLastLoop) return false; // defer packet
+                rendererHolder->get()->storeDeltaHeader(
+                        *reinterpret_cast<const protocol::FrameDeltaPacket*>(packet->buf));
+                break;
         }
         usb_free(packet);
     } else {
@@ -168,7 +179,12 @@ void configure(render::RendererId id, render::RendererOptions options, const led
     if (!led::init(options.ledsPerStrip, timings)) {
         rendererHolder->clear();
         serial_print("invalid configuration: can't init led driver\r\n");
+        return;
     }
+
+    // 24 bits per pixel on the wire, plus the reset latch between frames.
+    paramLedFramePeriodMicros = uint64_t(options.ledsPerStrip) * 24 * 1000000
+            / timings.frequency + timings.resetInterval;
 }
 
 void setup() {
@@ -189,16 +205,37 @@ void setup() {
     irqReceivedNewFrameSinceLastLoop = false;
     paramIndicatorMode = protocol::IndicatorMode::ACTIVITY;
     paramPrintStats = false;
+    paramLedFramePeriodMicros = 0;
     stats = {};
+
+    // FlexRAM is zero-filled at boot, so the min counter's sentinel must be
+    // set here rather than with a static initializer.
+    perf_renderMinMicros = 0xffffffff;
 }
 
 void loop() {
-    // Render the next output buffer and write it out using DMA.
-    if (rendererHolder->get()->render(backOutputBuffer)) {
-        std::swap(frontOutputBuffer, backOutputBuffer);
-        led::write(frontOutputBuffer);
-
-        stats.renderedFrameCount++;
+    // Start any queued frame whose reset latch has elapsed.
+    led::pump();
+
+    // Render the next output buffer and queue it for DMA. The back buffer
+    // is unavailable while the previous frame is still streaming out of it;
+    // rather than spin-waiting for the flip as write() used to, skip the
+    // render and keep servicing USB and configuration below.
+    if (!led::busy(backOutputBuffer)) {
+        uint64_t renderStart = micros64();
+        if (rendererHolder->get()->render(backOutputBuffer)) {
+            uint32_t renderMicros = uint32_t(micros64() - renderStart);
+            if (renderMicros < perf_renderMinMicros) perf_renderMinMicros = renderMicros;
+            if (renderMicros > perf_renderMaxMicros) perf_renderMaxMicros = renderMicros;
+            if (paramLedFramePeriodMicros && renderMicros > paramLedFramePeriodMicros) {
+                perf_ditherUnderrunCounter++;
+            }
+
+            std::swap(frontOutputBuffer, backOutputBuffer);
+            led::write(frontOutputBuffer);
+
+            stats.renderedFrameCount++;
+        }
     }
 
     // Synchronize with the interrupt handler.
@@ -53,9 +53,18 @@ static uint8_t bdt_deferred_map;
 
 static uint8_t reply_buffer[8];
 
-// Performance counters
+// Performance counters; see usb_dev.h for the counter index map
 volatile uint32_t perf_frameCounter;
 volatile uint32_t perf_receivedKeyframeCounter;
+FLEXRAM_DATA volatile uint32_t perf_renderMinMicros;
+FLEXRAM_DATA volatile uint32_t perf_renderMaxMicros;
+FLEXRAM_DATA volatile uint32_t perf_usbBufferHighWater;
+FLEXRAM_DATA volatile uint32_t perf_ditherUnderrunCounter;
+FLEXRAM_DATA volatile uint32_t perf_missedInterpolationCounter;
+
+// Render duration window latched by a read of counter 2, so counters 2
+// and 3 describe the same interval no matter when counter 3 is read.
+static uint32_t perf_renderSnapshot[2];
 
 #define BDT_OWN     0x80
 #define BDT_DATA1   0x40
@@ -265,6 +274,27 @@ static void usb_setup(void)
             case 1:
                 data = (uint8_t*) &perf_receivedKeyframeCounter;
                 break;
+            case 2:
+                // Latch and reset the render-duration window. We're in the
+                // ISR here, so the main loop can't interleave an update.
+                perf_renderSnapshot[0] = perf_renderMinMicros;
+                perf_renderSnapshot[1] = perf_renderMaxMicros;
+                perf_renderMinMicros = 0xffffffff;
+                perf_renderMaxMicros = 0;
+                data = (uint8_t*) &perf_renderSnapshot[0];
+                break;
+            case 3:
+                data = (uint8_t*) &perf_renderSnapshot[1];
+                break;
+            case 4:
+                data = (uint8_t*) &perf_usbBufferHighWater;
+                break;
+            case 5:
+                data = (uint8_t*) &perf_ditherUnderrunCounter;
+                break;
+            case 6:
+                data = (uint8_t*) &perf_missedInterpolationCounter;
+                break;
             default:
                 endpoint0_stall();
                 return;
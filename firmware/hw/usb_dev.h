@@ -66,9 +66,26 @@ extern volatile uint8_t usb_dfu_state;
 #define DFU_appIDLE    0
 #define DFU_appDETACH  1
 
-// Performance counters
+// Performance counters, readable over a vendor control request
+// (bmRequestType 0xC0, bRequest 0x01, wIndex = counter index, 4 bytes
+// little-endian):
+//   0  main loop passes (free-running)
+//   1  keyframes received (free-running)
+//   2  render pass minimum duration in microseconds; reading latches
+//      counters 2 and 3 together and restarts the measurement window
+//   3  render pass maximum duration, from the window latched by counter 2
+//   4  USB packet buffer high-water mark (buffers in use, monotonic)
+//   5  dither underruns: render passes that outlasted one LED output
+//      frame, so the temporal dither cadence slipped (free-running)
+//   6  interpolation intervals that ran dry before the next keyframe
+//      arrived (free-running)
 extern volatile uint32_t perf_frameCounter;
 extern volatile uint32_t perf_receivedKeyframeCounter;
+extern volatile uint32_t perf_renderMinMicros;
+extern volatile uint32_t perf_renderMaxMicros;
+extern volatile uint32_t perf_usbBufferHighWater;
+extern volatile uint32_t perf_ditherUnderrunCounter;
+extern volatile uint32_t perf_missedInterpolationCounter;
 
 
 #ifdef __cplusplus
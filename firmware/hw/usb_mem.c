@@ -37,11 +37,13 @@
 #include "config.h"
 #include "debug.h"
 #include "mk20dx128.h"
+#include "usb_dev.h"
 
 __attribute__ ((section(".usbbuffers"), used))
 unsigned char usb_buffer_memory[CONFIG_NUM_USB_BUFFERS * sizeof(usb_packet_t)];
 
 static uint32_t usb_buffer_available[(CONFIG_NUM_USB_BUFFERS + 31) / 32];
+static uint32_t usb_buffers_in_use;
 
 void usb_init_mem()
 {
@@ -80,6 +82,9 @@ usb_packet_t * usb_malloc(void)
     }
 
     usb_buffer_available[idx] = avail & ~(0x80000000 >> (n & 31));
+    if (++usb_buffers_in_use > perf_usbBufferHighWater) {
+        perf_usbBufferHighWater = usb_buffers_in_use;
+    }
     __enable_irq();
 
     p = usb_buffer_memory + (n * sizeof(usb_packet_t));
@@ -105,6 +110,7 @@ void usb_free(usb_packet_t *p)
         crash("usb double free");
     }
     usb_buffer_available[idx] |= mask;
+    usb_buffers_in_use--;
     __enable_irq();
 }
 
@@ -40,6 +40,14 @@ FLEXRAM_DATA volatile bool writeInProgress = false;
 FLEXRAM_DATA volatile uint64_t writeFinishedAt = 0;
 FLEXRAM_DATA uint32_t resetInterval;
 
+// The write pipeline: |activeBuffer| is streaming out via DMA (while
+// writeInProgress), |pendingBuffer| is queued to go out next. write() only
+// queues; pump() starts the transfer once the DMA engine is idle and the
+// reset latch has elapsed, so the main loop never blocks here and can keep
+// rendering and servicing USB while a frame drains.
+FLEXRAM_DATA const uint8_t* volatile activeBuffer = nullptr;
+FLEXRAM_DATA const uint8_t* volatile pendingBuffer = nullptr;
+
 // When set to 1, sends oscilloscope trigger pulses using the TDO pin.
 #define TRACE 0
 
@@ -65,8 +73,11 @@ bool init(size_t ledsPerStrip, const Timings& timings) {
     // Validate parameters.
     if (ledsPerStrip == 0 || !validateTimings(timings)) return false;
 
-    // wait for all prior DMA operations to complete
+    // wait for all prior DMA operations to complete, and drop any queued
+    // write; its buffer was sized for the old configuration
     while (writeInProgress);
+    pendingBuffer = nullptr;
+    activeBuffer = nullptr;
 
     const size_t bufsize = bufferSize(ledsPerStrip);
     resetInterval = timings.resetInterval;
@@ -164,18 +175,26 @@ bool init(size_t ledsPerStrip, const Timings& timings) {
 }
 
 void write(const uint8_t* buffer) {
-    // Wait for all prior DMA operations to complete.
-    while (writeInProgress);
+    pendingBuffer = buffer;
+    pump();
+}
+
+bool busy(const uint8_t* buffer) {
+    return (writeInProgress && buffer == activeBuffer) || buffer == pendingBuffer;
+}
+
+void pump() {
+    // A transfer is still draining, or there's nothing queued.
+    if (writeInProgress || !pendingBuffer) return;
 
-    // Wait for LED reset to complete.
-    uint64_t now;
-    do {
-        now = micros64();
-    } while (now < writeFinishedAt + resetInterval);
+    // The LED reset latch after the previous frame hasn't elapsed yet.
+    if (micros64() < writeFinishedAt + resetInterval) return;
 
     // Start the next DMA transfer.
     writeInProgress = true;
-    DMA_TCD2_SADDR = buffer;
+    activeBuffer = pendingBuffer;
+    pendingBuffer = nullptr;
+    DMA_TCD2_SADDR = activeBuffer;
 
     trace(true);
     __disable_irq();
@@ -48,12 +48,21 @@ constexpr size_t bufferSize(size_t ledsPerStrip) { return ledsPerStrip * 24; }
 // Returns true if successful, false if the parameters are invalid.
 bool init(size_t ledsPerStrip, const Timings& timings);
 
-// Writes a buffer of encoded LED data to the DMA engine.
-// This operation completes asynchronously. Subsequent writes will block
-// until all prior writes have completed and the LEDs are ready to receive
-// new data.
+// Queues a buffer of encoded LED data for output.
+// Returns immediately; the transfer starts from pump() once the DMA engine
+// is idle and the inter-frame reset latch has elapsed. At most one buffer
+// is queued at a time; a second write before the first starts replaces it.
 void write(const uint8_t* buffer);
 
+// Starts the queued transfer if the DMA engine and the LED reset latch
+// allow. Call this from the main loop; write() also calls it, so an
+// immediate start doesn't wait for the next loop iteration.
+void pump();
+
+// Returns true while the given buffer is queued or streaming out, and thus
+// must not be rendered into.
+bool busy(const uint8_t* buffer);
+
 // Pushes pixels into a DMA buffer.
 // For SK6812, WS2812, WS2811, and similar strips, the input is an array of
 // 24-bit GRB values and the output is 24 bytes or swizzled pixeliness.
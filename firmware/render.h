@@ -6,14 +6,17 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
 
 #include "arm/core_cmInstr.h"
+#include "arm/core_cm4_simd.h"
 #include "config.h"
 #include "glimmer/protocol.h"
+#include "hw/usb_dev.h"
 #include "hw/usb_mem.h"
 #include "time.h"
 
@@ -62,6 +65,25 @@ struct FrameAccessor<ColorFormat::R11G11B11> {
     }
 };
 
+template <>
+struct FrameAccessor<ColorFormat::R5G6B5> {
+    using ColorOut = Color<8>;
+
+    [[gnu::always_inline]] static ColorOut getPixel(const usb_packet_t* const * packets,
+            size_t packetIndex, size_t pixelIndex) {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(packets[packetIndex]);
+        const uint16_t pixel = reinterpret_cast<const uint16_t*>(data + 2)[pixelIndex];
+        // Expand to 8 bits per component by replicating the high bits into
+        // the low ones, so full intensity maps to 0xff rather than 0xf8.
+        const unsigned r = pixel >> 11, g = (pixel >> 5) & 0x3f, b = pixel & 0x1f;
+        return ColorOut{
+            (r << 3) | (r >> 2),
+            (g << 2) | (g >> 4),
+            (b << 3) | (b >> 2),
+        };
+    }
+};
+
 // A frame buffer consisting of USB packets for zero-copy access.
 template <ColorFormat fmt, size_t maxPackets>
 struct FrameBuffer {
@@ -139,15 +161,41 @@ template <typename ColorIn>
 class DitherOp<DitherMode::TEMPORAL, ColorIn> {
     static_assert(ColorIn::bpc > 8);
 
-    const unsigned shift_, zeroes_;
+    // The butterfly sequence depends only on the configured dither depth,
+    // so it is generated once when the renderer is configured instead of
+    // being bit-reversed again every output cycle: entry k is the
+    // bit-reversal of k over the dithered bits, placed at the dithered
+    // bits' position below the output's 8. Advancing the pattern is then
+    // an index wrap and a table load.
+    static constexpr size_t maxPatternLength_ = size_t(1) << config::maxDitherPatternBits;
+
+    unsigned pattern_[maxPatternLength_];
+    unsigned patternMask_;
+    unsigned patternIndex_ = 0;
     unsigned noise_ = 0;
 
 public:
     using ColorOut = ColorIn;
 
-    DitherOp(size_t maxDitherBits) :
-            shift_(32 - std::min(ColorIn::bpc - 8, maxDitherBits)),
-            zeroes_(ColorIn::bpc - 8 - std::min(ColorIn::bpc - 8, maxDitherBits)) {}
+    DitherOp(size_t maxDitherBits) {
+        // Produces a butterfly sequence with a certain number of bits such as:
+        // - 0, 1
+        // - 0, 2, 1, 3
+        // - 0, 4, 2, 6, 1, 5, 3, 7
+        const size_t bits = std::min({ColorIn::bpc - 8, maxDitherBits,
+                config::maxDitherPatternBits});
+        const size_t zeroes = ColorIn::bpc - 8 - bits;
+        const size_t length = size_t(1) << bits;
+
+        patternMask_ = length - 1;
+        for (size_t k = 0; k < length; ++k) {
+            unsigned rev = 0;
+            for (size_t b = 0; b < bits; ++b) {
+                rev |= ((k >> b) & 1u) << (bits - 1 - b);
+            }
+            pattern_[k] = rev << zeroes;
+        }
+    }
 
     [[gnu::always_inline]] ColorOut operator()(ColorIn color) const {
         // For this to work without requiring a saturating addition, the host must ensure that the
@@ -157,13 +205,8 @@ public:
     }
 
     void advancePattern() {
-        // Produces a butterfly sequence with a certain number of bits such as:
-        // - 0, 1
-        // - 0, 2, 1, 3
-        // - 0, 4, 2, 6, 1, 5, 3, 7
-        noise_ >>= zeroes_;
-        noise_ = (__RBIT(__RBIT(noise_ << shift_) + 1) >> shift_);
-        noise_ <<= zeroes_;
+        patternIndex_ = (patternIndex_ + 1) & patternMask_;
+        noise_ = pattern_[patternIndex_];
     }
 };
 
@@ -172,18 +215,33 @@ template <InterpolateMode mode, typename ColorIn>
 class InterpolateOp {
 public:
     using ColorOut = ColorIn;
- 
+
     [[gnu::always_inline]] ColorOut operator()(ColorIn front, ColorIn prior) const { return front; }
 
     void setCoeffs(uint64_t now, uint64_t frontTime, uint64_t priorTime) {}
+
+    // True when the prior frame no longer contributes, so callers may pass
+    // the front pixel for both operands and skip fetching the prior one.
+    [[gnu::always_inline]] bool isConverged() const { return true; }
 };
 
 template <typename ColorIn>
 class InterpolateOp<InterpolateMode::LINEAR, ColorIn> {
-    uint32_t alpha_ = 256, beta_ = 0;
+    // Both halves of the dual MAC below are signed 16-bit: at most 11 bits
+    // of color against a 9-bit coefficient.
+    static_assert(ColorIn::bpc <= 15);
+
+    // Packed (beta << 16) | alpha, with alpha + beta == 256.
+    uint32_t coeffs_ = 256;
 
     [[gnu::always_inline]] unsigned lerp(unsigned front, unsigned prior) const {
-        return front * alpha_ + prior * beta_;
+        // One SMUAD computes front * alpha + prior * beta as a dual 16-bit
+        // multiply-accumulate, replacing two multiplies and an add per
+        // component. USAT then clips to the output width, so a host that
+        // violates the frame buffer range contract (see DitherOp) smears
+        // at most one bit into the neighboring channel in OutputOp instead
+        // of arbitrary garbage.
+        return __USAT(__SMUAD(__PKHBT(front, prior, 16), coeffs_), ColorOut::bpc);
     }
 
 public:
@@ -202,14 +260,18 @@ public:
             uint32_t period32 = static_cast<uint32_t>(period);
             uint32_t advance32 = static_cast<uint32_t>(advance);
             if (advance32 < period32) {
-                alpha_ = advance32 * 256 / period32;
-                beta_ = 256 - alpha_;
+                uint32_t alpha = advance32 * 256 / period32;
+                coeffs_ = __PKHBT(alpha, 256 - alpha, 16);
                 return;
             }
         }
-        alpha_ = 256;
-        beta_ = 0;
+        coeffs_ = 256;
     }
+
+    // Once alpha saturates, blending (front, front) is an exact identity
+    // (a plain shift into the wider output), so the prior-buffer fetch and
+    // unpack can be skipped for the rest of the interval.
+    [[gnu::always_inline]] bool isConverged() const { return coeffs_ == 256; }
 };
 
 // Configuration options for a rendering algorithm.
@@ -229,6 +291,8 @@ struct RendererOptions {
     // - 2: 60 Hz cycle for 120 pixels at 800 kHz (very smooth)
     // - 3: 30 Hz cycle for 120 pixels at 800 kHz (flickers)
     //      42 Hz cycle for 120 pixels at 1000 kHz with aggressive timings (somewhat smooth)
+    //
+    // Values above CONFIG_MAX_DITHER_PATTERN_BITS are clamped to it.
     const size_t maxDitherBits;
 };
 
@@ -248,6 +312,11 @@ public:
         return false;
     }
 
+    // Stores a delta frame header. Subsequent frame packets count against the
+    // announced bitmap, and the frame commits once all of them have arrived.
+    // This function may be called from an interrupt context.
+    virtual void storeDeltaHeader(const protocol::FrameDeltaPacket& header) {}
+
     // Flips frame buffers.  Must be called before rendering the new frame.
     virtual void advanceFrame() {}
 
@@ -278,6 +347,31 @@ protected:
     FrameBuffer buffers_[numBuffers];
     FrameBuffer* backBuffer_;
 
+    // Delta frame bookkeeping. |deltaRemaining_| counts announced packets
+    // not yet received; |deltaAnnounced_| remembers the bitmap so unannounced
+    // packets can be copied forward from the front buffer at commit time.
+    bool deltaActive_ = false;
+    size_t deltaRemaining_ = 0;
+    uint8_t deltaPending_[protocol::frameDeltaBitmapBytes] = {};
+    uint8_t deltaAnnounced_[protocol::frameDeltaBitmapBytes] = {};
+
+    static constexpr bool bitmapTest(const uint8_t* bitmap, size_t i) {
+        return bitmap[i >> 3] & (1 << (i & 7));
+    }
+
+    // Copies the packets the delta left untouched from |from| into the back
+    // buffer. Called from the main loop before buffers are flipped.
+    void applyPendingDelta(const FrameBuffer* from) {
+        if (!deltaActive_) return;
+        for (size_t i = 0; i < packetsPerFrame_; ++i) {
+            if (!bitmapTest(deltaAnnounced_, i)) {
+                memcpy(backBuffer_->packets[i]->buf, from->packets[i]->buf,
+                        sizeof(from->packets[i]->buf));
+            }
+        }
+        deltaActive_ = false;
+    }
+
 public:
     BufferedRenderer(RendererOptions options) :
             options_(std::move(options)),
@@ -295,7 +389,34 @@ public:
     }
 
     bool storeFramePacket(size_t packetIndex, usb_packet_t* packet, size_t len) override {
-        return backBuffer_->storeFramePacket(packetsPerFrame_, packetIndex, packet, len);
+        bool last = backBuffer_->storeFramePacket(packetsPerFrame_, packetIndex, packet, len);
+        if (!deltaActive_) {
+            return last;
+        }
+
+        // During a delta, the announced bitmap decides completion rather
+        // than the final packet index.
+        if (packetIndex < packetsPerFrame_ && bitmapTest(deltaPending_, packetIndex)) {
+            deltaPending_[packetIndex >> 3] &= ~(1 << (packetIndex & 7));
+            if (--deltaRemaining_ == 0) {
+                backBuffer_->time = micros64();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void storeDeltaHeader(const protocol::FrameDeltaPacket& header) override {
+        size_t remaining = 0;
+        for (size_t i = 0; i < packetsPerFrame_; ++i) {
+            if (bitmapTest(header.bitmap, i)) remaining++;
+        }
+        if (!remaining) return;  // nothing announced; ignore
+
+        memcpy(deltaPending_, header.bitmap, sizeof(deltaPending_));
+        memcpy(deltaAnnounced_, header.bitmap, sizeof(deltaAnnounced_));
+        deltaRemaining_ = remaining;
+        deltaActive_ = true;
     }
 
     static bool canInstantiate(const RendererOptions& options) {
@@ -310,6 +431,7 @@ template <ColorFormat fmt, DitherMode ditherMode>
 class DoubleBufferedRenderer : public BufferedRenderer<fmt, 2, config::maxPacketsPerDoubleBufferedFrame> {
 protected:
     using Super = BufferedRenderer<fmt, 2, config::maxPacketsPerDoubleBufferedFrame>;
+    using Super::applyPendingDelta;
     using Super::backBuffer_;
     using Super::buffers_;
     using Super::options_;
@@ -328,6 +450,7 @@ public:
             dither_(options.maxDitherBits) { }
 
     void advanceFrame() override {
+        applyPendingDelta(frontBuffer_);
         std::swap(frontBuffer_, backBuffer_);
     }
 
@@ -349,6 +472,7 @@ class TripleBufferedRenderer : public BufferedRenderer<fmt, 3, config::maxPacket
 protected:
     using Super = BufferedRenderer<fmt, 3, config::maxPacketsPerTripleBufferedFrame>;
     using Super::FrameBuffer;
+    using Super::applyPendingDelta;
     using Super::backBuffer_;
     using Super::buffers_;
     using Super::options_;
@@ -362,6 +486,9 @@ protected:
     IO interpolate_;
     DO dither_;
     OO output_;
+    // Whether this interpolation interval has already been counted as having
+    // run dry before the next keyframe arrived.
+    bool countedDryInterval_ = false;
 
 public:
     TripleBufferedRenderer(RendererOptions options) :
@@ -371,21 +498,46 @@ public:
             dither_(options.maxDitherBits) {}
 
     void advanceFrame() override {
+        // The unannounced packets come from the newest committed frame, so
+        // delta completion is independent of how stale the back buffer is.
+        applyPendingDelta(frontBuffer_);
         std::swap(frontBuffer_, priorBuffer_);
         std::swap(frontBuffer_, backBuffer_);
+        countedDryInterval_ = false;
     }
 
     bool render(uint8_t* outputBuffer) override {
         interpolate_.setCoeffs(micros64(), frontBuffer_->time, priorBuffer_->time);
-        led::updateBuffer(outputBuffer, options_.ledStrips, options_.ledsPerStrip,
-                [&](size_t strip, size_t pixel) [[gnu::always_inline]] {
-            size_t x = strip * options_.ledsPerStrip + pixel;
-            size_t packetIndex = x / pixelsPerPacket_;
-            size_t pixelIndex = x % pixelsPerPacket_;
-            return output_(dither_(interpolate_(
-                    frontBuffer_->getPixel(packetIndex, pixelIndex),
-                    priorBuffer_->getPixel(packetIndex, pixelIndex))));
-        });
+        if (interpolate_.isConverged()) {
+            // The blend reached the front frame before the next keyframe
+            // arrived, so the host isn't sustaining the keyframe rate it
+            // advertised. Count each interval that runs dry exactly once.
+            if (!countedDryInterval_) {
+                countedDryInterval_ = true;
+                perf_missedInterpolationCounter++;
+            }
+            // Steady state between keyframes: the blend has settled on the
+            // front frame, so render it alone and spare every pixel the
+            // prior-buffer fetch and unpack.
+            led::updateBuffer(outputBuffer, options_.ledStrips, options_.ledsPerStrip,
+                    [&](size_t strip, size_t pixel) [[gnu::always_inline]] {
+                size_t x = strip * options_.ledsPerStrip + pixel;
+                size_t packetIndex = x / pixelsPerPacket_;
+                size_t pixelIndex = x % pixelsPerPacket_;
+                auto front = frontBuffer_->getPixel(packetIndex, pixelIndex);
+                return output_(dither_(interpolate_(front, front)));
+            });
+        } else {
+            led::updateBuffer(outputBuffer, options_.ledStrips, options_.ledsPerStrip,
+                    [&](size_t strip, size_t pixel) [[gnu::always_inline]] {
+                size_t x = strip * options_.ledsPerStrip + pixel;
+                size_t packetIndex = x / pixelsPerPacket_;
+                size_t pixelIndex = x % pixelsPerPacket_;
+                return output_(dither_(interpolate_(
+                        frontBuffer_->getPixel(packetIndex, pixelIndex),
+                        priorBuffer_->getPixel(packetIndex, pixelIndex))));
+            });
+        }
         dither_.advancePattern();
         return true;
     }
@@ -408,8 +560,9 @@ struct RendererId {
 template <ColorFormat fmt, DitherMode ditherMode, InterpolateMode interpolateMode>
 struct RendererTag {
     // In some modes, dithering is a no-op so make it a synonym of the non-dithering mode.
+    // R5G6B5 expands to 8 bits per component, so it dithers exactly like R8G8B8.
     static constexpr DitherMode effectiveDitherMode =
-            fmt == ColorFormat::R8G8B8 && interpolateMode == InterpolateMode::NONE ?
+            fmt != ColorFormat::R11G11B11 && interpolateMode == InterpolateMode::NONE ?
                 DitherMode::NONE : ditherMode;
 
     // Map the tag to a type.
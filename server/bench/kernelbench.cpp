@@ -0,0 +1,315 @@
+/*
+ * Microbenchmarks for the per-pixel kernels.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Isolated benchmarks for the kernels on the pixel path: color channel
+ * selection, the PixelMapper copy loops, the color correction LUT math,
+ * and the Glimmer 33-bit pixel packing. fcserver-bench measures the whole
+ * dispatch pipeline; this tool times each kernel by itself, over
+ * representative frame sizes, so a regression shows up as a number
+ * instead of dropped frames at a show.
+ *
+ * usage: fcserver-kernelbench [name substring]
+ *
+ * Each benchmark is calibrated by doubling its iteration count until the
+ * run is long enough to swamp timer overhead, then reported as
+ * nanoseconds per item and items per second. An "item" is one pixel, or
+ * one LUT entry for the computeLUT benchmark.
+ */
+
+#include "rapidjson/document.h"
+#include "opc.h"
+#include "pixelmapper.h"
+#include "fcdevice.h"
+#include "glimmerdevice.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef OS_LINUX
+#include <time.h>
+#else
+#include <sys/time.h>
+#endif
+
+
+static uint64_t monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+// Result sink; keeps the optimizer from deleting a benchmark body
+static volatile uint8_t gSink;
+
+/*
+ * Representative frame sizes: one packet's worth of pixels, and a full
+ * 8-strip Fadecandy frame.
+ */
+static const unsigned BENCH_SIZES[] = { 64, 512 };
+static const unsigned NUM_SIZES = 2;
+static const unsigned MAX_PIXELS = 512;
+
+// SetPixelColors messages of each benchmark size, filled with a gradient
+static OPC::Message gMessages[NUM_SIZES];
+
+/*
+ * Color channel selectors, copied out of string literals at startup so the
+ * compiler can't constant-fold the switch in pickColorChannel. In real use
+ * the selectors come from the JSON configuration.
+ */
+static char gSelectorsRGB[3];
+static char gSelectorsLum[3];
+
+// Compiled mapping programs: [variant][size]
+enum MapVariant {
+    MAP_COPY = 0,       // [ 0, 0, 0, N ]
+    MAP_SWIZZLE,        // [ 0, 0, 0, N, "grb" ]
+    MAP_LUMINANCE,      // [ 0, 0, 0, N, "lll" ]
+    NUM_MAP_VARIANTS
+};
+static PixelMapper::Program gPrograms[NUM_MAP_VARIANTS][NUM_SIZES];
+
+static void initWorkloads()
+{
+    memcpy(gSelectorsRGB, "rgb", 3);
+    memcpy(gSelectorsLum, "lll", 3);
+
+    for (unsigned s = 0; s < NUM_SIZES; s++) {
+        OPC::Message &msg = gMessages[s];
+        msg.channel = 0;
+        msg.command = OPC::SetPixelColors;
+        msg.setLength(BENCH_SIZES[s] * 3);
+        for (unsigned i = 0; i < BENCH_SIZES[s] * 3; i++) {
+            msg.data[i] = (uint8_t) i;
+        }
+
+        static const char *formats[NUM_MAP_VARIANTS] = {
+            "[[0, 0, 0, %u]]",
+            "[[0, 0, 0, %u, \"grb\"]]",
+            "[[0, 0, 0, %u, \"lll\"]]",
+        };
+        for (unsigned v = 0; v < NUM_MAP_VARIANTS; v++) {
+            char json[64];
+            snprintf(json, sizeof json, formats[v], BENCH_SIZES[s]);
+            rapidjson::Document map;
+            map.Parse<0>(json);
+            PixelMapper::compile(gPrograms[v][s], &map, true);
+        }
+    }
+}
+
+/*
+ * OPC::pickColorChannel, as the swizzle fallback paths use it: three
+ * selector-driven picks per pixel.
+ */
+static uint64_t benchPickColorChannel(unsigned iterations, unsigned arg)
+{
+    const char *selectors = arg ? gSelectorsLum : gSelectorsRGB;
+    unsigned pixels = BENCH_SIZES[1];
+    uint8_t out = 0;
+
+    for (unsigned n = 0; n < iterations; n++) {
+        const uint8_t *rgb = gMessages[1].data;
+        for (unsigned i = 0; i < pixels; i++, rgb += 3) {
+            uint8_t color[3];
+            OPC::pickColorChannel(color[0], selectors[0], rgb);
+            OPC::pickColorChannel(color[1], selectors[1], rgb);
+            OPC::pickColorChannel(color[2], selectors[2], rgb);
+            out ^= color[0] ^ color[1] ^ color[2];
+        }
+    }
+
+    gSink = out;
+    return (uint64_t) iterations * pixels;
+}
+
+/*
+ * The mapping copy loops, against the same writer shape the device
+ * backends use: a flat RGB framebuffer.
+ */
+struct BenchWriter {
+    uint8_t fb[MAX_PIXELS * 3];
+    unsigned numPixels() const { return MAX_PIXELS; }
+    void writePixel(unsigned index, uint8_t r, uint8_t g, uint8_t b) {
+        uint8_t *out = &fb[3 * index];
+        out[0] = r;
+        out[1] = g;
+        out[2] = b;
+    }
+};
+
+static uint64_t benchPixelMapperRun(unsigned iterations, unsigned arg)
+{
+    unsigned variant = arg / NUM_SIZES;
+    unsigned size = arg % NUM_SIZES;
+    BenchWriter writer;
+
+    for (unsigned n = 0; n < iterations; n++) {
+        PixelMapper::run(gPrograms[variant][size], gMessages[size], writer);
+    }
+
+    gSink = writer.fb[0];
+    return (uint64_t) iterations * BENCH_SIZES[size];
+}
+
+/*
+ * Benchmarks for kernels that are private implementation details of their
+ * device classes; both classes grant this one friend access.
+ */
+class KernelBench
+{
+public:
+    static uint64_t benchComputeLUT(unsigned iterations, unsigned arg)
+    {
+        // A representative correction curve: the identity LUT short-circuits
+        // most of the math that a configured installation pays for.
+        FCDevice::LUTParams params;
+        params.gamma = 2.5;
+        params.whitepoint[0] = 0.98;
+        params.whitepoint[1] = 1.0;
+        params.whitepoint[2] = 0.9;
+        params.linearSlope = 1.0;
+        params.linearCutoff = 1 / 256.0;
+
+        static FCDevice::Packet packets[FCDevice::LUT_PACKETS];
+        for (unsigned n = 0; n < iterations; n++) {
+            FCDevice::computeLUT(params, packets);
+        }
+
+        gSink = packets[0].data[1];
+        return (uint64_t) iterations * 3 * FCDevice::LUT_ENTRIES;
+    }
+
+    static uint64_t benchGlimmerPack33(unsigned iterations, unsigned arg)
+    {
+        bool dirty = arg / NUM_SIZES;
+        unsigned pixels = BENCH_SIZES[arg % NUM_SIZES];
+        GlimmerDevice *dev = glimmerBenchDevice();
+
+        for (unsigned n = 0; n < iterations; n++) {
+            // The dirty variant changes every pixel every frame; the clean
+            // variant resends identical values, so the delta comparison
+            // short-circuits the stores after the first pass.
+            unsigned phase = dirty ? (n & 1) : 0;
+            for (unsigned i = 0; i < pixels; i++) {
+                unsigned v = ((i + phase) * 9) & 0x7f8;
+                dev->writeDevicePixel33(i, v, v ^ 0x2a8, 0x7f8 - v);
+            }
+        }
+
+        gSink = (uint8_t) dev->mFramePackets[0].data[4];
+        return (uint64_t) iterations * pixels;
+    }
+
+private:
+    static GlimmerDevice *glimmerBenchDevice()
+    {
+        /*
+         * A hardware-less device with a heap frame packet buffer in place
+         * of the DMA-capable one open() would allocate. Leaked; the process
+         * exits when the benchmarks finish.
+         */
+        static GlimmerDevice *dev = 0;
+        if (!dev) {
+            dev = new GlimmerDevice(0, false);
+            size_t bytes = glimmer::protocol::maxPacketsPerFrame *
+                sizeof(glimmer::protocol::FramePacket);
+            dev->mFramePackets = (glimmer::protocol::FramePacket*) new uint8_t[bytes];
+            memset(dev->mFramePackets, 0, bytes);
+        }
+        return dev;
+    }
+};
+
+
+struct Bench {
+    const char *name;
+    uint64_t (*fn)(unsigned iterations, unsigned arg);
+    unsigned arg;
+};
+
+static const Bench gBenches[] = {
+    { "pickColorChannel/rgb",       benchPickColorChannel,          0 },
+    { "pickColorChannel/luminance", benchPickColorChannel,          1 },
+    { "pixelMapper/copy/64",        benchPixelMapperRun,            MAP_COPY * NUM_SIZES + 0 },
+    { "pixelMapper/copy/512",       benchPixelMapperRun,            MAP_COPY * NUM_SIZES + 1 },
+    { "pixelMapper/swizzle/64",     benchPixelMapperRun,            MAP_SWIZZLE * NUM_SIZES + 0 },
+    { "pixelMapper/swizzle/512",    benchPixelMapperRun,            MAP_SWIZZLE * NUM_SIZES + 1 },
+    { "pixelMapper/luminance/512",  benchPixelMapperRun,            MAP_LUMINANCE * NUM_SIZES + 1 },
+    { "fcdevice/computeLUT",        KernelBench::benchComputeLUT,   0 },
+    { "glimmer/pack33/clean/512",   KernelBench::benchGlimmerPack33, 0 * NUM_SIZES + 1 },
+    { "glimmer/pack33/dirty/64",    KernelBench::benchGlimmerPack33, 1 * NUM_SIZES + 0 },
+    { "glimmer/pack33/dirty/512",   KernelBench::benchGlimmerPack33, 1 * NUM_SIZES + 1 },
+};
+
+static const uint64_t MIN_RUN_MICROSECONDS = 500000;
+
+static void runBench(const Bench &bench)
+{
+    unsigned iterations = 1;
+    uint64_t elapsed, items;
+
+    for (;;) {
+        uint64_t started = monotonicMicroseconds();
+        items = bench.fn(iterations, bench.arg);
+        elapsed = monotonicMicroseconds() - started;
+        if (elapsed >= MIN_RUN_MICROSECONDS || iterations >= (1u << 30)) {
+            break;
+        }
+        iterations *= 2;
+    }
+
+    printf("%-28s %12llu items %9.2f ns/item %9.1f Mitems/s\n",
+        bench.name, (unsigned long long) items,
+        elapsed * 1e3 / items, items / (double) elapsed);
+    fflush(stdout);
+}
+
+int main(int argc, char **argv)
+{
+    const char *filter = argc > 1 ? argv[1] : 0;
+
+    initWorkloads();
+
+    unsigned matched = 0;
+    for (unsigned i = 0; i < sizeof gBenches / sizeof gBenches[0]; i++) {
+        if (filter && !strstr(gBenches[i].name, filter)) {
+            continue;
+        }
+        runBench(gBenches[i]);
+        matched++;
+    }
+
+    if (!matched) {
+        fprintf(stderr, "No benchmarks match '%s'\n", filter);
+        return 1;
+    }
+    return 0;
+}
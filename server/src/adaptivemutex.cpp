@@ -0,0 +1,85 @@
+/*
+ * Adaptive mutex: inline fast path, bounded spin, then futex park.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "adaptivemutex.h"
+
+#ifdef OS_LINUX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <sched.h>
+#endif
+
+// Iterations to spin before parking; roughly the cost of a context switch
+static const unsigned SPIN_LIMIT = 100;
+
+static inline void spinPause()
+{
+#if defined(__i386__) || defined(__x86_64__)
+    __asm__ __volatile__ ("pause");
+#elif defined(__arm__) || defined(__aarch64__)
+    __asm__ __volatile__ ("yield");
+#endif
+}
+
+void AdaptiveMutex::lockContended()
+{
+    /*
+     * Bounded spin first. When the holder is mid-critical-section on
+     * another core, the lock usually frees within a few dozen iterations,
+     * and a round trip through the kernel would cost more than it saves.
+     */
+
+    for (unsigned i = SPIN_LIMIT; i; i--) {
+        if (mState == 0 && __sync_bool_compare_and_swap(&mState, 0, 1)) {
+            return;
+        }
+        spinPause();
+    }
+
+#ifdef OS_LINUX
+    /*
+     * Park until the holder releases. Waiting marks the lock contended (2)
+     * so unlock() knows to issue a wake, and a woken waiter re-takes the
+     * lock in the contended state, since other waiters may still be parked.
+     * This is the classic three-state futex mutex from Drepper's
+     * "Futexes Are Tricky".
+     */
+    while (__sync_lock_test_and_set(&mState, 2) != 0) {
+        syscall(SYS_futex, (int*)&mState, FUTEX_WAIT_PRIVATE, 2, (void*)0, (void*)0, 0);
+    }
+#else
+    // No futex here; yield between attempts, like fast_mutex
+    while (!__sync_bool_compare_and_swap(&mState, 0, 1)) {
+        sched_yield();
+    }
+#endif
+}
+
+void AdaptiveMutex::wakeOne()
+{
+#ifdef OS_LINUX
+    syscall(SYS_futex, (int*)&mState, FUTEX_WAKE_PRIVATE, 1, (void*)0, (void*)0, 0);
+#endif
+}
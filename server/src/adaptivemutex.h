@@ -0,0 +1,75 @@
+/*
+ * Adaptive mutex: inline fast path, bounded spin, then futex park.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+
+/*
+ * AdaptiveMutex is a drop-in replacement for tthread::fast_mutex. That class
+ * is a pure spinlock: a waiter burns its core (or thrashes sched_yield) for
+ * the whole time the lock is held, which is real cost on the two-core
+ * machines fcserver typically runs on when the network thread and the main
+ * loop collide.
+ *
+ * The uncontended path here is a single inline compare-and-swap each way.
+ * A contended lock() spins briefly — most of our critical sections are a
+ * few dozen instructions — and then parks in the kernel on a futex until
+ * the holder releases. Where futexes aren't available, it degrades to the
+ * same spin-and-yield behavior as fast_mutex.
+ *
+ * Like fast_mutex, this class is not compatible with condition_variable.
+ */
+
+class AdaptiveMutex
+{
+public:
+    AdaptiveMutex() : mState(0) {}
+
+    inline void lock()
+    {
+        // mState: 0 = free, 1 = locked, 2 = locked with possible waiters
+        if (!__sync_bool_compare_and_swap(&mState, 0, 1)) {
+            lockContended();
+        }
+    }
+
+    inline bool try_lock()
+    {
+        return __sync_bool_compare_and_swap(&mState, 0, 1);
+    }
+
+    inline void unlock()
+    {
+        if (__sync_fetch_and_sub(&mState, 1) != 1) {
+            // Someone may be parked; release fully and wake one waiter
+            mState = 0;
+            wakeOne();
+        }
+    }
+
+private:
+    volatile int mState;
+
+    void lockContended();
+    void wakeOne();
+};
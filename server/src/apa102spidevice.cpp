@@ -23,6 +23,7 @@
  */
 
 #include "apa102spidevice.h"
+#include "rtsched.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
 #include "opc.h"
@@ -31,20 +32,73 @@
 
 const char* APA102SPIDevice::DEVICE_TYPE = "apa102spi";
 
+static uint64_t monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000000ULL + tv.tv_usec;
+#endif
+}
+
 APA102SPIDevice::APA102SPIDevice(uint32_t numLights, bool verbose)
     : SPIDevice(DEVICE_TYPE, verbose),
       mConfigMap(0),
-      mNumLights(numLights)
+      mNumLights(numLights),
+      mWriteThread(0),
+      mPendingIndex(0),
+      mStreamingIndex(0),
+      mWritePending(false),
+      mWriterRunning(false),
+      mCoalescedFrames(0),
+      mDither(true),
+      mDitherActive(false),
+      mInterpolate(false),
+      mKeyArrival(0),
+      mKeyDuration(0),
+      mHdr(false)
 {
+    mDitherTargets.resize(numLights * 3, 0);
+    mDitherResiduals.resize(numLights * 3, 0);
+
+    /*
+     * Brightness factorization tables. The LUT picks the smallest 5-bit
+     * brightness that can still represent the bucket's largest 16-bit
+     * value in 8 bits, so color resolution is maximized at low levels.
+     */
+    for (unsigned m = 0; m < 256; m++) {
+        uint32_t upper = m * 0x101 + 0x100;
+        uint32_t b = (upper * 31 + 65534) / 65535;
+        if (b < 1) b = 1;
+        if (b > 31) b = 31;
+        mBrightnessLUT[m] = uint8_t(b);
+    }
+    mBrightnessRecip[0] = 0;
+    mBrightnessScale[0] = 0;
+    for (unsigned b = 1; b < 32; b++) {
+        mBrightnessRecip[b] = uint16_t((31 << 14) / (0x101 * b));
+        mBrightnessScale[b] = uint16_t(((0x101 * b) << 8) / 31);
+    }
+
     uint32_t bufferSize = sizeof(PixelFrame) * (numLights + 2); // Number of lights plus start and end frames
     mFrameBuffer = (PixelFrame*)malloc(bufferSize);
 
     uint32_t flushCount = (numLights / 2) + (numLights % 2);
     mFlushBuffer = (PixelFrame*)malloc(flushCount);
 
+    // Halves the writer thread streams from; copied whole each frame
+    mDoubleBuffer[0] = (PixelFrame*)malloc(bufferSize);
+    mDoubleBuffer[1] = (PixelFrame*)malloc(bufferSize);
+
     // Initialize all buffers to zero
     memset(mFlushBuffer, 0, flushCount);
     memset(mFrameBuffer, 0, bufferSize);
+    memset(mDoubleBuffer[0], 0, bufferSize);
+    memset(mDoubleBuffer[1], 0, bufferSize);
 
     // Initialize start and end frames
     mFrameBuffer[0].value = START_FRAME;
@@ -53,15 +107,64 @@ APA102SPIDevice::APA102SPIDevice(uint32_t numLights, bool verbose)
 
 APA102SPIDevice::~APA102SPIDevice()
 {
-    free(mFrameBuffer);
-    free(mFlushBuffer);
+    // Stop the output worker before tearing down any state it might touch.
+    mOutputWorker.stop();
+
+    // Then the SPI writer it feeds
+    if (mWriteThread) {
+        mWriteMutex.lock();
+        mWriterRunning = false;
+        mWriteCond.notify_one();
+        mWriteMutex.unlock();
+        mWriteThread->join();
+        delete mWriteThread;
+    }
 
     flush();
+
+    free(mFrameBuffer);
+    free(mFlushBuffer);
+    free(mDoubleBuffer[0]);
+    free(mDoubleBuffer[1]);
 }
 
 void APA102SPIDevice::loadConfiguration(const Value &config)
 {
     mConfigMap = findConfigMap(config);
+    PixelMapper::compile(mCompiledMap, mConfigMap, mVerbose);
+
+    // Temporal dithering is on unless explicitly disabled, like the
+    // firmware dithering on Fadecandy boards.
+    const Value &dither = config["dither"];
+    mDither = !dither.IsFalse();
+    if (!(dither.IsTrue() || dither.IsFalse() || dither.IsNull()) && mVerbose) {
+        std::clog << "Dither configuration must be true or false.\n";
+    }
+
+    // Optional keyframe interpolation, like the Fadecandy firmware's
+    const Value &interpolate = config["interpolate"];
+    mInterpolate = interpolate.IsTrue();
+    if (!(interpolate.IsTrue() || interpolate.IsFalse() || interpolate.IsNull()) && mVerbose) {
+        std::clog << "Interpolate configuration must be true or false.\n";
+    }
+    if (mInterpolate) {
+        mKeyPrev.resize(mNumLights * 3, 0);
+        mKeyNext.resize(mNumLights * 3, 0);
+    }
+
+    // Optional extended dynamic range via the 5-bit brightness field
+    const Value &hdr = config["hdr"];
+    mHdr = hdr.IsTrue();
+    if (!(hdr.IsTrue() || hdr.IsFalse() || hdr.IsNull()) && mVerbose) {
+        std::clog << "HDR configuration must be true or false.\n";
+    }
+}
+
+bool APA102SPIDevice::getOPCChannels(std::set<unsigned> &channels)
+{
+    // The compiled mapping knows exactly which channels we listen to.
+    PixelMapper::programChannels(mCompiledMap, channels);
+    return true;
 }
 
 std::string APA102SPIDevice::getName()
@@ -81,12 +184,258 @@ void APA102SPIDevice::flush()
     *
     */
     uint32_t flushCount = (mNumLights / 2) + (mNumLights % 2);
+
+    mPortMutex.lock();
     SPIDevice::write(mFlushBuffer, flushCount);
+    mPortMutex.unlock();
 }
 
 void APA102SPIDevice::writeBuffer()
 {
-    SPIDevice::write(mFrameBuffer, sizeof(PixelFrame) * (mNumLights + 2));
+    /*
+     * Hand the current frame to the writer thread and return immediately.
+     * The copy also keeps mFrameBuffer pristine: the SPI transaction is a
+     * full-duplex read-write that clobbers the buffer it streams from.
+     */
+
+    mWriteMutex.lock();
+
+    unsigned idx;
+    if (mWritePending) {
+        // The writer hasn't started the queued frame yet; supersede it
+        idx = mPendingIndex;
+        mCoalescedFrames++;
+    } else {
+        idx = 1 - mStreamingIndex;
+    }
+
+    memcpy(mDoubleBuffer[idx], mFrameBuffer, sizeof(PixelFrame) * (mNumLights + 2));
+    mPendingIndex = idx;
+    mWritePending = true;
+
+    if (mInterpolate) {
+        /*
+         * New keyframe: blend from whatever is currently showing toward
+         * it, over the interval between the last two arrivals. Starting
+         * from the live blend keeps irregular arrivals from jumping.
+         */
+        uint64_t now = monotonicMicroseconds();
+
+        mKeyPrev = mDitherTargets;
+        for (unsigned i = 0; i < mNumLights; i++) {
+            const PixelFrame *in = &mFrameBuffer[i + 1];
+            mKeyNext[i*3 + 0] = in->r * 0x101;
+            mKeyNext[i*3 + 1] = in->g * 0x101;
+            mKeyNext[i*3 + 2] = in->b * 0x101;
+        }
+
+        if (mKeyArrival) {
+            mKeyDuration = now - mKeyArrival;
+            // Pause or resume: snap rather than crawl
+            if (mKeyDuration > 500000) {
+                mKeyDuration = 0;
+            }
+        }
+        mKeyArrival = now;
+        mDitherActive = true;
+
+    } else if (mDither) {
+        // New 16-bit targets; today's sources are 8-bit, scaled up
+        for (unsigned i = 0; i < mNumLights; i++) {
+            const PixelFrame *in = &mFrameBuffer[i + 1];
+            mDitherTargets[i*3 + 0] = in->r * 0x101;
+            mDitherTargets[i*3 + 1] = in->g * 0x101;
+            mDitherTargets[i*3 + 2] = in->b * 0x101;
+        }
+        mDitherActive = true;
+    }
+
+    if (!mWriteThread) {
+        // Lazily start the writer, like the output workers
+        mWriterRunning = true;
+        mWriteThread = new tthread::thread(writeThreadFunc, this);
+    }
+
+    mWriteCond.notify_one();
+    mWriteMutex.unlock();
+
+    // This is where a frame is committed to the output side, so it's the
+    // submission point the pacing analyzer traces.
+    mSubmitTrace.record(monotonicMicroseconds());
+}
+
+void APA102SPIDevice::blendKeyframes(uint64_t now)
+{
+    // Linear blend from mKeyPrev to mKeyNext in 16.16 fixed point
+    uint32_t alpha = 65536;
+    if (mKeyDuration && now - mKeyArrival < mKeyDuration) {
+        alpha = uint32_t(((now - mKeyArrival) << 16) / mKeyDuration);
+    }
+
+    for (unsigned i = 0; i < mNumLights * 3; i++) {
+        int32_t prev = mKeyPrev[i];
+        int32_t next = mKeyNext[i];
+        // The product spans +/- 65535 * 65536, so widen before multiplying
+        mDitherTargets[i] = uint16_t(prev + int32_t((int64_t(next - prev) * alpha) >> 16));
+    }
+}
+
+void APA102SPIDevice::ditherOutputFrame(PixelFrame *out)
+{
+    /*
+     * One dither tick: quantize each 16-bit target, carrying the
+     * quantization error into the next tick. Without HDR an 8-bit value v
+     * on the wire represents v * 0x101 in 16-bit space; with HDR the
+     * brightness field scales that, and the residual is figured against
+     * the value the factorization actually realizes.
+     */
+
+    for (unsigned p = 0; p < mNumLights; p++) {
+        PixelFrame *pixel = &out[p + 1];
+        int32_t acc[3];
+        int32_t brightest = 0;
+
+        for (unsigned c = 0; c < 3; c++) {
+            // With dithering off (interpolation only), residuals stay zero
+            acc[c] = int32_t(mDitherTargets[p*3 + c]) +
+                     (mDither ? mDitherResiduals[p*3 + c] : 0);
+            if (acc[c] > brightest) {
+                brightest = acc[c];
+            }
+        }
+
+        if (mHdr) {
+            if (brightest > 65535) brightest = 65535;
+            unsigned b = mBrightnessLUT[brightest >> 8];
+            pixel->l = uint8_t(BRIGHTNESS_HEADER | b);
+
+            for (unsigned c = 0; c < 3; c++) {
+                int32_t clamped = acc[c] < 0 ? 0 : (acc[c] > 65535 ? 65535 : acc[c]);
+                int32_t v = (clamped * mBrightnessRecip[b]) >> 14;
+                if (v > 255) v = 255;
+                if (mDither) {
+                    mDitherResiduals[p*3 + c] = int16_t(acc[c] - ((v * mBrightnessScale[b]) >> 8));
+                }
+
+                switch (c) {
+                    case 0: pixel->r = uint8_t(v); break;
+                    case 1: pixel->g = uint8_t(v); break;
+                    case 2: pixel->b = uint8_t(v); break;
+                }
+            }
+        } else {
+            pixel->l = 0xEF;
+
+            for (unsigned c = 0; c < 3; c++) {
+                int32_t v = (acc[c] + 0x80) / 0x101;
+                if (v < 0) v = 0;
+                if (v > 255) v = 255;
+                if (mDither) {
+                    mDitherResiduals[p*3 + c] = int16_t(acc[c] - v * 0x101);
+                }
+
+                switch (c) {
+                    case 0: pixel->r = uint8_t(v); break;
+                    case 1: pixel->g = uint8_t(v); break;
+                    case 2: pixel->b = uint8_t(v); break;
+                }
+            }
+        }
+    }
+}
+
+void APA102SPIDevice::hdrQuantizeFrame(PixelFrame *out)
+{
+    /*
+     * HDR factorization for the non-dithered path: no residual feedback,
+     * so use exact division for the color bytes.
+     */
+
+    for (unsigned p = 0; p < mNumLights; p++) {
+        PixelFrame *pixel = &out[p + 1];
+
+        unsigned brightest = pixel->r;
+        if (pixel->g > brightest) brightest = pixel->g;
+        if (pixel->b > brightest) brightest = pixel->b;
+
+        unsigned b = mBrightnessLUT[brightest];
+        unsigned divisor = 0x101 * b;
+        pixel->l = uint8_t(BRIGHTNESS_HEADER | b);
+        pixel->r = uint8_t((pixel->r * 0x101 * 31 + divisor/2) / divisor);
+        pixel->g = uint8_t((pixel->g * 0x101 * 31 + divisor/2) / divisor);
+        pixel->b = uint8_t((pixel->b * 0x101 * 31 + divisor/2) / divisor);
+    }
+}
+
+void APA102SPIDevice::writeThreadFunc(void *arg)
+{
+    ((APA102SPIDevice*) arg)->writeThreadLoop();
+}
+
+void APA102SPIDevice::writeThreadLoop()
+{
+    // This thread paces SPI output; include it in real-time mode
+    RtSched::applyToCurrentThread("spi");
+
+    mWriteMutex.lock();
+
+    while (mWriterRunning) {
+        bool repaint = (mDither || mInterpolate) && mDitherActive;
+
+        if (!mWritePending && !repaint) {
+            mWriteCond.wait(mWriteMutex);
+            continue;
+        }
+
+        unsigned idx;
+        if (mWritePending) {
+            idx = mPendingIndex;
+            mWritePending = false;
+        } else {
+            // Dither tick between input frames: repaint the idle half
+            idx = 1 - mStreamingIndex;
+        }
+        mStreamingIndex = idx;
+
+        if (repaint) {
+            if (mInterpolate) {
+                blendKeyframes(monotonicMicroseconds());
+            }
+            ditherOutputFrame(mDoubleBuffer[idx]);
+        } else if (mHdr) {
+            hdrQuantizeFrame(mDoubleBuffer[idx]);
+        }
+        mWriteMutex.unlock();
+
+        /*
+         * Stream outside the buffer lock, so mapping the next frame
+         * overlaps. Pixel data and the end-frame clocks a long chain needs
+         * to latch go out as one scatter-gather submission: one ioctl per
+         * frame, and no inter-transfer gap on the bus.
+         */
+        void *buffers[2] = {
+            mDoubleBuffer[idx],
+            mFlushBuffer,
+        };
+        const int lengths[2] = {
+            int(sizeof(PixelFrame) * (mNumLights + 2)),
+            int((mNumLights / 2) + (mNumLights % 2)),
+        };
+
+        mPortMutex.lock();
+        writeVectored(buffers, lengths, 2);
+        mPortMutex.unlock();
+
+        if (repaint) {
+            // Bound the restream rate on short chains; long chains are
+            // already paced by the bus itself.
+            tthread::this_thread::sleep_for(tthread::chrono::milliseconds(1));
+        }
+
+        mWriteMutex.lock();
+    }
+
+    mWriteMutex.unlock();
 }
 
 void APA102SPIDevice::writeMessage(Document &msg)
@@ -103,9 +452,16 @@ void APA102SPIDevice::writeMessage(Document &msg)
     const char *type = msg["type"].GetString();
 
     if (!strcmp(type, "device_pixels")) {
-        // Write raw pixels, without any mapping
+        // Write raw pixels, without any mapping. The writer thread's
+        // vectored submission already appends the end-frame latch, so no
+        // separate synchronous flush is needed here.
         writeDevicePixels(msg);
-        flush();
+        return;
+    }
+
+    if (!strcmp(type, "device_pixel_snapshot")) {
+        // Report what the device is currently showing, for live monitoring
+        jsonPixelSnapshot(msg);
         return;
     }
 
@@ -113,6 +469,29 @@ void APA102SPIDevice::writeMessage(Document &msg)
     SPIDevice::writeMessage(msg);
 }
 
+void APA102SPIDevice::writeDevicePixels(const uint8_t *rgb, unsigned numPixels)
+{
+    // Raw binary pixel write; see FCDevice::writeDevicePixels().
+
+    if (numPixels > mNumLights) {
+        numPixels = mNumLights;
+    }
+
+    mWriteMutex.lock();
+    mFrameBufferSeqlock.writeBegin();
+    for (unsigned i = 0; i < numPixels; i++) {
+        PixelFrame *out = fbPixel(i);
+        out->r = rgb[i*3 + 0];
+        out->g = rgb[i*3 + 1];
+        out->b = rgb[i*3 + 2];
+        out->l = 0xEF; // todo: fix so we actually pass brightness
+    }
+    mFrameBufferSeqlock.writeEnd();
+    mWriteMutex.unlock();
+
+    writeBuffer();
+}
+
 void APA102SPIDevice::writeDevicePixels(Document &msg)
 {
     /*
@@ -134,6 +513,10 @@ void APA102SPIDevice::writeDevicePixels(Document &msg)
         if (numPixels > mNumLights)
             numPixels = mNumLights;
 
+        // This path runs on the websocket thread, so writer serialization
+        // against the output worker's OPC mapping matters here.
+        mWriteMutex.lock();
+        mFrameBufferSeqlock.writeBegin();
         for (uint32_t i = 0; i < numPixels; i++) {
             PixelFrame *out = fbPixel(i);
 
@@ -146,6 +529,8 @@ void APA102SPIDevice::writeDevicePixels(Document &msg)
             out->b = std::max(0, std::min(255, b.IsInt() ? b.GetInt() : 0));
             out->l = 0xEF; // todo: fix so we actually pass brightness
         }
+        mFrameBufferSeqlock.writeEnd();
+        mWriteMutex.unlock();
 
         writeBuffer();
     }
@@ -177,95 +562,58 @@ void APA102SPIDevice::writeMessage(const OPC::Message &msg)
 void APA102SPIDevice::opcSetPixelColors(const OPC::Message &msg)
 {
     /*
-     * Parse through our device's mapping, and store any relevant portions of 'msg'
+     * Run through our compiled mapping, and store any relevant portions of 'msg'
      * in the framebuffer.
      */
 
-    if (!mConfigMap) {
-        // No mapping defined yet. This device is inactive.
-        return;
-    }
+    FramebufferWriter writer(*this);
 
-    const Value &map = *mConfigMap;
-    for (unsigned i = 0, e = map.Size(); i != e; i++) {
-        opcMapPixelColors(msg, map[i]);
-    }
+    // mWriteMutex serializes framebuffer writers (this path on the
+    // output worker, raw JSON writes on the websocket thread); the
+    // seqlock protocol itself allows only one writer at a time.
+    mWriteMutex.lock();
+    mFrameBufferSeqlock.writeBegin();
+    PixelMapper::run(mCompiledMap, msg, writer);
+    mFrameBufferSeqlock.writeEnd();
+    mWriteMutex.unlock();
 }
 
-void APA102SPIDevice::opcMapPixelColors(const OPC::Message &msg, const Value &inst)
+void APA102SPIDevice::jsonPixelSnapshot(Document &msg)
 {
     /*
-    * Parse one JSON mapping instruction, and copy any relevant parts of 'msg'
-    * into our framebuffer. This looks for any mapping instructions that we
-    * recognize:
-    *
-    *   [ OPC Channel, First OPC Pixel, First output pixel, Pixel count ]
-    */
-
-    unsigned msgPixelCount = msg.length() / 3;
-
-    if (inst.IsArray() && inst.Size() == 4) {
-        // Map a range from an OPC channel to our framebuffer
-
-        const Value &vChannel = inst[0u];
-        const Value &vFirstOPC = inst[1];
-        const Value &vFirstOut = inst[2];
-        const Value &vCount = inst[3];
-
-        if (vChannel.IsUint() && vFirstOPC.IsUint() && vFirstOut.IsUint() && vCount.IsInt()) {
-            unsigned channel = vChannel.GetUint();
-            unsigned firstOPC = vFirstOPC.GetUint();
-            unsigned firstOut = vFirstOut.GetUint();
-            unsigned count;
-            int direction;
-            if (vCount.GetInt() >= 0) {
-                count = vCount.GetInt();
-                direction = 1;
-            }
-            else {
-                count = -vCount.GetInt();
-                direction = -1;
-            }
-
-            if (channel != msg.channel) {
-                return;
-            }
-
-            // Clamping, overflow-safe
-            firstOPC = std::min<unsigned>(firstOPC, msgPixelCount);
-            firstOut = std::min<unsigned>(firstOut, mNumLights);
-            count = std::min<unsigned>(count, msgPixelCount - firstOPC);
-            count = std::min<unsigned>(count,
-                direction > 0 ? mNumLights - firstOut : firstOut + 1);
-
-            // Copy pixels
-            const uint8_t *inPtr = msg.data + (firstOPC * 3);
-            unsigned outIndex = firstOut;
-            while (count--) {
-                PixelFrame *outPtr = fbPixel(outIndex);
-                outIndex += direction;
-                outPtr->r = inPtr[0];
-                outPtr->g = inPtr[1];
-                outPtr->b = inPtr[2];
-                outPtr->l = 0xEF; // todo: fix so we actually pass brightness
-                inPtr += 3;
-            }
-
-            return;
-        }
-    }
+     * Report the mapped frame as a flat RGB integer array in
+     * msg["snapshot"]; see FCDevice::jsonPixelSnapshot(). The raw copy
+     * happens inside the seqlock read and the JSON conversion outside it,
+     * so a slow monitor connection can't force extra retries.
+     */
 
-    // Still haven't found a match?
-    if (mVerbose) {
-        rapidjson::GenericStringBuffer<rapidjson::UTF8<> > buffer;
-        rapidjson::Writer<rapidjson::GenericStringBuffer<rapidjson::UTF8<> > > writer(buffer);
-        inst.Accept(writer);
-        std::clog << "Unsupported JSON mapping instruction: " << buffer.GetString() << "\n";
+    std::vector<PixelFrame> snapshot(mNumLights);
+    uint32_t seq;
+
+    do {
+        seq = mFrameBufferSeqlock.readBegin();
+        memcpy(&snapshot[0], fbPixel(0), mNumLights * sizeof(PixelFrame));
+    } while (mFrameBufferSeqlock.readRetry(seq));
+
+    rapidjson::Value pixels(rapidjson::kArrayType);
+    for (uint32_t i = 0; i < mNumLights; i++) {
+        rapidjson::Value r(unsigned(snapshot[i].r));
+        rapidjson::Value g(unsigned(snapshot[i].g));
+        rapidjson::Value b(unsigned(snapshot[i].b));
+        pixels.PushBack(r, msg.GetAllocator());
+        pixels.PushBack(g, msg.GetAllocator());
+        pixels.PushBack(b, msg.GetAllocator());
     }
+    msg.AddMember("snapshot", pixels, msg.GetAllocator());
 }
 
 void APA102SPIDevice::describe(rapidjson::Value &object, Allocator &alloc)
 {
     SPIDevice::describe(object, alloc);
     object.AddMember("numLights", mNumLights, alloc);
+
+    mWriteMutex.lock();
+    uint64_t coalesced = mCoalescedFrames;
+    mWriteMutex.unlock();
+    object.AddMember("coalesced_frames", coalesced, alloc);
 }
@@ -25,7 +25,11 @@
 #pragma once
 #include "spidevice.h"
 #include "opc.h"
+#include "pixelmapper.h"
+#include "seqlock.h"
+#include "tinythread.h"
 #include <set>
+#include <vector>
 
 
 class APA102SPIDevice : public SPIDevice
@@ -35,6 +39,7 @@ public:
     virtual ~APA102SPIDevice();
 
     virtual void loadConfiguration(const Value &config);
+    virtual bool getOPCChannels(std::set<unsigned> &channels);
     virtual void writeMessage(const OPC::Message &msg);
     virtual void writeMessage(Document &msg);
     virtual std::string getName();
@@ -43,11 +48,13 @@ public:
     static const char* DEVICE_TYPE;
 
     virtual void describe(rapidjson::Value &object, Allocator &alloc);
+    virtual void writeDevicePixels(const uint8_t *rgb, unsigned numPixels);
 
 private:
     static const uint32_t START_FRAME = 0x00000000;
     static const uint32_t END_FRAME = 0xFFFFFFFF;
     static const uint32_t BRIGHTNESS_MASK = 0xE0;
+    static const uint32_t BRIGHTNESS_HEADER = 0xE0;     // Required high bits of the brightness byte
 
     union PixelFrame
     {
@@ -62,11 +69,102 @@ private:
         uint32_t value;
     };
 
+    // Pixel writer adapter for PixelMapper, targeting mFrameBuffer
+    struct FramebufferWriter {
+        APA102SPIDevice &device;
+        FramebufferWriter(APA102SPIDevice &device) : device(device) {}
+        unsigned numPixels() const { return device.mNumLights; }
+        void writePixel(unsigned index, uint8_t r, uint8_t g, uint8_t b) {
+            PixelFrame *out = device.fbPixel(index);
+            out->r = r;
+            out->g = g;
+            out->b = b;
+            out->l = 0xEF; // todo: fix so we actually pass brightness
+        }
+    };
+
     const Value *mConfigMap;
+    PixelMapper::Program mCompiledMap;
+
+    // Publishes mFrameBuffer to "device_pixel_snapshot" readers. The
+    // seqlock allows one writer at a time, so every framebuffer fill
+    // brackets it under mWriteMutex; writers pay two increments, and
+    // snapshot readers never block them.
+    Seqlock mFrameBufferSeqlock;
     PixelFrame* mFrameBuffer;
     PixelFrame* mFlushBuffer;
     uint32_t mNumLights;
 
+    /*
+     * Dedicated SPI writer thread with double buffering. A long APA102
+     * chain takes milliseconds to stream; doing that on the output worker
+     * would stall mapping of the next frame. writeBuffer() copies the
+     * mapped frame into whichever half the writer isn't streaming and
+     * returns; if the writer hasn't picked up the previous frame yet, the
+     * newer frame replaces it and the older one is counted as coalesced.
+     *
+     * mWriteMutex guards the buffer state; mPortMutex serializes the
+     * actual SPI transactions, which happen outside mWriteMutex.
+     */
+    tthread::mutex mWriteMutex;
+    tthread::mutex mPortMutex;
+    tthread::condition_variable mWriteCond;
+    tthread::thread *mWriteThread;
+    PixelFrame *mDoubleBuffer[2];
+    unsigned mPendingIndex;
+    unsigned mStreamingIndex;
+    bool mWritePending;
+    bool mWriterRunning;
+    uint64_t mCoalescedFrames;
+
+    /*
+     * Temporal dithering. The APA102 path quantizes straight to 8 bits,
+     * which bands low-brightness gradients that Fadecandy boards smooth
+     * out in firmware. With dithering on, each channel keeps a 16-bit
+     * target and a running quantization residual; the writer thread
+     * repaints and restreams between input frames, so the time-average of
+     * the 8-bit output converges on the 16-bit target. The APA102's high
+     * PWM frequency hides the flicker. Guarded by mWriteMutex.
+     */
+    bool mDither;
+    bool mDitherActive;
+    std::vector<uint16_t> mDitherTargets;   // 3 per pixel, r/g/b
+    std::vector<int16_t> mDitherResiduals;
+
+    /*
+     * Extended dynamic range via the APA102's 5-bit global brightness
+     * field: each pixel's 16-bit color is factored into (brightness x
+     * 8-bit color), for roughly 13 bits of effective range per channel.
+     * The brightness choice is one table lookup on the pixel's brightest
+     * channel, and the residual feedback in the dither loop absorbs the
+     * factorization's rounding error.
+     */
+    /*
+     * Optional keyframe interpolation, matching what Fadecandy firmware
+     * does in hardware: the writer thread blends from the frame being
+     * shown toward the newest frame over the interval between the last
+     * two arrivals, so 30 fps input plays back smoothly at the restream
+     * rate. Adds roughly one input frame of latency, hence opt-in.
+     */
+    bool mInterpolate;
+    std::vector<uint16_t> mKeyPrev;     // Blend start, captured at arrival
+    std::vector<uint16_t> mKeyNext;     // Newest keyframe
+    uint64_t mKeyArrival;               // Monotonic microseconds
+    uint64_t mKeyDuration;
+
+    void blendKeyframes(uint64_t now);
+
+    bool mHdr;
+    uint8_t mBrightnessLUT[256];    // High byte of brightest channel -> 5-bit brightness
+    uint16_t mBrightnessRecip[32];  // 16-bit target -> 8-bit color, as a >>14 multiply
+    uint16_t mBrightnessScale[32];  // 8-bit color -> realized 16-bit value, as a >>8 multiply
+
+    void ditherOutputFrame(PixelFrame *out);
+    void hdrQuantizeFrame(PixelFrame *out);
+
+    static void writeThreadFunc(void *arg);
+    void writeThreadLoop();
+
     // buffer accessor
     PixelFrame *fbPixel(unsigned num) {
         return &mFrameBuffer[num + 1];
@@ -74,7 +172,7 @@ private:
 
     void writeBuffer();
     void writeDevicePixels(Document &msg);
+    void jsonPixelSnapshot(Document &msg);
 
     void opcSetPixelColors(const OPC::Message &msg);
-    void opcMapPixelColors(const OPC::Message &msg, const Value &inst);
 };
@@ -0,0 +1,175 @@
+/*
+ * Asynchronous, rate-limited diagnostic logging.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "asynclog.h"
+#include "spscqueue.h"      // For SPSC_MEMORY_BARRIER()
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef OS_LINUX
+#include <time.h>
+#else
+#include <libusb.h> // Also brings in gettimeofday() in a portable way
+#endif
+
+
+AsyncLog::AsyncLog()
+    : mHead(0), mTail(0), mDroppedLines(0), mThread(0)
+{
+    for (unsigned i = 0; i < SLOTS; i++) {
+        mSlots[i].sequence = i;
+    }
+}
+
+AsyncLog &AsyncLog::instance()
+{
+    // Constructed before main() starts any threads
+    static AsyncLog log;
+    return log;
+}
+
+uint64_t AsyncLog::monotonicMilliseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000ULL + tv.tv_usec / 1000;
+#endif
+}
+
+void AsyncLog::write(const char *line)
+{
+    AsyncLog &self = instance();
+    uint32_t pos;
+    Slot *slot;
+
+    /*
+     * Claim a slot by advancing mHead, but only when the slot at that
+     * position has been recycled by the consumer. A full ring drops the
+     * line; a producer never waits here.
+     */
+
+    for (;;) {
+        pos = self.mHead;
+        slot = &self.mSlots[pos % SLOTS];
+        int32_t dif = int32_t(slot->sequence) - int32_t(pos);
+
+        if (dif == 0) {
+            if (__sync_bool_compare_and_swap(&self.mHead, pos, pos + 1)) {
+                break;
+            }
+        } else if (dif < 0) {
+            // Ring full; the logger thread is behind
+            __sync_fetch_and_add(&self.mDroppedLines, 1);
+            return;
+        }
+        // Another producer claimed this slot; retry with the new head
+    }
+
+    strncpy(slot->text, line, MAX_LINE_BYTES - 1);
+    slot->text[MAX_LINE_BYTES - 1] = '\0';
+
+    // Publish the slot after its contents are visible
+    SPSC_MEMORY_BARRIER();
+    slot->sequence = pos + 1;
+
+    if (!self.mThread) {
+        /*
+         * Lazily start the logger thread on first use. Rarely, two
+         * producers can race here; the mutex inside thread creation is
+         * off the frame path, and the flag check keeps one winner.
+         */
+        static volatile uint32_t starting = 0;
+        if (__sync_bool_compare_and_swap(&starting, 0, 1)) {
+            self.mThread = new tthread::thread(threadFunc, &self);
+        }
+    }
+}
+
+bool AsyncLog::allow(RateLimit &limit, unsigned perSecond)
+{
+    uint64_t now = monotonicMilliseconds();
+
+    if (now - limit.windowStartMs >= 1000) {
+        // New window; report anything the previous one suppressed
+        if (limit.suppressed) {
+            char buf[MAX_LINE_BYTES];
+            snprintf(buf, sizeof buf, "(rate limit: %u similar messages suppressed)\n",
+                limit.suppressed);
+            write(buf);
+        }
+        limit.windowStartMs = now;
+        limit.granted = 0;
+        limit.suppressed = 0;
+    }
+
+    if (limit.granted < perSecond) {
+        limit.granted++;
+        return true;
+    }
+
+    limit.suppressed++;
+    return false;
+}
+
+void AsyncLog::threadFunc(void *arg)
+{
+    ((AsyncLog*) arg)->run();
+}
+
+void AsyncLog::run()
+{
+    /*
+     * Drain the ring in order, sleeping briefly when it's empty; the same
+     * short poll the output workers use. All terminal I/O happens here,
+     * where blocking is harmless.
+     */
+
+    for (;;) {
+        uint32_t pos = mTail;
+        Slot &slot = mSlots[pos % SLOTS];
+
+        if (int32_t(slot.sequence) - int32_t(pos + 1) != 0) {
+            uint32_t dropped = mDroppedLines;
+            if (dropped) {
+                __sync_fetch_and_add(&mDroppedLines, -int32_t(dropped));
+                std::clog << "(log overflow: " << dropped << " lines dropped)\n";
+            }
+            tthread::this_thread::sleep_for(tthread::chrono::milliseconds(1));
+            continue;
+        }
+
+        SPSC_MEMORY_BARRIER();
+        std::clog << slot.text;
+
+        // Recycle the slot for the producer one lap ahead
+        SPSC_MEMORY_BARRIER();
+        slot.sequence = pos + SLOTS;
+        mTail = pos + 1;
+    }
+}
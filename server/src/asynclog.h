@@ -0,0 +1,91 @@
+/*
+ * Asynchronous, rate-limited diagnostic logging.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include <stdint.h>
+#include "tinythread.h"
+
+
+/*
+ * std::clog blocks on the terminal, so a log line in a frame path can stall
+ * pixel delivery whenever the console is slow. AsyncLog::write() instead
+ * copies the line into a bounded lock-free ring, drained by a background
+ * thread that does the actual I/O. When the ring is full the line is
+ * dropped and counted; diagnostics never apply backpressure.
+ *
+ * Hot call sites pair write() with a static RateLimit, so one misbehaving
+ * client produces a few lines per second instead of one per frame.
+ */
+
+class AsyncLog
+{
+public:
+    // Longest line the ring can carry; longer ones are truncated
+    static const unsigned MAX_LINE_BYTES = 240;
+
+    // Queue one NUL-terminated line for the logger thread. Never blocks
+    // on I/O; safe to call from any thread, including USB completions.
+    static void write(const char *line);
+
+    /*
+     * Per-site rate limiter. Declare one as zero-initialized static
+     * storage at the call site; allow() grants up to 'perSecond' lines
+     * each second, and reports how many were suppressed when the next
+     * window opens. Concurrent callers can miscount slightly, which for
+     * diagnostics is a fine trade against taking a lock.
+     */
+    struct RateLimit {
+        uint64_t windowStartMs;
+        uint32_t granted;
+        uint32_t suppressed;
+    };
+    static bool allow(RateLimit &limit, unsigned perSecond);
+
+private:
+    // Ring geometry; SLOTS must be a power of two
+    static const unsigned SLOTS = 64;
+
+    /*
+     * Bounded multi-producer ring. Each slot carries a sequence number:
+     * a producer may claim slot (head % SLOTS) when its sequence equals
+     * head, and publishes by storing head+1; the consumer recycles the
+     * slot by storing head+SLOTS. Producers that find the ring full drop
+     * the line rather than spin.
+     */
+    struct Slot {
+        volatile uint32_t sequence;
+        char text[MAX_LINE_BYTES];
+    };
+
+    Slot mSlots[SLOTS];
+    volatile uint32_t mHead;
+    volatile uint32_t mTail;
+    volatile uint32_t mDroppedLines;
+    tthread::thread *mThread;
+
+    AsyncLog();
+    static AsyncLog &instance();
+    static uint64_t monotonicMilliseconds();
+    static void threadFunc(void *arg);
+    void run();
+};
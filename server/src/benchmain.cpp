@@ -0,0 +1,326 @@
+/*
+ * Headless benchmark driver for the fcserver dispatch path.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * fcserver-bench replays an OPC stream through the real dispatch path —
+ * routing table, output workers, pixel mapping — against devices that
+ * complete their "transfers" immediately, so a mapping or dispatch change
+ * can be measured without hardware. It reports injected messages per
+ * second, frames mapped and dropped, and receive-to-mapping latency
+ * percentiles.
+ *
+ * usage: fcserver-bench <config.json> [stream.opc] [message count]
+ *
+ * The stream file is either a RecordDevice capture (see recordfile.h) or
+ * raw concatenated OPC messages (4-byte header plus payload), e.g. a
+ * capture from the relay port. Without one, a synthetic 512-pixel
+ * SetPixelColors frame on channel 0 is replayed.
+ */
+
+#include "rapidjson/document.h"
+#include "rapidjson/filestream.h"
+#include "fcserver.h"
+#include "usbdevice.h"
+#include "pixelmapper.h"
+#include "recordfile.h"
+#include <algorithm>
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "tinythread.h"
+
+#ifdef OS_LINUX
+#include <time.h>
+#else
+#include <sys/time.h>
+#endif
+
+
+static uint64_t monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+
+/*
+ * Null device: runs the real PixelMapper against a real config entry, and
+ * completes each frame immediately instead of submitting USB transfers.
+ * Latency samples measure transport timestamp to end-of-mapping, on the
+ * output worker thread, matching where a hardware device would hand the
+ * frame to libusb.
+ */
+
+class BenchDevice : public USBDevice
+{
+public:
+    static const unsigned NUM_PIXELS = 512;
+
+    BenchDevice(bool verbose)
+        : USBDevice(0, "bench", verbose),
+          mConfigMap(0), mFramesMapped(0)
+    {
+        memset(mFramebuffer, 0, sizeof mFramebuffer);
+        mLatencies.reserve(1 << 20);
+    }
+
+    virtual int open() { return 0; }
+    virtual void flush() {}
+    virtual std::string getName() { return "Null benchmark device"; }
+
+    virtual void loadConfiguration(const Value &config)
+    {
+        mConfigMap = findConfigMap(config);
+        PixelMapper::compile(mCompiledMap, mConfigMap, mVerbose);
+    }
+
+    virtual bool getOPCChannels(std::set<unsigned> &channels)
+    {
+        if (!mConfigMap) {
+            return false;
+        }
+        PixelMapper::programChannels(mCompiledMap, channels);
+        return true;
+    }
+
+    virtual void writeMessage(const OPC::Message &msg)
+    {
+        if (msg.command == OPC::SetPixelColors) {
+            FramebufferWriter writer(*this);
+            PixelMapper::run(mCompiledMap, msg, writer);
+            mFramesMapped++;
+            if (mReceiveTimestamp) {
+                mLatencies.push_back(monotonicMicroseconds() - mReceiveTimestamp);
+            }
+        }
+    }
+
+    uint64_t framesMapped() const { return mFramesMapped; }
+    uint64_t framesDropped() const { return mOutputWorker.droppedFrames(); }
+    unsigned queueDepthNow() { return getQueueDepth(); }
+    const std::vector<uint64_t> &latencies() const { return mLatencies; }
+
+private:
+    struct FramebufferWriter {
+        BenchDevice &device;
+        FramebufferWriter(BenchDevice &device) : device(device) {}
+        unsigned numPixels() const { return NUM_PIXELS; }
+        void writePixel(unsigned index, uint8_t r, uint8_t g, uint8_t b) {
+            uint8_t *out = &device.mFramebuffer[3 * index];
+            out[0] = r;
+            out[1] = g;
+            out[2] = b;
+        }
+    };
+
+    const Value *mConfigMap;
+    PixelMapper::Program mCompiledMap;
+    uint8_t mFramebuffer[NUM_PIXELS * 3];
+    uint64_t mFramesMapped;
+    std::vector<uint64_t> mLatencies;
+};
+
+
+static uint64_t percentile(const std::vector<uint64_t> &sorted, double p)
+{
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t index = (size_t)(p * (sorted.size() - 1));
+    return sorted[index];
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2 || argc > 4) {
+        fprintf(stderr, "usage: fcserver-bench <config.json> [stream.opc] [message count]\n");
+        return 1;
+    }
+
+    rapidjson::Document config;
+    FILE *configFile = fopen(argv[1], "r");
+    if (!configFile) {
+        perror("Error opening config file");
+        return 2;
+    }
+    rapidjson::FileStream istr(configFile);
+    config.ParseStream<0>(istr);
+    fclose(configFile);
+
+    if (config.HasParseError()) {
+        fprintf(stderr, "Parse error at character %d: %s\n",
+            int(config.GetErrorOffset()), config.GetParseError());
+        return 3;
+    }
+
+    FCServer server(config);
+    if (server.hasError()) {
+        fprintf(stderr, "Configuration errors:\n%s", server.errorText().c_str());
+        return 5;
+    }
+
+    // One null device per configured device entry, so routing and fan-out
+    // behave as they would with the boards attached.
+    const rapidjson::Value &devices = config["devices"];
+    std::vector<BenchDevice*> benchDevices;
+    for (unsigned i = 0; i < devices.Size(); ++i) {
+        BenchDevice *dev = new BenchDevice(false);
+        dev->loadConfiguration(devices[i]);
+        server.attachBenchmarkDevice(dev);
+        benchDevices.push_back(dev);
+    }
+    if (benchDevices.empty()) {
+        fprintf(stderr, "No devices configured; nothing to benchmark.\n");
+        return 4;
+    }
+
+    /*
+     * Load the replay stream: a RecordDevice capture, or raw concatenated
+     * OPC messages. Either way the messages are indexed as pointers into a
+     * persistent buffer up front, so the replay loop does no copying.
+     */
+    std::vector<uint8_t> stream;
+    std::vector<OPC::Message*> messages;
+    RecordFile::Reader capture;
+
+    if (argc >= 3 && RecordFile::Reader::probe(argv[2])) {
+        if (!capture.open(argv[2])) {
+            return 2;
+        }
+        uint64_t timestamp;
+        OPC::Message *msg;
+        while (capture.next(timestamp, msg)) {
+            messages.push_back(msg);
+        }
+        if (messages.empty()) {
+            fprintf(stderr, "Capture file holds no messages.\n");
+            return 4;
+        }
+    } else if (argc >= 3) {
+        FILE *streamFile = fopen(argv[2], "rb");
+        if (!streamFile) {
+            perror("Error opening stream file");
+            return 2;
+        }
+        fseek(streamFile, 0, SEEK_END);
+        long size = ftell(streamFile);
+        fseek(streamFile, 0, SEEK_SET);
+        stream.resize(size);
+        if (fread(&stream[0], 1, size, streamFile) != (size_t)size) {
+            fprintf(stderr, "Error reading stream file\n");
+            return 2;
+        }
+        fclose(streamFile);
+
+        size_t pos = 0;
+        while (pos + OPC::HEADER_BYTES <= stream.size()) {
+            OPC::Message *msg = (OPC::Message*) &stream[pos];
+            size_t total = OPC::HEADER_BYTES + msg->length();
+            if (pos + total > stream.size()) {
+                fprintf(stderr, "Truncated message at offset %u; ignoring the remainder.\n",
+                    (unsigned) pos);
+                break;
+            }
+            messages.push_back(msg);
+            pos += total;
+        }
+        if (messages.empty()) {
+            fprintf(stderr, "No OPC messages found in stream file.\n");
+            return 4;
+        }
+    } else {
+        // Synthetic frame: full 512-pixel SetPixelColors on channel 0
+        stream.resize(OPC::HEADER_BYTES + BenchDevice::NUM_PIXELS * 3);
+        OPC::Message *msg = (OPC::Message*) &stream[0];
+        msg->channel = 0;
+        msg->command = OPC::SetPixelColors;
+        msg->setLength(BenchDevice::NUM_PIXELS * 3);
+        for (unsigned i = 0; i < BenchDevice::NUM_PIXELS * 3; ++i) {
+            msg->data[i] = (uint8_t) i;
+        }
+        messages.push_back(msg);
+    }
+
+    uint64_t totalMessages = argc >= 4 ? strtoull(argv[3], 0, 10) : 100000;
+
+    fprintf(stderr, "Replaying %u unique message(s), %llu total, into %u device(s)...\n",
+        (unsigned) messages.size(), (unsigned long long) totalMessages,
+        (unsigned) benchDevices.size());
+
+    // Replay at maximum speed through the transport callback
+    uint64_t started = monotonicMicroseconds();
+    for (uint64_t n = 0; n < totalMessages; ++n) {
+        server.injectOpcMessage(*messages[n % messages.size()]);
+    }
+    uint64_t injectElapsed = monotonicMicroseconds() - started;
+
+    // Let the output workers drain before reading their counters
+    for (;;) {
+        unsigned depth = 0;
+        for (unsigned i = 0; i < benchDevices.size(); ++i) {
+            depth += benchDevices[i]->queueDepthNow();
+        }
+        if (!depth) {
+            break;
+        }
+        tthread::this_thread::sleep_for(tthread::chrono::milliseconds(1));
+    }
+    uint64_t drainElapsed = monotonicMicroseconds() - started;
+
+    uint64_t framesMapped = 0;
+    uint64_t framesDropped = 0;
+    std::vector<uint64_t> latencies;
+    for (unsigned i = 0; i < benchDevices.size(); ++i) {
+        framesMapped += benchDevices[i]->framesMapped();
+        framesDropped += benchDevices[i]->framesDropped();
+        const std::vector<uint64_t> &samples = benchDevices[i]->latencies();
+        latencies.insert(latencies.end(), samples.begin(), samples.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    printf("messages injected:  %llu in %.3f s (%.0f msg/s)\n",
+        (unsigned long long) totalMessages, injectElapsed / 1e6,
+        totalMessages * 1e6 / (injectElapsed ? injectElapsed : 1));
+    printf("frames mapped:      %llu (drained after %.3f s)\n",
+        (unsigned long long) framesMapped, drainElapsed / 1e6);
+    printf("frames dropped:     %llu (queue full; expected at maximum speed)\n",
+        (unsigned long long) framesDropped);
+    printf("latency (receive to end of mapping, over %u samples):\n",
+        (unsigned) latencies.size());
+    printf("    p50 %8llu us\n", (unsigned long long) percentile(latencies, 0.50));
+    printf("    p90 %8llu us\n", (unsigned long long) percentile(latencies, 0.90));
+    printf("    p99 %8llu us\n", (unsigned long long) percentile(latencies, 0.99));
+    printf("    max %8llu us\n",
+        (unsigned long long) (latencies.empty() ? 0 : latencies.back()));
+
+    return 0;
+}
@@ -22,15 +22,18 @@
  */
 
 #include "enttecdmxdevice.h"
+#include "rtsched.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
 #include "opc.h"
 #include <sstream>
 #include <iostream>
+#include <algorithm>
+#include <math.h>
 
 
 EnttecDMXDevice::Transfer::Transfer(EnttecDMXDevice *device, void *buffer, int length)
-    : transfer(libusb_alloc_transfer(0)), finished(false)
+    : transfer(libusb_alloc_transfer(0)), device(device), finished(false)
 {
     libusb_fill_bulk_transfer(transfer, device->mHandle,
         OUT_ENDPOINT, (uint8_t*) buffer, length, EnttecDMXDevice::completeTransfer, this, 2000);
@@ -41,24 +44,68 @@ EnttecDMXDevice::Transfer::~Transfer()
     libusb_free_transfer(transfer);
 }
 
+static uint64_t monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000000ULL + tv.tv_usec;
+#endif
+}
+
 EnttecDMXDevice::EnttecDMXDevice(libusb_device *device, bool verbose)
     : USBDevice(device, "enttec", verbose),
       mFoundEnttecStrings(false),
-      mConfigMap(0)
+      mConfigMap(0),
+      mNumUniverses(1),
+      mInterpolate(false),
+      mBlendThread(0),
+      mBlendRunning(false),
+      mKeyArrival(0),
+      mKeyDuration(0),
+      mUniverseInFlight(false),
+      mLastSubmit(0)
 {
+    memset(mKeyPrev, 0, sizeof mKeyPrev);
+    memset(mKeyNext, 0, sizeof mKeyNext);
+    memset(mDirty, 0, sizeof mDirty);
+
+    // Identity correction until writeColorCorrection() says otherwise
+    for (unsigned c = 0; c < 4; c++) {
+        for (unsigned i = 0; i < 256; i++) {
+            mColorLUT[c][i] = i;
+        }
+    }
+
     mSerialBuffer[0] = '\0';
     mSerialString = mSerialBuffer;
 
-    // Initialize a minimal valid DMX packet
-    memset(&mChannelBuffer, 0, sizeof mChannelBuffer);
-    mChannelBuffer.start = START_OF_MESSAGE;
-    mChannelBuffer.label = SEND_DMX_PACKET;
-    mChannelBuffer.data[0] = START_CODE;
-    setChannel(1, 0);
+    // Initialize a minimal valid DMX packet for each port
+    memset(mChannelBuffer, 0, sizeof mChannelBuffer);
+    for (unsigned u = 0; u < MAX_UNIVERSES; u++) {
+        mChannelBuffer[u].start = START_OF_MESSAGE;
+        mChannelBuffer[u].label = u ? SEND_DMX_PORT2 : SEND_DMX_PACKET;
+        mChannelBuffer[u].data[0] = START_CODE;
+    }
+    setChannel(0, 1, 0);
 }
 
 EnttecDMXDevice::~EnttecDMXDevice()
 {
+    // Stop the output worker before tearing down any state it might touch.
+    mOutputWorker.stop();
+
+    // Then the blend thread it feeds
+    if (mBlendThread) {
+        mBlendRunning = false;
+        mBlendThread->join();
+        delete mBlendThread;
+    }
+
     /*
      * If we have pending transfers, cancel them.
      * The Transfer objects themselves will be freed once libusb completes them.
@@ -157,6 +204,62 @@ bool EnttecDMXDevice::probeAfterOpening()
 void EnttecDMXDevice::loadConfiguration(const Value &config)
 {
     mConfigMap = findConfigMap(config);
+
+    // Optional server-side keyframe interpolation
+    const Value &interpolate = config["interpolate"];
+    mInterpolate = interpolate.IsTrue();
+    if (!(interpolate.IsTrue() || interpolate.IsFalse() || interpolate.IsNull()) && mVerbose) {
+        std::clog << "Interpolate configuration must be true or false.\n";
+    }
+
+    // Optional second universe, for the Pro Mk2's second port
+    const Value &universes = config["universes"];
+    if (universes.IsUint() && universes.GetUint() >= 1 && universes.GetUint() <= MAX_UNIVERSES) {
+        mNumUniverses = universes.GetUint();
+        if (mNumUniverses > 1) {
+            sendMk2Enable();
+        }
+    } else if (!universes.IsNull() && mVerbose) {
+        std::clog << "Universe count must be 1 or " << MAX_UNIVERSES << ".\n";
+    }
+}
+
+void EnttecDMXDevice::sendMk2Enable()
+{
+    /*
+     * The Pro Mk2 speaks the original Pro protocol until it's unlocked
+     * with the API key from Enttec's Mk2 API document; after that, port
+     * assignment switches both physical ports to DMX output. Both
+     * messages ride in one bulk transfer. Harmless if sent to an
+     * original Pro, which ignores labels it doesn't recognize.
+     */
+
+    uint8_t *p = mMk2EnableBuffer;
+
+    *(p++) = START_OF_MESSAGE;
+    *(p++) = SET_API_KEY;
+    *(p++) = 4;
+    *(p++) = 0;
+    *(p++) = 0xC9;
+    *(p++) = 0xA4;
+    *(p++) = 0x03;
+    *(p++) = 0xE4;
+    *(p++) = END_OF_MESSAGE;
+
+    *(p++) = START_OF_MESSAGE;
+    *(p++) = SET_PORT_ASSIGNMENT;
+    *(p++) = 2;
+    *(p++) = 0;
+    *(p++) = 1;     // Port 1: DMX output
+    *(p++) = 1;     // Port 2: DMX output
+    *(p++) = END_OF_MESSAGE;
+
+    submitTransfer(new Transfer(this, mMk2EnableBuffer, p - mMk2EnableBuffer));
+}
+
+bool EnttecDMXDevice::getOPCChannels(std::set<unsigned> &channels)
+{
+    return findMapChannels(mConfigMap, channels);
 }
 
 std::string EnttecDMXDevice::getName()
@@ -169,13 +272,17 @@ std::string EnttecDMXDevice::getName()
     return s.str();
 }
 
-void EnttecDMXDevice::setChannel(unsigned n, uint8_t value)
+void EnttecDMXDevice::setChannel(unsigned universe, unsigned n, uint8_t value)
 {
-    if (n >= 1 && n <= 512) {
-        unsigned len = std::max<unsigned>(mChannelBuffer.length, n + 1);
-        mChannelBuffer.length = len;
-        mChannelBuffer.data[n] = value;
-        mChannelBuffer.data[len] = END_OF_MESSAGE;
+    if (universe < mNumUniverses && n >= 1 && n <= 512) {
+        Packet &packet = mChannelBuffer[universe];
+        unsigned len = std::max<unsigned>(packet.length, n + 1);
+        if (len != packet.length || packet.data[n] != value) {
+            mDirty[universe] = true;
+        }
+        packet.length = len;
+        packet.data[n] = value;
+        packet.data[len] = END_OF_MESSAGE;
     }
 }
 
@@ -194,20 +301,31 @@ void EnttecDMXDevice::submitTransfer(Transfer *fct)
         }
         delete fct;
     } else {
+        mPendingMutex.lock();
         mPending.insert(fct);
+        mPendingMutex.unlock();
     }
 }
 
 void EnttecDMXDevice::completeTransfer(struct libusb_transfer *transfer)
 {
     EnttecDMXDevice::Transfer *fct = static_cast<EnttecDMXDevice::Transfer*>(transfer->user_data);
+    EnttecDMXDevice *self = fct->device;
     fct->finished = true;
+
+    self->mPendingMutex.lock();
+    self->mUniverseInFlight = false;
+    self->mPendingMutex.unlock();
+
+    // If updates were coalesced while this packet was in flight, follow up
+    self->maybeWriteDMXPacket();
 }
 
 void EnttecDMXDevice::flush()
 {
     // Erase any finished transfers
 
+    mPendingMutex.lock();
     std::set<Transfer*>::iterator current = mPending.begin();
     while (current != mPending.end()) {
         std::set<Transfer*>::iterator next = current;
@@ -221,19 +339,193 @@ void EnttecDMXDevice::flush()
 
         current = next;
     }
+    mPendingMutex.unlock();
+
+    // Opportunistically send a universe the cadence held back earlier
+    maybeWriteDMXPacket();
+}
+
+void EnttecDMXDevice::blendThreadFunc(void *arg)
+{
+    ((EnttecDMXDevice*) arg)->blendThreadLoop();
+}
+
+void EnttecDMXDevice::blendThreadLoop()
+{
+    // This thread paces DMX output; include it in real-time mode
+    RtSched::applyToCurrentThread("dmx");
+
+    /*
+     * Emit intermediate packets at the DMX universe rate, blending from
+     * mKeyPrev toward mKeyNext in 16.16 fixed point. Once the blend
+     * completes, each tick just retransmits the keyframe, which doubles
+     * as the periodic refresh DMX fixtures expect.
+     */
+
+    while (mBlendRunning) {
+        mBlendMutex.lock();
+
+        uint64_t now = monotonicMicroseconds();
+        uint32_t alpha = 65536;
+        if (mKeyDuration && now - mKeyArrival < mKeyDuration) {
+            alpha = uint32_t(((now - mKeyArrival) << 16) / mKeyDuration);
+        }
+
+        for (unsigned u = 0; u < mNumUniverses; u++) {
+            Packet &packet = mChannelBuffer[u];
+            unsigned count = packet.length ? packet.length - 1 : 0;
+            for (unsigned i = 0; i < count && i < sizeof mKeyNext[u]; i++) {
+                int32_t prev = mKeyPrev[u][i];
+                int32_t next = mKeyNext[u][i];
+                packet.data[1 + i] = uint8_t(prev + ((next - prev) * int32_t(alpha) >> 16));
+            }
+        }
+
+        writeDMXPacket();
+        mBlendMutex.unlock();
+
+        tthread::this_thread::sleep_for(tthread::chrono::milliseconds(BLEND_INTERVAL_MS));
+    }
 }
 
 void EnttecDMXDevice::writeDMXPacket()
 {
     /*
-     * Asynchronously write an FTDI packet containing an Enttec packet containing
-     * our set of DMX channels.
-     *
-     * XXX: We should probably throttle this so that we don't send DMX messages
-     *      faster than the Enttec device can keep up!
+     * Asynchronously write an FTDI packet containing an Enttec packet per
+     * active universe. The FTDI side is a plain byte FIFO, so consecutive
+     * Enttec messages concatenate into a single bulk transfer; a two-port
+     * Mk2 pays one USB submission per frame, not one per universe.
      */
 
-    submitTransfer(new Transfer(this, &mChannelBuffer, mChannelBuffer.length + 5));
+    uint8_t *p = mBatchBuffer;
+
+    for (unsigned u = 0; u < mNumUniverses; u++) {
+        Packet &packet = mChannelBuffer[u];
+        if (packet.length) {
+            unsigned bytes = packet.length + 5;
+            memcpy(p, &packet, bytes);
+            p += bytes;
+        }
+    }
+
+    if (p != mBatchBuffer) {
+        submitTransfer(new Transfer(this, mBatchBuffer, p - mBatchBuffer));
+    }
+}
+
+void EnttecDMXDevice::maybeWriteDMXPacket()
+{
+    /*
+     * Submit the universes if any changed, keeping at most one packet in
+     * flight and no more than the wire's refresh cadence. A 60 fps OPC
+     * source coalesces down to the ~44 Hz the universe can carry; skipped
+     * frames just leave their values in the buffer for the next submit.
+     */
+
+    if (mInterpolate) {
+        // The blend thread paces its own submissions
+        return;
+    }
+
+    mPendingMutex.lock();
+
+    bool dirty = false;
+    for (unsigned u = 0; u < mNumUniverses; u++) {
+        dirty = dirty || mDirty[u];
+    }
+
+    uint64_t now = monotonicMicroseconds();
+    if (!dirty || mUniverseInFlight || now - mLastSubmit < DMX_REFRESH_INTERVAL_US) {
+        mPendingMutex.unlock();
+        return;
+    }
+
+    memset(mDirty, 0, sizeof mDirty);
+    mUniverseInFlight = true;
+    mLastSubmit = now;
+    mPendingMutex.unlock();
+
+    writeDMXPacket();
+}
+
+void EnttecDMXDevice::writeColorCorrection(const Value &color)
+{
+    /*
+     * Parse color correction settings from a JSON configuration object and
+     * rebuild the server-side lookup tables. The parameters and curve shape
+     * match FCDevice::computeLUT() -- a linear section near zero followed by
+     * a gamma curve, scaled per channel by the whitepoint -- so one "color"
+     * dictionary corrects a mixed rig consistently. 'color' may be 'null'
+     * for an identity mapping.
+     */
+
+    double gamma = 1.0;                 // Power for nonlinear portion of curve
+    double whitepoint[3] = { 1.0, 1.0, 1.0 };
+    double linearSlope = 1.0;           // Slope (output / input) of linear section of the curve, near zero
+    double linearCutoff = 0.0;          // Y (output) coordinate of intersection of linear and nonlinear curves
+
+    if (color.IsObject()) {
+        const Value &vGamma = color["gamma"];
+        const Value &vWhitepoint = color["whitepoint"];
+        const Value &vLinearSlope = color["linearSlope"];
+        const Value &vLinearCutoff = color["linearCutoff"];
+
+        if (vGamma.IsNumber()) {
+            gamma = vGamma.GetDouble();
+        } else if (!vGamma.IsNull() && mVerbose) {
+            std::clog << "Gamma value must be a number.\n";
+        }
+
+        if (vLinearSlope.IsNumber()) {
+            linearSlope = vLinearSlope.GetDouble();
+        } else if (!vLinearSlope.IsNull() && mVerbose) {
+            std::clog << "Linear slope value must be a number.\n";
+        }
+
+        if (vLinearCutoff.IsNumber()) {
+            linearCutoff = vLinearCutoff.GetDouble();
+        } else if (!vLinearCutoff.IsNull() && mVerbose) {
+            std::clog << "Linear cutoff value must be a number.\n";
+        }
+
+        if (vWhitepoint.IsArray() &&
+            vWhitepoint.Size() == 3 &&
+            vWhitepoint[0u].IsNumber() &&
+            vWhitepoint[1].IsNumber() &&
+            vWhitepoint[2].IsNumber()) {
+            whitepoint[0] = vWhitepoint[0u].GetDouble();
+            whitepoint[1] = vWhitepoint[1].GetDouble();
+            whitepoint[2] = vWhitepoint[2].GetDouble();
+        } else if (!vWhitepoint.IsNull() && mVerbose) {
+            std::clog << "Whitepoint value must be a list of 3 numbers.\n";
+        }
+
+    } else if (!color.IsNull() && mVerbose) {
+        std::clog << "Color correction value must be a JSON dictionary object.\n";
+    }
+
+    // Table 3 drives luminance selectors; use the averaged whitepoint
+    for (unsigned channel = 0; channel < 4; channel++) {
+        double wp = channel < 3 ? whitepoint[channel]
+            : (whitepoint[0] + whitepoint[1] + whitepoint[2]) / 3.0;
+
+        for (unsigned entry = 0; entry < 256; entry++) {
+            double input = (entry / 255.0) * wp;
+
+            // Linear section, then the gamma curve it hands off to;
+            // see FCDevice::computeLUT() for the rationale
+            double output = input * linearSlope;
+            if (output > linearCutoff) {
+                double linearRange = linearCutoff / linearSlope;
+                output = linearCutoff +
+                    pow((input - linearRange) / (1.0 - linearRange), gamma) * (1.0 - linearCutoff);
+            }
+
+            int64_t longValue = (output * 255.0) + 0.5;
+            mColorLUT[channel][entry] =
+                std::max<int64_t>(0, std::min<int64_t>(255, longValue));
+        }
+    }
 }
 
 void EnttecDMXDevice::writeMessage(const OPC::Message &msg)
@@ -245,8 +537,46 @@ void EnttecDMXDevice::writeMessage(const OPC::Message &msg)
     switch (msg.command) {
 
         case OPC::SetPixelColors:
+            if (mInterpolate) {
+                // The blend thread owns the submission cadence here
+                /*
+                 * Interpolated: the mapped channel values become the next
+                 * keyframe, blending from what's on the wire now; the
+                 * blend thread does the actual packet writes.
+                 */
+                mBlendMutex.lock();
+
+                // The wire currently shows the blend in mChannelBuffer
+                for (unsigned u = 0; u < mNumUniverses; u++) {
+                    memcpy(mKeyPrev[u], &mChannelBuffer[u].data[1], sizeof mKeyPrev[u]);
+                }
+                opcSetPixelColors(msg);
+                for (unsigned u = 0; u < mNumUniverses; u++) {
+                    memcpy(mKeyNext[u], &mChannelBuffer[u].data[1], sizeof mKeyNext[u]);
+                }
+
+                uint64_t now = monotonicMicroseconds();
+                if (mKeyArrival) {
+                    mKeyDuration = now - mKeyArrival;
+                    // Pause or resume: snap rather than crawl
+                    if (mKeyDuration > 500000) {
+                        mKeyDuration = 0;
+                    }
+                }
+                mKeyArrival = now;
+
+                if (!mBlendThread) {
+                    // Lazily start the blend thread, like the output workers
+                    mBlendRunning = true;
+                    mBlendThread = new tthread::thread(blendThreadFunc, this);
+                }
+
+                mBlendMutex.unlock();
+                return;
+            }
+
             opcSetPixelColors(msg);
-            writeDMXPacket();
+            maybeWriteDMXPacket();
             return;
 
         case OPC::SystemExclusive:
@@ -285,19 +615,32 @@ void EnttecDMXDevice::opcMapPixelColors(const OPC::Message &msg, const Value &in
      * recognize:
      *
      *   [ OPC Channel, OPC Pixel, Pixel Color, DMX Channel ]
+     *   [ OPC Channel, OPC Pixel, Pixel Color, DMX Channel, DMX Universe ]
+     *
+     * The universe, numbered from 1, defaults to the first port.
      */
 
     unsigned msgPixelCount = msg.length() / 3;
 
-    if (inst.IsArray() && inst.Size() == 4) {
+    if (inst.IsArray() && (inst.Size() == 4 || inst.Size() == 5)) {
         // Map a range from an OPC channel to our framebuffer
 
         const Value &vChannel = inst[0u];
         const Value &vPixelIndex = inst[1];
         const Value &vPixelColor = inst[2];
         const Value &vDMXChannel = inst[3];
+        unsigned universe = 1;
+
+        if (inst.Size() == 5) {
+            const Value &vUniverse = inst[4];
+            if (!vUniverse.IsUint() || vUniverse.GetUint() < 1) {
+                universe = 0;
+            } else {
+                universe = vUniverse.GetUint();
+            }
+        }
 
-        if (vChannel.IsUint() && vPixelIndex.IsUint() && vPixelColor.IsString() && vDMXChannel.IsUint()) {
+        if (universe && vChannel.IsUint() && vPixelIndex.IsUint() && vPixelColor.IsString() && vDMXChannel.IsUint()) {
             unsigned channel = vChannel.GetUint();
             unsigned pixelIndex = vPixelIndex.GetUint();
             const char *pixelColor = vPixelColor.GetString();
@@ -311,23 +654,34 @@ void EnttecDMXDevice::opcMapPixelColors(const OPC::Message &msg, const Value &in
             uint8_t value;
 
             if (OPC::pickColorChannel(value, pixelColor[0], pixel)) {
-                setChannel(dmxChannel, value);
+                setChannel(universe - 1, dmxChannel,
+                    mColorLUT[colorLUTIndex(pixelColor[0])][value]);
                 return;
             }
         }
     }
 
-    if (inst.IsArray() && inst.Size() == 2) {
+    if (inst.IsArray() && (inst.Size() == 2 || inst.Size() == 3)) {
         // Constant value
 
         const Value &vValue = inst[0u];
         const Value &vDMXChannel = inst[1];
+        unsigned universe = 1;
+
+        if (inst.Size() == 3) {
+            const Value &vUniverse = inst[2];
+            if (!vUniverse.IsUint() || vUniverse.GetUint() < 1) {
+                universe = 0;
+            } else {
+                universe = vUniverse.GetUint();
+            }
+        }
 
-        if (vValue.IsUint() && vDMXChannel.IsUint()) {
+        if (universe && vValue.IsUint() && vDMXChannel.IsUint()) {
             unsigned value = vValue.GetUint();
             unsigned dmxChannel = vDMXChannel.GetUint();
 
-            setChannel(dmxChannel, value);
+            setChannel(universe - 1, dmxChannel, value);
             return;
         }
     }
@@ -24,6 +24,8 @@
 #pragma once
 #include "usbdevice.h"
 #include "opc.h"
+#include "adaptivemutex.h"
+#include "tinythread.h"
 #include <set>
 
 
@@ -38,12 +40,15 @@ public:
     virtual int open();
     virtual bool probeAfterOpening();
     virtual void loadConfiguration(const Value &config);
+    virtual bool getOPCChannels(std::set<unsigned> &channels);
     virtual void writeMessage(const OPC::Message &msg);
+    virtual void writeColorCorrection(const Value &color);
     virtual std::string getName();
     virtual void flush();
 
     void writeDMXPacket();
-    void setChannel(unsigned n, uint8_t value);
+    void maybeWriteDMXPacket();
+    void setChannel(unsigned universe, unsigned n, uint8_t value);
 
 private:
     static const unsigned OUT_ENDPOINT = 2;
@@ -52,6 +57,12 @@ private:
     static const unsigned SEND_DMX_PACKET = 0x06;
     static const unsigned START_CODE = 0x00;
 
+    // Pro Mk2 extensions; the second port is locked behind an API key
+    static const unsigned MAX_UNIVERSES = 2;
+    static const unsigned SET_API_KEY = 0x0d;
+    static const unsigned SEND_DMX_PORT2 = 0xa9;
+    static const unsigned SET_PORT_ASSIGNMENT = 0xcb;
+
     struct Packet {
         uint8_t start;
         uint8_t label;
@@ -63,15 +74,92 @@ private:
         Transfer(EnttecDMXDevice *device, void *buffer, int length);
         ~Transfer();
         libusb_transfer *transfer;
+        EnttecDMXDevice *device;
         bool finished;
     };
 
     char mSerialBuffer[256];
     bool mFoundEnttecStrings;
     const Value *mConfigMap;
-    Packet mChannelBuffer;
+
+    /*
+     * One DMX universe per port. The original Pro has a single port;
+     * the Pro Mk2 adds a second, addressed with its own message label.
+     * A universe with zero channels mapped stays at length 0 and is
+     * never transmitted.
+     */
+    unsigned mNumUniverses;
+    Packet mChannelBuffer[MAX_UNIVERSES];
+
+    // Staging area for batched submission; all active universes are
+    // concatenated here and sent as a single bulk transfer.
+    uint8_t mBatchBuffer[MAX_UNIVERSES * sizeof(Packet)];
+
+    // Mk2 unlock handshake, kept alive while its transfer is in flight
+    uint8_t mMk2EnableBuffer[16];
+
+    /*
+     * Optional keyframe interpolation. DMX fixtures snap between 30 fps
+     * input frames; with "interpolate" set, arriving frames become
+     * keyframes and a blend thread emits intermediate packets at the DMX
+     * universe rate, blending from the values on the wire toward the
+     * newest keyframe over the interval between the last two arrivals.
+     * mBlendMutex guards the keyframes and mChannelBuffer.
+     */
+    static const unsigned BLEND_INTERVAL_MS = 25;
+
+    // A full 513-byte universe takes about 23 ms at 250 kbps; submitting
+    // faster than that only queues redundant serial traffic in the FTDI.
+    static const unsigned DMX_REFRESH_INTERVAL_US = 23000;
+
+    bool mInterpolate;
+    tthread::mutex mBlendMutex;
+    tthread::thread *mBlendThread;
+    volatile bool mBlendRunning;
+    uint8_t mKeyPrev[MAX_UNIVERSES][513];
+    uint8_t mKeyNext[MAX_UNIVERSES][513];
+    uint64_t mKeyArrival;       // Monotonic microseconds
+    uint64_t mKeyDuration;
+
+    /*
+     * Coalesced universe submission, guarded by mPendingMutex: mDirty is
+     * raised when a channel value actually changes, and at most one
+     * batched packet is in flight at a time, no more often than the DMX
+     * refresh cadence. Intermediate updates just overwrite the buffers.
+     */
+    bool mDirty[MAX_UNIVERSES];
+    bool mUniverseInFlight;
+    uint64_t mLastSubmit;
+
+    static void blendThreadFunc(void *arg);
+    void blendThreadLoop();
+
+    // Guards mPending, shared between the output worker thread and the
+    // main loop's flush().
+    AdaptiveMutex mPendingMutex;
     std::set<Transfer*> mPending;
 
+    /*
+     * Server-side color correction. DMX hardware has no device LUT, so the
+     * correction curve is precomputed here into one 8-bit table per color
+     * channel and applied as pixel values are mapped -- one lookup per
+     * mapped byte. Tables 0-2 follow the R/G/B whitepoint; table 3 is the
+     * curve for luminance ('l') selectors, using the averaged whitepoint.
+     * Constant-value instructions are intentionally not corrected, since
+     * they address non-pixel fixture channels like pan or strobe.
+     */
+    uint8_t mColorLUT[4][256];
+
+    static int colorLUTIndex(char selector) {
+        switch (selector) {
+            case 'g': case 'G': return 1;
+            case 'b': case 'B': return 2;
+            case 'l': case 'L': return 3;
+            default:            return 0;
+        }
+    }
+
+    void sendMk2Enable();
     void submitTransfer(Transfer *fct);
     static LIBUSB_CALL void completeTransfer(struct libusb_transfer *transfer);
 
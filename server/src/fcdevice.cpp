@@ -25,6 +25,7 @@
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
 #include "opc.h"
+#include "asynclog.h"
 #include <math.h>
 #include <iostream>
 #include <sstream>
@@ -32,12 +33,58 @@
 #include <stdio.h>
 
 
-FCDevice::Transfer::Transfer(FCDevice *device, void *buffer, int length, PacketType type)
+AdaptiveMutex FCDevice::mLUTCacheMutex;
+std::vector<FCDevice::LUTCacheEntry*> FCDevice::mLUTCache;
+
+static uint64_t monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000000ULL + tv.tv_usec;
+#endif
+}
+
+bool FCDevice::LUTParams::operator==(const LUTParams &other) const
+{
+    return gamma == other.gamma &&
+           whitepoint[0] == other.whitepoint[0] &&
+           whitepoint[1] == other.whitepoint[1] &&
+           whitepoint[2] == other.whitepoint[2] &&
+           linearSlope == other.linearSlope &&
+           linearCutoff == other.linearCutoff;
+}
+
+FCDevice::Transfer::Transfer(FCDevice *device)
     : transfer(libusb_alloc_transfer(0)),
-      type(type), finished(false)
+      device(device), prev(0), next(0), type(OTHER), finished(false),
+      timestamp(0), submitTimestamp(0)
 {
     #if NEED_COPY_USB_TRANSFER_BUFFER
-        bufferCopy = malloc(length);
+        bufferCopy = 0;
+        bufferCapacity = 0;
+    #endif
+}
+
+void FCDevice::Transfer::prepare(void *buffer, int length, PacketType type)
+{
+    this->type = type;
+    finished = false;
+    timestamp = 0;
+    submitTimestamp = 0;
+
+    #if NEED_COPY_USB_TRANSFER_BUFFER
+        // The staging buffer persists across reuses; grow it only when a
+        // larger packet comes through.
+        if (unsigned(length) > bufferCapacity) {
+            free(bufferCopy);
+            bufferCopy = malloc(length);
+            bufferCapacity = length;
+        }
         memcpy(bufferCopy, buffer, length);
         uint8_t *data = (uint8_t*) bufferCopy;
     #else
@@ -58,41 +105,53 @@ FCDevice::Transfer::~Transfer()
 
 FCDevice::FCDevice(libusb_device *device, bool verbose)
     : USBDevice(device, "fadecandy", verbose),
-      mConfigMap(0), mNumFramesPending(0), mFrameWaitingForSubmit(false)
+      mConfigMap(0), mPending(0), mNumFramesPending(0),
+      mFramesPendingLimit(2), mQueueDepthMin(1), mQueueDepthMax(MAX_FRAMES_PENDING),
+      mTransferLatency(0), mTransferLatencyFloor(0),
+      mFramesSinceQueueAdjust(0), mCoalescedAtLastAdjust(0),
+      mFrameWaitingForSubmit(false),
+      mCoalescedFrames(0),
+      mFramesWritten(0),
+      mUSBErrors(0), mConsecutiveUSBErrors(0),
+      mDirtyPackets(ALL_PACKETS_DIRTY), mDirtyStagingIndex(0),
+      mFrameTimestamp(0), mColorLUT(0), mLUTPrevValid(false)
 {
+    memset(mLatencyHistogram, 0, sizeof mLatencyHistogram);
+
     mSerialBuffer[0] = '\0';
     mSerialString = mSerialBuffer;
 
     memset(&mFirmwareConfig, 0, sizeof mFirmwareConfig);
     mFirmwareConfig.control = TYPE_CONFIG;
 
-    // Framebuffer headers
+    // Packet control bytes are produced at staging time; see writeFramebuffer()
     memset(mFramebuffer, 0, sizeof mFramebuffer);
-    for (unsigned i = 0; i < FRAMEBUFFER_PACKETS; ++i) {
-        mFramebuffer[i].control = TYPE_FRAMEBUFFER | i;
-    }
-    mFramebuffer[FRAMEBUFFER_PACKETS - 1].control |= FINAL;
 
-    // Color LUT headers
-    memset(mColorLUT, 0, sizeof mColorLUT);
-    for (unsigned i = 0; i < LUT_PACKETS; ++i) {
-        mColorLUT[i].control = TYPE_LUT | i;
+    for (unsigned i = 0; i < MAX_FRAMES_PENDING; ++i) {
+        mDirtyStaging[i] = 0;
     }
-    mColorLUT[LUT_PACKETS - 1].control |= FINAL;
 }
 
 FCDevice::~FCDevice()
 {
+    // Stop the output worker before tearing down any state it might touch.
+    mOutputWorker.stop();
+
     /*
      * If we have pending transfers, cancel them.
      * The Transfer objects themselves will be freed
      * once libusb completes them.
      */
 
-    for (std::set<Transfer*>::iterator i = mPending.begin(), e = mPending.end(); i != e; ++i) {
-        Transfer *fct = *i;
+    for (Transfer *fct = mPending; fct; fct = fct->next) {
         libusb_cancel_transfer(fct->transfer);
     }
+
+    for (std::vector<Transfer*>::iterator i = mFreeTransfers.begin(), e = mFreeTransfers.end(); i != e; ++i) {
+        delete *i;
+    }
+
+    freeTransferBuffer((uint8_t*) mColorLUT, TRANSFER_BUFFER_BYTES);
 }
 
 bool FCDevice::probe(libusb_device *device)
@@ -128,18 +187,80 @@ int FCDevice::open()
     unsigned minor = mDD.bcdDevice & 0xFF;
     snprintf(mVersionString, sizeof mVersionString, "%x.%02x", major, minor);
 
-    return libusb_get_string_descriptor_ascii(mHandle, mDD.iSerialNumber, 
-        (uint8_t*)mSerialBuffer, sizeof mSerialBuffer);
+    /*
+     * One DMA-capable block for everything we submit on the frame and LUT
+     * paths, carved into the color LUT and the per-frame staging buffers.
+     */
+    Packet *block = (Packet*) allocTransferBuffer(TRANSFER_BUFFER_BYTES);
+    mColorLUT = block;
+    block += LUT_PACKETS;
+    for (unsigned i = 0; i < MAX_FRAMES_PENDING; ++i) {
+        mDirtyStaging[i] = block;
+        block += FRAMEBUFFER_PACKETS;
+    }
+
+    return getSerialDescriptor(mDD, mSerialBuffer, sizeof mSerialBuffer);
 }
 
 void FCDevice::loadConfiguration(const Value &config)
 {
     mConfigMap = findConfigMap(config);
+    PixelMapper::compile(mCompiledMap, mConfigMap, mVerbose);
+
+    // Optional lossless delivery: block instead of dropping frames
+    const Value &lossless = config["lossless"];
+    mLossless = lossless.IsTrue();
+    if (!(lossless.IsTrue() || lossless.IsFalse() || lossless.IsNull()) && mVerbose) {
+        std::clog << "Lossless configuration must be true or false.\n";
+    }
+
+    /*
+     * Optional bounds for the adaptive USB frame queue. A single number
+     * pins the in-flight limit; a [min, max] pair bounds the adaptation.
+     * Values are clamped to the staging buffers we actually allocate.
+     */
+    const Value &queueDepth = config["queueDepth"];
+    unsigned depthMin = 1;
+    unsigned depthMax = MAX_FRAMES_PENDING;
+    if (queueDepth.IsUint()) {
+        depthMin = depthMax = queueDepth.GetUint();
+    } else if (queueDepth.IsArray() && queueDepth.Size() == 2 &&
+               queueDepth[0u].IsUint() && queueDepth[1].IsUint()) {
+        depthMin = queueDepth[0u].GetUint();
+        depthMax = queueDepth[1].GetUint();
+    } else if (!queueDepth.IsNull() && mVerbose) {
+        std::clog << "Queue depth must be a number or a [min, max] pair.\n";
+    }
+    if (depthMin < 1) depthMin = 1;
+    if (depthMin > MAX_FRAMES_PENDING) depthMin = MAX_FRAMES_PENDING;
+    if (depthMax < depthMin) depthMax = depthMin;
+    if (depthMax > MAX_FRAMES_PENDING) depthMax = MAX_FRAMES_PENDING;
+    mPendingMutex.lock();
+    mQueueDepthMin = depthMin;
+    mQueueDepthMax = depthMax;
+    if (mFramesPendingLimit < depthMin) mFramesPendingLimit = depthMin;
+    if (mFramesPendingLimit > depthMax) mFramesPendingLimit = depthMax;
+    mPendingMutex.unlock();
+
+    // Optional genlock group; membership is bound in rebuildChannelRouting()
+    const Value &syncGroup = config["syncGroup"];
+    if (syncGroup.IsString()) {
+        mSyncGroupName = syncGroup.GetString();
+    } else if (!syncGroup.IsNull() && mVerbose) {
+        std::clog << "Sync group name must be a string.\n";
+    }
 
     // Initial firmware configuration from our device options
     writeFirmwareConfiguration(config);
 }
 
+bool FCDevice::getOPCChannels(std::set<unsigned> &channels)
+{
+    // The compiled mapping knows exactly which channels we listen to.
+    PixelMapper::programChannels(mCompiledMap, channels);
+    return true;
+}
+
 void FCDevice::writeFirmwareConfiguration(const Value &config)
 {
     /*
@@ -169,24 +290,71 @@ void FCDevice::writeFirmwareConfiguration(const Value &config)
     writeFirmwareConfiguration();
 }
 
+FCDevice::Transfer *FCDevice::allocTransfer(void *buffer, int length, PacketType type)
+{
+    Transfer *fct = 0;
+
+    mPendingMutex.lock();
+    if (!mFreeTransfers.empty()) {
+        fct = mFreeTransfers.back();
+        mFreeTransfers.pop_back();
+    }
+    mPendingMutex.unlock();
+
+    if (!fct) {
+        fct = new Transfer(this);
+    }
+
+    fct->prepare(buffer, length, type);
+    return fct;
+}
+
+void FCDevice::releaseTransfer(Transfer *fct)
+{
+    mPendingMutex.lock();
+    if (mFreeTransfers.size() < MAX_POOLED_TRANSFERS) {
+        mFreeTransfers.push_back(fct);
+        fct = 0;
+    }
+    mPendingMutex.unlock();
+
+    delete fct;
+}
+
 bool FCDevice::submitTransfer(Transfer *fct)
 {
     /*
-     * Submit a new USB transfer. The Transfer object is guaranteed to be freed eventually.
-     * On error, it's freed right away.
+     * Submit a new USB transfer. The Transfer object is guaranteed to return
+     * to the pool eventually. On error, it goes back right away.
      */
 
     int r = libusb_submit_transfer(fct->transfer);
 
     if (r < 0) {
         if (mVerbose && r != LIBUSB_ERROR_PIPE) {
-            std::clog << "Error submitting USB transfer: " << libusb_strerror(libusb_error(r)) << "\n";
+            // Log asynchronously; this runs on frame submission paths
+            static AsyncLog::RateLimit limit;
+            if (AsyncLog::allow(limit, 2)) {
+                char buf[AsyncLog::MAX_LINE_BYTES];
+                snprintf(buf, sizeof buf, "Error submitting USB transfer: %s\n",
+                    libusb_strerror(libusb_error(r)));
+                AsyncLog::write(buf);
+            }
         }
-        delete fct;
+        __sync_fetch_and_add(&mUSBErrors, 1);
+        __sync_fetch_and_add(&mConsecutiveUSBErrors, 1);
+        releaseTransfer(fct);
         return false;
 
     } else {
-        mPending.insert(fct);
+        mPendingMutex.lock();
+        fct->prev = 0;
+        fct->next = mPending;
+        if (mPending) {
+            mPending->prev = fct;
+        }
+        mPending = fct;
+        mPendingMutex.unlock();
         return true;
     }
 }
@@ -194,40 +362,145 @@ bool FCDevice::submitTransfer(Transfer *fct)
 void FCDevice::completeTransfer(libusb_transfer *transfer)
 {
     FCDevice::Transfer *fct = static_cast<FCDevice::Transfer*>(transfer->user_data);
+    FCDevice *self = fct->device;
     fct->finished = true;
+
+    /*
+     * Completion status feeds the error telemetry in describe(). Cancelled
+     * transfers are teardown, not device trouble, so they count as neither
+     * a success nor a failure.
+     */
+    if (transfer->status == LIBUSB_TRANSFER_COMPLETED) {
+        self->mConsecutiveUSBErrors = 0;
+    } else if (transfer->status != LIBUSB_TRANSFER_CANCELLED) {
+        __sync_fetch_and_add(&self->mUSBErrors, 1);
+        __sync_fetch_and_add(&self->mConsecutiveUSBErrors, 1);
+    }
+
+    if (fct->type == FRAME) {
+        /*
+         * A frame just completed. If another frame is queued, submit it
+         * right here in the completion callback instead of waiting for the
+         * next mainLoop flush pass, so back-to-back frames pipeline at USB
+         * speed rather than being gated on the event-loop tick.
+         */
+
+        uint64_t now = monotonicMicroseconds();
+
+        self->mPendingMutex.lock();
+        self->mNumFramesPending--;
+        bool needSubmit = self->mFrameWaitingForSubmit;
+
+        if (fct->timestamp) {
+            // Log2 bucket of the end-to-end latency for this frame
+            uint64_t delta = now - fct->timestamp;
+            unsigned bucket = 0;
+            while (delta > 1 && bucket < LATENCY_BUCKETS - 1) {
+                delta >>= 1;
+                bucket++;
+            }
+            self->mLatencyHistogram[bucket]++;
+        }
+
+        if (fct->submitTimestamp && transfer->status == LIBUSB_TRANSFER_COMPLETED) {
+            self->adjustQueueDepth(now - fct->submitTimestamp);
+        }
+
+        self->mPendingMutex.unlock();
+
+        if (needSubmit) {
+            self->writeFramebuffer();
+        }
+    }
+}
+
+void FCDevice::adjustQueueDepth(uint64_t transferLatency)
+{
+    /*
+     * Adapt the in-flight frame limit from measured submit-to-completion
+     * latency. Called from completeTransfer() with mPendingMutex held.
+     *
+     * The fastest recent completion approximates the uncongested transfer
+     * time for this device's frame size. While the running average stays
+     * near that floor the bus is keeping up, and if frames are being
+     * coalesced in the meantime, a deeper queue would let them pipeline
+     * instead -- so the limit grows. When the average drifts well above the
+     * floor, transfers are queueing behind other bus traffic and extra
+     * depth is pure latency, so the limit shrinks.
+     */
+
+    if (!mTransferLatency) {
+        mTransferLatency = mTransferLatencyFloor = transferLatency;
+        return;
+    }
+
+    mTransferLatency += (int64_t(transferLatency) - int64_t(mTransferLatency)) / 8;
+    if (transferLatency < mTransferLatencyFloor) {
+        mTransferLatencyFloor = transferLatency;
+    }
+
+    if (++mFramesSinceQueueAdjust < QUEUE_ADJUST_INTERVAL) {
+        return;
+    }
+    mFramesSinceQueueAdjust = 0;
+
+    bool congested = mTransferLatency > mTransferLatencyFloor * 3;
+    bool starved = mCoalescedFrames != mCoalescedAtLastAdjust;
+    mCoalescedAtLastAdjust = mCoalescedFrames;
+
+    if (congested && mFramesPendingLimit > mQueueDepthMin) {
+        mFramesPendingLimit--;
+    } else if (!congested && starved && mFramesPendingLimit < mQueueDepthMax) {
+        mFramesPendingLimit++;
+    }
+
+    // Inflate the floor gently toward the average so it tracks
+    // slowly-changing bus conditions instead of pinning to a one-time
+    // best case.
+    mTransferLatencyFloor += (mTransferLatency - mTransferLatencyFloor) / 16;
 }
 
 void FCDevice::flush()
 {
-    // Erase any finished transfers
+    // Unlink any finished transfers
 
-    std::set<Transfer*>::iterator current = mPending.begin();
-    while (current != mPending.end()) {
-        std::set<Transfer*>::iterator next = current;
-        next++;
+    mPendingMutex.lock();
+    Transfer *fct = mPending;
+    while (fct) {
+        Transfer *next = fct->next;
 
-        Transfer *fct = *current;
         if (fct->finished) {
-            switch (fct->type) {
-
-                case FRAME:
-                    mNumFramesPending--;
-                    break;
+            // mNumFramesPending is maintained by completeTransfer()
 
-                default:
-                    break;
+            if (fct->prev) {
+                fct->prev->next = fct->next;
+            } else {
+                mPending = fct->next;
+            }
+            if (fct->next) {
+                fct->next->prev = fct->prev;
             }
 
-            mPending.erase(current);
-            delete fct;
+            // Recycle the transfer. We already hold mPendingMutex.
+            if (mFreeTransfers.size() < MAX_POOLED_TRANSFERS) {
+                mFreeTransfers.push_back(fct);
+            } else {
+                delete fct;
+            }
         }
 
-        current = next;
+        fct = next;
     }
 
-    // Submit new frames, if we had a queued frame waiting
+    /*
+     * Normally completeTransfer() resubmits queued frames; this is only a
+     * fallback for the rare case where that submission failed.
+     */
+
+    bool needSubmit = mFrameWaitingForSubmit && mNumFramesPending < int(mFramesPendingLimit);
+    mPendingMutex.unlock();
 
-    if (mFrameWaitingForSubmit && mNumFramesPending < MAX_FRAMES_PENDING) {
+    if (needSubmit) {
         writeFramebuffer();
     }
 }
@@ -235,29 +508,21 @@ void FCDevice::flush()
 void FCDevice::writeColorCorrection(const Value &color)
 {
     /*
-     * Populate the color correction table based on a JSON configuration object,
-     * and send the new color LUT out over USB.
+     * Parse the color correction settings based on a JSON configuration
+     * object, and send the new color LUT out over USB.
      *
      * 'color' may be 'null' to load an identity-mapped LUT, or it may be
      * a dictionary of options including 'gamma' and 'whitepoint'.
-     *
-     * This calculates a compound curve with a linear section and a nonlinear
-     * section. The linear section, near zero, avoids creating very low output
-     * values that will cause distracting flicker when dithered. This isn't a problem
-     * when the LEDs are viewed indirectly such that the flicker is below the threshold
-     * of perception, but in cases where the flicker is a problem this linear section can
-     * eliminate it entierly at the cost of some dynamic range.
-     *
-     * By default, the linear section is disabled (linearCutoff is zero). To enable the
-     * linear section, set linearCutoff to some nonzero value. A good starting point is
-     * 1/256.0, correspnding to the lowest 8-bit PWM level.
      */
 
     // Default color LUT parameters
-    double gamma = 1.0;                         // Power for nonlinear portion of curve
-    double whitepoint[3] = {1.0, 1.0, 1.0};     // White-point RGB value (also, global brightness)
-    double linearSlope = 1.0;                   // Slope (output / input) of linear section of the curve, near zero
-    double linearCutoff = 0.0;                  // Y (output) coordinate of intersection of linear and nonlinear curves
+    LUTParams params;
+    params.gamma = 1.0;                         // Power for nonlinear portion of curve
+    params.whitepoint[0] = 1.0;                 // White-point RGB value (also, global brightness)
+    params.whitepoint[1] = 1.0;
+    params.whitepoint[2] = 1.0;
+    params.linearSlope = 1.0;                   // Slope (output / input) of linear section of the curve, near zero
+    params.linearCutoff = 0.0;                  // Y (output) coordinate of intersection of linear and nonlinear curves
 
     /*
      * Parse the JSON object
@@ -270,19 +535,19 @@ void FCDevice::writeColorCorrection(const Value &color)
         const Value &vLinearCutoff = color["linearCutoff"];
 
         if (vGamma.IsNumber()) {
-            gamma = vGamma.GetDouble();
+            params.gamma = vGamma.GetDouble();
         } else if (!vGamma.IsNull() && mVerbose) {
             std::clog << "Gamma value must be a number.\n";
         }
 
         if (vLinearSlope.IsNumber()) {
-            linearSlope = vLinearSlope.GetDouble();
+            params.linearSlope = vLinearSlope.GetDouble();
         } else if (!vLinearSlope.IsNull() && mVerbose) {
             std::clog << "Linear slope value must be a number.\n";
         }
 
         if (vLinearCutoff.IsNumber()) {
-            linearCutoff = vLinearCutoff.GetDouble();
+            params.linearCutoff = vLinearCutoff.GetDouble();
         } else if (!vLinearCutoff.IsNull() && mVerbose) {
             std::clog << "Linear slope value must be a number.\n";
         }
@@ -292,9 +557,9 @@ void FCDevice::writeColorCorrection(const Value &color)
             vWhitepoint[0u].IsNumber() &&
             vWhitepoint[1].IsNumber() &&
             vWhitepoint[2].IsNumber()) {
-            whitepoint[0] = vWhitepoint[0u].GetDouble();
-            whitepoint[1] = vWhitepoint[1].GetDouble();
-            whitepoint[2] = vWhitepoint[2].GetDouble();
+            params.whitepoint[0] = vWhitepoint[0u].GetDouble();
+            params.whitepoint[1] = vWhitepoint[1].GetDouble();
+            params.whitepoint[2] = vWhitepoint[2].GetDouble();
         } else if (!vWhitepoint.IsNull() && mVerbose) {
             std::clog << "Whitepoint value must be a list of 3 numbers.\n";
         }
@@ -303,11 +568,94 @@ void FCDevice::writeColorCorrection(const Value &color)
         std::clog << "Color correction value must be a JSON dictionary object.\n";
     }
 
+    /*
+     * A broadcast color change asks every device for the same table, so look
+     * for an already-computed LUT first. Holding the lock while computing a
+     * miss means concurrent devices wait for the result and then share it,
+     * rather than all recomputing it in parallel.
+     */
+
+    mLUTCacheMutex.lock();
+
+    LUTCacheEntry *entry = 0;
+    for (std::vector<LUTCacheEntry*>::iterator i = mLUTCache.begin(), e = mLUTCache.end(); i != e; ++i) {
+        if ((*i)->params == params) {
+            entry = *i;
+            break;
+        }
+    }
+
+    if (!entry) {
+        entry = new LUTCacheEntry;
+        entry->params = params;
+        computeLUT(params, entry->packets);
+
+        if (mLUTCache.size() >= MAX_CACHED_LUTS) {
+            // Evict the oldest entry
+            delete mLUTCache.front();
+            mLUTCache.erase(mLUTCache.begin());
+        }
+        mLUTCache.push_back(entry);
+    }
+
+    /*
+     * Delta update: each LUT packet is self-describing (the control byte
+     * carries its table index) and the device applies packets into its
+     * table in place, committing on FINAL. A whitepoint nudge moves only a
+     * handful of entries, so diff against the table this device was last
+     * sent, compact the changed packets to the front of the transfer
+     * buffer, and mark the last of them FINAL. The first write after
+     * open() has no previous table and sends all of it.
+     */
+
+    unsigned changed = 0;
+    for (unsigned i = 0; i < LUT_PACKETS; i++) {
+        if (!mLUTPrevValid ||
+            memcmp(entry->packets[i].data, mLUTPrev[i].data, sizeof entry->packets[i].data)) {
+            mColorLUT[changed] = entry->packets[i];
+            mColorLUT[changed].control = TYPE_LUT | i;
+            changed++;
+        }
+    }
+    memcpy(mLUTPrev, entry->packets, sizeof mLUTPrev);
+    mLUTPrevValid = true;
+
+    mLUTCacheMutex.unlock();
+
+    if (!changed) {
+        // Identical table; the device already has it.
+        return;
+    }
+    mColorLUT[changed - 1].control |= FINAL;
+
+    // Start asynchronously sending the changed portion of the LUT.
+    submitTransfer(allocTransfer(mColorLUT, changed * sizeof(Packet)));
+}
+
+void FCDevice::computeLUT(const LUTParams &params, Packet *packets)
+{
     /*
      * Calculate the color LUT, stowing the result in an array of USB packets.
+     *
+     * This calculates a compound curve with a linear section and a nonlinear
+     * section. The linear section, near zero, avoids creating very low output
+     * values that will cause distracting flicker when dithered. This isn't a problem
+     * when the LEDs are viewed indirectly such that the flicker is below the threshold
+     * of perception, but in cases where the flicker is a problem this linear section can
+     * eliminate it entierly at the cost of some dynamic range.
+     *
+     * By default, the linear section is disabled (linearCutoff is zero). To enable the
+     * linear section, set linearCutoff to some nonzero value. A good starting point is
+     * 1/256.0, correspnding to the lowest 8-bit PWM level.
      */
 
-    Packet *packet = mColorLUT;
+    memset(packets, 0, LUT_PACKETS * sizeof *packets);
+    for (unsigned i = 0; i < LUT_PACKETS; ++i) {
+        packets[i].control = TYPE_LUT | i;
+    }
+    packets[LUT_PACKETS - 1].control |= FINAL;
+
+    Packet *packet = packets;
     const unsigned firstByteOffset = 1;  // Skip padding byte
     unsigned byteOffset = firstByteOffset;
 
@@ -323,15 +671,16 @@ void FCDevice::writeColorCorrection(const Value &color)
             double input = (entry << 8) / 65535.0;
 
             // Scale by whitepoint before anything else
-            input *= whitepoint[channel];
+            input *= params.whitepoint[channel];
 
             // Is this entry part of the linear section still?
-            output = input * linearSlope;
-            if (output > linearCutoff) {
+            output = input * params.linearSlope;
+            if (output > params.linearCutoff) {
                 // Nonlinear portion of the curve. This starts right where the linear portion leaves
                 // off. We need to avoid any discontinuity.
-                double linearRange = linearCutoff / linearSlope;
-                output = linearCutoff + pow((input - linearRange) / (1.0 - linearRange), gamma) * (1.0 - linearCutoff);
+                double linearRange = params.linearCutoff / params.linearSlope;
+                output = params.linearCutoff +
+                    pow((input - linearRange) / (1.0 - linearRange), params.gamma) * (1.0 - params.linearCutoff);
             }
             // Round to the nearest integer, and clamp. Overflow-safe.
             int64_t longValue = (output * 0xFFFF) + 0.5;
@@ -346,9 +695,11 @@ void FCDevice::writeColorCorrection(const Value &color)
             }
         }
     }
+}
 
-    // Start asynchronously sending the LUT.
-    submitTransfer(new Transfer(this, &mColorLUT, sizeof mColorLUT));
+void FCDevice::submitDeferredFrame()
+{
+    writeFramebuffer();
 }
 
 void FCDevice::writeFramebuffer()
@@ -356,20 +707,79 @@ void FCDevice::writeFramebuffer()
     /*
      * Asynchronously write the current framebuffer.
      *
-     * TODO: Currently if this gets ahead of what the USB device is capable of,
-     *       we always drop frames. Alternatively, it would be nice to have end-to-end
-     *       flow control so that the client can produce frames slower.
+     * If this gets ahead of what the USB device is capable of, by default we
+     * drop frames; in lossless mode we block the output worker instead, and
+     * clients can pace themselves with the queue depth SysEx extension.
      */
 
-    if (mNumFramesPending >= MAX_FRAMES_PENDING) {
-        // Too many outstanding frames. Wait to submit until a previous frame completes.
-        mFrameWaitingForSubmit = true;
-        return;
+    mPendingMutex.lock();
+    while (mNumFramesPending >= int(mFramesPendingLimit)) {
+        if (!mLossless) {
+            // Too many outstanding frames. Wait to submit until a previous frame completes.
+            if (mFrameWaitingForSubmit) {
+                // A queued frame was superseded before it ever went out
+                mCoalescedFrames++;
+            }
+            mFrameWaitingForSubmit = true;
+            mPendingMutex.unlock();
+            return;
+        }
+
+        // Lossless mode: hold the output worker until a transfer completes,
+        // never dropping. Completions arrive on the USB event thread, so
+        // waiting here can't starve them.
+        mPendingMutex.unlock();
+        tthread::this_thread::sleep_for(tthread::chrono::milliseconds(1));
+        mPendingMutex.lock();
     }
 
-    if (submitTransfer(new Transfer(this, &mFramebuffer, sizeof mFramebuffer, FRAME))) {
+    /*
+     * Stage only the packets that changed since the last successful
+     * submission. The control byte in each packet carries its own index, so
+     * the device accepts any subset; the FINAL packet is always included,
+     * since that's what commits the frame. One staging buffer per possible
+     * in-flight frame keeps the transfer's data stable until it completes.
+     */
+
+    uint32_t dirty = mDirtyPackets | (1 << (FRAMEBUFFER_PACKETS - 1));
+    mDirtyPackets = 0;
+
+    uint64_t timestamp = mFrameTimestamp;
+    mFrameTimestamp = 0;
+
+    Packet *staging = mDirtyStaging[mDirtyStagingIndex];
+    mDirtyStagingIndex = (mDirtyStagingIndex + 1) % MAX_FRAMES_PENDING;
+
+    unsigned count = 0;
+    for (unsigned i = 0; i < FRAMEBUFFER_PACKETS; i++) {
+        if (dirty & (1 << i)) {
+            Packet &p = staging[count++];
+            p.control = TYPE_FRAMEBUFFER | i;
+            memcpy(p.data, &mFramebuffer[i * sizeof p.data], sizeof p.data);
+        }
+    }
+    if (count) {
+        // The last staged packet is always framebuffer packet 24; see above
+        staging[count - 1].control |= FINAL;
+    }
+    mPendingMutex.unlock();
+
+    Transfer *fct = allocTransfer(staging, count * sizeof(Packet), FRAME);
+    fct->timestamp = timestamp;
+    fct->submitTimestamp = monotonicMicroseconds();
+
+    if (submitTransfer(fct)) {
+        mPendingMutex.lock();
         mFrameWaitingForSubmit = false;
         mNumFramesPending++;
+        mFramesWritten++;
+        mPendingMutex.unlock();
+        mSubmitTrace.record(monotonicMicroseconds());
+    } else {
+        // Put the dirty bits back, so the retry resends these packets
+        mPendingMutex.lock();
+        mDirtyPackets |= dirty;
+        mPendingMutex.unlock();
     }
 }
 
@@ -402,6 +812,32 @@ void FCDevice::writeMessage(Document &msg)
         return;
     }
 
+    if (!strcmp(type, "device_pixel_snapshot")) {
+        // Report what the device is currently showing, for live monitoring
+        jsonPixelSnapshot(msg);
+        return;
+    }
+
+    if (!strcmp(type, "latency_histogram")) {
+        /*
+         * Report receive-to-completion latency. Element N of the reply
+         * counts frames that took [2^N, 2^N+1) microseconds from the
+         * transport's receive callback to USB transfer completion.
+         */
+
+        rapidjson::Value buckets(rapidjson::kArrayType);
+
+        mPendingMutex.lock();
+        for (unsigned i = 0; i < LATENCY_BUCKETS; i++) {
+            rapidjson::Value count(mLatencyHistogram[i]);
+            buckets.PushBack(count, msg.GetAllocator());
+        }
+        mPendingMutex.unlock();
+
+        msg.AddMember("histogram", buckets, msg.GetAllocator());
+        return;
+    }
+
     // Chain to default handler
     USBDevice::writeMessage(msg);
 }
@@ -426,6 +862,10 @@ void FCDevice::writeDevicePixels(Document &msg)
         if (numPixels > NUM_PIXELS)
             numPixels = NUM_PIXELS;
 
+        // This path runs on the websocket thread, so writer serialization
+        // against the output worker's OPC mapping matters here.
+        mPendingMutex.lock();
+        mFramebufferSeqlock.writeBegin();
         for (int i = 0; i < numPixels; i++) {
             uint8_t *out = fbPixel(i);
 
@@ -437,11 +877,71 @@ void FCDevice::writeDevicePixels(Document &msg)
             out[1] = std::max(0, std::min(255, g.IsInt() ? g.GetInt() : 0));
             out[2] = std::max(0, std::min(255, b.IsInt() ? b.GetInt() : 0));
         }
+        mFramebufferSeqlock.writeEnd();
+
+        // Raw writes bypass the dirty tracking; send the whole framebuffer.
+        mDirtyPackets = ALL_PACKETS_DIRTY;
+        mPendingMutex.unlock();
 
         writeFramebuffer();
     }
 }
 
+void FCDevice::writeDevicePixels(const uint8_t *rgb, unsigned numPixels)
+{
+    /*
+     * Raw binary pixel write: one straight memcpy into the flat
+     * framebuffer. This is the fast equivalent of the JSON "device_pixels"
+     * message, for tools that push unmapped frames at interactive rates.
+     */
+
+    if (numPixels > NUM_PIXELS) {
+        numPixels = NUM_PIXELS;
+    }
+
+    unsigned packets = (numPixels + PIXELS_PER_PACKET - 1) / PIXELS_PER_PACKET;
+
+    mPendingMutex.lock();
+    mFramebufferSeqlock.writeBegin();
+    memcpy(mFramebuffer, rgb, numPixels * 3);
+    mFramebufferSeqlock.writeEnd();
+    // Raw writes bypass the per-pixel dirty tracking
+    mDirtyPackets |= (1 << packets) - 1;
+    mPendingMutex.unlock();
+
+    writeFramebuffer();
+}
+
+void FCDevice::jsonPixelSnapshot(Document &msg)
+{
+    /*
+     * Report the staged framebuffer as a flat RGB integer array in
+     * msg["snapshot"], for dashboards that want a live preview of what a
+     * device is showing without subscribing to the relay stream.
+     *
+     * The copy goes through mFramebufferSeqlock: if a frame lands while
+     * we're copying, the copy is simply repeated, so the reply is always
+     * one whole frame and the output worker never waits on a monitor.
+     * (The reply path strips "pixels" from every message, so the snapshot
+     * travels under its own member name.)
+     */
+
+    uint8_t snapshot[NUM_PIXELS * 3];
+    uint32_t seq;
+
+    do {
+        seq = mFramebufferSeqlock.readBegin();
+        memcpy(snapshot, mFramebuffer, sizeof snapshot);
+    } while (mFramebufferSeqlock.readRetry(seq));
+
+    rapidjson::Value pixels(rapidjson::kArrayType);
+    for (unsigned i = 0; i < sizeof snapshot; i++) {
+        rapidjson::Value v(unsigned(snapshot[i]));
+        pixels.PushBack(v, msg.GetAllocator());
+    }
+    msg.AddMember("snapshot", pixels, msg.GetAllocator());
+}
+
 void FCDevice::writeMessage(const OPC::Message &msg)
 {
     /*
@@ -452,7 +952,13 @@ void FCDevice::writeMessage(const OPC::Message &msg)
 
         case OPC::SetPixelColors:
             opcSetPixelColors(msg);
-            writeFramebuffer();
+            busScheduleDelay();
+            if (mSyncGroup) {
+                // Flip together with the rest of the sync group
+                syncFrameReady();
+            } else {
+                writeFramebuffer();
+            }
             return;
 
         case OPC::SystemExclusive:
@@ -461,7 +967,13 @@ void FCDevice::writeMessage(const OPC::Message &msg)
     }
 
     if (mVerbose) {
-        std::clog << "Unsupported OPC command: " << unsigned(msg.command) << "\n";
+        // A client can send these at frame rate; log off the worker thread
+        static AsyncLog::RateLimit limit;
+        if (AsyncLog::allow(limit, 2)) {
+            char buf[AsyncLog::MAX_LINE_BYTES];
+            snprintf(buf, sizeof buf, "Unsupported OPC command: %u\n", unsigned(msg.command));
+            AsyncLog::write(buf);
+        }
     }
 }
 
@@ -469,7 +981,10 @@ void FCDevice::opcSysEx(const OPC::Message &msg)
 {
     if (msg.length() < 4) {
         if (mVerbose) {
-            std::clog << "SysEx message too short!\n";
+            static AsyncLog::RateLimit limit;
+            if (AsyncLog::allow(limit, 2)) {
+                AsyncLog::write("SysEx message too short!\n");
+            }
         }
         return;
     }
@@ -487,6 +1002,9 @@ void FCDevice::opcSysEx(const OPC::Message &msg)
         case OPC::FCSetFirmwareConfiguration:
             return opcSetFirmwareConfiguration(msg);
 
+        case OPC::FCSetPixelColors16:
+            return opcSetPixelColors16(msg);
+
     }
 
     // Quietly ignore unhandled SysEx messages.
@@ -495,150 +1013,51 @@ void FCDevice::opcSysEx(const OPC::Message &msg)
 void FCDevice::opcSetPixelColors(const OPC::Message &msg)
 {
     /*
-     * Parse through our device's mapping, and store any relevant portions of 'msg'
+     * Run through our compiled mapping, and store any relevant portions of 'msg'
      * in the framebuffer.
      */
 
-    if (!mConfigMap) {
-        // No mapping defined yet. This device is inactive.
-        return;
-    }
-
-    const Value &map = *mConfigMap;
-    for (unsigned i = 0, e = map.Size(); i != e; i++) {
-        opcMapPixelColors(msg, map[i]);
-    }
+    FramebufferWriter writer(*this);
+
+    // mPendingMutex serializes framebuffer writers (this path on the
+    // output worker, raw JSON writes on the websocket thread); the
+    // seqlock protocol itself allows only one writer at a time.
+    mPendingMutex.lock();
+    mFramebufferSeqlock.writeBegin();
+    PixelMapper::run(mCompiledMap, msg, writer);
+    mFramebufferSeqlock.writeEnd();
+    mDirtyPackets |= writer.dirty;
+    // Date the staged frame; if it supersedes a coalesced one, the newest
+    // arrival time wins, matching the data that actually goes out.
+    mFrameTimestamp = mReceiveTimestamp;
+    mPendingMutex.unlock();
 }
 
-void FCDevice::opcMapPixelColors(const OPC::Message &msg, const Value &inst)
+void FCDevice::opcSetPixelColors16(const OPC::Message &msg)
 {
     /*
-     * Parse one JSON mapping instruction, and copy any relevant parts of 'msg'
-     * into our framebuffer. This looks for any mapping instructions that we
-     * recognize:
-     *
-     *   [ OPC Channel, First OPC Pixel, First output pixel, Pixel count ]
-     *   [ OPC Channel, First OPC Pixel, First output pixel, Color channels ]
+     * 16-bit SetPixelColors. The Fadecandy USB framebuffer is 8 bits per
+     * channel, so the extra precision is rounded away here; this exists so
+     * mixed installations can feed every backend from one wire format.
+     * Frame pacing and submission match the 8-bit path in writeMessage().
      */
 
-    unsigned msgPixelCount = msg.length() / 3;
-
-    if (inst.IsArray() && inst.Size() == 4) {
-        // Map a range from an OPC channel to our framebuffer
-
-        const Value &vChannel = inst[0u];
-        const Value &vFirstOPC = inst[1];
-        const Value &vFirstOut = inst[2];
-        const Value &vCount = inst[3];
-
-        if (vChannel.IsUint() && vFirstOPC.IsUint() && vFirstOut.IsUint() && vCount.IsInt()) {
-            unsigned channel = vChannel.GetUint();
-            unsigned firstOPC = vFirstOPC.GetUint();
-            unsigned firstOut = vFirstOut.GetUint();
-            unsigned count;
-            int direction;
-            if (vCount.GetInt() >= 0) {
-                count = vCount.GetInt();
-                direction = 1;
-            } else {
-                count = -vCount.GetInt();
-                direction = -1;
-            }
+    FramebufferWriter writer(*this);
 
-            if (channel != msg.channel) {
-                return;
-            }
-
-            // Clamping, overflow-safe
-            firstOPC = std::min<unsigned>(firstOPC, msgPixelCount);
-            firstOut = std::min<unsigned>(firstOut, unsigned(NUM_PIXELS));
-            count = std::min<unsigned>(count, msgPixelCount - firstOPC);
-            count = std::min<unsigned>(count,
-                    direction > 0 ? NUM_PIXELS - firstOut : firstOut + 1);
-
-            // Copy pixels
-            const uint8_t *inPtr = msg.data + (firstOPC * 3);
-            unsigned outIndex = firstOut;
-            while (count--) {
-                uint8_t *outPtr = fbPixel(outIndex);
-                outIndex += direction;
-                outPtr[0] = inPtr[0];
-                outPtr[1] = inPtr[1];
-                outPtr[2] = inPtr[2];
-                inPtr += 3;
-            }
+    // Writer serialization, as in the 8-bit path
+    mPendingMutex.lock();
+    mFramebufferSeqlock.writeBegin();
+    PixelMapper::run16(mCompiledMap, msg, writer);
+    mFramebufferSeqlock.writeEnd();
+    mDirtyPackets |= writer.dirty;
+    mFrameTimestamp = mReceiveTimestamp;
+    mPendingMutex.unlock();
 
-            return;
-        }
-    }
-
-    if (inst.IsArray() && inst.Size() == 5) {
-        // Map a range from an OPC channel to our framebuffer, with color channel swizzling
-
-        const Value &vChannel = inst[0u];
-        const Value &vFirstOPC = inst[1];
-        const Value &vFirstOut = inst[2];
-        const Value &vCount = inst[3];
-        const Value &vColorChannels = inst[4];
-
-        if (vChannel.IsUint() && vFirstOPC.IsUint() && vFirstOut.IsUint() && vCount.IsInt()
-            && vColorChannels.IsString() && vColorChannels.GetStringLength() == 3) {
-
-            unsigned channel = vChannel.GetUint();
-            unsigned firstOPC = vFirstOPC.GetUint();
-            unsigned firstOut = vFirstOut.GetUint();
-            unsigned count;
-            int direction;
-            if (vCount.GetInt() >= 0) {
-                count = vCount.GetInt();
-                direction = 1;
-            } else {
-                count = -vCount.GetInt();
-                direction = -1;
-            }
-            const char *colorChannels = vColorChannels.GetString();
-
-            if (channel != msg.channel) {
-                return;
-            }
-
-            // Clamping, overflow-safe
-            firstOPC = std::min<unsigned>(firstOPC, msgPixelCount);
-            firstOut = std::min<unsigned>(firstOut, unsigned(NUM_PIXELS));
-            count = std::min<unsigned>(count, msgPixelCount - firstOPC);
-            count = std::min<unsigned>(count,
-                    direction > 0 ? NUM_PIXELS - firstOut : firstOut + 1);
-
-            // Copy pixels
-            const uint8_t *inPtr = msg.data + (firstOPC * 3);
-            unsigned outIndex = firstOut;
-            bool success = true;
-            while (count--) {
-                uint8_t *outPtr = fbPixel(outIndex);
-                outIndex += direction;
-
-                for (int channel = 0; channel < 3; channel++) {
-                    if (!OPC::pickColorChannel(outPtr[channel], colorChannels[channel], inPtr)) {
-                        success = false;
-                        break;
-                    }
-                }
-
-                inPtr += 3;
-            }
-
-            if (success) {
-                return;
-            }
-        }
-    }
-
-    // Still haven't found a match?
-    if (mVerbose) {
-        rapidjson::GenericStringBuffer<rapidjson::UTF8<> > buffer;
-        rapidjson::Writer<rapidjson::GenericStringBuffer<rapidjson::UTF8<> > > writer(buffer);
-        inst.Accept(writer);
-        std::clog << "Unsupported JSON mapping instruction: " << buffer.GetString() << "\n";
+    busScheduleDelay();
+    if (mSyncGroup) {
+        syncFrameReady();
+    } else {
+        writeFramebuffer();
     }
 }
 
@@ -684,7 +1103,7 @@ void FCDevice::opcSetFirmwareConfiguration(const OPC::Message &msg)
 void FCDevice::writeFirmwareConfiguration()
 {
     // Write mFirmwareConfig to the device
-    submitTransfer(new Transfer(this, &mFirmwareConfig, sizeof mFirmwareConfig));
+    submitTransfer(allocTransfer(&mFirmwareConfig, sizeof mFirmwareConfig));
 }
 
 std::string FCDevice::getName()
@@ -697,9 +1116,49 @@ std::string FCDevice::getName()
     return s.str();
 }
 
+unsigned FCDevice::getQueueDepth()
+{
+    mPendingMutex.lock();
+    unsigned depth = mNumFramesPending + (mFrameWaitingForSubmit ? 1 : 0);
+    mPendingMutex.unlock();
+
+    return depth + USBDevice::getQueueDepth();
+}
+
 void FCDevice::describe(rapidjson::Value &object, Allocator &alloc)
 {
     USBDevice::describe(object, alloc);
     object.AddMember("version", mVersionString, alloc);
     object.AddMember("bcd_version", mDD.bcdDevice, alloc);
+
+    mPendingMutex.lock();
+    uint64_t coalesced = mCoalescedFrames;
+    uint64_t frames = mFramesWritten;
+    int pending = mNumFramesPending;
+    unsigned pendingLimit = mFramesPendingLimit;
+    uint64_t transferLatency = mTransferLatency;
+    uint64_t histogram[LATENCY_BUCKETS];
+    memcpy(histogram, mLatencyHistogram, sizeof histogram);
+    mPendingMutex.unlock();
+    object.AddMember("coalesced_frames", coalesced, alloc);
+    object.AddMember("frames_total", frames, alloc);
+    object.AddMember("frames_pending", pending, alloc);
+    object.AddMember("frames_pending_limit", pendingLimit, alloc);
+    object.AddMember("transfer_latency_usec", transferLatency, alloc);
+    object.AddMember("usb_errors", mUSBErrors, alloc);
+    object.AddMember("consecutive_usb_errors", mConsecutiveUSBErrors, alloc);
+
+    /*
+     * Latency summary, in microseconds, from the same histogram that the
+     * latency_histogram device message reports in full. The figures are
+     * bucket lower bounds, so they're log2-quantized; a p99 that jumps by
+     * a few buckets while p50 holds steady is the signature of a flaky
+     * cable or an overloaded bus.
+     */
+    object.AddMember("latency_min_usec",
+        latencyHistogramMin(histogram, LATENCY_BUCKETS), alloc);
+    object.AddMember("latency_p50_usec",
+        latencyHistogramPercentile(histogram, LATENCY_BUCKETS, 50), alloc);
+    object.AddMember("latency_p99_usec",
+        latencyHistogramPercentile(histogram, LATENCY_BUCKETS, 99), alloc);
 }
@@ -24,7 +24,11 @@
 #pragma once
 #include "usbdevice.h"
 #include "opc.h"
+#include "pixelmapper.h"
+#include "adaptivemutex.h"
+#include "seqlock.h"
 #include <set>
+#include <vector>
 
 
 class FCDevice : public USBDevice
@@ -37,12 +41,16 @@ public:
 
     virtual int open();
     virtual void loadConfiguration(const Value &config);
+    virtual bool getOPCChannels(std::set<unsigned> &channels);
     virtual void writeMessage(const OPC::Message &msg);
     virtual void writeMessage(Document &msg);
     virtual void writeColorCorrection(const Value &color);
     virtual std::string getName();
     virtual void flush();
     virtual void describe(rapidjson::Value &object, Allocator &alloc);
+    virtual unsigned getQueueDepth();
+    virtual void submitDeferredFrame();
+    virtual void writeDevicePixels(const uint8_t *rgb, unsigned numPixels);
 
     static const unsigned NUM_PIXELS = 512;
 
@@ -51,7 +59,7 @@ public:
 
     // Framebuffer accessor
     uint8_t *fbPixel(unsigned num) {
-        return &mFramebuffer[num / PIXELS_PER_PACKET].data[3 * (num % PIXELS_PER_PACKET)];
+        return &mFramebuffer[3 * num];
     }
  
 private:
@@ -61,13 +69,16 @@ private:
     static const unsigned LUT_PACKETS = 25;
     static const unsigned LUT_ENTRIES = 257;
     static const unsigned OUT_ENDPOINT = 1;
-    static const unsigned MAX_FRAMES_PENDING = 2;
+    static const unsigned MAX_FRAMES_PENDING = 4;
+    static const unsigned MAX_POOLED_TRANSFERS = 8;
 
     static const uint8_t TYPE_FRAMEBUFFER = 0x00;
     static const uint8_t TYPE_LUT = 0x40;
     static const uint8_t TYPE_CONFIG = 0x80;
     static const uint8_t FINAL = 0x20;
 
+    static const uint32_t ALL_PACKETS_DIRTY = (1 << FRAMEBUFFER_PACKETS) - 1;
+
     static const uint8_t CFLAG_NO_DITHERING     = (1 << 0);
     static const uint8_t CFLAG_NO_INTERPOLATION = (1 << 1);
     static const uint8_t CFLAG_NO_ACTIVITY_LED  = (1 << 2);
@@ -83,39 +94,199 @@ private:
         FRAME,
     };
 
+    /*
+     * Transfers are pooled and reused: the libusb transfer object (and, on
+     * platforms that need it, the staging buffer) is allocated once, and
+     * prepare() refits it for each submission. The steady-state frame path
+     * does no heap allocation at all.
+     */
     struct Transfer {
-        Transfer(FCDevice *device, void *buffer, int length, PacketType type = OTHER);
+        Transfer(FCDevice *device);
         ~Transfer();
+        void prepare(void *buffer, int length, PacketType type = OTHER);
         libusb_transfer *transfer;
+        FCDevice *device;
+        Transfer *prev, *next;      // Intrusive links for the pending list
         #if NEED_COPY_USB_TRANSFER_BUFFER
           void *bufferCopy;
+          unsigned bufferCapacity;
         #endif
         PacketType type;
         bool finished;
+        uint64_t timestamp;         // Receive time of the frame aboard, or 0
+        uint64_t submitTimestamp;   // Submission time of a frame transfer, or 0
+    };
+
+    /*
+     * Computed color LUTs depend only on the curve parameters, and a
+     * broadcast color change asks every attached device for the identical
+     * table. Cache the packed LUT packets process-wide, keyed by the
+     * parameters, so the table is computed once instead of per device.
+     */
+    struct LUTParams {
+        double gamma;
+        double whitepoint[3];
+        double linearSlope;
+        double linearCutoff;
+        bool operator==(const LUTParams &other) const;
+    };
+    struct LUTCacheEntry {
+        LUTParams params;
+        Packet packets[LUT_PACKETS];
+    };
+    static const unsigned MAX_CACHED_LUTS = 8;
+    static AdaptiveMutex mLUTCacheMutex;
+    static std::vector<LUTCacheEntry*> mLUTCache;
+
+    static void computeLUT(const LUTParams &params, Packet *packets);
+
+    // Lets the kernel microbenchmarks (bench/kernelbench.cpp) time
+    // computeLUT() without widening the public interface.
+    friend class KernelBench;
+
+    /*
+     * Pixel writer adapter for PixelMapper, targeting mFramebuffer.
+     * Accumulates a dirty bit per framebuffer packet, so writeFramebuffer()
+     * can send only the packets a frame actually changed.
+     */
+    struct FramebufferWriter {
+        FCDevice &device;
+        uint32_t dirty;
+        FramebufferWriter(FCDevice &device) : device(device), dirty(0) {}
+        unsigned numPixels() const { return NUM_PIXELS; }
+        void writePixel(unsigned index, uint8_t r, uint8_t g, uint8_t b) {
+            uint8_t *out = device.fbPixel(index);
+            if (out[0] != r || out[1] != g || out[2] != b) {
+                out[0] = r;
+                out[1] = g;
+                out[2] = b;
+                dirty |= 1 << (index / PIXELS_PER_PACKET);
+            }
+        }
+        void writePixel16(unsigned index, uint16_t r, uint16_t g, uint16_t b) {
+            // The USB framebuffer is 8 bits per channel; round to nearest.
+            writePixel(index,
+                std::min<unsigned>(255, (r + 0x80) >> 8),
+                std::min<unsigned>(255, (g + 0x80) >> 8),
+                std::min<unsigned>(255, (b + 0x80) >> 8));
+        }
     };
 
     const Value *mConfigMap;
-    std::set<Transfer*> mPending;
+    PixelMapper::Program mCompiledMap;
+
+    // Guards mPending and the frame counters, which are shared between the
+    // output worker thread and the main loop's flush().
+    // Intrusive doubly-linked list of in-flight transfers; insertion and
+    // removal are O(1) with no node allocations.
+    AdaptiveMutex mPendingMutex;
+    Transfer *mPending;
+    std::vector<Transfer*> mFreeTransfers;
     int mNumFramesPending;
+
+    /*
+     * Adaptive in-flight frame limit. MAX_FRAMES_PENDING is the hard
+     * ceiling the staging buffers are sized for; the working limit moves
+     * within the configured "queueDepth" bounds based on measured
+     * submit-to-completion transfer latency. A deeper queue hides bus idle
+     * time between frames, but every queued frame is latency, so the limit
+     * shrinks when transfers start queueing behind other bus traffic.
+     * Guarded by mPendingMutex, like the frame counters.
+     */
+    static const unsigned QUEUE_ADJUST_INTERVAL = 32;
+    unsigned mFramesPendingLimit;
+    unsigned mQueueDepthMin;
+    unsigned mQueueDepthMax;
+    uint64_t mTransferLatency;          // EWMA of submit-to-completion, in usec
+    uint64_t mTransferLatencyFloor;     // Recent fastest completion, in usec
+    unsigned mFramesSinceQueueAdjust;
+    uint64_t mCoalescedAtLastAdjust;
+
+    /*
+     * Latest-wins coalescing slot: when the device already has
+     * mFramesPendingLimit transfers in flight, the framebuffer holds the one
+     * frame waiting to go out, and newer frames simply overwrite it. The
+     * counter records how many frames were superseded that way.
+     */
     bool mFrameWaitingForSubmit;
+    uint64_t mCoalescedFrames;
+    uint64_t mFramesWritten;
+    uint64_t mUSBErrors;
+
+    // Errors since the last successful transfer completion. A total that
+    // grows slowly is background noise; a run of consecutive failures is a
+    // device that has stopped responding.
+    uint64_t mConsecutiveUSBErrors;
+
+    /*
+     * Receive-to-completion latency, in log2 microsecond buckets: bucket N
+     * counts frames that took [2^N, 2^N+1) microseconds from the transport
+     * callback to USB transfer completion. Guarded by mPendingMutex, like
+     * the frame counters. mFrameTimestamp is the arrival time of the frame
+     * currently staged in mFramebuffer.
+     */
+    static const unsigned LATENCY_BUCKETS = 24;
+    uint64_t mLatencyHistogram[LATENCY_BUCKETS];
+    uint64_t mFrameTimestamp;
+
+    // Framebuffer packets modified since the last successful submission
+    uint32_t mDirtyPackets;
+    unsigned mDirtyStagingIndex;
 
     char mSerialBuffer[256];
     char mVersionString[10];
 
     libusb_device_descriptor mDD;
-    Packet mFramebuffer[FRAMEBUFFER_PACKETS];
-    Packet mColorLUT[LUT_PACKETS];
+
+    /*
+     * Staging framebuffer, in flat pixel order. Mapping writes land densely
+     * here with no per-pixel packet arithmetic; the packet layout (a control
+     * byte in front of every 63 payload bytes) is produced once per frame in
+     * writeFramebuffer(), as a single sequential pass over the dirty range.
+     * Packet i's payload is exactly bytes [63*i, 63*i+63) of this array.
+     *
+     * The seqlock publishes the framebuffer to snapshot readers (the
+     * "device_pixel_snapshot" message). Its protocol allows one writer
+     * at a time, so every framebuffer write -- OPC mapping on the output
+     * worker, raw JSON writes on the websocket thread -- brackets the
+     * seqlock while holding mPendingMutex; readers still never block the
+     * writers, which pay two counter increments per frame.
+     */
+    Seqlock mFramebufferSeqlock;
+    uint8_t mFramebuffer[FRAMEBUFFER_PACKETS * (sizeof(Packet) - 1)];
+    /*
+     * Staging buffers and the color LUT are what we actually hand to libusb,
+     * so they live in one DMA-capable allocation made at open() time.
+     * mColorLUT is the base of the block.
+     */
+    static const size_t TRANSFER_BUFFER_BYTES =
+        (LUT_PACKETS + MAX_FRAMES_PENDING * FRAMEBUFFER_PACKETS) * sizeof(Packet);
+    Packet *mDirtyStaging[MAX_FRAMES_PENDING];
+    Packet *mColorLUT;
     Packet mFirmwareConfig;
 
+    /*
+     * The LUT as last sent to this device, for delta updates. Each LUT
+     * packet carries its own table index, and the device applies packets
+     * into its table in place, so a whitepoint nudge only needs the few
+     * packets whose entries moved -- see writeColorCorrection().
+     */
+    Packet mLUTPrev[LUT_PACKETS];
+    bool mLUTPrevValid;
+
+    Transfer *allocTransfer(void *buffer, int length, PacketType type = OTHER);
+    void adjustQueueDepth(uint64_t transferLatency);
+    void releaseTransfer(Transfer *fct);
     bool submitTransfer(Transfer *fct);
     void writeFirmwareConfiguration();
     void writeFirmwareConfiguration(const Value &json);
     void writeDevicePixels(Document &msg);
+    void jsonPixelSnapshot(Document &msg);
     static LIBUSB_CALL void completeTransfer(libusb_transfer *transfer);
 
     void opcSetPixelColors(const OPC::Message &msg);
+    void opcSetPixelColors16(const OPC::Message &msg);
     void opcSysEx(const OPC::Message &msg);
     void opcSetGlobalColorCorrection(const OPC::Message &msg);
     void opcSetFirmwareConfiguration(const OPC::Message &msg);
-    void opcMapPixelColors(const OPC::Message &msg, const Value &inst);
 };
@@ -0,0 +1,320 @@
+/*
+ * Firmware performance counter reader for Fadecandy boards.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * fcperf polls the firmware's performance counters on every attached
+ * board and emits one sample per board per interval, as CSV (default) or
+ * JSON lines, so firmware-side throughput can feed routine monitoring
+ * instead of requiring the pyusb script in firmware/benchmark.py.
+ *
+ * The counters ride a vendor control request (bmRequestType 0xC0,
+ * bRequest 0x01, wIndex = counter, 4 bytes little-endian): counter 0 is
+ * frames rendered and counter 1 is keyframes received; see
+ * firmware/hw/usb_dev.h for the full index map. They're free-running
+ * 32-bit counters, so rates are computed from wrapped deltas. Boards are
+ * polled concurrently, one thread per board, so one wedged device can't
+ * stall the others' samples.
+ *
+ * With -x, each sample also carries the extended counters: the render
+ * pass min/max duration over the sample interval (reading the min
+ * latches both and restarts the firmware's measurement window, so each
+ * sample describes exactly one interval), the USB packet buffer
+ * high-water mark, and the dither underrun and dry interpolation
+ * interval totals. Requires firmware with the extended counter surface.
+ *
+ * usage: fcperf [-j] [-x] [-i interval ms] [-n samples]
+ *
+ *   -j   JSON lines instead of CSV
+ *   -x   include the extended firmware counters in each sample
+ *   -i   sample interval in milliseconds (default 1000)
+ *   -n   samples per board, 0 for until interrupted (default 0)
+ */
+
+#include <libusb.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "tinythread.h"
+
+#ifdef OS_LINUX
+#include <time.h>
+#else
+#include <sys/time.h>
+#endif
+
+
+static uint64_t monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+static const uint16_t FC_VENDOR = 0x1d50;
+static const uint16_t FC_PRODUCT = 0x607a;
+
+// Counter indexes, from the firmware's vendor request handler
+static const unsigned COUNTER_FRAMES = 0;
+static const unsigned COUNTER_KEYFRAMES = 1;
+static const unsigned COUNTER_RENDER_MIN = 2;    // reading latches 2+3, restarts window
+static const unsigned COUNTER_RENDER_MAX = 3;
+static const unsigned COUNTER_USB_HIGHWATER = 4;
+static const unsigned COUNTER_DITHER_UNDERRUNS = 5;
+static const unsigned COUNTER_DRY_INTERVALS = 6;
+
+// One stdout line per sample; the pollers share the stream
+static tthread::mutex gOutputMutex;
+
+struct Options {
+    bool json;
+    bool extended;
+    unsigned intervalMs;
+    unsigned samples;       // 0 = until interrupted
+};
+
+struct Poller {
+    libusb_device_handle *handle;
+    char serial[256];
+    const Options *options;
+    bool failed;
+};
+
+static bool readCounter(libusb_device_handle *handle, unsigned index, uint32_t &value)
+{
+    uint8_t buffer[4];
+    int r = libusb_control_transfer(handle,
+        LIBUSB_ENDPOINT_IN | LIBUSB_REQUEST_TYPE_VENDOR | LIBUSB_RECIPIENT_DEVICE,
+        0x01, 0, index, buffer, sizeof buffer, 1000);
+    if (r != sizeof buffer) {
+        return false;
+    }
+    // Little-endian on the wire, regardless of host
+    value = buffer[0] | (buffer[1] << 8) | (buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+    return true;
+}
+
+static void pollerThreadFunc(void *arg)
+{
+    Poller *p = (Poller*) arg;
+    const Options &opt = *p->options;
+
+    uint32_t lastFrames, lastKeyframes;
+    if (!readCounter(p->handle, COUNTER_FRAMES, lastFrames) ||
+        !readCounter(p->handle, COUNTER_KEYFRAMES, lastKeyframes)) {
+        fprintf(stderr, "%s: error reading performance counters; firmware too old?\n", p->serial);
+        p->failed = true;
+        return;
+    }
+    if (opt.extended) {
+        // Discard the stale min/max window so the first sample's window
+        // starts now, aligned with the first interval.
+        uint32_t discard;
+        if (!readCounter(p->handle, COUNTER_RENDER_MIN, discard)) {
+            fprintf(stderr, "%s: error reading extended counters; firmware too old?\n", p->serial);
+            p->failed = true;
+            return;
+        }
+    }
+    uint64_t lastTime = monotonicMicroseconds();
+
+    for (unsigned n = 0; !opt.samples || n < opt.samples; n++) {
+        tthread::this_thread::sleep_for(tthread::chrono::milliseconds(opt.intervalMs));
+
+        uint32_t frames, keyframes;
+        if (!readCounter(p->handle, COUNTER_FRAMES, frames) ||
+            !readCounter(p->handle, COUNTER_KEYFRAMES, keyframes)) {
+            fprintf(stderr, "%s: error reading performance counters\n", p->serial);
+            p->failed = true;
+            return;
+        }
+        uint32_t renderMin = 0, renderMax = 0, highwater = 0, underruns = 0, dry = 0;
+        if (opt.extended) {
+            // Reading the min latches the max too, so they describe the
+            // same window even though they arrive in separate transfers.
+            if (!readCounter(p->handle, COUNTER_RENDER_MIN, renderMin) ||
+                !readCounter(p->handle, COUNTER_RENDER_MAX, renderMax) ||
+                !readCounter(p->handle, COUNTER_USB_HIGHWATER, highwater) ||
+                !readCounter(p->handle, COUNTER_DITHER_UNDERRUNS, underruns) ||
+                !readCounter(p->handle, COUNTER_DRY_INTERVALS, dry)) {
+                fprintf(stderr, "%s: error reading extended counters\n", p->serial);
+                p->failed = true;
+                return;
+            }
+            // An empty window leaves the min at its reset sentinel
+            if (renderMin == 0xffffffff) {
+                renderMin = 0;
+            }
+        }
+        uint64_t now = monotonicMicroseconds();
+
+        // Free-running 32-bit counters; deltas survive wraparound
+        uint32_t dFrames = frames - lastFrames;
+        uint32_t dKeyframes = keyframes - lastKeyframes;
+        double seconds = (now - lastTime) / 1e6;
+        double fps = seconds > 0 ? dFrames / seconds : 0;
+        double kfps = seconds > 0 ? dKeyframes / seconds : 0;
+
+        gOutputMutex.lock();
+        if (opt.json) {
+            printf("{\"timestamp_usec\": %llu, \"serial\": \"%s\", "
+                "\"frames_total\": %lu, \"keyframes_total\": %lu, "
+                "\"fps\": %.2f, \"keyframes_per_sec\": %.2f",
+                (unsigned long long) now, p->serial,
+                (unsigned long) frames, (unsigned long) keyframes, fps, kfps);
+            if (opt.extended) {
+                printf(", \"render_min_usec\": %lu, \"render_max_usec\": %lu, "
+                    "\"usb_buffers_highwater\": %lu, "
+                    "\"dither_underruns_total\": %lu, \"dry_intervals_total\": %lu",
+                    (unsigned long) renderMin, (unsigned long) renderMax,
+                    (unsigned long) highwater, (unsigned long) underruns,
+                    (unsigned long) dry);
+            }
+            printf("}\n");
+        } else {
+            printf("%llu,%s,%lu,%lu,%.2f,%.2f",
+                (unsigned long long) now, p->serial,
+                (unsigned long) frames, (unsigned long) keyframes, fps, kfps);
+            if (opt.extended) {
+                printf(",%lu,%lu,%lu,%lu,%lu",
+                    (unsigned long) renderMin, (unsigned long) renderMax,
+                    (unsigned long) highwater, (unsigned long) underruns,
+                    (unsigned long) dry);
+            }
+            printf("\n");
+        }
+        fflush(stdout);
+        gOutputMutex.unlock();
+
+        lastFrames = frames;
+        lastKeyframes = keyframes;
+        lastTime = now;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    options.json = false;
+    options.extended = false;
+    options.intervalMs = 1000;
+    options.samples = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-j")) {
+            options.json = true;
+        } else if (!strcmp(argv[i], "-x")) {
+            options.extended = true;
+        } else if (!strcmp(argv[i], "-i") && i + 1 < argc) {
+            options.intervalMs = atoi(argv[++i]);
+            if (!options.intervalMs) {
+                fprintf(stderr, "Invalid interval\n");
+                return 1;
+            }
+        } else if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+            options.samples = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: fcperf [-j] [-x] [-i interval ms] [-n samples]\n");
+            return 1;
+        }
+    }
+
+    libusb_context *usb;
+    if (libusb_init(&usb) < 0) {
+        fprintf(stderr, "Error initializing USB library\n");
+        return 2;
+    }
+
+    libusb_device **list;
+    ssize_t listSize = libusb_get_device_list(usb, &list);
+
+    std::vector<Poller*> pollers;
+    for (ssize_t i = 0; i < listSize; i++) {
+        libusb_device_descriptor dd;
+        if (libusb_get_device_descriptor(list[i], &dd) < 0) {
+            continue;
+        }
+        if (dd.idVendor != FC_VENDOR || dd.idProduct != FC_PRODUCT) {
+            continue;
+        }
+
+        libusb_device_handle *handle;
+        if (libusb_open(list[i], &handle) < 0) {
+            fprintf(stderr, "Error opening device at bus %d address %d; permissions?\n",
+                libusb_get_bus_number(list[i]), libusb_get_device_address(list[i]));
+            continue;
+        }
+
+        Poller *p = new Poller;
+        p->handle = handle;
+        p->options = &options;
+        p->failed = false;
+        p->serial[0] = '\0';
+        libusb_get_string_descriptor_ascii(handle, dd.iSerialNumber,
+            (uint8_t*) p->serial, sizeof p->serial);
+        pollers.push_back(p);
+    }
+    libusb_free_device_list(list, 1);
+
+    if (pollers.empty()) {
+        fprintf(stderr, "No Fadecandy boards found\n");
+        libusb_exit(usb);
+        return 3;
+    }
+
+    fprintf(stderr, "Polling %u board(s) every %u ms...\n",
+        (unsigned) pollers.size(), options.intervalMs);
+    if (!options.json) {
+        printf("timestamp_usec,serial,frames_total,keyframes_total,fps,keyframes_per_sec");
+        if (options.extended) {
+            printf(",render_min_usec,render_max_usec,usb_buffers_highwater,"
+                "dither_underruns_total,dry_intervals_total");
+        }
+        printf("\n");
+    }
+
+    std::vector<tthread::thread*> threads;
+    for (unsigned i = 0; i < pollers.size(); i++) {
+        threads.push_back(new tthread::thread(pollerThreadFunc, pollers[i]));
+    }
+
+    int exitCode = 0;
+    for (unsigned i = 0; i < threads.size(); i++) {
+        threads[i]->join();
+        delete threads[i];
+        if (pollers[i]->failed) {
+            exitCode = 4;
+        }
+        libusb_close(pollers[i]->handle);
+        delete pollers[i];
+    }
+
+    libusb_exit(usb);
+    return exitCode;
+}
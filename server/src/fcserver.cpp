@@ -24,29 +24,107 @@
 #include "fcserver.h"
 #include "usbdevice.h"
 #include "apa102spidevice.h"
+#include "ws2811device.h"
+#include "recorddevice.h"
+#include "nulldevice.h"
+#include "probedevice.h"
 #include "fcdevice.h"
 #include "version.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+#include "rapidjson/filestream.h"
 #include "enttecdmxdevice.h"
 #include "glimmerdevice.h"
+#include "rtsched.h"
+#include "asynclog.h"
+#include "taskpool.h"
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
 #include <ctype.h>
+#include <algorithm>
 #include <iostream>
 
+#ifdef OS_LINUX
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
 #ifdef FCSERVER_HAS_WIRINGPI
 #include <wiringPi.h>
 #endif
 
+// Atomic reader count for the routing table grace period
+#ifdef _MSC_VER
+#define DISPATCH_ENTER(self)  _InterlockedIncrement(&(self)->mDispatchCount)
+#define DISPATCH_LEAVE(self)  _InterlockedDecrement(&(self)->mDispatchCount)
+#else
+#define DISPATCH_ENTER(self)  __sync_add_and_fetch(&(self)->mDispatchCount, 1)
+#define DISPATCH_LEAVE(self)  __sync_sub_and_fetch(&(self)->mDispatchCount, 1)
+#endif
+
 FCServer::FCServer(rapidjson::Document &config)
     : mConfig(config),
       mListen(config["listen"]),
       mRelay(config["relay"]),
+      mUdpListen(config["udpListen"]),
+      mShmListen(config["shmListen"]),
+      mListenShards(config["listenShards"]),
+      mDeviceDebounce(config["deviceDebounce"]),
+      mRtPriority(config["rtPriority"]),
+      mThreads(config["threads"]),
       mColor(config["color"]),
       mDevices(config["devices"]),
+      mUsbBusFilter(config["usbBusFilter"]),
       mVerbose(config["verbose"].IsTrue()),
+      mFastBoot(config["fastBoot"].IsTrue()),
+      mDedupe(config["dedupe"].IsTrue()),
       mPollForDevicesOnce(false),
-      mTcpNetServer(cbOpcMessage, cbJsonMessage, this, mVerbose),
+      mDevicesChangedPending(false),
+      mDevicesChangedDeadline(0),
+      mReloadPending(0),
+      mShutdownPending(0),
+      mTcpNetServer(cbOpcMessage, cbJsonMessage, this, mVerbose, cbOpcMessageBatch),
+      mUdpNetServer(cbOpcMessage, this, mVerbose),
+      mShmServer(cbOpcMessage, this, mVerbose),
+      mFrameScheduler(cbOpcMessage, this, mVerbose),
       mUSBHotplugThread(0),
-      mUSB(0)
+      mUSB(0),
+      mRoutingTable(new RoutingTable),
+      mDispatchCount(0),
+      mFirstUSBDeviceSeen(false),
+      mFirstFrameLatch(0),
+      mFirstFrameMicroseconds(0),
+      mAttachThreadCount(0),
+      mGeneratorRunning(0)
 {
+    mStartupBase = monotonicMicroseconds();
+
+#ifdef OS_LINUX
+    mEpollFd = -1;
+    mWakeupFd = -1;
+#endif
+
+    for (unsigned i = 0; i < OPC_CHANNEL_COUNT; i++) {
+        mFrameCache[i].msg = 0;
+        mChannelFrameHash[i] = 0;
+    }
+    mDuplicateFramesSuppressed = 0;
+
+    /*
+     * Serialize the configuration once; server_info replies splice this
+     * cached text in instead of deep-copying the config tree per request.
+     */
+    rapidjson::GenericStringBuffer<rapidjson::UTF8<> > configBuffer;
+    rapidjson::Writer<rapidjson::GenericStringBuffer<rapidjson::UTF8<> > > configWriter(configBuffer);
+    mConfig.Accept(configWriter);
+    mConfigText.assign(configBuffer.GetString(), configBuffer.Size());
+
+    mTcpNetServer.setMetricsCallback(cbMetrics);
+
     /*
      * Validate the listen [host, port] list.
      */
@@ -92,22 +170,265 @@ FCServer::FCServer(rapidjson::Document &config)
         mError << "The optional 'relay' configuration key must be a [host, post] list.\n";
     }
 
+    /*
+     * Validate the optional udpListen [host, port] list.
+     */
+
+    if (mUdpListen.IsArray() && mUdpListen.Size() == 2) {
+        const Value &host = mUdpListen[0u];
+        const Value &port = mUdpListen[1];
+
+        if (!host.IsString() && !host.IsNull()) {
+            mError << "Hostname in 'udpListen' must be null (any) or a hostname string.\n";
+        }
+
+        if (!port.IsUint()) {
+            mError << "The 'udpListen' port must be an integer.\n";
+        }
+    }
+    else if (!mUdpListen.IsNull()) {
+        mError << "The optional 'udpListen' configuration key must be a [host, port] list.\n";
+    }
+
+    /*
+     * Validate the optional shmListen path.
+     */
+
+    if (!mShmListen.IsString() && !mShmListen.IsNull()) {
+        mError << "The optional 'shmListen' configuration key must be a file path string.\n";
+    }
+
+    /*
+     * Validate the optional listenShards count.
+     */
+
+    if (mListenShards.IsUint()) {
+        if (mListenShards.GetUint() < 1 || mListenShards.GetUint() > 32) {
+            mError << "The 'listenShards' count must be between 1 and 32.\n";
+        }
+    } else if (!mListenShards.IsNull()) {
+        mError << "The optional 'listenShards' configuration key must be an integer.\n";
+    }
+
+    /*
+     * Validate the optional real-time scheduling priority.
+     */
+
+    if (mRtPriority.IsUint()) {
+        if (mRtPriority.GetUint() < 1 || mRtPriority.GetUint() > 99) {
+            mError << "The 'rtPriority' value must be between 1 and 99.\n";
+        }
+    } else if (!mRtPriority.IsNull()) {
+        mError << "The optional 'rtPriority' configuration key must be an integer.\n";
+    }
+
+    /*
+     * Validate the optional thread placement section. Each member maps one
+     * of fcserver's named threads to the CPU or list of CPUs it should run
+     * on. The names are checked here so a typo fails loudly instead of
+     * silently leaving a thread unpinned.
+     */
+
+    if (mThreads.IsObject()) {
+        static const char *knownThreads[] = {
+            "usb", "net", "relay", "output", "spi", "dmx", "tasks", 0
+        };
+
+        for (Value::ConstMemberIterator iter = mThreads.MemberBegin(),
+                e = mThreads.MemberEnd(); iter != e; ++iter) {
+            const char *name = iter->name.GetString();
+            const Value &cpus = iter->value;
+
+            unsigned k = 0;
+            while (knownThreads[k] && strcmp(knownThreads[k], name)) {
+                k++;
+            }
+            if (!knownThreads[k]) {
+                mError << "Unknown thread name '" << name << "' in 'threads'.\n";
+                continue;
+            }
+
+            if (cpus.IsUint()) {
+                continue;
+            }
+            if (cpus.IsArray() && cpus.Size() >= 1) {
+                bool ok = true;
+                for (unsigned i = 0; i < cpus.Size(); i++) {
+                    ok = ok && cpus[i].IsUint();
+                }
+                if (ok) {
+                    continue;
+                }
+            }
+            mError << "The 'threads' entry for '" << name
+                << "' must be a CPU number or a list of CPU numbers.\n";
+        }
+    } else if (!mThreads.IsNull()) {
+        mError << "The optional 'threads' configuration key must be an object.\n";
+    }
+
+    /*
+     * Validate the optional device-change debounce interval.
+     */
+
+    if (!mDeviceDebounce.IsUint() && !mDeviceDebounce.IsNull()) {
+        mError << "The optional 'deviceDebounce' configuration key must be an integer (milliseconds).\n";
+    }
+
+    /*
+     * Validate the optional fast-boot flag.
+     */
+
+    if (!config["fastBoot"].IsBool() && !config["fastBoot"].IsNull()) {
+        mError << "The optional 'fastBoot' configuration key must be true or false.\n";
+    }
+
     /*
      * Minimal validation on 'devices'
      */
 
     if (!mDevices.IsArray()) {
         mError << "The required 'devices' configuration key must be an array.\n";
+    } else {
+        // Pre-parse the fields used for device matching; see DeviceConfig
+        buildDeviceConfigs(mDevices, mDeviceConfigs);
+    }
+
+    markStartupPhase("config_validated");
+}
+
+void FCServer::markStartupPhase(const char *name)
+{
+    /*
+     * Record how long after construction a startup phase completed, for
+     * the log and for server_info replies. Knowing whether a slow boot is
+     * stuck in enumeration or in device configuration turns "it takes
+     * five seconds to light up" into a fixable report.
+     */
+
+    StartupPhase phase;
+    phase.name = name;
+    phase.microseconds = monotonicMicroseconds() - mStartupBase;
+    mStartupPhases.push_back(phase);
+
+    if (mVerbose) {
+        std::clog << "Startup: " << name << " at +" << (phase.microseconds / 1000) << " ms\n";
+    }
+}
+
+void FCServer::buildDeviceConfigs(const Value &devices, std::vector<DeviceConfig> &out)
+{
+    out.resize(devices.Size());
+    for (unsigned i = 0; i < devices.Size(); ++i) {
+        const Value &device = devices[i];
+        DeviceConfig &dc = out[i];
+
+        dc.json = &device;
+        dc.port = 0;
+        dc.numLights = 0;
+        dc.hasPort = false;
+        dc.hasNumLights = false;
+        dc.matchable = true;
+
+        if (!device.IsObject()) {
+            dc.matchable = false;
+            continue;
+        }
+
+        const Value &vtype = device["type"];
+        const Value &vserial = device["serial"];
+        const Value &vport = device["port"];
+        const Value &vnumLights = device["numLights"];
+
+        if (vtype.IsString()) {
+            dc.type = vtype.GetString();
+        } else if (!vtype.IsNull()) {
+            dc.matchable = false;
+        }
+        if (vserial.IsString()) {
+            dc.serial = vserial.GetString();
+        } else if (!vserial.IsNull()) {
+            dc.matchable = false;
+        }
+        if (vport.IsUint()) {
+            dc.port = vport.GetUint();
+            dc.hasPort = true;
+        }
+        if (vnumLights.IsUint()) {
+            dc.numLights = vnumLights.GetUint();
+            dc.hasNumLights = true;
+        }
+    }
+}
+
+bool FCServer::configMatchesUSB(const DeviceConfig &dc, USBDevice *dev)
+{
+    /*
+     * Typed equivalent of USBDevice::matchConfiguration(), for the hotplug
+     * paths. The JSON form remains for device-targeted client messages,
+     * which match against descriptors we haven't pre-parsed.
+     */
+
+    if (!dc.matchable) {
+        return false;
+    }
+
+    if (!dc.type.empty() && dc.type != dev->getTypeString()) {
+        return false;
+    }
+
+    if (!dc.serial.empty() && dev->getSerial() && dc.serial != dev->getSerial()) {
+        return false;
     }
+
+    return true;
 }
 
 bool FCServer::start(libusb_context *usb)
 {
+    if (mRtPriority.IsUint()) {
+        // Lock memory before the servers and devices allocate theirs
+        RtSched::enable(mRtPriority.GetUint());
+    }
+
+    if (mThreads.IsObject()) {
+        // Record thread placements before any of the named threads start
+        for (Value::ConstMemberIterator iter = mThreads.MemberBegin(),
+                e = mThreads.MemberEnd(); iter != e; ++iter) {
+            std::vector<int> cpus;
+            if (iter->value.IsUint()) {
+                cpus.push_back(iter->value.GetUint());
+            } else {
+                for (unsigned i = 0; i < iter->value.Size(); i++) {
+                    cpus.push_back(iter->value[i].GetUint());
+                }
+            }
+            RtSched::setThreadCpus(iter->name.GetString(), cpus);
+        }
+    }
+
     const Value &host = mListen[0u];
     const Value &port = mListen[1];
     const char *hostStr = host.IsString() ? host.GetString() : NULL;
 
-    bool started = mTcpNetServer.start(hostStr, port.GetUint()) && startUSB(usb) && startSPI();
+    unsigned shards = mListenShards.IsUint() ? mListenShards.GetUint() : 1;
+
+    bool started = mTcpNetServer.start(hostStr, port.GetUint(), shards)
+        && mFrameScheduler.start();
+
+    // The network comes up before device enumeration starts, so clients
+    // can connect and stream while the boards are still attaching.
+    if (started) {
+        markStartupPhase("network_listening");
+        started = startUSB(usb);
+    }
+    if (started) {
+        markStartupPhase("usb_hotplug_registered");
+        started = startSPI() && startVirtualDevices();
+    }
+    if (started) {
+        markStartupPhase("local_devices_started");
+    }
 
     if (started && !mRelay.IsNull()) {
         const Value &relayHost = mRelay[0u];
@@ -116,6 +437,17 @@ bool FCServer::start(libusb_context *usb)
         mTcpNetServer.startRelay(relayHostStr, relayPort.GetUint());
     }
 
+    if (started && !mUdpListen.IsNull()) {
+        const Value &udpHost = mUdpListen[0u];
+        const Value &udpPort = mUdpListen[1];
+        const char *udpHostStr = udpHost.IsString() ? udpHost.GetString() : NULL;
+        started = mUdpNetServer.start(udpHostStr, udpPort.GetUint());
+    }
+
+    if (started && !mShmListen.IsNull()) {
+        started = mShmServer.start(mShmListen.GetString());
+    }
+
     return started;
 }
 
@@ -144,233 +476,1304 @@ bool FCServer::startUSB(libusb_context *usb)
 void FCServer::cbOpcMessage(OPC::Message &msg, void *context)
 {
     /*
-     * Broadcast the OPC message to all configured devices.
+     * Route one OPC message to all interested devices.
+     *
+     * Lock-free fast path. Every transport thread dispatches through
+     * here; writers wait for the reader count to drain after
+     * swapping in a new table, so the snapshot we load stays valid until
+     * we decrement.
      */
 
     FCServer *self = static_cast<FCServer*>(context);
-    self->mEventMutex.lock();
+    uint64_t timestamp = monotonicMicroseconds();
 
-    for (std::vector<USBDevice*>::iterator i = self->mUSBDevices.begin(), e = self->mUSBDevices.end(); i != e; ++i) {
-        USBDevice *dev = *i;
-        dev->writeMessage(msg);
-    }
+    DISPATCH_ENTER(self);
+    SPSC_MEMORY_BARRIER();
+    RoutingTable *table = self->mRoutingTable;
 
-    for (std::vector<SPIDevice*>::iterator i = self->mSPIDevices.begin(), e = self->mSPIDevices.end(); i != e; ++i) {
-        SPIDevice *dev = *i;
-        dev->writeMessage(msg);
-    }
+    self->dispatchOpcMessage(msg, *table, timestamp);
 
-    self->mEventMutex.unlock();
+    SPSC_MEMORY_BARRIER();
+    DISPATCH_LEAVE(self);
 
     // also forward the message to clients connected on the relay socket
     self->mTcpNetServer.relayMessage(msg);
 }
 
-int FCServer::cbHotplug(libusb_context *ctx, libusb_device *device, libusb_hotplug_event event, void *user_data)
+void FCServer::cbOpcMessageBatch(OPC::Message **messages, unsigned count, void *context)
 {
-    FCServer *self = static_cast<FCServer*>(user_data);
+    /*
+     * Batch form: several messages drained from one socket read share a
+     * single reader-count bracket and routing table load, instead of paying
+     * that overhead per message.
+     */
 
-    self->mEventMutex.lock();
+    FCServer *self = static_cast<FCServer*>(context);
+    uint64_t timestamp = monotonicMicroseconds();
 
-    if (event & LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED) {
-        self->usbDeviceArrived(device);
+    DISPATCH_ENTER(self);
+    SPSC_MEMORY_BARRIER();
+    RoutingTable *table = self->mRoutingTable;
+
+    for (unsigned i = 0; i < count; i++) {
+        self->dispatchOpcMessage(*messages[i], *table, timestamp);
     }
-    if (event & LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT) {
-        self->usbDeviceLeft(device);
+
+    SPSC_MEMORY_BARRIER();
+    DISPATCH_LEAVE(self);
+
+    for (unsigned i = 0; i < count; i++) {
+        self->mTcpNetServer.relayMessage(*messages[i]);
     }
+}
 
-    self->mEventMutex.unlock();
-    return false;
+void FCServer::dispatchOpcMessage(OPC::Message &msg, RoutingTable &table, uint64_t timestamp)
+{
+    // SysEx ID, if this is a well-formed SysEx message
+    unsigned sysexId = 0;
+    if (msg.command == OPC::SystemExclusive && msg.length() >= 4) {
+        sysexId = (unsigned(msg.data[0]) << 24) |
+                  (unsigned(msg.data[1]) << 16) |
+                  (unsigned(msg.data[2]) << 8)  |
+                   unsigned(msg.data[3])        ;
+    }
+
+    if (msg.command == OPC::SetPixelColors || sysexId == OPC::FCSetPixelColors16) {
+        // Pixel data, 8 or 16 bits per channel. Deliver only to devices that
+        // map this channel, plus any devices whose channel set we couldn't
+        // determine. The 16-bit form shares this path so it gets the same
+        // pacing statistics and fast-boot frame caching.
+
+        mPacingAnalyzer.recordChannelFrame(msg.channel, timestamp);
+
+        if (!mFirstFrameLatch && !__sync_lock_test_and_set(&mFirstFrameLatch, 1)) {
+            // One-shot startup stamp; the flag check keeps this off the
+            // steady-state path.
+            mFirstFrameMicroseconds = timestamp - mStartupBase;
+            if (mVerbose) {
+                std::clog << "Startup: first_frame_dispatched at +"
+                    << (mFirstFrameMicroseconds / 1000) << " ms\n";
+            }
+        }
+
+        if (mDedupe) {
+            // Static content: an unchanged payload has already been
+            // delivered (and, with fast boot, cached), so there's nothing
+            // for any device to do with a repeat of it.
+            uint64_t hash = hashPixelPayload(msg);
+            if (hash == mChannelFrameHash[msg.channel]) {
+                __sync_fetch_and_add(&mDuplicateFramesSuppressed, 1);
+                return;
+            }
+            mChannelFrameHash[msg.channel] = hash;
+        }
+
+        ChannelRouting &routing = table.channels[msg.channel];
+
+        for (std::vector<USBDevice*>::iterator i = routing.usbDevices.begin(), e = routing.usbDevices.end(); i != e; ++i) {
+            (*i)->writeMessageAsync(msg, timestamp);
+        }
+        for (std::vector<SPIDevice*>::iterator i = routing.spiDevices.begin(), e = routing.spiDevices.end(); i != e; ++i) {
+            (*i)->writeMessageAsync(msg, timestamp);
+        }
+        for (std::vector<USBDevice*>::iterator i = table.unroutedUSBDevices.begin(), e = table.unroutedUSBDevices.end(); i != e; ++i) {
+            (*i)->writeMessageAsync(msg, timestamp);
+        }
+        for (std::vector<SPIDevice*>::iterator i = table.unroutedSPIDevices.begin(), e = table.unroutedSPIDevices.end(); i != e; ++i) {
+            (*i)->writeMessageAsync(msg, timestamp);
+        }
+
+        if (mFastBoot) {
+            // After delivery, so caching never delays the lights
+            cacheFrame(msg);
+        }
+
+    } else if (sysexId == OPC::FCQueueDepthRequest) {
+        // Flow control: answer with per-channel queue depths, not forwarded to devices.
+
+        opcQueueDepthRequest(table);
+
+    } else if (sysexId == OPC::FCSetGlobalColorCorrection) {
+        // Parse the JSON once here, instead of once per device.
+
+        opcSetGlobalColorCorrection(msg, table);
+
+    } else if (sysexId == OPC::FCFramePresent) {
+        // Hand the embedded message to the presentation scheduler.
+
+        opcFramePresent(msg);
+
+    } else if (sysexId == OPC::FCDevicePixels) {
+        // Raw unmapped pixel data, addressed by device serial.
+
+        opcDevicePixels(msg, table);
+
+    } else {
+        // Other commands (SysEx, etc.) aren't channel-addressed; broadcast them.
+
+        for (std::vector<USBDevice*>::iterator i = table.allUSBDevices.begin(), e = table.allUSBDevices.end(); i != e; ++i) {
+            (*i)->writeMessageAsync(msg, timestamp);
+        }
+        for (std::vector<SPIDevice*>::iterator i = table.allSPIDevices.begin(), e = table.allSPIDevices.end(); i != e; ++i) {
+            (*i)->writeMessageAsync(msg, timestamp);
+        }
+    }
 }
 
-void FCServer::usbDeviceArrived(libusb_device *device)
+uint64_t FCServer::hashPixelPayload(const OPC::Message &msg)
 {
     /*
-     * New USB device. Is this a device we recognize?
+     * FNV-1a over the command byte and pixel data. One multiply per byte
+     * keeps this cheap enough for the dispatch hot path, and 64 bits makes
+     * an accidental collision between two distinct frames on one channel
+     * vanishingly unlikely. The command byte distinguishes the 8- and
+     * 16-bit pixel forms, whose payloads could otherwise alias.
      */
 
-    USBDevice *dev;
+    uint64_t hash = 14695981039346656037ULL;
+    unsigned length = msg.length();
 
-    if (FCDevice::probe(device)) {
-        dev = new FCDevice(device, mVerbose);
+    hash = (hash ^ msg.command) * 1099511628211ULL;
+    for (unsigned i = 0; i < length; i++) {
+        hash = (hash ^ msg.data[i]) * 1099511628211ULL;
+    }
 
-    } else if (EnttecDMXDevice::probe(device)) {
-        dev = new EnttecDMXDevice(device, mVerbose);
+    // Zero is reserved to mean "no previous frame"
+    return hash ? hash : 1;
+}
 
-    } else if (GlimmerDevice::probe(device)) {
-        dev = new GlimmerDevice(device, mVerbose);
+void FCServer::cacheFrame(OPC::Message &msg)
+{
+    /*
+     * Fast boot: remember the newest frame seen on this channel, so a
+     * device that attaches later can be lit immediately. Runs on the
+     * dispatch path after delivery; the per-channel lock is uncontended
+     * unless an attaching device is being primed from this channel.
+     */
 
-    } else {
-        return;
+    CachedFrame &slot = mFrameCache[msg.channel];
+
+    slot.mutex.lock();
+    if (!slot.msg) {
+        slot.msg = new OPC::Message;
     }
+    memcpy(slot.msg, &msg, OPC::HEADER_BYTES + msg.length());
+    slot.mutex.unlock();
+}
 
-    int r = dev->open();
-    if (r < 0) {
+void FCServer::primeAttachedDevice(USBDevice *dev)
+{
+    /*
+     * Fast boot: replay the newest cached frame for each channel the new
+     * device maps — every cached channel, if its channel set can't be
+     * enumerated — so its LEDs show the client's current frame at attach
+     * instead of staying dark until the client sends another one. Call
+     * with mEventMutex held, after the device has been registered.
+     */
+
+    std::set<unsigned> channels;
+    bool enumerated = dev->getOPCChannels(channels);
+    uint64_t timestamp = monotonicMicroseconds();
+
+    for (unsigned i = 0; i < OPC_CHANNEL_COUNT; i++) {
+        if (enumerated && !channels.count(i)) {
+            continue;
+        }
+
+        CachedFrame &slot = mFrameCache[i];
+        slot.mutex.lock();
+        if (slot.msg) {
+            // writeMessageAsync copies into the device's queue, so the
+            // slot can be overwritten again as soon as we unlock
+            dev->writeMessageAsync(*slot.msg, timestamp);
+        }
+        slot.mutex.unlock();
+    }
+}
+
+void FCServer::opcFramePresent(OPC::Message &msg)
+{
+    /*
+     * Presentation-timestamped frame: the SysEx payload is a 32-bit
+     * big-endian delay in microseconds followed by a complete embedded OPC
+     * message. The scheduler dispatches the embedded message through
+     * cbOpcMessage once the delay elapses, turning network jitter into a
+     * fixed pipeline latency. If the scheduler can't take it, the frame is
+     * presented immediately rather than dropped.
+     */
+
+    if (msg.length() < 8 + OPC::HEADER_BYTES) {
         if (mVerbose) {
-            switch (r) {
+            std::clog << "Short frame presentation message\n";
+        }
+        return;
+    }
 
-                // Errors that may occur transiently while a device is connecting...
-                case LIBUSB_ERROR_NOT_FOUND:
-                case LIBUSB_ERROR_NOT_SUPPORTED:
-                    #ifdef OS_WINDOWS
-                        std::clog << "Waiting for Windows to install " << dev->getName() << " driver. This may take a moment...\n";
-                    #endif
-                    #ifdef OS_LINUX
-                        // Try again in ~100ms or so.
-                        mPollForDevicesOnce = true;
-                    #endif
-                    break;
+    uint64_t delayMicros = (uint64_t(msg.data[4]) << 24) |
+                           (uint64_t(msg.data[5]) << 16) |
+                           (uint64_t(msg.data[6]) << 8)  |
+                            uint64_t(msg.data[7])        ;
 
-                default:
-                    std::clog << "Error opening " << dev->getName() << ": " << libusb_strerror(libusb_error(r)) << "\n";
-                    break;
-            }
+    // Too large for the stack; see opcQueueDepthRequest.
+    OPC::Message *inner = new OPC::Message;
+    inner->channel = msg.data[8];
+    inner->command = msg.data[9];
+    inner->lenHigh = msg.data[10];
+    inner->lenLow = msg.data[11];
+
+    if (8 + OPC::HEADER_BYTES + inner->length() > msg.length()) {
+        if (mVerbose) {
+            std::clog << "Truncated embedded message in frame presentation\n";
         }
-        delete dev;
+        delete inner;
         return;
     }
 
-    if (!dev->probeAfterOpening()) {
-        // We were mistaken, this device isn't actually one we want.
-        delete dev;
+    memcpy(inner->data, &msg.data[12], inner->length());
+
+    if (!mFrameScheduler.schedule(*inner, delayMicros)) {
+        cbOpcMessage(*inner, this);
+    }
+
+    delete inner;
+}
+
+void FCServer::opcDevicePixels(OPC::Message &msg, RoutingTable &table)
+{
+    /*
+     * Binary replacement for the JSON "device_pixels" message: a 16-byte
+     * NUL-padded device serial followed by raw RGB data, copied straight
+     * into the addressed device's framebuffer with no per-pixel JSON
+     * parsing. An empty serial addresses every device. Arrives over raw
+     * OPC sockets and binary WebSocket frames alike.
+     */
+
+    static const unsigned SERIAL_BYTES = 16;
+
+    if (msg.length() < 4 + SERIAL_BYTES) {
         return;
     }
 
-    for (unsigned i = 0; i < mDevices.Size(); ++i) {
-        if (dev->matchConfiguration(mDevices[i])) {
-            // Found a matching configuration for this device. We're keeping it!
+    char serial[SERIAL_BYTES + 1];
+    memcpy(serial, &msg.data[4], SERIAL_BYTES);
+    serial[SERIAL_BYTES] = '\0';
 
-            dev->loadConfiguration(mDevices[i]);
-            dev->writeColorCorrection(mColor);
-            mUSBDevices.push_back(dev);
+    const uint8_t *rgb = &msg.data[4 + SERIAL_BYTES];
+    unsigned numPixels = (msg.length() - 4 - SERIAL_BYTES) / 3;
 
-            if (mVerbose) {
-                std::clog << "USB device " << dev->getName() << " attached.\n";
-            }
-            jsonConnectedDevicesChanged();
-            return;
+    for (std::vector<USBDevice*>::iterator i = table.allUSBDevices.begin(), e = table.allUSBDevices.end(); i != e; ++i) {
+        if (!serial[0] || ((*i)->getSerial() && !strcmp(serial, (*i)->getSerial()))) {
+            (*i)->writeDevicePixels(rgb, numPixels);
+        }
+    }
+    for (std::vector<SPIDevice*>::iterator i = table.allSPIDevices.begin(), e = table.allSPIDevices.end(); i != e; ++i) {
+        if (!serial[0]) {
+            // SPI devices have no serial; they listen to the broadcast form
+            (*i)->writeDevicePixels(rgb, numPixels);
+        }
+    }
+}
+
+void FCServer::opcSetGlobalColorCorrection(OPC::Message &msg, RoutingTable &table)
+{
+    /*
+     * A global color correction broadcast used to be parsed by every
+     * device's writeMessage() separately, costing one JSON parse per
+     * attached board. Parse it once here and hand each device the parsed
+     * document; the per-device work left is just LUT packing and USB
+     * submission. Devices keep their own SysEx handler for completeness,
+     * but dispatch from the transports always takes this path.
+     */
+
+    // Mutable NUL-terminated copy of the message string
+    std::string text((char*)msg.data + 4, msg.length() - 4);
+
+    // Parse it in-place
+    rapidjson::Document doc;
+    doc.ParseInsitu<0>(&text[0]);
+
+    if (doc.HasParseError()) {
+        if (mVerbose) {
+            std::clog << "Parse error in color correction JSON at character "
+                << doc.GetErrorOffset() << ": " << doc.GetParseError() << "\n";
+        }
+        return;
+    }
+
+    for (std::vector<USBDevice*>::iterator i = table.allUSBDevices.begin(), e = table.allUSBDevices.end(); i != e; ++i) {
+        (*i)->writeColorCorrection(doc);
+    }
+    for (std::vector<SPIDevice*>::iterator i = table.allSPIDevices.begin(), e = table.allSPIDevices.end(); i != e; ++i) {
+        (*i)->writeColorCorrection(doc);
+    }
+}
+
+void FCServer::opcQueueDepthRequest(RoutingTable &table)
+{
+    /*
+     * Flow-control SysEx extension: reply with one byte per OPC channel,
+     * counting frames that are queued for the busiest device listening on
+     * that channel but not yet on the wire. Clients use this to pace
+     * themselves instead of blindly overrunning the USB bus. The reply goes
+     * out over the relay socket, our only server-to-client OPC path.
+     */
+
+    OPC::Message *reply = new OPC::Message;
+    reply->channel = 0;
+    reply->command = OPC::SystemExclusive;
+    reply->setLength(4 + OPC_CHANNEL_COUNT);
+    reply->data[0] = uint8_t(OPC::FCQueueDepthReply >> 24);
+    reply->data[1] = uint8_t(OPC::FCQueueDepthReply >> 16);
+    reply->data[2] = uint8_t(OPC::FCQueueDepthReply >> 8);
+    reply->data[3] = uint8_t(OPC::FCQueueDepthReply);
+
+    // Unrouted devices receive every channel's messages
+    unsigned unrouted = 0;
+    for (std::vector<USBDevice*>::iterator i = table.unroutedUSBDevices.begin(), e = table.unroutedUSBDevices.end(); i != e; ++i) {
+        unrouted = std::max(unrouted, (*i)->getQueueDepth());
+    }
+    for (std::vector<SPIDevice*>::iterator i = table.unroutedSPIDevices.begin(), e = table.unroutedSPIDevices.end(); i != e; ++i) {
+        unrouted = std::max(unrouted, (*i)->getQueueDepth());
+    }
+
+    for (unsigned channel = 0; channel < OPC_CHANNEL_COUNT; channel++) {
+        ChannelRouting &routing = table.channels[channel];
+        unsigned depth = unrouted;
+
+        for (std::vector<USBDevice*>::iterator i = routing.usbDevices.begin(), e = routing.usbDevices.end(); i != e; ++i) {
+            depth = std::max(depth, (*i)->getQueueDepth());
+        }
+        for (std::vector<SPIDevice*>::iterator i = routing.spiDevices.begin(), e = routing.spiDevices.end(); i != e; ++i) {
+            depth = std::max(depth, (*i)->getQueueDepth());
+        }
+
+        reply->data[4 + channel] = uint8_t(std::min(depth, 255u));
+    }
+
+    mTcpNetServer.relayMessage(*reply);
+    delete reply;
+}
+
+int FCServer::cbHotplug(libusb_context *ctx, libusb_device *device, libusb_hotplug_event event, void *user_data)
+{
+    FCServer *self = static_cast<FCServer*>(user_data);
+
+    self->mEventMutex.lock();
+
+    if (event & LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED) {
+        self->usbDeviceArrived(device);
+    }
+    if (event & LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT) {
+        self->usbDeviceLeft(device);
+    }
+
+    self->mEventMutex.unlock();
+    return false;
+}
+
+void FCServer::usbDeviceArrived(libusb_device *device)
+{
+    /*
+     * New USB device. Is this a device we recognize?
+     *
+     * Probing is a cheap descriptor check, but opening involves synchronous
+     * string descriptor reads, LUT computation and USB writes — several
+     * hundred milliseconds per board. Attaches run on a few concurrent
+     * attach threads so a rack of boards comes up in parallel; the device
+     * is registered with the server only once it's fully configured. Call
+     * with mEventMutex held.
+     */
+
+    USBDevice *dev;
+
+    if (mUsbBusFilter.IsUint() && libusb_get_bus_number(device) != mUsbBusFilter.GetUint()) {
+        // Another supervisor worker owns this bus
+        return;
+    }
+
+    if (mPendingUSBAddresses.count(usbAddressKey(device))) {
+        // An attach thread is already working on this device
+        return;
+    }
+
+    if (FCDevice::probe(device)) {
+        dev = new FCDevice(device, mVerbose);
+
+    } else if (EnttecDMXDevice::probe(device)) {
+        dev = new EnttecDMXDevice(device, mVerbose);
+
+    } else if (GlimmerDevice::probe(device)) {
+        dev = new GlimmerDevice(device, mVerbose);
+
+    } else {
+        return;
+    }
+
+    if (mAttachThreadCount < MAX_ATTACH_THREADS) {
+        AttachJob *job = new AttachJob;
+        job->server = this;
+        job->dev = dev;
+
+        mPendingUSBAddresses.insert(usbAddressKey(device));
+        mAttachThreadCount++;
+
+        TaskPool::shared().submit(attachThreadFunc, job);
+        return;
+    }
+
+    // Too many attaches already in flight; do it here, as before
+    finishUsbDeviceAttach(dev);
+}
+
+void FCServer::attachThreadFunc(void *arg)
+{
+    AttachJob *job = (AttachJob*) arg;
+    FCServer *self = job->server;
+    uint16_t key = usbAddressKey(job->dev->getDevice());
+
+    self->finishUsbDeviceAttach(job->dev);
+
+    self->mEventMutex.lock();
+    self->mPendingUSBAddresses.erase(key);
+    self->mAttachThreadCount--;
+    self->mEventMutex.unlock();
+
+    delete job;
+}
+
+void FCServer::finishUsbDeviceAttach(USBDevice *dev)
+{
+    /*
+     * Open, probe and configure a recognized device, then register it.
+     * Everything up to registration touches only the device itself, so
+     * this runs without mEventMutex; the lock is taken just for the
+     * registration step.
+     */
+
+    int r = dev->open();
+    if (r < 0) {
+        if (mVerbose) {
+            switch (r) {
+
+                // Errors that may occur transiently while a device is connecting...
+                case LIBUSB_ERROR_NOT_FOUND:
+                case LIBUSB_ERROR_NOT_SUPPORTED:
+                    #ifdef OS_WINDOWS
+                        std::clog << "Waiting for Windows to install " << dev->getName() << " driver. This may take a moment...\n";
+                    #endif
+                    #ifdef OS_LINUX
+                        // Try again shortly.
+                        mEventMutex.lock();
+                        mPollForDevicesOnce = true;
+                        mEventMutex.unlock();
+                        wakeMainLoop();
+                    #endif
+                    break;
+
+                default:
+                    std::clog << "Error opening " << dev->getName() << ": " << libusb_strerror(libusb_error(r)) << "\n";
+                    break;
+            }
+        }
+        delete dev;
+        return;
+    }
+
+    if (!dev->probeAfterOpening()) {
+        // We were mistaken, this device isn't actually one we want.
+        delete dev;
+        return;
+    }
+
+    for (unsigned i = 0; i < mDeviceConfigs.size(); ++i) {
+        if (configMatchesUSB(mDeviceConfigs[i], dev)) {
+            // Found a matching configuration for this device. We're keeping it!
+
+            dev->loadConfiguration(*mDeviceConfigs[i].json);
+            dev->writeColorCorrection(mColor);
+
+            mEventMutex.lock();
+            mUSBDevices.push_back(dev);
+            mKnownUSBAddresses.insert(usbAddressKey(dev->getDevice()));
+            if (dev->getSerial() && dev->getSerial()[0]) {
+                mUSBDevicesBySerial[dev->getSerial()] = dev;
+            }
+            rebuildChannelRouting();
+
+            if (!mFirstUSBDeviceSeen) {
+                mFirstUSBDeviceSeen = true;
+                markStartupPhase("first_usb_device_ready");
+            }
+            if (mFastBoot) {
+                primeAttachedDevice(dev);
+            }
+
+            if (mVerbose) {
+                std::clog << "USB device " << dev->getName() << " attached.\n";
+            }
+            jsonConnectedDevicesChanged();
+            mEventMutex.unlock();
+            return;
+        }
+    }
+
+    if (mVerbose) {
+        std::clog << "USB device " << dev->getName() << " has no matching configuration. Not using it.\n";
+    }
+    delete dev;
+}
+
+void FCServer::rebuildChannelRouting()
+{
+    /*
+     * Build a fresh routing table from the current device lists and publish
+     * it with a pointer swap. Called with mEventMutex held, whenever the
+     * device list changes.
+     *
+     * After the swap we wait out a grace period: once the count of threads
+     * inside cbOpcMessage has drained to zero, no reader can still hold the
+     * old table (or a device that was removed from it), so it's safe to
+     * free the table and for our callers to delete removed devices.
+     */
+
+    RoutingTable *table = new RoutingTable;
+
+    if (mDedupe) {
+        // Forget previous frames, so a device that just attached isn't
+        // starved of static content its channel already delivered.
+        for (unsigned i = 0; i < OPC_CHANNEL_COUNT; i++) {
+            mChannelFrameHash[i] = 0;
+        }
+    }
+
+    /*
+     * Assign each device a frame submission slot among the devices sharing
+     * its USB bus, so a broadcast frame's transfers are staggered across
+     * the bus instead of all colliding at the hub.
+     */
+    unsigned busSlots[256];
+    memset(busSlots, 0, sizeof busSlots);
+
+    /*
+     * Rebind devices to their configured sync groups. The group objects
+     * themselves persist for the server's lifetime, since output workers
+     * may be standing at a group barrier while we rebuild. Frames deferred
+     * across a hotplug event are abandoned; the next frame resubmits them.
+     */
+    for (std::map<std::string, USBDevice::SyncGroup*>::iterator g = mSyncGroups.begin(), ge = mSyncGroups.end(); g != ge; ++g) {
+        g->second->mutex.lock();
+        g->second->memberCount = 0;
+        g->second->ready.clear();
+        g->second->mutex.unlock();
+    }
+
+    for (std::vector<USBDevice*>::iterator i = mUSBDevices.begin(), e = mUSBDevices.end(); i != e; ++i) {
+        USBDevice *dev = *i;
+        const std::string &groupName = dev->getSyncGroupName();
+
+        if (groupName.empty()) {
+            dev->setSyncGroup(0);
+            continue;
+        }
+
+        USBDevice::SyncGroup *&group = mSyncGroups[groupName];
+        if (!group) {
+            group = new USBDevice::SyncGroup;
+        }
+
+        group->mutex.lock();
+        group->memberCount++;
+        group->mutex.unlock();
+
+        dev->setSyncGroup(group);
+    }
+
+    for (std::vector<USBDevice*>::iterator i = mUSBDevices.begin(), e = mUSBDevices.end(); i != e; ++i) {
+        USBDevice *dev = *i;
+        std::set<unsigned> channels;
+
+        dev->setBusSchedule(busSlots[libusb_get_bus_number(dev->getDevice())]++);
+
+        table->allUSBDevices.push_back(dev);
+
+        if (!dev->getOPCChannels(channels)) {
+            table->unroutedUSBDevices.push_back(dev);
+            continue;
+        }
+        for (std::set<unsigned>::iterator ch = channels.begin(); ch != channels.end(); ++ch) {
+            if (*ch < OPC_CHANNEL_COUNT) {
+                table->channels[*ch].usbDevices.push_back(dev);
+            }
+        }
+    }
+
+    for (std::vector<SPIDevice*>::iterator i = mSPIDevices.begin(), e = mSPIDevices.end(); i != e; ++i) {
+        SPIDevice *dev = *i;
+        std::set<unsigned> channels;
+
+        table->allSPIDevices.push_back(dev);
+
+        if (!dev->getOPCChannels(channels)) {
+            table->unroutedSPIDevices.push_back(dev);
+            continue;
+        }
+        for (std::set<unsigned>::iterator ch = channels.begin(); ch != channels.end(); ++ch) {
+            if (*ch < OPC_CHANNEL_COUNT) {
+                table->channels[*ch].spiDevices.push_back(dev);
+            }
+        }
+    }
+
+    RoutingTable *old = mRoutingTable;
+    mRoutingTable = table;
+    SPSC_MEMORY_BARRIER();
+
+    while (mDispatchCount) {
+        tthread::this_thread::sleep_for(tthread::chrono::milliseconds(1));
+    }
+
+    delete old;
+}
+
+void FCServer::usbDeviceLeft(libusb_device *device)
+{
+    /*
+     * Is this a device we recognize? If so, delete it.
+     */
+
+    for (std::vector<USBDevice*>::iterator i = mUSBDevices.begin(), e = mUSBDevices.end(); i != e; ++i) {
+        USBDevice *dev = *i;
+        if (dev->getDevice() == device) {
+            usbDeviceLeft(i);
+            break;
+        }
+    }
+}
+
+void FCServer::usbDeviceLeft(std::vector<USBDevice*>::iterator iter)
+{
+    USBDevice *dev = *iter;
+    if (mVerbose) {
+        std::clog << "USB device " << dev->getName() << " removed.\n";
+    }
+    mUSBDevices.erase(iter);
+    mKnownUSBAddresses.erase(usbAddressKey(dev->getDevice()));
+    USBDevice::invalidateCachedSerial(dev->getDevice());
+    if (dev->getSerial() && dev->getSerial()[0]) {
+        mUSBDevicesBySerial.erase(dev->getSerial());
+    }
+    rebuildChannelRouting();
+    delete dev;
+    jsonConnectedDevicesChanged();
+}
+
+bool FCServer::startSPI()
+{
+#ifdef FCSERVER_HAS_WIRINGPI
+    wiringPiSetup();
+#endif
+
+    for (unsigned i = 0; i < mDeviceConfigs.size(); ++i) {
+        const DeviceConfig &dc = mDeviceConfigs[i];
+
+        if (dc.type == APA102SPIDevice::DEVICE_TYPE && dc.hasPort && dc.hasNumLights) {
+            openAPA102SPIDevice(dc.port, dc.numLights);
+        }
+
+        if (dc.type == WS2811Device::DEVICE_TYPE && dc.hasPort && dc.hasNumLights) {
+            openWS2811Device(dc.port, dc.numLights);
+        }
+    }
+
+    return true;
+}
+
+void FCServer::openAPA102SPIDevice(uint32_t port, int numLights)
+{
+    APA102SPIDevice* dev = new APA102SPIDevice(numLights, mVerbose);
+
+    int r = dev->open(port);
+    if (r < 0) {
+        if (mVerbose) {
+            std::clog << "Error opening " << dev->getName() << "\n";
+        }
+        delete dev;
+        return;
+    }
+
+    for (unsigned i = 0; i < mDeviceConfigs.size(); ++i) {
+        const DeviceConfig &dc = mDeviceConfigs[i];
+
+        // Typed match: same type, and either no port constraint or ours
+        if (dc.matchable && dc.type == APA102SPIDevice::DEVICE_TYPE &&
+            (!dc.hasPort || dc.port == port)) {
+            // Found a matching configuration for this device. We're keeping it!
+
+            dev->loadConfiguration(*dc.json);
+            dev->writeColorCorrection(mColor);
+            mSPIDevices.push_back(dev);
+            rebuildChannelRouting();
+
+            if (mVerbose) {
+                std::clog << "SPI device " << dev->getName() << " attached.\n";
+            }
+            jsonConnectedDevicesChanged();
+            return;
+        }
+    }
+}
+
+void FCServer::openWS2811Device(uint32_t gpio, int numLights)
+{
+    WS2811Device* dev = new WS2811Device(numLights, mVerbose);
+
+    int r = dev->open(gpio);
+    if (r < 0) {
+        if (mVerbose) {
+            std::clog << "Error opening " << dev->getName() << "\n";
+        }
+        delete dev;
+        return;
+    }
+
+    for (unsigned i = 0; i < mDeviceConfigs.size(); ++i) {
+        const DeviceConfig &dc = mDeviceConfigs[i];
+
+        // Typed match: same type, and either no port constraint or ours
+        if (dc.matchable && dc.type == WS2811Device::DEVICE_TYPE &&
+            (!dc.hasPort || dc.port == gpio)) {
+            // Found a matching configuration for this device. We're keeping it!
+
+            dev->loadConfiguration(*dc.json);
+            dev->writeColorCorrection(mColor);
+            mSPIDevices.push_back(dev);
+            rebuildChannelRouting();
+
+            if (mVerbose) {
+                std::clog << "GPIO device " << dev->getName() << " attached.\n";
+            }
+            jsonConnectedDevicesChanged();
+            return;
+        }
+    }
+}
+
+bool FCServer::startVirtualDevices()
+{
+    /*
+     * Attach the configuration-instantiated hardware-less devices: stream
+     * recorders, null sinks, and latency probes. One that can't open is
+     * skipped with a complaint rather than failing startup; the lights
+     * matter more than the diagnostics.
+     */
+
+    for (unsigned i = 0; i < mDeviceConfigs.size(); ++i) {
+        const DeviceConfig &dc = mDeviceConfigs[i];
+
+        if (!dc.matchable) {
+            continue;
+        }
+
+        USBDevice *dev;
+        if (dc.type == RecordDevice::DEVICE_TYPE) {
+            dev = new RecordDevice(mVerbose);
+        } else if (dc.type == NullDevice::DEVICE_TYPE) {
+            dev = new NullDevice(mVerbose);
+        } else if (dc.type == ProbeDevice::DEVICE_TYPE) {
+            dev = new ProbeDevice(mVerbose);
+        } else {
+            continue;
+        }
+
+        dev->loadConfiguration(*dc.json);
+
+        if (dev->open() < 0) {
+            std::clog << "Error opening " << dev->getName() << "\n";
+            delete dev;
+            continue;
+        }
+
+        mUSBDevices.push_back(dev);
+        rebuildChannelRouting();
+
+        if (mFastBoot) {
+            primeAttachedDevice(dev);
+        }
+
+        if (mVerbose) {
+            std::clog << dev->getName() << " attached.\n";
+        }
+        jsonConnectedDevicesChanged();
+    }
+
+    return true;
+}
+
+void FCServer::mainLoop()
+{
+    // The main thread runs the USB event loop; completions and frame
+    // submissions shouldn't wait behind time-shared processes.
+    RtSched::applyToCurrentThread("usb");
+
+#ifdef OS_LINUX
+    if (mainLoopEpoll()) {
+        return;
+    }
+    // epoll setup failed; fall through to the portable timeout loop
+#endif
+
+    /*
+     * Portable timeout loop, used on Windows and when epoll setup fails.
+     * The libusb Windows backend already runs every transfer as overlapped
+     * I/O internally and wakes this loop on completion; what we control
+     * here is how long deferred work waits between wakeups. Derive the
+     * timeout from the pending work — libusb's own next deadline, the
+     * device-change debounce, a requested one-shot device poll — instead
+     * of a fixed 100 ms tick, so that work runs when it's due rather than
+     * on the next tick.
+     */
+
+    for (;;) {
+        long timeoutUs = 100000;
+
+        struct timeval tv;
+        if (libusb_get_next_timeout(mUSB, &tv) == 1) {
+            long us = tv.tv_sec * 1000000L + tv.tv_usec;
+            if (us < timeoutUs) {
+                timeoutUs = us;
+            }
+        }
+
+        mEventMutex.lock();
+        if (mDevicesChangedPending) {
+            uint64_t nowMs = monotonicMilliseconds();
+            long remainingUs = mDevicesChangedDeadline > nowMs ?
+                long(mDevicesChangedDeadline - nowMs) * 1000 : 0;
+            if (remainingUs < timeoutUs) {
+                timeoutUs = remainingUs;
+            }
+        }
+        if (mPollForDevicesOnce) {
+            timeoutUs = 0;
+        }
+        mEventMutex.unlock();
+
+        struct timeval timeout;
+        timeout.tv_sec = timeoutUs / 1000000;
+        timeout.tv_usec = timeoutUs % 1000000;
+
+        int err = libusb_handle_events_timeout_completed(mUSB, &timeout, 0);
+        if (err) {
+            /*
+             * This happens on Windows during normal operation when we're
+             * queueing a lot of output URBs, so rate-limit it off the
+             * event path rather than stalling on console I/O.
+             */
+            static AsyncLog::RateLimit limit;
+            if (AsyncLog::allow(limit, 2)) {
+                char buf[AsyncLog::MAX_LINE_BYTES];
+                snprintf(buf, sizeof buf, "Error handling USB events: %s\n",
+                    libusb_strerror(libusb_error(err)));
+                AsyncLog::write(buf);
+            }
+        }
+
+        mainLoopTick();
+    }
+}
+
+#ifdef OS_LINUX
+
+bool FCServer::mainLoopEpoll()
+{
+    /*
+     * Event-driven main loop. Instead of spinning on a 100 ms libusb
+     * timeout, wait on libusb's own poll descriptors plus an eventfd that
+     * other threads use to nudge us, so completions and deferred work are
+     * handled as soon as the kernel reports them rather than on the next
+     * tick. Returns false if the machinery couldn't be set up; the caller
+     * then falls back to the portable loop.
+     */
+
+    mEpollFd = epoll_create1(0);
+    if (mEpollFd < 0) {
+        return false;
+    }
+
+    mWakeupFd = eventfd(0, EFD_NONBLOCK);
+    if (mWakeupFd < 0) {
+        close(mEpollFd);
+        mEpollFd = -1;
+        return false;
+    }
+
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof ev);
+    ev.events = EPOLLIN;
+    ev.data.fd = mWakeupFd;
+    epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mWakeupFd, &ev);
+
+    // Mirror libusb's poll set into ours, now and as it changes
+    const struct libusb_pollfd **fds = libusb_get_pollfds(mUSB);
+    if (!fds) {
+        close(mWakeupFd);
+        close(mEpollFd);
+        mWakeupFd = mEpollFd = -1;
+        return false;
+    }
+    for (unsigned i = 0; fds[i]; ++i) {
+        cbPollfdAdded(fds[i]->fd, fds[i]->events, this);
+    }
+    free(fds);
+    libusb_set_pollfd_notifiers(mUSB, cbPollfdAdded, cbPollfdRemoved, this);
+
+    for (;;) {
+        /*
+         * If libusb needs a timeout honored on its behalf (transfer
+         * timeouts on older kernels), respect it; otherwise block until
+         * a descriptor is ready or someone wakes us.
+         */
+        int timeoutMs = -1;
+        struct timeval tv;
+        if (libusb_get_next_timeout(mUSB, &tv) == 1) {
+            timeoutMs = tv.tv_sec * 1000 + tv.tv_usec / 1000;
+        }
+
+        // A pending device-change debounce also bounds the wait
+        mEventMutex.lock();
+        if (mDevicesChangedPending) {
+            uint64_t nowMs = monotonicMilliseconds();
+            int remaining = mDevicesChangedDeadline > nowMs ? int(mDevicesChangedDeadline - nowMs) : 0;
+            if (timeoutMs < 0 || remaining < timeoutMs) {
+                timeoutMs = remaining;
+            }
+        }
+        mEventMutex.unlock();
+
+        struct epoll_event events[16];
+        int n = epoll_wait(mEpollFd, events, 16, timeoutMs);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::clog << "Error waiting for USB events: " << strerror(errno) << "\n";
+            return true;
+        }
+
+        for (int i = 0; i < n; i++) {
+            if (events[i].data.fd == mWakeupFd) {
+                uint64_t value;
+                if (read(mWakeupFd, &value, sizeof value) < 0) {
+                    // Spurious wakeup; nothing to drain
+                }
+            }
+        }
+
+        // The kernel told us there's work; handle it without blocking.
+        struct timeval zero = { 0, 0 };
+        int err = libusb_handle_events_timeout_completed(mUSB, &zero, 0);
+        if (err) {
+            std::clog << "Error handling USB events: " << libusb_strerror(libusb_error(err)) << "\n";
+        }
+
+        mainLoopTick();
+    }
+}
+
+void FCServer::cbPollfdAdded(int fd, short events, void *user_data)
+{
+    FCServer *self = static_cast<FCServer*>(user_data);
+
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof ev);
+    ev.events = (events & POLLIN ? EPOLLIN : 0) | (events & POLLOUT ? EPOLLOUT : 0);
+    ev.data.fd = fd;
+    epoll_ctl(self->mEpollFd, EPOLL_CTL_ADD, fd, &ev);
+}
+
+void FCServer::cbPollfdRemoved(int fd, void *user_data)
+{
+    FCServer *self = static_cast<FCServer*>(user_data);
+    epoll_ctl(self->mEpollFd, EPOLL_CTL_DEL, fd, 0);
+}
+
+#endif  // OS_LINUX
+
+void FCServer::mainLoopTick()
+{
+    // An orderly shutdown was requested by SIGTERM or SIGINT
+    if (mShutdownPending) {
+        shutdownAndExit();
+    }
+
+    // Apply a requested configuration reload, from SIGHUP or a client
+    if (mReloadPending && __sync_lock_test_and_set(&mReloadPending, 0)) {
+        reloadConfig();
+    }
+
+    // We may have been asked for a one-shot poll, to retry connecting devices that failed.
+    if (mPollForDevicesOnce) {
+        mPollForDevicesOnce = false;
+        usbHotplugPoll();
+    }
+
+    // Flush completed transfers
+    mEventMutex.lock();
+    for (std::vector<USBDevice*>::iterator i = mUSBDevices.begin(), e = mUSBDevices.end(); i != e; ++i) {
+        USBDevice *dev = *i;
+        dev->flush();
+    }
+
+    // Send a batched device-change notification once its debounce expires
+    if (mDevicesChangedPending && monotonicMilliseconds() >= mDevicesChangedDeadline) {
+        mDevicesChangedPending = false;
+        jsonBroadcastConnectedDevices();
+    }
+    mEventMutex.unlock();
+}
+
+void FCServer::wakeMainLoop()
+{
+#ifdef OS_LINUX
+    if (mWakeupFd >= 0) {
+        uint64_t one = 1;
+        if (write(mWakeupFd, &one, sizeof one) < 0) {
+            // Best-effort; the loop wakes on USB activity anyway
+        }
+    }
+#endif
+}
+
+void FCServer::requestConfigReload()
+{
+    // Only flag-and-wake here; this runs from the SIGHUP handler, where
+    // taking locks or allocating isn't safe. The reload itself happens on
+    // the main thread, from mainLoopTick().
+    __sync_lock_test_and_set(&mReloadPending, 1);
+    wakeMainLoop();
+}
+
+void FCServer::attachBenchmarkDevice(USBDevice *dev)
+{
+    // Register a hardware-less device and route it; see fcserver-bench
+    mEventMutex.lock();
+    mUSBDevices.push_back(dev);
+    rebuildChannelRouting();
+    mEventMutex.unlock();
+}
+
+void FCServer::detachBenchmarkDevice(USBDevice *dev)
+{
+    /*
+     * Unroute and delete a device attached by attachBenchmarkDevice(),
+     * exercising the same routing-table churn a real removal does.
+     * rebuildChannelRouting() waits out the dispatch grace period, so no
+     * transport thread can still be touching the device when it's deleted.
+     */
+    mEventMutex.lock();
+    for (std::vector<USBDevice*>::iterator i = mUSBDevices.begin(), e = mUSBDevices.end(); i != e; ++i) {
+        if (*i == dev) {
+            mUSBDevices.erase(i);
+            break;
         }
     }
+    rebuildChannelRouting();
+    mEventMutex.unlock();
 
-    if (mVerbose) {
-        std::clog << "USB device " << dev->getName() << " has no matching configuration. Not using it.\n";
-    }
     delete dev;
 }
 
-void FCServer::usbDeviceLeft(libusb_device *device)
+void FCServer::requestShutdown()
+{
+    // Only flag-and-wake; runs from signal handlers
+    __sync_lock_test_and_set(&mShutdownPending, 1);
+    wakeMainLoop();
+}
+
+void FCServer::shutdownAndExit()
 {
     /*
-     * Is this a device we recognize? If so, delete it.
+     * Orderly teardown for upgrades and service stops. The point is to
+     * release the USB interfaces and cancel outstanding transfers while
+     * we're still alive: a successor process can then claim the devices
+     * immediately, instead of waiting for the kernel to reap a killed
+     * process's URBs and file handles. Devices are unrouted first and the
+     * dispatch grace period waited out, so no transport thread can still
+     * be touching one when it's deleted.
      */
 
-    for (std::vector<USBDevice*>::iterator i = mUSBDevices.begin(), e = mUSBDevices.end(); i != e; ++i) {
-        USBDevice *dev = *i;
-        if (dev->getDevice() == device) {
-            usbDeviceLeft(i);
-            break;
-        }
+    std::clog << "Shutting down...\n";
+
+    mEventMutex.lock();
+
+    std::vector<USBDevice*> usbDevices;
+    std::vector<SPIDevice*> spiDevices;
+    usbDevices.swap(mUSBDevices);
+    spiDevices.swap(mSPIDevices);
+    mUSBDevicesBySerial.clear();
+    mKnownUSBAddresses.clear();
+    rebuildChannelRouting();
+
+    for (unsigned i = 0; i < usbDevices.size(); ++i) {
+        delete usbDevices[i];
     }
+    for (unsigned i = 0; i < spiDevices.size(); ++i) {
+        delete spiDevices[i];
+    }
+
+    mEventMutex.unlock();
+
+    exit(0);
 }
 
-void FCServer::usbDeviceLeft(std::vector<USBDevice*>::iterator iter)
+std::string FCServer::serializeValue(const Value &v)
 {
-    USBDevice *dev = *iter;
-    if (mVerbose) {
-        std::clog << "USB device " << dev->getName() << " removed.\n";
-    }
-    mUSBDevices.erase(iter);
-    delete dev;
-    jsonConnectedDevicesChanged();
+    rapidjson::GenericStringBuffer<rapidjson::UTF8<> > buffer;
+    rapidjson::Writer<rapidjson::GenericStringBuffer<rapidjson::UTF8<> > > writer(buffer);
+    v.Accept(writer);
+    return std::string(buffer.GetString(), buffer.Size());
 }
 
-bool FCServer::startSPI()
+void FCServer::reloadConfig()
 {
-#ifdef FCSERVER_HAS_WIRINGPI
-    wiringPiSetup();
-#endif
+    /*
+     * Re-read the configuration file and apply device-level changes in
+     * place, so a mapping edit doesn't black out the installation the way
+     * a restart does. Only the "devices" array is diffed: global keys like
+     * "listen" describe resources that can't be rebound while running.
+     *
+     * Devices whose serialized entry is byte-identical aren't touched and
+     * keep streaming uninterrupted; changed entries are re-applied through
+     * the ordinary loadConfiguration() and writeColorCorrection() paths.
+     * A device mid-frame during its reload may briefly mix old and new
+     * mappings, which beats seconds of darkness.
+     */
+
+    if (mConfigPath.empty()) {
+        std::clog << "Config reload requested, but no config file was given; ignoring.\n";
+        return;
+    }
 
-    for (unsigned i = 0; i < mDevices.Size(); ++i) {
-        const Value &device = mDevices[i];
+    FILE *configFile = fopen(mConfigPath.c_str(), "r");
+    if (!configFile) {
+        std::clog << "Config reload: error opening " << mConfigPath << "\n";
+        return;
+    }
 
-        const Value &vtype = device["type"];
-        const Value &vport = device["port"];
-        const Value &vnumLights = device["numLights"];
+    Document *doc = new Document;
+    rapidjson::FileStream istr(configFile);
+    doc->ParseStream<0>(istr);
+    fclose(configFile);
 
-        if (vtype.IsNull() || (!vtype.IsString() || strcmp(vtype.GetString(), APA102SPIDevice::DEVICE_TYPE))) {
-            continue;
+    if (doc->HasParseError()) {
+        std::clog << "Config reload: parse error at character "
+            << int(doc->GetErrorOffset()) << ": " << doc->GetParseError() << "\n";
+        delete doc;
+        return;
+    }
+
+    if (!doc->IsObject()) {
+        std::clog << "Config reload: config must be a JSON object; keeping the old configuration.\n";
+        delete doc;
+        return;
+    }
+
+    const Value &devices = (*doc)["devices"];
+    if (!devices.IsArray()) {
+        std::clog << "Config reload: the 'devices' key must be an array; keeping the old configuration.\n";
+        delete doc;
+        return;
+    }
+
+    std::vector<DeviceConfig> newConfigs;
+    buildDeviceConfigs(devices, newConfigs);
+
+    mEventMutex.lock();
+
+    unsigned changed = 0;
+
+    for (std::vector<USBDevice*>::iterator i = mUSBDevices.begin(), e = mUSBDevices.end(); i != e; ++i) {
+        USBDevice *dev = *i;
+
+        const DeviceConfig *oldEntry = 0;
+        const DeviceConfig *newEntry = 0;
+        for (unsigned n = 0; n < mDeviceConfigs.size() && !oldEntry; ++n) {
+            if (configMatchesUSB(mDeviceConfigs[n], dev)) {
+                oldEntry = &mDeviceConfigs[n];
+            }
+        }
+        for (unsigned n = 0; n < newConfigs.size() && !newEntry; ++n) {
+            if (configMatchesUSB(newConfigs[n], dev)) {
+                newEntry = &newConfigs[n];
+            }
         }
 
-        if (vport.IsNull() || (!vport.IsUint())) {
+        // A device whose entry disappeared keeps its last configuration
+        if (!newEntry) {
             continue;
         }
 
-        if (vnumLights.IsNull() || (!vnumLights.IsUint())) {
+        if (oldEntry && serializeValue(*oldEntry->json) == serializeValue(*newEntry->json)) {
             continue;
         }
 
-        openAPA102SPIDevice(vport.GetUint(), vnumLights.GetUint());
-    }
-
-    return true;
-}
-
-void FCServer::openAPA102SPIDevice(uint32_t port, int numLights)
-{
-    APA102SPIDevice* dev = new APA102SPIDevice(numLights, mVerbose);
+        dev->loadConfiguration(*newEntry->json);
+        dev->writeColorCorrection((*doc)["color"]);
+        changed++;
 
-    int r = dev->open(port);
-    if (r < 0) {
         if (mVerbose) {
-            std::clog << "Error opening " << dev->getName() << "\n";
+            std::clog << "Reloaded configuration for " << dev->getName() << "\n";
         }
-        delete dev;
-        return;
     }
 
-    for (unsigned i = 0; i < mDevices.Size(); ++i) {
-        if (dev->matchConfiguration(mDevices[i])) {
-            // Found a matching configuration for this device. We're keeping it!
-
-            dev->loadConfiguration(mDevices[i]);
-            dev->writeColorCorrection(mColor);
-            mSPIDevices.push_back(dev);
+    for (std::vector<SPIDevice*>::iterator i = mSPIDevices.begin(), e = mSPIDevices.end(); i != e; ++i) {
+        SPIDevice *dev = *i;
 
-            if (mVerbose) {
-                std::clog << "SPI device " << dev->getName() << " attached.\n";
+        const DeviceConfig *oldEntry = 0;
+        const DeviceConfig *newEntry = 0;
+        for (unsigned n = 0; n < mDeviceConfigs.size() && !oldEntry; ++n) {
+            if (mDeviceConfigs[n].matchable && dev->matchConfiguration(*mDeviceConfigs[n].json)) {
+                oldEntry = &mDeviceConfigs[n];
+            }
+        }
+        for (unsigned n = 0; n < newConfigs.size() && !newEntry; ++n) {
+            if (newConfigs[n].matchable && dev->matchConfiguration(*newConfigs[n].json)) {
+                newEntry = &newConfigs[n];
             }
-            jsonConnectedDevicesChanged();
-            return;
         }
-    }
-}
-
-void FCServer::mainLoop()
-{
-    for (;;) {
-        struct timeval timeout;
-        timeout.tv_sec = 0;
-        timeout.tv_usec = 100000;
 
-        int err = libusb_handle_events_timeout_completed(mUSB, &timeout, 0);
-        if (err) {
-            std::clog << "Error handling USB events: " << libusb_strerror(libusb_error(err)) << "\n";
-            // Sometimes this happens on Windows during normal operation if we're queueing a lot of output URBs. Meh.
+        if (!newEntry) {
+            continue;
         }
 
-        // We may have been asked for a one-shot poll, to retry connecting devices that failed.
-        if (mPollForDevicesOnce) {
-            mPollForDevicesOnce = false;
-            usbHotplugPoll();
+        if (oldEntry && serializeValue(*oldEntry->json) == serializeValue(*newEntry->json)) {
+            continue;
         }
 
-        // Flush completed transfers
-        mEventMutex.lock();
-        for (std::vector<USBDevice*>::iterator i = mUSBDevices.begin(), e = mUSBDevices.end(); i != e; ++i) {
-            USBDevice *dev = *i;
-            dev->flush();
+        dev->loadConfiguration(*newEntry->json);
+        dev->writeColorCorrection((*doc)["color"]);
+        changed++;
+
+        if (mVerbose) {
+            std::clog << "Reloaded configuration for " << dev->getName() << "\n";
         }
-        mEventMutex.unlock();
+    }
+
+    /*
+     * Publish the new entries and keep the document alive: untouched
+     * devices still point into the document they were configured from.
+     * New entries may describe boards we previously turned away, so ask
+     * the hotplug poll to take another look.
+     */
+    mDeviceConfigs.swap(newConfigs);
+    mReloadedConfigs.push_back(doc);
+    rebuildChannelRouting();
+    mPollForDevicesOnce = true;
+
+    mEventMutex.unlock();
+
+    if (mVerbose) {
+        std::clog << "Configuration reloaded; " << changed << " device(s) updated.\n";
     }
 }
 
@@ -397,47 +1800,56 @@ bool FCServer::usbHotplugPoll()
         return false;
     }
 
-    // Take the lock after get_device_list completes
-    mEventMutex.lock();
+    /*
+     * Compare the enumeration against the set of claimed device addresses
+     * outside the lock, so a poll that finds nothing new (the common case,
+     * once per second) doesn't stall dispatch at all. The claimed set is
+     * maintained by usbDeviceArrived()/usbDeviceLeft() under mEventMutex.
+     */
 
-    // Look for devices that were added
+    std::set<uint16_t> current;
     for (ssize_t listItem = 0; listItem < listSize; ++listItem) {
-        bool isNew = true;
+        current.insert(usbAddressKey(list[listItem]));
+    }
 
-        for (std::vector<USBDevice*>::iterator i = mUSBDevices.begin(), e = mUSBDevices.end(); i != e; ++i) {
-            USBDevice *dev = *i;
-            if (dev->getDevice() == list[listItem]) {
-                isNew = false;
-            }
-        }
+    mEventMutex.lock();
+    std::set<uint16_t> known = mKnownUSBAddresses;
+    mEventMutex.unlock();
 
-        if (isNew) {
+    // Look for devices that were added. Unclaimed devices stay out of the
+    // known set, so transient open failures are retried on a later poll.
+    for (ssize_t listItem = 0; listItem < listSize; ++listItem) {
+        if (known.count(usbAddressKey(list[listItem])) == 0) {
+            mEventMutex.lock();
             usbDeviceArrived(list[listItem]);
+            mEventMutex.unlock();
         }
     }
 
     // Look for devices that were removed
-    for (std::vector<USBDevice*>::iterator i = mUSBDevices.begin(), e = mUSBDevices.end(); i != e; ++i) {
-        USBDevice *dev = *i;
-        libusb_device *usbdev = dev->getDevice();
-        bool isRemoved = true;
-
-        for (ssize_t listItem = 0; listItem < listSize; ++listItem) {
-            if (list[listItem] == usbdev) {
-                isRemoved = false;
+    for (std::set<uint16_t>::iterator k = known.begin(), ke = known.end(); k != ke; ++k) {
+        if (current.count(*k) == 0) {
+            mEventMutex.lock();
+            for (std::vector<USBDevice*>::iterator i = mUSBDevices.begin(), e = mUSBDevices.end(); i != e; ++i) {
+                if (usbAddressKey((*i)->getDevice()) == *k) {
+                    usbDeviceLeft(i);
+                    break;
+                }
             }
-        }
-
-        if (isRemoved) {
-            usbDeviceLeft(i);
+            mEventMutex.unlock();
         }
     }
 
-    mEventMutex.unlock();
     libusb_free_device_list(list, true);
     return true;
 }
 
+uint16_t FCServer::usbAddressKey(libusb_device *device)
+{
+    // Bus number and device address together identify an attached device
+    return (uint16_t(libusb_get_bus_number(device)) << 8) | libusb_get_device_address(device);
+}
+
 void FCServer::usbHotplugThreadFunc(void *arg)
 {
     FCServer *self = (FCServer*) arg;
@@ -464,10 +1876,21 @@ void FCServer::cbJsonMessage(libwebsocket *wsi, rapidjson::Document &message, vo
     // Hold the event lock while dispatching
     self->mEventMutex.lock();
 
+    bool spliceConfig = false;
+
     if (!strcmp(type, "list_connected_devices")) {
         self->jsonListConnectedDevices(message);
     } else if (!strcmp(type, "server_info")) {
         self->jsonServerInfo(message);
+        spliceConfig = true;
+    } else if (!strcmp(type, "pacing_info")) {
+        self->jsonPacingInfo(message);
+    } else if (!strcmp(type, "reload_config")) {
+        // Applied asynchronously on the main thread; the reply only
+        // acknowledges that the reload was scheduled.
+        self->requestConfigReload();
+    } else if (!strcmp(type, "signal_generator")) {
+        self->jsonSignalGenerator(message);
     } else if (message.HasMember("device")) {
         self->jsonDeviceMessage(message);
     } else {
@@ -481,7 +1904,12 @@ void FCServer::cbJsonMessage(libwebsocket *wsi, rapidjson::Document &message, vo
 
     // All messages get a reply, and we leave any extra parameters on the message
     // so that clients can keep track of asynchronous completions.
-    self->mTcpNetServer.jsonReply(wsi, message);
+    if (spliceConfig) {
+        // The config member comes from the cached pre-serialized text
+        self->mTcpNetServer.jsonReplySpliced(wsi, message, "config", self->mConfigText);
+    } else {
+        self->mTcpNetServer.jsonReply(wsi, message);
+    }
 }
 
 void FCServer::jsonDeviceMessage(rapidjson::Document &message)
@@ -495,6 +1923,27 @@ void FCServer::jsonDeviceMessage(rapidjson::Document &message)
     bool matched = false;
 
     if (device.IsObject()) {
+        const Value &serial = device["serial"];
+
+        if (serial.IsString() && serial.GetString()[0]) {
+            /*
+             * Serial numbers are unique, so a serial-addressed message can
+             * go straight to the indexed device instead of comparing JSON
+             * against every device on the server. matchConfiguration still
+             * arbitrates, in case the message constrains other fields too.
+             */
+            std::map<std::string, USBDevice*>::iterator entry = mUSBDevicesBySerial.find(serial.GetString());
+            if (entry != mUSBDevicesBySerial.end() && entry->second->matchConfiguration(device)) {
+                matched = true;
+                entry->second->writeMessage(message);
+            }
+
+            if (!matched) {
+                message.AddMember("error", "No matching device found", message.GetAllocator());
+            }
+            return;
+        }
+
         for (unsigned i = 0; i != mUSBDevices.size(); i++) {
             USBDevice *usbDev = mUSBDevices[i];
 
@@ -540,19 +1989,289 @@ void FCServer::jsonListConnectedDevices(rapidjson::Document &message)
     }
 }
 
+void FCServer::jsonPacingInfo(rapidjson::Document &message)
+{
+    /*
+     * Pacing traces for a timeline view: recent inter-frame intervals per
+     * OPC channel, measured where messages arrive at dispatch, and per
+     * device, measured where frames are handed to the output transport.
+     * Lining the two up distinguishes client-side stutter from server
+     * queueing from USB or SPI stalls. Clients poll this at whatever rate
+     * their view needs; the traces hold the last PacingAnalyzer::TRACE_DEPTH
+     * intervals regardless.
+     */
+
+    uint64_t now = monotonicMicroseconds();
+
+    message.AddMember("channels", rapidjson::kArrayType, message.GetAllocator());
+    mPacingAnalyzer.describeChannels(message["channels"], message.GetAllocator(), now);
+
+    message.AddMember("devices", rapidjson::kArrayType, message.GetAllocator());
+    Value &list = message["devices"];
+    unsigned n = 0;
+
+    for (unsigned i = 0; i != mUSBDevices.size(); i++) {
+        USBDevice *usbDev = mUSBDevices[i];
+        list.PushBack(rapidjson::kObjectType, message.GetAllocator());
+        Value &entry = list[n++];
+        entry.AddMember("type", usbDev->getTypeString(), message.GetAllocator());
+        if (usbDev->getSerial()) {
+            entry.AddMember("serial", usbDev->getSerial(), message.GetAllocator());
+        }
+        usbDev->submitTrace().describe(entry, message.GetAllocator(), now);
+    }
+
+    for (unsigned i = 0; i != mSPIDevices.size(); i++) {
+        SPIDevice *spiDev = mSPIDevices[i];
+        list.PushBack(rapidjson::kObjectType, message.GetAllocator());
+        Value &entry = list[n++];
+        entry.AddMember("type", spiDev->getTypeString(), message.GetAllocator());
+        spiDev->submitTrace().describe(entry, message.GetAllocator(), now);
+    }
+}
+
+void FCServer::jsonSignalGenerator(rapidjson::Document &message)
+{
+    /*
+     * Start a signal-generator run for throughput ceiling tests. Frames
+     * are synthesized internally and fed straight into the dispatch path
+     * as fast as the generator thread can produce them, so the measured
+     * ceiling is the output transport's, unmuddled by client generation
+     * or network costs. The reply only acknowledges the start; results
+     * arrive as a "signal_generator_results" broadcast when the run ends.
+     *
+     * Optional parameters: "channel" (default 0), "pixels" per frame
+     * (default 512), and "milliseconds" to run for (default 5000).
+     */
+
+    if (!__sync_bool_compare_and_swap(&mGeneratorRunning, 0, 1)) {
+        message.AddMember("error", "Signal generator is already running", message.GetAllocator());
+        return;
+    }
+
+    GeneratorRun *run = new GeneratorRun;
+    run->server = this;
+    run->channel = 0;
+    run->pixels = 512;
+    run->milliseconds = 5000;
+
+    const Value &vChannel = message["channel"];
+    if (vChannel.IsUint() && vChannel.GetUint() < OPC_CHANNEL_COUNT) {
+        run->channel = vChannel.GetUint();
+    }
+    const Value &vPixels = message["pixels"];
+    if (vPixels.IsUint() && vPixels.GetUint() >= 1 && vPixels.GetUint() <= 0xFFFF / 3) {
+        run->pixels = vPixels.GetUint();
+    }
+    const Value &vMilliseconds = message["milliseconds"];
+    if (vMilliseconds.IsUint() && vMilliseconds.GetUint() >= 100 && vMilliseconds.GetUint() <= 60000) {
+        run->milliseconds = vMilliseconds.GetUint();
+    }
+
+    TaskPool::shared().submit(generatorThreadFunc, run);
+}
+
+void FCServer::generatorThreadFunc(void *arg)
+{
+    GeneratorRun *run = (GeneratorRun*) arg;
+    FCServer *self = run->server;
+
+    /*
+     * Per-device baselines from the submission pacing traces, which every
+     * output driver records into as frames are handed to the transport.
+     * Trace::head counts total submissions, so the delta over the run is
+     * the number of frames that actually reached the wire. Devices are
+     * keyed by name in case the list changes mid-run.
+     */
+    std::map<std::string, uint32_t> baselines;
+    self->mEventMutex.lock();
+    for (unsigned i = 0; i != self->mUSBDevices.size(); i++) {
+        baselines[self->mUSBDevices[i]->getName()] = self->mUSBDevices[i]->submitTrace().head;
+    }
+    for (unsigned i = 0; i != self->mSPIDevices.size(); i++) {
+        baselines[self->mSPIDevices[i]->getName()] = self->mSPIDevices[i]->submitTrace().head;
+    }
+    self->mEventMutex.unlock();
+
+    OPC::Message msg;
+    msg.command = OPC::SetPixelColors;
+    msg.channel = run->channel;
+    msg.setLength(run->pixels * 3);
+
+    uint64_t start = monotonicMicroseconds();
+    uint64_t deadline = start + run->milliseconds * 1000ULL;
+    uint64_t now = start;
+    uint64_t framesGenerated = 0;
+    unsigned phase = 0;
+
+    while ((now = monotonicMicroseconds()) < deadline) {
+        /*
+         * Moving grayscale ramp: every pixel changes every frame, so
+         * dirty-packet tracking in the drivers can't elide any of the
+         * work, and the result reflects full-frame throughput.
+         */
+        for (unsigned i = 0; i < run->pixels; i++) {
+            uint8_t v = uint8_t(i + phase);
+            msg.data[i*3 + 0] = v;
+            msg.data[i*3 + 1] = v;
+            msg.data[i*3 + 2] = v;
+        }
+        phase++;
+
+        self->injectOpcMessage(msg);
+        framesGenerated++;
+    }
+
+    double elapsed = (now - start) * 1e-6;
+
+    rapidjson::Document message;
+    message.SetObject();
+    Document::AllocatorType &alloc = message.GetAllocator();
+    message.AddMember("type", "signal_generator_results", alloc);
+    message.AddMember("channel", run->channel, alloc);
+    message.AddMember("pixels", run->pixels, alloc);
+    message.AddMember("seconds", elapsed, alloc);
+    message.AddMember("frames_generated", framesGenerated, alloc);
+    message.AddMember("generated_fps", framesGenerated / elapsed, alloc);
+    message.AddMember("devices", rapidjson::kArrayType, alloc);
+    Value &list = message["devices"];
+    unsigned n = 0;
+
+    self->mEventMutex.lock();
+    for (unsigned i = 0; i != self->mUSBDevices.size(); i++) {
+        USBDevice *usbDev = self->mUSBDevices[i];
+        std::map<std::string, uint32_t>::iterator base = baselines.find(usbDev->getName());
+        if (base == baselines.end()) {
+            continue;   // Attached mid-run; no meaningful rate
+        }
+        list.PushBack(rapidjson::kObjectType, alloc);
+        Value &entry = list[n++];
+        entry.AddMember("type", usbDev->getTypeString(), alloc);
+        if (usbDev->getSerial()) {
+            entry.AddMember("serial", usbDev->getSerial(), alloc);
+        }
+        entry.AddMember("achieved_fps",
+            (usbDev->submitTrace().head - base->second) / elapsed, alloc);
+    }
+    for (unsigned i = 0; i != self->mSPIDevices.size(); i++) {
+        SPIDevice *spiDev = self->mSPIDevices[i];
+        std::map<std::string, uint32_t>::iterator base = baselines.find(spiDev->getName());
+        if (base == baselines.end()) {
+            continue;
+        }
+        list.PushBack(rapidjson::kObjectType, alloc);
+        Value &entry = list[n++];
+        entry.AddMember("type", spiDev->getTypeString(), alloc);
+        entry.AddMember("achieved_fps",
+            (spiDev->submitTrace().head - base->second) / elapsed, alloc);
+    }
+    self->mTcpNetServer.jsonBroadcast(message);
+    self->mEventMutex.unlock();
+
+    delete run;
+    __sync_bool_compare_and_swap(&self->mGeneratorRunning, 1, 0);
+}
+
 void FCServer::jsonServerInfo(rapidjson::Document &message)
 {
-    // Server version
+    // Server version; the config member is spliced in from mConfigText
+    // when the reply is serialized.
     message.AddMember("version", kFCServerVersion, message.GetAllocator());
 
-    // Server configuration
-    message.AddMember("config", rapidjson::kObjectType, message.GetAllocator());
-    message.DeepCopy(message["config"], mConfig);
+    // Startup phase trace: microseconds from construction to each phase
+    message.AddMember("startup_usec", rapidjson::kObjectType, message.GetAllocator());
+    Value &startup = message["startup_usec"];
+    for (unsigned i = 0; i < mStartupPhases.size(); i++) {
+        startup.AddMember(mStartupPhases[i].name, mStartupPhases[i].microseconds, message.GetAllocator());
+    }
+    if (mFirstFrameMicroseconds) {
+        startup.AddMember("first_frame_dispatched",
+            uint64_t(mFirstFrameMicroseconds), message.GetAllocator());
+    }
+}
+
+void FCServer::cbMetrics(std::string &text, void *context)
+{
+    /*
+     * Build the /metrics response: Prometheus text format, one line per
+     * counter. Server-wide traffic totals come from the TCP server's
+     * hot-path counters; per-device counters are derived from the same
+     * describe() data the JSON API reports, plus a live queue depth gauge,
+     * labeled by serial number (or device type, for devices without one).
+     */
+
+    FCServer *self = (FCServer*) context;
+    std::ostringstream out;
+
+    out << "fcserver_opc_messages_total " << self->mTcpNetServer.opcMessagesTotal() << "\n";
+    out << "fcserver_opc_bytes_total " << self->mTcpNetServer.opcBytesTotal() << "\n";
+    out << "fcserver_opc_duplicate_frames_suppressed_total " << self->mDuplicateFramesSuppressed << "\n";
+
+    self->mEventMutex.lock();
+
+    for (unsigned i = 0; i != self->mUSBDevices.size(); i++) {
+        self->metricsForDevice(out, self->mUSBDevices[i]);
+    }
+    for (unsigned i = 0; i != self->mSPIDevices.size(); i++) {
+        self->metricsForDevice(out, self->mSPIDevices[i]);
+    }
+
+    self->mEventMutex.unlock();
+
+    text = out.str();
+}
+
+template <typename T>
+void FCServer::metricsForDevice(std::ostringstream &out, T *dev)
+{
+    rapidjson::Document desc;
+    desc.SetObject();
+    dev->describe(desc, desc.GetAllocator());
+
+    const char *label = desc["serial"].IsString() ?
+        desc["serial"].GetString() : dev->getTypeString();
+
+    for (rapidjson::Value::MemberIterator m = desc.MemberBegin(); m != desc.MemberEnd(); ++m) {
+        if (m->value.IsUint64()) {
+            out << "fcserver_device_" << m->name.GetString()
+                << "{device=\"" << label << "\"} " << m->value.GetUint64() << "\n";
+        }
+    }
+
+    out << "fcserver_device_queue_depth{device=\"" << label << "\"} "
+        << dev->getQueueDepth() << "\n";
 }
 
 void FCServer::jsonConnectedDevicesChanged()
 {
-    rapidjson::Document message;
+    /*
+     * Debounce device-change notifications: a 40-board rig powering up
+     * produces a storm of arrivals in under a second, and rebuilding and
+     * broadcasting the full device list for each one stalls dispatch. Note
+     * the change and (re)arm a short deadline; the main loop broadcasts one
+     * batched notification once the storm subsides. Call with mEventMutex
+     * held, which also guards the pending flag and deadline.
+     */
+
+    unsigned debounce = mDeviceDebounce.IsUint() ? mDeviceDebounce.GetUint() : DEFAULT_DEVICE_DEBOUNCE_MS;
+
+    if (!debounce) {
+        jsonBroadcastConnectedDevices();
+        return;
+    }
+
+    mDevicesChangedPending = true;
+    mDevicesChangedDeadline = monotonicMilliseconds() + debounce;
+    wakeMainLoop();
+}
+
+void FCServer::jsonBroadcastConnectedDevices()
+{
+    // Runs under mEventMutex, so the backing buffer can live in the server.
+    // A device list that fits costs no heap; larger ones spill into pool
+    // chunks freed when the broadcast is done.
+    rapidjson::MemoryPoolAllocator<> arena(mJsonArena, sizeof mJsonArena);
+    rapidjson::Document message(&arena);
 
     message.SetObject();
     message.AddMember("type", "connected_devices_changed", message.GetAllocator());
@@ -561,3 +2280,29 @@ void FCServer::jsonConnectedDevicesChanged()
 
     mTcpNetServer.jsonBroadcast(message);
 }
+
+uint64_t FCServer::monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000000ULL + tv.tv_usec;
+#endif
+}
+
+uint64_t FCServer::monotonicMilliseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000ULL + tv.tv_usec / 1000;
+#endif
+}
@@ -25,10 +25,17 @@
 #include "rapidjson/document.h"
 #include "opc.h"
 #include "tcpnetserver.h"
+#include "udpnetserver.h"
+#include "shmserver.h"
+#include "framescheduler.h"
+#include "pacinganalyzer.h"
 #include "usbdevice.h"
 #include "spidevice.h"
+#include "spscqueue.h"
 #include <sstream>
 #include <vector>
+#include <set>
+#include <map>
 #include <libusb.h>
 #include "tinythread.h"
 
@@ -47,27 +54,250 @@ public:
     bool start(libusb_context *usb);
     void mainLoop();
 
+    // Where the configuration was loaded from, for hot reload. Unset when
+    // the server is running on the built-in default config.
+    void setConfigPath(const char *path) { mConfigPath = path; }
+
+    // Flag a configuration reload and nudge the main loop, which applies
+    // it from mainLoopTick(). Async-signal-safe; called from the SIGHUP
+    // handler and from the reload_config WebSocket message.
+    void requestConfigReload();
+
+    /*
+     * Benchmark hooks, used by the fcserver-bench and fcserver-soak
+     * targets: attach or detach an already-configured device that isn't
+     * backed by hardware, and inject an OPC message as if a transport
+     * delivered it. Not used by the production server.
+     */
+    void attachBenchmarkDevice(USBDevice *dev);
+    void detachBenchmarkDevice(USBDevice *dev);
+    void injectOpcMessage(OPC::Message &msg) { cbOpcMessage(msg, this); }
+
+    // Flag an orderly shutdown and nudge the main loop. Async-signal-safe;
+    // called from the SIGTERM/SIGINT handlers. The main loop releases the
+    // USB devices and exits, so a successor process can re-claim them
+    // immediately instead of waiting on kernel cleanup of a killed process.
+    void requestShutdown();
+
 private:
     std::ostringstream mError;
 
     const Document& mConfig;
     const Value& mListen;
     const Value& mRelay;
+    const Value& mUdpListen;
+    const Value& mShmListen;
+    const Value& mListenShards;
+    const Value& mDeviceDebounce;
+    const Value& mRtPriority;
+    const Value& mThreads;
     const Value& mColor;
     const Value& mDevices;
+
+    // Optional USB bus restriction; used by supervisor-mode workers, each
+    // of which claims devices on exactly one root bus
+    const Value& mUsbBusFilter;
     bool mVerbose;
+    bool mFastBoot;
+    bool mDedupe;
     bool mPollForDevicesOnce;
 
+    // Device-change broadcast debounce, guarded by mEventMutex
+    static const unsigned DEFAULT_DEVICE_DEBOUNCE_MS = 100;
+    bool mDevicesChangedPending;
+    uint64_t mDevicesChangedDeadline;
+
+    // Configuration pre-serialized at startup, for server_info replies
+    std::string mConfigText;
+
+    // Arena backing for broadcast documents; see jsonBroadcastConnectedDevices()
+    static const size_t JSON_ARENA_BYTES = 16 * 1024;
+    char mJsonArena[JSON_ARENA_BYTES];
+
+    /*
+     * Device configurations pre-parsed into typed entries at startup, so
+     * the fields consulted on every hotplug event don't require walking
+     * JSON. The full object stays attached for loadConfiguration(), which
+     * owns the deep parts like pixel maps. Built once in the constructor;
+     * the config document outlives the server, so the pointers are stable.
+     */
+    struct DeviceConfig {
+        const Value *json;
+        std::string type;       // Empty when unspecified: matches any type
+        std::string serial;     // Empty when unspecified: matches any serial
+        uint32_t port;
+        int numLights;
+        bool hasPort;
+        bool hasNumLights;
+        bool matchable;         // False when type/serial are wrongly typed
+    };
+    std::vector<DeviceConfig> mDeviceConfigs;
+
+    static bool configMatchesUSB(const DeviceConfig &dc, USBDevice *dev);
+    static void buildDeviceConfigs(const Value &devices, std::vector<DeviceConfig> &out);
+
+    /*
+     * Configuration hot reload. The reload runs on the main thread, diffs
+     * the new devices array against the running devices, and re-applies
+     * only changed entries. Reloaded documents are retained for the
+     * server's lifetime, since untouched devices keep pointers into the
+     * document their configuration was loaded from.
+     */
+    std::string mConfigPath;
+    volatile int mReloadPending;
+    std::vector<Document*> mReloadedConfigs;
+    void reloadConfig();
+    static std::string serializeValue(const Value &v);
+
+    // Orderly shutdown, run from mainLoopTick(); see requestShutdown()
+    volatile int mShutdownPending;
+    void shutdownAndExit();
+
     TcpNetServer mTcpNetServer;
+    UDPNetServer mUdpNetServer;
+    ShmServer mShmServer;
+    FrameScheduler mFrameScheduler;
     tthread::recursive_mutex mEventMutex;
     tthread::thread *mUSBHotplugThread;
 
     std::vector<USBDevice*> mUSBDevices;
+
+    // Serial-addressed lookup for device-targeted JSON messages
+    std::map<std::string, USBDevice*> mUSBDevicesBySerial;
+
+    // (bus << 8 | address) keys of the claimed devices, so the hotplug
+    // poll can diff an enumeration without scanning the device list
+    std::set<uint16_t> mKnownUSBAddresses;
+
     struct libusb_context *mUSB;
 
     std::vector<SPIDevice*> mSPIDevices;
 
+    /*
+     * Routing index for OPC messages, keyed by OPC channel. Devices that can
+     * enumerate their channels appear only in the per-channel lists; devices
+     * that can't appear in the unrouted lists and receive every message,
+     * preserving the old broadcast behavior.
+     *
+     * The table is an immutable snapshot: rebuildChannelRouting() constructs
+     * a fresh one under mEventMutex, publishes it with a pointer swap, waits
+     * out a grace period, and frees the old one. Readers (the transport
+     * threads, in cbOpcMessage) bracket their use of the table with
+     * mDispatchCount, so the streaming fast path never takes a lock and
+     * never blocks on hotplug or control-plane work.
+     */
+    static const unsigned OPC_CHANNEL_COUNT = 256;
+    struct ChannelRouting {
+        std::vector<USBDevice*> usbDevices;
+        std::vector<SPIDevice*> spiDevices;
+    };
+    struct RoutingTable {
+        ChannelRouting channels[OPC_CHANNEL_COUNT];
+        std::vector<USBDevice*> unroutedUSBDevices;
+        std::vector<SPIDevice*> unroutedSPIDevices;
+        std::vector<USBDevice*> allUSBDevices;
+        std::vector<SPIDevice*> allSPIDevices;
+    };
+    RoutingTable * volatile mRoutingTable;
+    volatile long mDispatchCount;
+
+    // Genlock groups, by configured name. Groups live for the server's
+    // lifetime; worker threads hold bare pointers to them.
+    std::map<std::string, USBDevice::SyncGroup*> mSyncGroups;
+
+    // Inter-frame interval traces, per OPC channel and per device; read
+    // out by the pacing_info WebSocket message
+    PacingAnalyzer mPacingAnalyzer;
+
+    /*
+     * Startup phase trace. Cold boot to first light spans config parsing,
+     * socket setup, USB enumeration and LUT writes, and knowing which
+     * phase is slow on a given install beats guessing. Each phase records
+     * its offset from server construction, logged as it happens and
+     * reported in server_info replies. Phases after the single-threaded
+     * startup sequence are marked with mEventMutex held, which also
+     * guards the list against server_info readers.
+     */
+    struct StartupPhase {
+        const char *name;       // String literal
+        uint64_t microseconds;  // Offset from server construction
+    };
+    uint64_t mStartupBase;
+    std::vector<StartupPhase> mStartupPhases;
+    bool mFirstUSBDeviceSeen;
+    void markStartupPhase(const char *name);
+
+    // One-shot first-frame stamp, written on the lock-free dispatch path;
+    // reported alongside the startup phases
+    volatile long mFirstFrameLatch;
+    volatile uint64_t mFirstFrameMicroseconds;
+
+    /*
+     * Fast-boot frame cache. The server accepts OPC connections before
+     * USB enumeration finishes, so on a cold boot the client's frames
+     * arrive while the boards are still attaching, and the LEDs stay dark
+     * until the client happens to send another one. With "fastBoot"
+     * enabled, dispatch keeps a copy of the newest SetPixelColors message
+     * per channel, and a device is primed with the cached frames for its
+     * channels the moment it's registered. Slots are allocated on first
+     * use and guarded per channel, so writers on different channels never
+     * contend.
+     */
+    struct CachedFrame {
+        AdaptiveMutex mutex;
+        OPC::Message *msg;      // Allocated on first use
+    };
+    CachedFrame mFrameCache[OPC_CHANNEL_COUNT];
+    void cacheFrame(OPC::Message &msg);
+    void primeAttachedDevice(USBDevice *dev);
+
+    /*
+     * Duplicate frame suppression. With "dedupe" enabled, dispatch hashes
+     * each pixel payload and skips delivery when it matches the previous
+     * frame on the same channel, so a source that resends identical frames
+     * for static content costs no mapping or transport work downstream.
+     * Slots are cleared whenever the device list changes, so a newly
+     * attached device still receives the next repeat of a static frame.
+     * Per-channel words are read and written without locking: sources
+     * racing on one channel are already unordered at the transport level,
+     * and a stale word only costs a missed suppression.
+     */
+    uint64_t mChannelFrameHash[OPC_CHANNEL_COUNT];
+    volatile uint64_t mDuplicateFramesSuppressed;
+    static uint64_t hashPixelPayload(const OPC::Message &msg);
+
+    void rebuildChannelRouting();
+
+#ifdef OS_LINUX
+    /*
+     * Event-driven main loop: epoll over libusb's poll descriptors plus an
+     * eventfd for cross-thread wakeups. The portable timeout loop remains
+     * as a fallback when setup fails.
+     */
+    int mEpollFd;
+    int mWakeupFd;
+    bool mainLoopEpoll();
+    static void cbPollfdAdded(int fd, short events, void *user_data);
+    static void cbPollfdRemoved(int fd, void *user_data);
+#endif
+
+    // One pass of deferred main-loop work: retry polls and transfer reaping
+    void mainLoopTick();
+
+    // Nudge the main loop from another thread. Best-effort; the fallback
+    // loop wakes on its own timeout.
+    void wakeMainLoop();
+
+    static void cbMetrics(std::string &text, void *context);
+    template <typename T> void metricsForDevice(std::ostringstream &out, T *dev);
+
     static void cbOpcMessage(OPC::Message &msg, void *context);
+    static void cbOpcMessageBatch(OPC::Message **messages, unsigned count, void *context);
+    void dispatchOpcMessage(OPC::Message &msg, RoutingTable &table, uint64_t timestamp);
+    void opcQueueDepthRequest(RoutingTable &table);
+    void opcSetGlobalColorCorrection(OPC::Message &msg, RoutingTable &table);
+    void opcFramePresent(OPC::Message &msg);
+    void opcDevicePixels(OPC::Message &msg, RoutingTable &table);
     static void cbJsonMessage(libwebsocket *wsi, rapidjson::Document &message, void *context);
 
     static LIBUSB_CALL int cbHotplug(libusb_context *ctx, libusb_device *device, libusb_hotplug_event event, void *user_data);
@@ -77,17 +307,64 @@ private:
     void usbDeviceLeft(libusb_device *device);
     void usbDeviceLeft(std::vector<USBDevice*>::iterator iter);
     bool usbHotplugPoll();
+    static uint16_t usbAddressKey(libusb_device *device);
+
+    /*
+     * Concurrent device attachment. Opening and configuring a board takes
+     * long enough that serial attachment delays first light on large rigs;
+     * a bounded number of attach tasks on the shared TaskPool do the slow
+     * part off the event lock. The pending set keeps the hotplug paths from
+     * starting a second attach for the same device. Both are guarded by
+     * mEventMutex.
+     */
+    static const unsigned MAX_ATTACH_THREADS = 4;
+    unsigned mAttachThreadCount;
+    std::set<uint16_t> mPendingUSBAddresses;
+    struct AttachJob {
+        FCServer *server;
+        USBDevice *dev;
+    };
+    static void attachThreadFunc(void *arg);
+    void finishUsbDeviceAttach(USBDevice *dev);
 
     static void usbHotplugThreadFunc(void *arg);
 
     bool startSPI();
     void openAPA102SPIDevice(uint32_t port, int numLights);
+    void openWS2811Device(uint32_t gpio, int numLights);
+
+    bool startVirtualDevices();
 
     // JSON event broadcasters
     void jsonConnectedDevicesChanged();
+    void jsonBroadcastConnectedDevices();
+
+    static uint64_t monotonicMilliseconds();
+    static uint64_t monotonicMicroseconds();
 
     // JSON message handlers
     void jsonListConnectedDevices(rapidjson::Document &message);
     void jsonServerInfo(rapidjson::Document &message);
+    void jsonPacingInfo(rapidjson::Document &message);
+    void jsonSignalGenerator(rapidjson::Document &message);
     void jsonDeviceMessage(rapidjson::Document &message);
+
+    /*
+     * Built-in signal generator for throughput ceiling tests. A
+     * "signal_generator" WebSocket message starts a detached thread that
+     * synthesizes SetPixelColors frames straight into the dispatch path
+     * at an unbounded rate for the requested duration, then broadcasts a
+     * "signal_generator_results" event with the frame rate each device
+     * actually achieved, measured from its submission pacing trace.
+     * Generating inside the server isolates the USB/SPI ceiling from
+     * client and network costs. One run at a time.
+     */
+    struct GeneratorRun {
+        FCServer *server;
+        unsigned channel;
+        unsigned pixels;
+        unsigned milliseconds;
+    };
+    volatile long mGeneratorRunning;
+    static void generatorThreadFunc(void *arg);
 };
@@ -0,0 +1,214 @@
+/*
+ * Presentation-time frame scheduler.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "framescheduler.h"
+#include <algorithm>
+#include <string.h>
+#include <iostream>
+
+#ifdef OS_LINUX
+#include <sys/timerfd.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#else
+#include <libusb.h> // Also brings in gettimeofday() in a portable way
+#endif
+
+
+FrameScheduler::FrameScheduler(OPC::callback_t callback, void *context, bool verbose)
+    : mCallback(callback),
+      mContext(context),
+      mVerbose(verbose),
+      mThread(0)
+{
+#ifdef OS_LINUX
+    mTimerFd = -1;
+    mWakeupFd = -1;
+#endif
+}
+
+bool FrameScheduler::start()
+{
+#ifdef OS_LINUX
+    mTimerFd = timerfd_create(CLOCK_MONOTONIC, 0);
+    mWakeupFd = eventfd(0, EFD_NONBLOCK);
+    if (mTimerFd < 0 || mWakeupFd < 0) {
+        // Fall back to the polling loop in run()
+        if (mTimerFd >= 0) {
+            close(mTimerFd);
+            mTimerFd = -1;
+        }
+        if (mWakeupFd >= 0) {
+            close(mWakeupFd);
+            mWakeupFd = -1;
+        }
+    }
+#endif
+
+    mThread = new tthread::thread(threadFunc, this);
+    return true;
+}
+
+uint64_t FrameScheduler::now()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000000ULL + tv.tv_usec;
+#endif
+}
+
+bool FrameScheduler::framePresentsLater(PendingFrame *a, PendingFrame *b)
+{
+    // Comparator for a min-heap on presentAt
+    return a->presentAt > b->presentAt;
+}
+
+bool FrameScheduler::schedule(const OPC::Message &msg, uint64_t delayMicros)
+{
+    PendingFrame *frame;
+    uint64_t presentAt = now() + delayMicros;
+
+    mMutex.lock();
+
+    if (mPending.size() >= MAX_PENDING_FRAMES) {
+        mMutex.unlock();
+        if (mVerbose) {
+            std::clog << "Frame scheduler full, presenting frame immediately\n";
+        }
+        return false;
+    }
+
+    frame = new PendingFrame;
+    frame->presentAt = presentAt;
+    memcpy(&frame->msg, &msg, OPC::HEADER_BYTES + msg.length());
+
+    bool isEarliest = mPending.empty() || presentAt < mPending.front()->presentAt;
+
+    mPending.push_back(frame);
+    std::push_heap(mPending.begin(), mPending.end(), framePresentsLater);
+
+    mMutex.unlock();
+
+#ifdef OS_LINUX
+    if (isEarliest && mWakeupFd >= 0) {
+        // Rearm the timer for the new, earlier deadline
+        uint64_t one = 1;
+        if (write(mWakeupFd, &one, sizeof one) < 0) {
+            // Harmless; the timer fires at the previous deadline anyway
+        }
+    }
+#else
+    (void) isEarliest;
+#endif
+
+    return true;
+}
+
+uint64_t FrameScheduler::dispatchDueFrames()
+{
+    uint64_t current = now();
+
+    for (;;) {
+        mMutex.lock();
+
+        if (mPending.empty()) {
+            mMutex.unlock();
+            return 0;
+        }
+
+        PendingFrame *frame = mPending.front();
+        if (frame->presentAt > current) {
+            uint64_t deadline = frame->presentAt;
+            mMutex.unlock();
+            return deadline;
+        }
+
+        std::pop_heap(mPending.begin(), mPending.end(), framePresentsLater);
+        mPending.pop_back();
+        mMutex.unlock();
+
+        // Dispatch outside the lock; the callback may do real work
+        mCallback(frame->msg, mContext);
+        delete frame;
+    }
+}
+
+void FrameScheduler::threadFunc(void *arg)
+{
+    ((FrameScheduler*) arg)->run();
+}
+
+void FrameScheduler::run()
+{
+#ifdef OS_LINUX
+    if (mTimerFd >= 0) {
+        for (;;) {
+            uint64_t deadline = dispatchDueFrames();
+
+            if (deadline) {
+                struct itimerspec its;
+                memset(&its, 0, sizeof its);
+                its.it_value.tv_sec = deadline / 1000000;
+                its.it_value.tv_nsec = (deadline % 1000000) * 1000;
+                timerfd_settime(mTimerFd, TFD_TIMER_ABSTIME, &its, 0);
+            }
+
+            struct pollfd fds[2];
+            fds[0].fd = mWakeupFd;
+            fds[0].events = POLLIN;
+            fds[1].fd = mTimerFd;
+            fds[1].events = POLLIN;
+
+            // With nothing scheduled, wait indefinitely for a wakeup
+            int nfds = deadline ? 2 : 1;
+            if (poll(fds, nfds, -1) < 0 && errno != EINTR) {
+                return;
+            }
+
+            uint64_t value;
+            if (fds[0].revents & POLLIN) {
+                while (read(mWakeupFd, &value, sizeof value) > 0);
+            }
+            if (nfds == 2 && (fds[1].revents & POLLIN)) {
+                if (read(mTimerFd, &value, sizeof value) < 0) {
+                    // Spurious; loop and re-evaluate deadlines
+                }
+            }
+        }
+    }
+#endif
+
+    // Portable fallback: poll at millisecond granularity
+    for (;;) {
+        dispatchDueFrames();
+        tthread::this_thread::sleep_for(tthread::chrono::milliseconds(1));
+    }
+}
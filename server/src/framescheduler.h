@@ -0,0 +1,88 @@
+/*
+ * Presentation-time frame scheduler.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include "opc.h"
+#include "tinythread.h"
+#include "adaptivemutex.h"
+#include <vector>
+
+
+/*
+ * Holds OPC messages carrying a presentation delay, and dispatches each one
+ * when its target time arrives. Network jitter between the client and the
+ * server becomes a fixed, known pipeline delay: the client stamps each frame
+ * with "present this N microseconds from receipt" and sends it early.
+ *
+ * On Linux the scheduler thread sleeps on a timerfd armed for the next
+ * deadline, woken early through an eventfd when a new earliest frame
+ * arrives. Elsewhere it polls on a millisecond sleep, which is still within
+ * a dither cycle of the target.
+ */
+
+class FrameScheduler
+{
+public:
+    FrameScheduler(OPC::callback_t callback, void *context, bool verbose = false);
+
+    // Start the scheduler thread
+    bool start();
+
+    /*
+     * Queue a copy of 'msg' for dispatch 'delayMicros' from now. Returns
+     * false if the scheduler is full; the caller should dispatch the
+     * message immediately instead of dropping it.
+     */
+    bool schedule(const OPC::Message &msg, uint64_t delayMicros);
+
+private:
+    static const unsigned MAX_PENDING_FRAMES = 64;
+
+    struct PendingFrame {
+        uint64_t presentAt;     // Monotonic microseconds
+        OPC::Message msg;
+    };
+
+    OPC::callback_t mCallback;
+    void *mContext;
+    bool mVerbose;
+
+    // Guards mPending, a min-heap ordered by presentAt
+    AdaptiveMutex mMutex;
+    std::vector<PendingFrame*> mPending;
+    tthread::thread *mThread;
+
+#ifdef OS_LINUX
+    int mTimerFd;
+    int mWakeupFd;
+#endif
+
+    static uint64_t now();
+    static bool framePresentsLater(PendingFrame *a, PendingFrame *b);
+    static void threadFunc(void *arg);
+    void run();
+
+    // Dispatch every frame that has come due; returns the next deadline,
+    // or 0 when the heap is empty.
+    uint64_t dispatchDueFrames();
+};
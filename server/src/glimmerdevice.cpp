@@ -31,10 +31,28 @@
 #include <algorithm>
 #include <stdio.h>
 
+#ifdef OS_LINUX
+#include <time.h>
+#endif
+
+
+static uint64_t monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
 
 GlimmerDevice::Transfer::Transfer(GlimmerDevice *device, void *buffer, int length, PacketType type)
     : transfer(libusb_alloc_transfer(0)),
-      type(type), finished(false)
+      device(device), type(type), finished(false)
 {
     #if NEED_COPY_USB_TRANSFER_BUFFER
         bufferCopy = malloc(length);
@@ -66,6 +84,9 @@ GlimmerDevice::GlimmerDevice(libusb_device *device, bool verbose)
 
 GlimmerDevice::~GlimmerDevice()
 {
+    // Stop the output worker before tearing down any state it might touch.
+    mOutputWorker.stop();
+
     /*
      * If we have pending transfers, cancel them.
      * The Transfer objects themselves will be freed
@@ -76,6 +97,10 @@ GlimmerDevice::~GlimmerDevice()
         Transfer *fct = *i;
         libusb_cancel_transfer(fct->transfer);
     }
+
+    freeTransferBuffer((uint8_t*) mFramePackets,
+        glimmer::protocol::maxPacketsPerFrame * sizeof(mFramePackets[0]));
+    freeTransferBuffer(mDeltaStaging, 2 * DELTA_STAGING_BYTES);
 }
 
 bool GlimmerDevice::probe(libusb_device *device)
@@ -111,20 +136,54 @@ int GlimmerDevice::open()
     unsigned minor = mDD.bcdDevice & 0xFF;
     snprintf(mVersionString, sizeof mVersionString, "%x.%02x", major, minor);
 
-    return libusb_get_string_descriptor_ascii(mHandle, mDD.iSerialNumber, 
-        (uint8_t*)mSerialBuffer, sizeof mSerialBuffer);
+    // Frame packets go straight to libusb, so prefer DMA-capable memory
+    mFramePackets = (glimmer::protocol::FramePacket*) allocTransferBuffer(
+        glimmer::protocol::maxPacketsPerFrame * sizeof(mFramePackets[0]));
+    mDeltaStaging = allocTransferBuffer(2 * DELTA_STAGING_BYTES);
+
+    // Delta frames shipped in firmware 3.91
+    mSupportsDeltaFrames = mDD.bcdDevice >= 0x0391;
+
+    return getSerialDescriptor(mDD, mSerialBuffer, sizeof mSerialBuffer);
 }
 
 void GlimmerDevice::completeTransfer(libusb_transfer *transfer)
 {
     GlimmerDevice::Transfer *fct = static_cast<GlimmerDevice::Transfer*>(transfer->user_data);
+    GlimmerDevice *self = fct->device;
     fct->finished = true;
+
+    /*
+     * Error telemetry for describe(): the running total keeps counting, but
+     * any successful completion ends the consecutive run. Cancelled
+     * transfers are our own teardown and count as neither.
+     */
+    if (transfer->status == LIBUSB_TRANSFER_COMPLETED) {
+        self->mConsecutiveUSBErrors = 0;
+    } else if (transfer->status != LIBUSB_TRANSFER_CANCELLED) {
+        __sync_fetch_and_add(&self->mUSBErrors, 1);
+        __sync_fetch_and_add(&self->mConsecutiveUSBErrors, 1);
+    }
+
+    if (fct->type == FRAME && fct->timestamp) {
+        // Log2 bucket of this frame's receive-to-completion latency
+        uint64_t delta = monotonicMicroseconds() - fct->timestamp;
+        unsigned bucket = 0;
+        while (delta > 1 && bucket < LATENCY_BUCKETS - 1) {
+            delta >>= 1;
+            bucket++;
+        }
+        self->mPendingMutex.lock();
+        self->mLatencyHistogram[bucket]++;
+        self->mPendingMutex.unlock();
+    }
 }
 
 void GlimmerDevice::flush()
 {
     // Erase any finished transfers
 
+    mPendingMutex.lock();
     std::set<Transfer*>::iterator current = mPending.begin();
     while (current != mPending.end()) {
         std::set<Transfer*>::iterator next = current;
@@ -150,7 +209,10 @@ void GlimmerDevice::flush()
     }
 
     // Submit new frames, if we had a queued frame waiting
-    if (mFrameWaitingForSubmit && mNumFramesPending < MAX_FRAMES_PENDING) {
+    bool needSubmit = mFrameWaitingForSubmit && mNumFramesPending < MAX_FRAMES_PENDING;
+    mPendingMutex.unlock();
+
+    if (needSubmit) {
         writeFrame();
     }
 }
@@ -158,6 +220,7 @@ void GlimmerDevice::flush()
 void GlimmerDevice::loadConfiguration(const Value &config)
 {
     mConfigMap = findConfigMap(config);
+    PixelMapper::compile(mCompiledMap, mConfigMap, mVerbose);
 
     // Initial firmware configuration from our device options
     parseConfiguration(config);
@@ -165,6 +228,13 @@ void GlimmerDevice::loadConfiguration(const Value &config)
     clearFrame();
 }
 
+bool GlimmerDevice::getOPCChannels(std::set<unsigned> &channels)
+{
+    // The compiled mapping knows exactly which channels we listen to.
+    PixelMapper::programChannels(mCompiledMap, channels);
+    return true;
+}
+
 void GlimmerDevice::parseConfiguration(const Value &config)
 {
     mConfigInitialized = true;
@@ -227,11 +297,13 @@ void GlimmerDevice::parseConfiguration(const Value &config)
 
     // Color depth
     const Value &colorDepth = config["colorDepth"];
-    if (colorDepth.IsUint() && colorDepth.GetUint() == 24 || colorDepth.GetUint() == 33) {
-        mConfigPacket.colorFormat = colorDepth.GetUint() == 24 ? glimmer::protocol::ColorFormat::R8G8B8 :
+    if (colorDepth.IsUint() &&
+            (colorDepth.GetUint() == 16 || colorDepth.GetUint() == 24 || colorDepth.GetUint() == 33)) {
+        mConfigPacket.colorFormat = colorDepth.GetUint() == 16 ? glimmer::protocol::ColorFormat::R5G6B5 :
+                colorDepth.GetUint() == 24 ? glimmer::protocol::ColorFormat::R8G8B8 :
                 glimmer::protocol::ColorFormat::R11G11B11;
     } else if (!colorDepth.IsNull()) {
-        std::clog << "Value for 'colorDepth' must be 24 or 33, or null (default).";
+        std::clog << "Value for 'colorDepth' must be 16, 24 or 33, or null (default).";
     }
 
     // Check frame dimensions.
@@ -300,11 +372,15 @@ bool GlimmerDevice::submitTransfer(Transfer *fct)
         if (mVerbose && r != LIBUSB_ERROR_PIPE) {
             std::clog << "Error submitting USB transfer: " << libusb_strerror(libusb_error(r)) << "\n";
         }
+        __sync_fetch_and_add(&mUSBErrors, 1);
+        __sync_fetch_and_add(&mConsecutiveUSBErrors, 1);
         delete fct;
         return false;
 
     } else {
+        mPendingMutex.lock();
         mPending.insert(fct);
+        mPendingMutex.unlock();
         return true;
     }
 }
@@ -416,6 +492,10 @@ void GlimmerDevice::writeColorCorrection(const Value &color)
                 case glimmer::protocol::ColorFormat::R11G11B11:
                     mColorMap[channel][entry] = uint16_t(output * 0x7f8);
                     break;
+                case glimmer::protocol::ColorFormat::R5G6B5:
+                    // 8-bit entries; the packing truncates to 5/6 bits
+                    mColorMap[channel][entry] = uint16_t(output * 0xff);
+                    break;
             }
         }
     }
@@ -423,10 +503,14 @@ void GlimmerDevice::writeColorCorrection(const Value &color)
 }
 
 void GlimmerDevice::clearFrame() {
-    memset(&mFramePackets, 0, sizeof(mFramePackets));
+    memset(mFramePackets, 0, glimmer::protocol::maxPacketsPerFrame * sizeof(mFramePackets[0]));
     for (uint8_t i = 0; i < mConfigFramePacketCount; ++i) {
         mFramePackets[i].index = i;
     }
+
+    // The device-side buffers were just reinitialized too, so the next
+    // frame must be a full one.
+    memset(mDirtyPackets, 0xff, sizeof mDirtyPackets);
 }
 
 void GlimmerDevice::writeFrame()
@@ -441,16 +525,90 @@ void GlimmerDevice::writeFrame()
 
     if (!mConfigInitialized) return;
 
+    /*
+     * Stage and account under mPendingMutex, like FCDevice's
+     * writeFramebuffer: flush() on the libusb thread and the output
+     * worker can both enter here, and the staging slab choice, the
+     * dirty-bit handoff, and the frame timestamp all have to agree on
+     * one frame.
+     */
+
+    mPendingMutex.lock();
+
+    // Count the packets touched since the last submitted frame
+    size_t dirtyCount = 0;
+    for (size_t i = 0; i < mConfigFramePacketCount; i++) {
+        if (mDirtyPackets[i >> 3] & (1 << (i & 7))) {
+            dirtyCount++;
+        }
+    }
+    if (!dirtyCount) {
+        // Nothing changed; the device keeps showing the committed frame
+        mPendingMutex.unlock();
+        return;
+    }
+
     if (mNumFramesPending >= MAX_FRAMES_PENDING) {
         // Too many outstanding frames. Wait to submit until a previous frame completes.
+        // Dirty bits keep accumulating until the frame actually goes out.
         mFrameWaitingForSubmit = true;
+        mPendingMutex.unlock();
         return;
     }
 
-    if (submitTransfer(new Transfer(this, &mFramePackets,
-            mConfigFramePacketCount * sizeof(mFramePackets[0]), FRAME))) {
+    // This frame now owns the accumulated dirty bits; on a failed submit
+    // they're OR'd back so the retry resends the same packets.
+    uint8_t dirty[sizeof mDirtyPackets];
+    memcpy(dirty, mDirtyPackets, sizeof dirty);
+    memset(mDirtyPackets, 0, sizeof mDirtyPackets);
+
+    uint64_t timestamp = mFrameTimestamp;
+    mFrameTimestamp = 0;
+
+    Transfer *fct;
+    if (mSupportsDeltaFrames && dirtyCount < mConfigFramePacketCount) {
+        /*
+         * Partial frame: a delta header announcing the dirty packets,
+         * followed by just those packets. The header rides in its own
+         * 64-byte USB packet to keep the frame packets aligned.
+         */
+        const size_t packetBytes = sizeof(mFramePackets[0]);
+        uint8_t *staging = mDeltaStaging + (mDeltaStagingIndex++ & 1) * DELTA_STAGING_BYTES;
+        memset(staging, 0, packetBytes);
+        glimmer::protocol::FrameDeltaPacket *header =
+            reinterpret_cast<glimmer::protocol::FrameDeltaPacket*>(staging);
+        header->type = glimmer::protocol::PacketType::frameDelta;
+        memcpy(header->bitmap, dirty, sizeof header->bitmap);
+
+        uint8_t *p = staging + packetBytes;
+        for (size_t i = 0; i < mConfigFramePacketCount; i++) {
+            if (dirty[i >> 3] & (1 << (i & 7))) {
+                memcpy(p, &mFramePackets[i], packetBytes);
+                p += packetBytes;
+            }
+        }
+        fct = new Transfer(this, staging, p - staging, FRAME);
+    } else {
+        fct = new Transfer(this, mFramePackets,
+            mConfigFramePacketCount * sizeof(mFramePackets[0]), FRAME);
+    }
+
+    fct->timestamp = timestamp;
+    mPendingMutex.unlock();
+
+    if (submitTransfer(fct)) {
+        mPendingMutex.lock();
         mFrameWaitingForSubmit = false;
         mNumFramesPending++;
+        mPendingMutex.unlock();
+        mSubmitTrace.record(monotonicMicroseconds());
+    } else {
+        // Put the dirty bits back, so the retry resends these packets
+        mPendingMutex.lock();
+        for (size_t i = 0; i < sizeof dirty; i++) {
+            mDirtyPackets[i] |= dirty[i];
+        }
+        mPendingMutex.unlock();
     }
 }
 
@@ -497,6 +655,7 @@ void GlimmerDevice::writeDevicePixels(Document &msg)
      * the reply to save network bandwidth.
      *
      * Color components are clamped based on the configured color depth:
+     *   16-bits: [0, 255]
      *   24-bits: [0, 255]
      *   33-bits: [0, 1023]
      */
@@ -507,21 +666,37 @@ void GlimmerDevice::writeDevicePixels(Document &msg)
     if (!pixels.IsArray()) {
         msg.AddMember("error", "Pixel array is missing", msg.GetAllocator());
     } else {
-        size_t numPixels = std::min<size_t>(pixels.Size() / 3, mConfigFramePixelCount);
-        for (size_t i = 0; i < numPixels; i++) {
-            const Value &r = pixels[i * 3 + 0];
-            const Value &g = pixels[i * 3 + 1];
-            const Value &b = pixels[i * 3 + 2];
-            writeDevicePixelWithClamping(i,
-                    r.IsInt() ? r.GetInt() : 0,
-                    g.IsInt() ? g.GetInt() : 0,
-                    b.IsInt() ? b.GetInt() : 0);
+        switch (mConfigPacket.colorFormat) {
+            case glimmer::protocol::ColorFormat::R8G8B8:
+                writeDevicePixelArray<glimmer::protocol::ColorFormat::R8G8B8>(pixels);
+                break;
+            case glimmer::protocol::ColorFormat::R11G11B11:
+                writeDevicePixelArray<glimmer::protocol::ColorFormat::R11G11B11>(pixels);
+                break;
+            case glimmer::protocol::ColorFormat::R5G6B5:
+                writeDevicePixelArray<glimmer::protocol::ColorFormat::R5G6B5>(pixels);
+                break;
         }
 
         writeFrame();
     }
 }
 
+template <glimmer::protocol::ColorFormat format>
+void GlimmerDevice::writeDevicePixelArray(const Value &pixels)
+{
+    size_t numPixels = std::min<size_t>(pixels.Size() / 3, mConfigFramePixelCount);
+    for (size_t i = 0; i < numPixels; i++) {
+        const Value &r = pixels[i * 3 + 0];
+        const Value &g = pixels[i * 3 + 1];
+        const Value &b = pixels[i * 3 + 2];
+        writeDevicePixelWithClamping<format>(i,
+                r.IsInt() ? r.GetInt() : 0,
+                g.IsInt() ? g.GetInt() : 0,
+                b.IsInt() ? b.GetInt() : 0);
+    }
+}
+
 void GlimmerDevice::writeMessage(const OPC::Message &msg)
 {
     /*
@@ -532,6 +707,7 @@ void GlimmerDevice::writeMessage(const OPC::Message &msg)
 
         case OPC::SetPixelColors:
             opcSetPixelColors(msg);
+            busScheduleDelay();
             writeFrame();
             return;
 
@@ -567,6 +743,9 @@ void GlimmerDevice::opcSysEx(const OPC::Message &msg)
         case OPC::FCSetFirmwareConfiguration:
             return opcSetFirmwareConfiguration(msg);
 
+        case OPC::FCSetPixelColors16:
+            return opcSetPixelColors16(msg);
+
     }
 
     // Quietly ignore unhandled SysEx messages.
@@ -575,148 +754,77 @@ void GlimmerDevice::opcSysEx(const OPC::Message &msg)
 void GlimmerDevice::opcSetPixelColors(const OPC::Message &msg)
 {
     /*
-     * Parse through our device's mapping, and store any relevant portions of 'msg'
+     * Run through our compiled mapping, and store any relevant portions of 'msg'
      * in the framebuffer.
      */
 
-    if (!mConfigMap || !mConfigInitialized || !mColorMapInitialized) {
-        // No mapping defined yet. This device is inactive.
+    if (!mConfigInitialized || !mColorMapInitialized) {
+        // Not configured yet. This device is inactive.
         return;
     }
 
-    const Value &map = *mConfigMap;
-    for (unsigned i = 0, e = map.Size(); i != e; i++) {
-        opcMapPixelColors(msg, map[i]);
+    // Pick the color format once here, so the mapping loop runs with the
+    // packing code for that format fully inlined.
+    switch (mConfigPacket.colorFormat) {
+        case glimmer::protocol::ColorFormat::R8G8B8: {
+            FramebufferWriter<glimmer::protocol::ColorFormat::R8G8B8> writer(*this);
+            PixelMapper::run(mCompiledMap, msg, writer);
+            break;
+        }
+        case glimmer::protocol::ColorFormat::R11G11B11: {
+            FramebufferWriter<glimmer::protocol::ColorFormat::R11G11B11> writer(*this);
+            PixelMapper::run(mCompiledMap, msg, writer);
+            break;
+        }
+        case glimmer::protocol::ColorFormat::R5G6B5: {
+            FramebufferWriter<glimmer::protocol::ColorFormat::R5G6B5> writer(*this);
+            PixelMapper::run(mCompiledMap, msg, writer);
+            break;
+        }
     }
+
+    // Date the staged frame; when messages coalesce, the newest arrival
+    // time wins, matching the data the next transfer carries.
+    mFrameTimestamp = mReceiveTimestamp;
 }
 
-void GlimmerDevice::opcMapPixelColors(const OPC::Message &msg, const Value &inst)
+void GlimmerDevice::opcSetPixelColors16(const OPC::Message &msg)
 {
     /*
-     * Parse one JSON mapping instruction, and copy any relevant parts of 'msg'
-     * into our framebuffer. This looks for any mapping instructions that we
-     * recognize:
-     *
-     *   [ OPC Channel, First OPC Pixel, First output pixel, Pixel count ]
-     *   [ OPC Channel, First OPC Pixel, First output pixel, Color channels ]
+     * 16-bit SetPixelColors. Same mapping as the 8-bit path, but the color
+     * map is interpolated per component, so shader precision survives into
+     * the wider R11G11B11 wire format and the firmware's dithering instead
+     * of being quantized to 8 bits at the client. Submission matches the
+     * SetPixelColors case in writeMessage().
      */
 
-    unsigned msgPixelCount = msg.length() / 3;
-
-    if (inst.IsArray() && inst.Size() == 4) {
-        // Map a range from an OPC channel to our framebuffer
-
-        const Value &vChannel = inst[0u];
-        const Value &vFirstOPC = inst[1];
-        const Value &vFirstOut = inst[2];
-        const Value &vCount = inst[3];
-
-        if (vChannel.IsUint() && vFirstOPC.IsUint() && vFirstOut.IsUint() && vCount.IsInt()) {
-            unsigned channel = vChannel.GetUint();
-            unsigned firstOPC = vFirstOPC.GetUint();
-            unsigned firstOut = vFirstOut.GetUint();
-            unsigned count;
-            int direction;
-            if (vCount.GetInt() >= 0) {
-                count = vCount.GetInt();
-                direction = 1;
-            } else {
-                count = -vCount.GetInt();
-                direction = -1;
-            }
-
-            if (channel != msg.channel) {
-                return;
-            }
-
-            // Clamping, overflow-safe
-            firstOPC = std::min<unsigned>(firstOPC, msgPixelCount);
-            firstOut = std::min<unsigned>(firstOut, mConfigFramePixelCount);
-            count = std::min<unsigned>(count, msgPixelCount - firstOPC);
-            count = std::min<unsigned>(count,
-                    direction > 0 ? mConfigFramePixelCount - firstOut : firstOut + 1);
-
-            // Copy pixels
-            const uint8_t *inPtr = msg.data + (firstOPC * 3);
-            unsigned outIndex = firstOut;
-            while (count--) {
-                writeColorMappedPixel(outIndex, inPtr[0], inPtr[1], inPtr[2]);
-                outIndex += direction;
-                inPtr += 3;
-            }
-
-            return;
-        }
+    if (!mConfigInitialized || !mColorMapInitialized) {
+        // Not configured yet. This device is inactive.
+        return;
     }
 
-    if (inst.IsArray() && inst.Size() == 5) {
-        // Map a range from an OPC channel to our framebuffer, with color channel swizzling
-
-        const Value &vChannel = inst[0u];
-        const Value &vFirstOPC = inst[1];
-        const Value &vFirstOut = inst[2];
-        const Value &vCount = inst[3];
-        const Value &vColorChannels = inst[4];
-
-        if (vChannel.IsUint() && vFirstOPC.IsUint() && vFirstOut.IsUint() && vCount.IsInt()
-            && vColorChannels.IsString() && vColorChannels.GetStringLength() == 3) {
-
-            unsigned channel = vChannel.GetUint();
-            unsigned firstOPC = vFirstOPC.GetUint();
-            unsigned firstOut = vFirstOut.GetUint();
-            unsigned count;
-            int direction;
-            if (vCount.GetInt() >= 0) {
-                count = vCount.GetInt();
-                direction = 1;
-            } else {
-                count = -vCount.GetInt();
-                direction = -1;
-            }
-            const char *colorChannels = vColorChannels.GetString();
-
-            if (channel != msg.channel) {
-                return;
-            }
-
-            // Clamping, overflow-safe
-            firstOPC = std::min<unsigned>(firstOPC, msgPixelCount);
-            firstOut = std::min<unsigned>(firstOut, mConfigFramePixelCount);
-            count = std::min<unsigned>(count, msgPixelCount - firstOPC);
-            count = std::min<unsigned>(count,
-                    direction > 0 ? mConfigFramePixelCount - firstOut : firstOut + 1);
-
-            // Copy pixels
-            const uint8_t *inPtr = msg.data + (firstOPC * 3);
-            unsigned outIndex = firstOut;
-            bool success = true;
-            uint8_t color[3] = {};
-            while (count--) {
-                for (int channel = 0; channel < 3; channel++) {
-                    if (!OPC::pickColorChannel(color[channel], colorChannels[channel], inPtr)) {
-                        success = false;
-                        break;
-                    }
-                }
-
-                writeColorMappedPixel(outIndex, color[0], color[1], color[2]);
-                outIndex += direction;
-                inPtr += 3;
-            }
-
-            if (success) {
-                return;
-            }
+    switch (mConfigPacket.colorFormat) {
+        case glimmer::protocol::ColorFormat::R8G8B8: {
+            FramebufferWriter<glimmer::protocol::ColorFormat::R8G8B8> writer(*this);
+            PixelMapper::run16(mCompiledMap, msg, writer);
+            break;
+        }
+        case glimmer::protocol::ColorFormat::R11G11B11: {
+            FramebufferWriter<glimmer::protocol::ColorFormat::R11G11B11> writer(*this);
+            PixelMapper::run16(mCompiledMap, msg, writer);
+            break;
+        }
+        case glimmer::protocol::ColorFormat::R5G6B5: {
+            FramebufferWriter<glimmer::protocol::ColorFormat::R5G6B5> writer(*this);
+            PixelMapper::run16(mCompiledMap, msg, writer);
+            break;
         }
     }
 
-    // Still haven't found a match?
-    if (mVerbose) {
-        rapidjson::GenericStringBuffer<rapidjson::UTF8<> > buffer;
-        rapidjson::Writer<rapidjson::GenericStringBuffer<rapidjson::UTF8<> > > writer(buffer);
-        inst.Accept(writer);
-        std::clog << "Unsupported JSON mapping instruction: " << buffer.GetString() << "\n";
-    }
+    mFrameTimestamp = mReceiveTimestamp;
+
+    busScheduleDelay();
+    writeFrame();
 }
 
 void GlimmerDevice::opcSetGlobalColorCorrection(const OPC::Message &msg)
@@ -770,4 +878,23 @@ void GlimmerDevice::describe(rapidjson::Value &object, Allocator &alloc)
     USBDevice::describe(object, alloc);
     object.AddMember("version", mVersionString, alloc);
     object.AddMember("bcd_version", mDD.bcdDevice, alloc);
+
+    mPendingMutex.lock();
+    int pending = mNumFramesPending;
+    uint64_t histogram[LATENCY_BUCKETS];
+    memcpy(histogram, mLatencyHistogram, sizeof histogram);
+    mPendingMutex.unlock();
+
+    object.AddMember("frames_pending", pending, alloc);
+    object.AddMember("usb_errors", mUSBErrors, alloc);
+    object.AddMember("consecutive_usb_errors", mConsecutiveUSBErrors, alloc);
+
+    // Receive-to-completion latency summary, log2-quantized to bucket
+    // lower bounds; see the histogram comment in the header.
+    object.AddMember("latency_min_usec",
+        latencyHistogramMin(histogram, LATENCY_BUCKETS), alloc);
+    object.AddMember("latency_p50_usec",
+        latencyHistogramPercentile(histogram, LATENCY_BUCKETS, 50), alloc);
+    object.AddMember("latency_p99_usec",
+        latencyHistogramPercentile(histogram, LATENCY_BUCKETS, 99), alloc);
 }
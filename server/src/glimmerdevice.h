@@ -24,6 +24,8 @@
 #pragma once
 #include "usbdevice.h"
 #include "opc.h"
+#include "pixelmapper.h"
+#include "adaptivemutex.h"
 #include <set>
 
 #include "glimmer/protocol.h"
@@ -38,6 +40,7 @@ public:
 
     virtual int open();
     virtual void loadConfiguration(const Value &config);
+    virtual bool getOPCChannels(std::set<unsigned> &channels);
     virtual void writeMessage(const OPC::Message &msg);
     virtual void writeMessage(Document &msg);
     virtual void writeColorCorrection(const Value &color);
@@ -61,15 +64,58 @@ private:
         #if NEED_COPY_USB_TRANSFER_BUFFER
           void *bufferCopy;
         #endif
+        GlimmerDevice *device;
         PacketType type;
         bool finished;
+        uint64_t timestamp = 0;     // Receive time of the frame aboard, or 0
+    };
+
+    typedef glimmer::protocol::ColorFormat ColorFormat;
+
+    /*
+     * Pixel writer adapter for PixelMapper, targeting mFramePackets through
+     * the color map. Templated on the color format so the format dispatch
+     * happens once per message rather than once per pixel, and so each
+     * instantiation of the mapping loop inlines only its own packing code;
+     * the 24-bit path stays a straight LUT-and-store loop the compiler can
+     * vectorize, without the 33-bit shift/mask work.
+     */
+    template <ColorFormat format>
+    struct FramebufferWriter {
+        GlimmerDevice &device;
+        FramebufferWriter(GlimmerDevice &device) : device(device) {}
+        unsigned numPixels() const { return device.mConfigFramePixelCount; }
+        void writePixel(unsigned index, uint8_t r, uint8_t g, uint8_t b) {
+            device.writeColorMappedPixel<format>(index, r, g, b);
+        }
+        void writePixel16(unsigned index, uint16_t r, uint16_t g, uint16_t b) {
+            device.writeColorMappedPixel16<format>(index, r, g, b);
+        }
     };
 
     const Value *mConfigMap;
+    PixelMapper::Program mCompiledMap;
+
+    // Guards mPending and the frame counters, which are shared between the
+    // output worker thread and the main loop's flush().
+    AdaptiveMutex mPendingMutex;
     std::set<Transfer*> mPending;
     int mNumFramesPending;
     bool mFrameWaitingForSubmit;
 
+    /*
+     * Operational telemetry for describe(). The histogram counts each
+     * frame's receive-to-completion time in log2 microsecond buckets, same
+     * layout as FCDevice's, and shares mPendingMutex with the frame
+     * counters. mFrameTimestamp dates the newest message staged into
+     * mFramePackets and is only touched on the output worker thread.
+     */
+    static const unsigned LATENCY_BUCKETS = 24;
+    uint64_t mLatencyHistogram[LATENCY_BUCKETS] = {};
+    uint64_t mFrameTimestamp = 0;
+    uint64_t mUSBErrors = 0;
+    uint64_t mConsecutiveUSBErrors = 0;
+
     char mSerialBuffer[256];
     char mVersionString[10];
 
@@ -82,7 +128,28 @@ private:
     glimmer::protocol::DebugPacket mDebugPacket = glimmer::protocol::debugPacketDefault;
 
     bool mFrameInitialized = false;
-    glimmer::protocol::FramePacket mFramePackets[glimmer::protocol::maxPacketsPerFrame];
+    glimmer::protocol::FramePacket *mFramePackets = 0;   // DMA-capable, allocated in open()
+
+    /*
+     * Delta frame support, for firmware >= 3.91. Pixel writes mark their
+     * packet dirty; writeFrame() sends only the dirty packets, preceded by
+     * a header announcing them, and an unchanged frame costs no USB traffic
+     * at all. mDeltaStaging holds the header plus the dirty packets for the
+     * duration of the transfer.
+     */
+    bool mSupportsDeltaFrames = false;
+    uint8_t mDirtyPackets[glimmer::protocol::frameDeltaBitmapBytes] = {};
+
+    // Two staging slabs, used alternately so a delta can be built while the
+    // previous one is still in flight (MAX_FRAMES_PENDING == 2).
+    uint8_t *mDeltaStaging = 0;     // DMA-capable, allocated in open()
+    unsigned mDeltaStagingIndex = 0;
+    static const size_t DELTA_STAGING_BYTES =
+        (1 + glimmer::protocol::maxPacketsPerFrame) * sizeof(glimmer::protocol::FramePacket);
+
+    inline void markPacketDirty(size_t packetIndex) {
+        mDirtyPackets[packetIndex >> 3] |= 1 << (packetIndex & 7);
+    }
 
     // The color map is scaled according to the color depth.
     bool mColorMapInitialized = false;
@@ -101,11 +168,20 @@ private:
         glimmer::protocol::FramePacket* packet = &mFramePackets[n / ppp];
         size_t pixelIndex = n % ppp;
         uint8_t* pixel = &packet->data[pixelIndex * 3];
-        pixel[0] = r;
-        pixel[1] = g;
-        pixel[2] = b;
+        // Only unchanged pixels keep their packet clean, so clients that
+        // resend identical frames still produce empty deltas.
+        if (pixel[0] != r || pixel[1] != g || pixel[2] != b) {
+            pixel[0] = r;
+            pixel[1] = g;
+            pixel[2] = b;
+            markPacketDirty(n / ppp);
+        }
     }
 
+    // Lets the kernel microbenchmarks (bench/kernelbench.cpp) time the
+    // pixel packing without widening the public interface.
+    friend class KernelBench;
+
     inline void writeDevicePixel33(size_t n, unsigned r, unsigned g, unsigned b) {
         const size_t ppp = glimmer::protocol::pixelsPerPacket(glimmer::protocol::ColorFormat::R11G11B11);
         glimmer::protocol::FramePacket* packet = &mFramePackets[n / ppp];
@@ -113,18 +189,25 @@ private:
         uint8_t* data = reinterpret_cast<uint8_t*>(packet);
         uint32_t* pixel = &reinterpret_cast<uint32_t*>(data + 4)[pixelIndex];
         uint16_t* blues = reinterpret_cast<uint16_t*>(data + 2);
-        *pixel = (r << 21) | (g << 10) | (b >> 1);
-        *blues = (*blues & ~(1u << pixelIndex)) | ((b & 1u) << pixelIndex);
+        uint32_t packed = (r << 21) | (g << 10) | (b >> 1);
+        uint16_t packedBlues = (*blues & ~(1u << pixelIndex)) | ((b & 1u) << pixelIndex);
+        if (*pixel != packed || *blues != packedBlues) {
+            *pixel = packed;
+            *blues = packedBlues;
+            markPacketDirty(n / ppp);
+        }
     }
 
-    inline void writeDevicePixel(size_t n, unsigned r, unsigned g, unsigned b) {
-        switch (mConfigPacket.colorFormat) {
-            case glimmer::protocol::ColorFormat::R8G8B8:
-                writeDevicePixel24(n, r, g, b);
-                break;
-            case glimmer::protocol::ColorFormat::R11G11B11:
-                writeDevicePixel33(n, r, g, b);
-                break;
+    inline void writeDevicePixel16(size_t n, unsigned r, unsigned g, unsigned b) {
+        const size_t ppp = glimmer::protocol::pixelsPerPacket(glimmer::protocol::ColorFormat::R5G6B5);
+        glimmer::protocol::FramePacket* packet = &mFramePackets[n / ppp];
+        size_t pixelIndex = n % ppp;
+        uint8_t* data = reinterpret_cast<uint8_t*>(packet);
+        uint16_t* pixel = &reinterpret_cast<uint16_t*>(data + 2)[pixelIndex];
+        uint16_t packed = ((r & 0xf8u) << 8) | ((g & 0xfcu) << 3) | (b >> 3);
+        if (*pixel != packed) {
+            *pixel = packed;
+            markPacketDirty(n / ppp);
         }
     }
 
@@ -132,35 +215,66 @@ private:
         return x < 0 ? 0u : x > max ? max : static_cast<unsigned>(x);
     }
 
+    // The 'format' branches below are compile-time constants; each
+    // instantiation keeps only its own packing code.
+
+    template <ColorFormat format>
     inline void writeDevicePixelWithClamping(size_t n, int r, int g, int b) {
-        switch (mConfigPacket.colorFormat) {
-            case glimmer::protocol::ColorFormat::R8G8B8:
-                writeDevicePixel24(n, clamp(r, 0xffu), clamp(g, 0xffu), clamp(b, 0xffu));
-                break;
-            case glimmer::protocol::ColorFormat::R11G11B11:
-                writeDevicePixel33(n, clamp(r, 0x7f8u), clamp(g, 0x7f8u), clamp(b, 0x7f8u));
-                break;
+        if (format == ColorFormat::R8G8B8) {
+            writeDevicePixel24(n, clamp(r, 0xffu), clamp(g, 0xffu), clamp(b, 0xffu));
+        } else if (format == ColorFormat::R5G6B5) {
+            writeDevicePixel16(n, clamp(r, 0xffu), clamp(g, 0xffu), clamp(b, 0xffu));
+        } else {
+            writeDevicePixel33(n, clamp(r, 0x7f8u), clamp(g, 0x7f8u), clamp(b, 0x7f8u));
         }
     }
 
+    template <ColorFormat format>
     inline void writeColorMappedPixel(size_t n, unsigned r, unsigned g, unsigned b) {
-        switch (mConfigPacket.colorFormat) {
-            case glimmer::protocol::ColorFormat::R8G8B8:
-                writeDevicePixel24(n, mColorMap[0][r], mColorMap[1][g], mColorMap[2][b]);
-                break;
-            case glimmer::protocol::ColorFormat::R11G11B11:
-                writeDevicePixel33(n, mColorMap[0][r], mColorMap[1][g], mColorMap[2][b]);
-                break;
+        if (format == ColorFormat::R8G8B8) {
+            writeDevicePixel24(n, mColorMap[0][r], mColorMap[1][g], mColorMap[2][b]);
+        } else if (format == ColorFormat::R5G6B5) {
+            writeDevicePixel16(n, mColorMap[0][r], mColorMap[1][g], mColorMap[2][b]);
+        } else {
+            writeDevicePixel33(n, mColorMap[0][r], mColorMap[1][g], mColorMap[2][b]);
+        }
+    }
+
+    /*
+     * Color-map a 16-bit component by interpolating between adjacent map
+     * entries, the same way the FCDevice firmware interpolates its LUT.
+     * The result stays between the two entries, so it needs no clamping
+     * for any color depth the map was scaled to.
+     */
+    inline unsigned mapComponent16(unsigned channel, unsigned v) {
+        unsigned hi = v >> 8;
+        int a = mColorMap[channel][hi];
+        int b = mColorMap[channel][hi < 255 ? hi + 1 : 255];
+        return a + (((b - a) * int(v & 0xff)) >> 8);
+    }
+
+    template <ColorFormat format>
+    inline void writeColorMappedPixel16(size_t n, unsigned r, unsigned g, unsigned b) {
+        r = mapComponent16(0, r);
+        g = mapComponent16(1, g);
+        b = mapComponent16(2, b);
+        if (format == ColorFormat::R8G8B8) {
+            writeDevicePixel24(n, r, g, b);
+        } else if (format == ColorFormat::R5G6B5) {
+            writeDevicePixel16(n, r, g, b);
+        } else {
+            writeDevicePixel33(n, r, g, b);
         }
     }
 
     bool submitTransfer(Transfer *fct);
     void writeDevicePixels(Document &msg);
+    template <ColorFormat format> void writeDevicePixelArray(const Value &pixels);
     static LIBUSB_CALL void completeTransfer(libusb_transfer *transfer);
 
     void opcSetPixelColors(const OPC::Message &msg);
+    void opcSetPixelColors16(const OPC::Message &msg);
     void opcSysEx(const OPC::Message &msg);
     void opcSetGlobalColorCorrection(const OPC::Message &msg);
     void opcSetFirmwareConfiguration(const OPC::Message &msg);
-    void opcMapPixelColors(const OPC::Message &msg, const Value &inst);
 };
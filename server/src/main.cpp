@@ -25,10 +25,35 @@
 #include "rapidjson/reader.h"
 #include "rapidjson/filestream.h"
 #include "fcserver.h"
+#include "supervisor.h"
 #include "version.h"
 #include <cstdio>
 #include <iostream>
 
+#ifndef OS_WINDOWS
+#include <signal.h>
+
+// SIGHUP asks the running server to re-read its config file; see
+// FCServer::requestConfigReload(). The handler only sets a flag.
+static FCServer *gServer = 0;
+
+static void handleSighup(int sig)
+{
+    if (gServer) {
+        gServer->requestConfigReload();
+    }
+}
+
+// SIGTERM/SIGINT release the USB devices before exiting, so a successor
+// process (e.g. during an upgrade) can re-claim them immediately.
+static void handleShutdownSignal(int sig)
+{
+    if (gServer) {
+        gServer->requestShutdown();
+    }
+}
+#endif
+
 const char *kDefaultConfig =
     "    {\n"
     "        \"listen\": [\"127.0.0.1\", 7890],\n"
@@ -53,6 +78,7 @@ const char *kSystemConfigPath = "/etc/fcserver/config.json";
 int main(int argc, char **argv)
 {
     rapidjson::Document config;
+    const char *configPath = 0;
 
     libusb_context *usb;
     if (libusb_init(&usb)) {
@@ -71,6 +97,7 @@ int main(int argc, char **argv)
 
         rapidjson::FileStream istr(configFile);
         config.ParseStream<0>(istr);
+        configPath = argv[1];
 
     } else if (argc == 1) {
         // Load default configuration
@@ -80,6 +107,7 @@ int main(int argc, char **argv)
             std::clog << "Using system config at " << kSystemConfigPath << "\n";
             rapidjson::FileStream istr(configFile);
             config.ParseStream<0>(istr);
+            configPath = kSystemConfigPath;
 
         } else {
             std::clog << "No system config file found, using default\n";
@@ -122,11 +150,33 @@ int main(int argc, char **argv)
         return 3;
     }
 
+#ifdef OS_LINUX
+    if (config["shardByBus"].IsTrue()) {
+        // Supervisor mode: the master and each per-bus worker manage
+        // their own libusb contexts.
+        libusb_exit(usb);
+        Supervisor supervisor(config, configPath);
+        return supervisor.run();
+    }
+#endif
+
     FCServer server(config);
     if (server.hasError()) {
         fprintf(stderr, "Configuration errors:\n%s", server.errorText().c_str());
         return 5;
     }
+
+    if (configPath) {
+        server.setConfigPath(configPath);
+    }
+
+#ifndef OS_WINDOWS
+    gServer = &server;
+    signal(SIGHUP, handleSighup);
+    signal(SIGTERM, handleShutdownSignal);
+    signal(SIGINT, handleShutdownSignal);
+#endif
+
     if (!server.start(usb)) {
         return 9;
     }
@@ -0,0 +1,95 @@
+/*
+ * Null sink virtual device.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "nulldevice.h"
+#include <string.h>
+
+
+const char *NullDevice::DEVICE_TYPE = "null";
+
+
+NullDevice::NullDevice(bool verbose)
+    : USBDevice(0, DEVICE_TYPE, verbose),
+      mConfigMap(0), mMessagesReceived(0), mBytesReceived(0), mFramesMapped(0)
+{
+    memset(mFramebuffer, 0, sizeof mFramebuffer);
+}
+
+NullDevice::~NullDevice()
+{
+    // Stop the output worker before the members it writes are torn down
+    mOutputWorker.stop();
+}
+
+int NullDevice::open()
+{
+    return 0;
+}
+
+void NullDevice::loadConfiguration(const Value &config)
+{
+    mConfigMap = findConfigMap(config);
+    PixelMapper::compile(mCompiledMap, mConfigMap, mVerbose);
+}
+
+bool NullDevice::getOPCChannels(std::set<unsigned> &channels)
+{
+    if (!mConfigMap) {
+        // No map; stay unrouted and count every message
+        return false;
+    }
+    PixelMapper::programChannels(mCompiledMap, channels);
+    return true;
+}
+
+void NullDevice::writeMessage(const OPC::Message &msg)
+{
+    mMessagesReceived++;
+    mBytesReceived += OPC::HEADER_BYTES + msg.length();
+
+    if (msg.command == OPC::SetPixelColors && !mCompiledMap.instructions.empty()) {
+        // Do the work a hardware backend would, then drop the result
+        FramebufferWriter writer(*this);
+        PixelMapper::run(mCompiledMap, msg, writer);
+        mFramesMapped++;
+    }
+}
+
+std::string NullDevice::getName()
+{
+    return "Null sink device";
+}
+
+void NullDevice::flush()
+{
+    // Nothing buffered; there is no downstream
+}
+
+void NullDevice::describe(rapidjson::Value &object, Allocator &alloc)
+{
+    USBDevice::describe(object, alloc);
+
+    object.AddMember("messages_received", mMessagesReceived, alloc);
+    object.AddMember("bytes_received", mBytesReceived, alloc);
+    object.AddMember("frames_mapped", mFramesMapped, alloc);
+}
@@ -0,0 +1,80 @@
+/*
+ * Null sink virtual device.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include "usbdevice.h"
+#include "pixelmapper.h"
+
+
+/*
+ * NullDevice counts what it's sent and throws it away, so mapping
+ * throughput can be validated on CI machines and staging boxes with no
+ * hardware attached:
+ *
+ *   { "type": "null", "map": [ [ 0, 0, 0, 512 ] ] }
+ *
+ * With a map configured it compiles and runs the real PixelMapper per
+ * frame and enumerates its channels for routing, doing the same work per
+ * message a Fadecandy board's backend would; without one it sits in the
+ * unrouted list and counts everything. The counters are visible in
+ * list_connected_devices and the metrics endpoint.
+ */
+
+class NullDevice : public USBDevice
+{
+public:
+    static const char *DEVICE_TYPE;
+    static const unsigned NUM_PIXELS = 512;
+
+    NullDevice(bool verbose);
+    virtual ~NullDevice();
+
+    virtual int open();
+    virtual void loadConfiguration(const Value &config);
+    virtual bool getOPCChannels(std::set<unsigned> &channels);
+    virtual void writeMessage(const OPC::Message &msg);
+    virtual std::string getName();
+    virtual void flush();
+    virtual void describe(rapidjson::Value &object, Allocator &alloc);
+
+private:
+    struct FramebufferWriter {
+        NullDevice &device;
+        FramebufferWriter(NullDevice &device) : device(device) {}
+        unsigned numPixels() const { return NUM_PIXELS; }
+        void writePixel(unsigned index, uint8_t r, uint8_t g, uint8_t b) {
+            uint8_t *out = &device.mFramebuffer[3 * index];
+            out[0] = r;
+            out[1] = g;
+            out[2] = b;
+        }
+    };
+
+    const Value *mConfigMap;
+    PixelMapper::Program mCompiledMap;
+    uint8_t mFramebuffer[NUM_PIXELS * 3];
+
+    uint64_t mMessagesReceived;
+    uint64_t mBytesReceived;
+    uint64_t mFramesMapped;
+};
@@ -34,7 +34,20 @@ namespace OPC {
     // SysEx system and command IDs
     enum SysEx {
         FCSetGlobalColorCorrection = 0x00010001,
-        FCSetFirmwareConfiguration = 0x00010002
+        FCSetFirmwareConfiguration = 0x00010002,
+        FCQueueDepthRequest = 0x00010003,
+        FCQueueDepthReply = 0x00010004,
+        FCFramePresent = 0x00010005,
+        FCDevicePixels = 0x00010006,
+
+        /*
+         * 16-bit-per-channel SetPixelColors. Channel-addressed and mapped
+         * exactly like SetPixelColors, but the payload after the SysEx ID is
+         * six bytes per pixel: R, G, B as big-endian uint16. Lets clients
+         * hand shader output to the firmware's temporal dithering without
+         * quantizing to 8 bits first.
+         */
+        FCSetPixelColors16 = 0x00010007
     };
 
     struct Message
@@ -59,6 +72,10 @@ namespace OPC {
 
     typedef void (*callback_t)(Message &msg, void *context);
 
+    // Batch form: several complete messages drained from one socket read,
+    // letting the receiver amortize its per-dispatch overhead.
+    typedef void (*batch_callback_t)(Message **messages, unsigned count, void *context);
+
     // Common idiom for choosing color channels based on a character string
     inline bool pickColorChannel(uint8_t &output, char selector, const uint8_t *rgb)
     {
@@ -89,4 +106,39 @@ namespace OPC {
         }
     }
 
+    // 16-bit variant, for FCSetPixelColors16 payloads. 'rgb' points at one
+    // six-byte pixel of big-endian uint16 components.
+    inline bool pickColorChannel16(uint16_t &output, char selector, const uint8_t *rgb)
+    {
+        unsigned r = (unsigned(rgb[0]) << 8) | rgb[1];
+        unsigned g = (unsigned(rgb[2]) << 8) | rgb[3];
+        unsigned b = (unsigned(rgb[4]) << 8) | rgb[5];
+
+        switch (selector) {
+
+            case 'r':
+            case 'R':
+                output = r;
+                return true;
+
+            case 'g':
+            case 'G':
+                output = g;
+                return true;
+
+            case 'b':
+            case 'B':
+                output = b;
+                return true;
+
+            case 'l':
+            case 'L':
+                output = (r + g + b) / 3;
+                return true;
+
+            default:
+                return false;
+        }
+    }
+
 }
@@ -0,0 +1,98 @@
+/*
+ * Per-device output worker thread for OPC message delivery.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "outputworker.h"
+#include "rtsched.h"
+#include <string.h>
+
+
+OutputWorker::OutputWorker(writeFn_t writeFn, void *context)
+    : mWriteFn(writeFn), mContext(context),
+      mThread(0), mRunning(false), mDroppedFrames(0)
+{}
+
+OutputWorker::~OutputWorker()
+{
+    stop();
+}
+
+bool OutputWorker::enqueue(const OPC::Message &msg, uint64_t timestamp, bool dropOnFull)
+{
+    Entry *slot = mQueue.head();
+    if (!slot) {
+        // Queue full. Drop this message rather than blocking the dispatch thread.
+        if (dropOnFull) {
+            mDroppedFrames++;
+        }
+        return false;
+    }
+
+    // Copy only the header and the used portion of the payload.
+    slot->timestamp = timestamp;
+    memcpy(&slot->msg, &msg, OPC::HEADER_BYTES + msg.length());
+    mQueue.push();
+
+    if (!mThread) {
+        // Lazily start the worker, so briefly-probed devices never pay for a thread.
+        mRunning = true;
+        mThread = new tthread::thread(threadFunc, this);
+    }
+
+    return true;
+}
+
+void OutputWorker::stop()
+{
+    if (mThread) {
+        mRunning = false;
+        mThread->join();
+        delete mThread;
+        mThread = 0;
+    }
+}
+
+void OutputWorker::threadFunc(void *arg)
+{
+    OutputWorker *self = (OutputWorker*) arg;
+
+    // Device writers are on the frame path; schedule them ahead of
+    // time-shared work when real-time mode is configured.
+    RtSched::applyToCurrentThread("output");
+
+    /*
+     * Drain the queue, sleeping briefly when it's empty. The short poll keeps
+     * the queue itself lock-free; one millisecond is far below a frame period,
+     * and an idle worker costs nearly nothing.
+     */
+
+    while (self->mRunning) {
+        Entry *entry = self->mQueue.front();
+        if (!entry) {
+            tthread::this_thread::sleep_for(tthread::chrono::milliseconds(1));
+            continue;
+        }
+
+        self->mWriteFn(entry->msg, entry->timestamp, self->mContext);
+        self->mQueue.pop();
+    }
+}
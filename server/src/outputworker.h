@@ -0,0 +1,86 @@
+/*
+ * Per-device output worker thread for OPC message delivery.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include "opc.h"
+#include "spscqueue.h"
+#include "tinythread.h"
+#include <stdint.h>
+
+
+/*
+ * Each output device owns one OutputWorker. The server's dispatch thread
+ * enqueues OPC messages without blocking; the worker thread drains them and
+ * hands each one to the device's writeMessage(). This keeps one slow device
+ * from delaying delivery to every other device.
+ *
+ * The queue is a bounded lock-free SPSC ring. When it's full the newest
+ * message is dropped and counted; for SetPixelColors this is the right
+ * policy, since a newer frame always supersedes a dropped one.
+ */
+
+class OutputWorker
+{
+public:
+    typedef void (*writeFn_t)(const OPC::Message &msg, uint64_t timestamp, void *context);
+
+    OutputWorker(writeFn_t writeFn, void *context);
+    ~OutputWorker();
+
+    // Queue a message for delivery on the worker thread. Starts the thread
+    // on first use. Returns false if the queue was full; the message is
+    // then dropped and counted, unless dropOnFull is false (for callers
+    // that will retry instead). 'timestamp' rides along untouched; the
+    // latency instrumentation uses it to date the message's arrival.
+    bool enqueue(const OPC::Message &msg, uint64_t timestamp = 0, bool dropOnFull = true);
+
+    // Stop and join the worker thread. Idempotent; must be called before
+    // the device state referenced by writeFn is torn down.
+    void stop();
+
+    uint64_t droppedFrames() const { return mDroppedFrames; }
+
+    // Messages queued but not yet delivered
+    unsigned depth() const { return mQueue.count(); }
+
+private:
+    // Deep enough to ride out a transient stall, small enough that we drop
+    // rather than queueing seconds of stale frames.
+    static const unsigned QUEUE_DEPTH = 4;
+
+    writeFn_t mWriteFn;
+    void *mContext;
+    tthread::thread *mThread;
+    volatile bool mRunning;
+    uint64_t mDroppedFrames;
+
+    // Ring slots carry the message plus its out-of-band receive timestamp
+    struct Entry {
+        uint64_t timestamp;
+        OPC::Message msg;
+    };
+
+    SPSCQueue<Entry, QUEUE_DEPTH> mQueue;
+
+    static void threadFunc(void *arg);
+};
@@ -0,0 +1,85 @@
+/*
+ * Frame pacing analyzer, feeding the web UI's timeline view.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "pacinganalyzer.h"
+#include <string.h>
+
+
+PacingAnalyzer::PacingAnalyzer()
+{
+    memset(mChannels, 0, sizeof mChannels);
+}
+
+void PacingAnalyzer::Trace::record(uint64_t timestamp)
+{
+    // Exchange, so concurrent recorders each pair with some prior arrival
+    uint64_t last = __sync_lock_test_and_set(&lastTimestamp, timestamp);
+    if (!last || timestamp <= last) {
+        // First frame on this trace, or arrivals reordered across threads
+        return;
+    }
+
+    uint64_t delta = timestamp - last;
+    uint32_t slot = __sync_fetch_and_add(&head, 1);
+    intervals[slot % TRACE_DEPTH] = delta > 0xFFFFFFFFu ? 0xFFFFFFFFu : uint32_t(delta);
+}
+
+void PacingAnalyzer::Trace::describe(Value &object, Allocator &alloc, uint64_t now) const
+{
+    uint32_t count = head;
+    uint64_t last = lastTimestamp;
+
+    object.AddMember("intervals_total", count, alloc);
+    object.AddMember("last_frame_age_usec",
+        (last && now > last) ? now - last : (uint64_t)0, alloc);
+
+    /*
+     * The interval ring, oldest to newest. Readout isn't synchronized
+     * against recording; the worst case is one stale slot, which a
+     * timeline view can tolerate.
+     */
+    rapidjson::Value ring(rapidjson::kArrayType);
+    uint32_t n = count < TRACE_DEPTH ? count : TRACE_DEPTH;
+    uint32_t start = count - n;
+    for (uint32_t i = 0; i < n; i++) {
+        rapidjson::Value interval(intervals[(start + i) % TRACE_DEPTH]);
+        ring.PushBack(interval, alloc);
+    }
+    object.AddMember("intervals_usec", ring, alloc);
+}
+
+void PacingAnalyzer::describeChannels(Value &list, Allocator &alloc, uint64_t now) const
+{
+    unsigned n = 0;
+    for (unsigned c = 0; c < NUM_CHANNELS; c++) {
+        const Trace &trace = mChannels[c];
+        if (!trace.lastTimestamp) {
+            continue;
+        }
+
+        list.PushBack(rapidjson::kObjectType, alloc);
+        Value &entry = list[n++];
+        entry.AddMember("channel", c, alloc);
+        trace.describe(entry, alloc, now);
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * Frame pacing analyzer, feeding the web UI's timeline view.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include "rapidjson/document.h"
+#include <stdint.h>
+
+
+/*
+ * PacingAnalyzer keeps short traces of inter-frame intervals: per OPC
+ * channel as messages arrive at dispatch, and per device as frames are
+ * handed to the output transport. Lining the two up on a timeline tells
+ * client-side stutter apart from server queueing and from output stalls.
+ *
+ * Recording is lock-free and sized for the streaming fast path; the
+ * traces are read out by the pacing_info WebSocket message.
+ */
+
+class PacingAnalyzer
+{
+public:
+    typedef rapidjson::Value Value;
+    typedef rapidjson::MemoryPoolAllocator<> Allocator;
+
+    static const unsigned TRACE_DEPTH = 64;
+
+    /*
+     * One pacing trace: a ring of the most recent inter-frame intervals,
+     * in microseconds with the newest last, plus the arrival time of the
+     * latest frame. record() never blocks. Concurrent recorders can
+     * interleave, each pairing with some prior arrival; that's harmless
+     * in a diagnostic trace.
+     */
+    struct Trace {
+        volatile uint64_t lastTimestamp;
+        volatile uint32_t head;             // Total intervals recorded
+        uint32_t intervals[TRACE_DEPTH];
+
+        void record(uint64_t timestamp);
+        void describe(Value &object, Allocator &alloc, uint64_t now) const;
+    };
+
+    PacingAnalyzer();
+
+    // Record a SetPixelColors arrival; called from the dispatch fast path
+    void recordChannelFrame(unsigned channel, uint64_t timestamp)
+    {
+        mChannels[channel & 0xFF].record(timestamp);
+    }
+
+    // Append one object per channel that has seen traffic to a JSON array
+    void describeChannels(Value &list, Allocator &alloc, uint64_t now) const;
+
+private:
+    static const unsigned NUM_CHANNELS = 256;
+    Trace mChannels[NUM_CHANNELS];
+};
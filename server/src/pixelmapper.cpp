@@ -0,0 +1,331 @@
+/*
+ * Shared OPC mapping engine for Fadecandy device backends.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "pixelmapper.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+#include <iostream>
+#include <string.h>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+
+void PixelMapper::compile(Program &program, const Value *map, bool verbose)
+{
+    program.instructions.clear();
+    program.channels.clear();
+
+    if (map) {
+        for (unsigned i = 0, e = map->Size(); i != e; i++) {
+            if (!compileInstruction(program, (*map)[i]) && verbose) {
+                rapidjson::GenericStringBuffer<rapidjson::UTF8<> > buffer;
+                rapidjson::Writer<rapidjson::GenericStringBuffer<rapidjson::UTF8<> > > writer(buffer);
+                (*map)[i].Accept(writer);
+                std::clog << "Unsupported JSON mapping instruction: " << buffer.GetString() << "\n";
+            }
+        }
+    }
+
+    /*
+     * Build the per-channel index. Sorting by (channel, firstOPC) groups
+     * each channel's instructions into one contiguous span, in a sensible
+     * order for run()'s early-out on short messages. Relative order of
+     * instructions with the same channel and start pixel is preserved.
+     */
+
+    std::stable_sort(program.instructions.begin(), program.instructions.end(), instructionOrder);
+
+    for (unsigned i = 0, e = program.instructions.size(); i != e; i++) {
+        unsigned channel = program.instructions[i].channel;
+        if (program.channels.empty() || program.channels.back().channel != channel) {
+            Program::ChannelSpan span = { channel, i, i + 1 };
+            program.channels.push_back(span);
+        } else {
+            program.channels.back().end = i + 1;
+        }
+    }
+}
+
+bool PixelMapper::instructionOrder(const Instruction &a, const Instruction &b)
+{
+    if (a.channel != b.channel) {
+        return a.channel < b.channel;
+    }
+    return a.firstOPC < b.firstOPC;
+}
+
+bool PixelMapper::compileInstruction(Program &program, const Value &inst)
+{
+    /*
+     * Compile one JSON mapping instruction into an Instruction, appending
+     * it to 'program'. Returns false if the instruction isn't in a format
+     * we support.
+     */
+
+    if (inst.IsArray() && inst.Size() == 6) {
+        // Six-element form: fractional resampling
+        return compileResample(program, inst);
+    }
+
+    if (!inst.IsArray() || (inst.Size() != 4 && inst.Size() != 5)) {
+        return false;
+    }
+
+    const Value &vChannel = inst[0u];
+    const Value &vFirstOPC = inst[1];
+    const Value &vFirstOut = inst[2];
+    const Value &vCount = inst[3];
+
+    if (!vChannel.IsUint() || !vFirstOPC.IsUint() || !vFirstOut.IsUint() || !vCount.IsInt()) {
+        return false;
+    }
+
+    Instruction compiled;
+    compiled.channel = vChannel.GetUint();
+    compiled.firstOPC = vFirstOPC.GetUint();
+    compiled.firstOut = vFirstOut.GetUint();
+    if (vCount.GetInt() >= 0) {
+        compiled.count = vCount.GetInt();
+        compiled.direction = 1;
+    } else {
+        compiled.count = -vCount.GetInt();
+        compiled.direction = -1;
+    }
+    compiled.swizzle[0] = '\0';
+    compiled.byteSwizzle = false;
+    compiled.resample = false;
+    compiled.sourceCount = 0;
+    compiled.tapIndex = 0;
+
+    if (inst.Size() == 5) {
+        // Color channel swizzling. Validate the selectors now, so the
+        // copy loop doesn't need a failure path.
+
+        const Value &vColorChannels = inst[4];
+        if (!vColorChannels.IsString() || vColorChannels.GetStringLength() != 3) {
+            return false;
+        }
+
+        const char *colorChannels = vColorChannels.GetString();
+        uint8_t scratch;
+        static const uint8_t testRGB[3] = { 0, 0, 0 };
+        for (int channel = 0; channel < 3; channel++) {
+            if (!OPC::pickColorChannel(scratch, colorChannels[channel], testRGB)) {
+                return false;
+            }
+            compiled.swizzle[channel] = colorChannels[channel];
+        }
+
+        /*
+         * If every selector is a plain color channel, the whole instruction
+         * is a byte shuffle and runInstruction() can use the vectorized
+         * block kernel. Luminance selectors fall back to pickColorChannel.
+         */
+        compiled.byteSwizzle = true;
+        for (int channel = 0; channel < 3; channel++) {
+            switch (compiled.swizzle[channel]) {
+                case 'r': case 'R':  compiled.shuffle[channel] = 0;  break;
+                case 'g': case 'G':  compiled.shuffle[channel] = 1;  break;
+                case 'b': case 'B':  compiled.shuffle[channel] = 2;  break;
+                default:             compiled.byteSwizzle = false;   break;
+            }
+        }
+    }
+
+    program.instructions.push_back(compiled);
+    return true;
+}
+
+bool PixelMapper::compileResample(Program &program, const Value &inst)
+{
+    /*
+     * Compile the resampling form:
+     *
+     *   [ OPC Channel, First OPC Pixel, Source count, First output pixel, Output count, "resample" ]
+     *
+     * Precomputes a box filter mapping the N source pixels onto the M
+     * outputs: output o covers the fractional source interval
+     * [o*N/M, (o+1)*N/M), and each overlapped source contributes in
+     * proportion to its coverage. The weights land in the shared sparse
+     * tap table as 8.8 fixed point, normalized to sum to exactly 256 per
+     * output so the frame kernel never divides.
+     */
+
+    const Value &vChannel = inst[0u];
+    const Value &vFirstOPC = inst[1];
+    const Value &vSourceCount = inst[2];
+    const Value &vFirstOut = inst[3];
+    const Value &vOutputCount = inst[4];
+    const Value &vKeyword = inst[5];
+
+    if (!vChannel.IsUint() || !vFirstOPC.IsUint() || !vSourceCount.IsUint() ||
+        !vFirstOut.IsUint() || !vOutputCount.IsUint() ||
+        !vKeyword.IsString() || strcmp(vKeyword.GetString(), "resample")) {
+        return false;
+    }
+
+    unsigned sourceCount = vSourceCount.GetUint();
+    unsigned outputCount = vOutputCount.GetUint();
+    if (!sourceCount || !outputCount) {
+        return false;
+    }
+
+    Instruction compiled;
+    compiled.channel = vChannel.GetUint();
+    compiled.firstOPC = vFirstOPC.GetUint();
+    compiled.firstOut = vFirstOut.GetUint();
+    compiled.count = outputCount;
+    compiled.direction = 1;
+    compiled.swizzle[0] = '\0';
+    compiled.byteSwizzle = false;
+    compiled.resample = true;
+    compiled.sourceCount = sourceCount;
+    compiled.tapIndex = program.tapOffsets.empty() ? 0 : program.tapOffsets.size() - 1;
+
+    /*
+     * tapOffsets is shared across instructions, with one trailing sentinel.
+     * The first instruction starts the table; later ones reuse the previous
+     * sentinel as their first offset.
+     */
+    if (program.tapOffsets.empty()) {
+        program.tapOffsets.push_back(0);
+    }
+
+    double scale = double(sourceCount) / outputCount;
+
+    for (unsigned o = 0; o < outputCount; o++) {
+        double s0 = o * scale;
+        double s1 = s0 + scale;
+        unsigned firstTap = program.taps.size();
+
+        for (unsigned j = (unsigned)s0; j < sourceCount && j < s1; j++) {
+            double coverage = std::min<double>(s1, j + 1) - std::max<double>(s0, j);
+            int weight = (int)(coverage / scale * 256.0 + 0.5);
+            if (weight > 0) {
+                Program::ResampleTap tap = { j, (uint16_t)weight };
+                program.taps.push_back(tap);
+            }
+        }
+
+        // Rounding residual goes to the widest tap, keeping the sum at 256
+        unsigned numTaps = program.taps.size() - firstTap;
+        if (numTaps) {
+            int sum = 0;
+            unsigned widest = firstTap;
+            for (unsigned t = firstTap; t != program.taps.size(); t++) {
+                sum += program.taps[t].weight;
+                if (program.taps[t].weight > program.taps[widest].weight) {
+                    widest = t;
+                }
+            }
+            program.taps[widest].weight += 256 - sum;
+        }
+
+        program.tapOffsets.push_back(program.taps.size());
+    }
+
+    program.instructions.push_back(compiled);
+    return true;
+}
+
+bool PixelMapper::findMapChannels(const Value *map, std::set<unsigned> &channels)
+{
+    if (!map) {
+        // No mapping; this device is inactive and listens to no channels.
+        return true;
+    }
+
+    for (unsigned i = 0, e = map->Size(); i != e; i++) {
+        const Value &inst = (*map)[i];
+
+        if (!inst.IsArray() || inst.Size() < 4 || !inst[0u].IsUint()) {
+            return false;
+        }
+        channels.insert(inst[0u].GetUint());
+    }
+
+    return true;
+}
+
+void PixelMapper::programChannels(const Program &program, std::set<unsigned> &channels)
+{
+    for (std::vector<Program::ChannelSpan>::const_iterator i = program.channels.begin(),
+            e = program.channels.end(); i != e; ++i) {
+        channels.insert(i->channel);
+    }
+}
+
+void PixelMapper::swizzleBlock(uint8_t *out, const uint8_t *in, unsigned count, const uint8_t shuffle[3])
+{
+#if defined(__SSSE3__)
+    /*
+     * Shuffle 5 whole pixels (15 bytes) per 16-byte pshufb. The 16th output
+     * byte is garbage, but it's rewritten by the next iteration or by the
+     * scalar tail; we stop vectorizing while at least 6 pixels remain so
+     * the 16-byte load and store both stay in bounds.
+     */
+    uint8_t maskBytes[16];
+    for (unsigned i = 0; i < 5; i++) {
+        maskBytes[i*3 + 0] = i*3 + shuffle[0];
+        maskBytes[i*3 + 1] = i*3 + shuffle[1];
+        maskBytes[i*3 + 2] = i*3 + shuffle[2];
+    }
+    maskBytes[15] = 0x80;
+    __m128i mask = _mm_loadu_si128((const __m128i*) maskBytes);
+
+    while (count >= 6) {
+        __m128i v = _mm_loadu_si128((const __m128i*) in);
+        _mm_storeu_si128((__m128i*) out, _mm_shuffle_epi8(v, mask));
+        in += 15;
+        out += 15;
+        count -= 5;
+    }
+
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+    // De-interleave 8 pixels into r/g/b lanes, reorder the lanes, re-interleave.
+    while (count >= 8) {
+        uint8x8x3_t v = vld3_u8(in);
+        uint8x8x3_t o;
+        o.val[0] = v.val[shuffle[0]];
+        o.val[1] = v.val[shuffle[1]];
+        o.val[2] = v.val[shuffle[2]];
+        vst3_u8(out, o);
+        in += 24;
+        out += 24;
+        count -= 8;
+    }
+#endif
+
+    // Scalar path; also the tail for the vectorized loops above
+    while (count--) {
+        out[0] = in[shuffle[0]];
+        out[1] = in[shuffle[1]];
+        out[2] = in[shuffle[2]];
+        in += 3;
+        out += 3;
+    }
+}
@@ -0,0 +1,378 @@
+/*
+ * Shared OPC mapping engine for Fadecandy device backends.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include "opc.h"
+#include "rapidjson/document.h"
+#include <algorithm>
+#include <vector>
+#include <set>
+#include <stdint.h>
+
+
+/*
+ * PixelMapper interprets the JSON "map" arrays from our config file, in one
+ * place, for every device backend. The JSON is compiled once into a flat
+ * Program of Instructions, and the per-frame hot path runs the Program
+ * against an OPC message without touching rapidjson at all.
+ *
+ * The destination framebuffer is abstracted as a "pixel writer", a small
+ * object passed to run() which provides:
+ *
+ *    unsigned numPixels() const;
+ *    void writePixel(unsigned index, uint8_t r, uint8_t g, uint8_t b);
+ *
+ * Each backend supplies its own writer to handle its native pixel format,
+ * so optimizations to the mapping loop itself benefit all backends at once.
+ */
+
+class PixelMapper
+{
+public:
+    typedef rapidjson::Value Value;
+
+    /*
+     * One JSON mapping instruction, compiled to a flat structure at
+     * configuration time. Supported source formats:
+     *
+     *   [ OPC Channel, First OPC Pixel, First output pixel, Pixel count ]
+     *   [ OPC Channel, First OPC Pixel, First output pixel, Pixel count, Color channels ]
+     *   [ OPC Channel, First OPC Pixel, Source count, First output pixel, Output count, "resample" ]
+     *
+     * The "resample" form maps N source pixels onto M output pixels with a
+     * box filter, so content authored at one strip length drives a strip of
+     * a different length without re-rendering at the client. The per-output
+     * source weights are precomputed here into a sparse fixed-point table;
+     * the per-frame cost is just the weighted accumulation.
+     */
+    struct Instruction {
+        unsigned channel;       // OPC channel this instruction listens on
+        unsigned firstOPC;      // First OPC pixel
+        unsigned firstOut;      // First output pixel
+        unsigned count;         // Number of pixels, always non-negative
+        int direction;          // +1 or -1 output stride
+        char swizzle[3];        // Color channel selectors, or swizzle[0] == '\0' for a plain RGB copy
+        bool byteSwizzle;       // True if 'swizzle' only reorders bytes (no luminance selectors)
+        uint8_t shuffle[3];     // Source byte indices, valid when byteSwizzle
+        bool resample;          // True for the "resample" form; count is the output count
+        unsigned sourceCount;   // Resample: number of source pixels
+        unsigned tapIndex;      // Resample: first output's entry in Program::tapOffsets
+    };
+
+    /*
+     * A compiled mapping. Instructions are sorted by (channel, firstOPC)
+     * and indexed by channel, so the per-frame hot path touches only the
+     * instructions that can match an incoming message.
+     */
+    struct Program {
+        std::vector<Instruction> instructions;
+
+        // One entry per distinct OPC channel: [begin, end) into 'instructions'
+        struct ChannelSpan {
+            unsigned channel;
+            unsigned begin;
+            unsigned end;
+        };
+        std::vector<ChannelSpan> channels;
+
+        /*
+         * Sparse resampling weights, shared by every "resample" instruction.
+         * Output pixel i of an instruction owns taps
+         * [tapOffsets[tapIndex + i], tapOffsets[tapIndex + i + 1]), with
+         * sources ascending. Weights are 8.8 fixed point and sum to 256 per
+         * output, so the accumulated color needs only a shift.
+         */
+        struct ResampleTap {
+            uint32_t source;    // Source pixel, relative to the instruction's firstOPC
+            uint16_t weight;    // 8.8 fixed point
+        };
+        std::vector<ResampleTap> taps;
+        std::vector<uint32_t> tapOffsets;
+    };
+
+    /*
+     * Compile a JSON mapping array into a Program. 'map' may be NULL, which
+     * yields an empty program. Unsupported instructions are reported once,
+     * if 'verbose', rather than once per frame.
+     */
+    static void compile(Program &program, const Value *map, bool verbose);
+
+    /*
+     * Enumerate the OPC channels referenced by a JSON mapping array, for
+     * getOPCChannels() implementations. All of our JSON mapping instruction
+     * formats that reference an OPC channel store it as an unsigned integer
+     * in the first array element. If every instruction follows that pattern,
+     * we can enumerate the channels exactly and return true. If any
+     * instruction doesn't (including unsupported ones), return false and let
+     * the server fall back to broadcasting.
+     */
+    static bool findMapChannels(const Value *map, std::set<unsigned> &channels);
+
+    // Enumerate the OPC channels a compiled Program listens on.
+    static void programChannels(const Program &program, std::set<unsigned> &channels);
+
+    /*
+     * Run a compiled Program against an OPC message, storing any relevant
+     * portion of 'msg' through the pixel writer.
+     */
+    template <typename Writer>
+    static void run(const Program &program, const OPC::Message &msg, Writer &writer)
+    {
+        unsigned msgPixelCount = msg.length() / 3;
+
+        for (std::vector<Program::ChannelSpan>::const_iterator s = program.channels.begin(),
+                se = program.channels.end(); s != se; ++s) {
+            if (s->channel != msg.channel) {
+                continue;
+            }
+
+            for (unsigned i = s->begin; i != s->end; i++) {
+                const Instruction &inst = program.instructions[i];
+                if (inst.firstOPC >= msgPixelCount) {
+                    /*
+                     * This instruction starts past the end of the message,
+                     * so it can't copy anything. Instructions within a span
+                     * are sorted by firstOPC, so neither can any later one.
+                     */
+                    break;
+                }
+                if (inst.resample) {
+                    runResample(program, inst, msg, writer);
+                } else {
+                    runInstruction(inst, msg, writer);
+                }
+            }
+            break;
+        }
+    }
+
+    /*
+     * Run a compiled Program against an FCSetPixelColors16 message. Same
+     * mapping semantics as run(), but the source pixels are six bytes each
+     * (big-endian uint16 R, G, B) starting after the four-byte SysEx ID,
+     * and the writer receives them through writePixel16(). 16-bit sources
+     * are rare enough that this path stays scalar.
+     */
+    template <typename Writer>
+    static void run16(const Program &program, const OPC::Message &msg, Writer &writer)
+    {
+        if (msg.length() < 4) {
+            return;
+        }
+        unsigned msgPixelCount = (msg.length() - 4) / 6;
+
+        for (std::vector<Program::ChannelSpan>::const_iterator s = program.channels.begin(),
+                se = program.channels.end(); s != se; ++s) {
+            if (s->channel != msg.channel) {
+                continue;
+            }
+
+            for (unsigned i = s->begin; i != s->end; i++) {
+                const Instruction &inst = program.instructions[i];
+                if (inst.firstOPC >= msgPixelCount) {
+                    // Sorted by firstOPC; see run()
+                    break;
+                }
+                if (inst.resample) {
+                    // Resampling applies to 8-bit sources only
+                    continue;
+                }
+                runInstruction16(inst, msg, msgPixelCount, writer);
+            }
+            break;
+        }
+    }
+
+    /*
+     * Execute one compiled mapping instruction. The instruction was fully
+     * validated at compile time; only the clamping against this particular
+     * message's length and the writer's framebuffer size happens here.
+     */
+    template <typename Writer>
+    static void runInstruction(const Instruction &inst, const OPC::Message &msg, Writer &writer)
+    {
+        if (inst.channel != msg.channel) {
+            return;
+        }
+
+        unsigned msgPixelCount = msg.length() / 3;
+        unsigned numPixels = writer.numPixels();
+
+        // Clamping, overflow-safe
+        unsigned firstOPC = std::min<unsigned>(inst.firstOPC, msgPixelCount);
+        unsigned firstOut = std::min<unsigned>(inst.firstOut, numPixels);
+        unsigned count = std::min<unsigned>(inst.count, msgPixelCount - firstOPC);
+        count = std::min<unsigned>(count,
+                inst.direction > 0 ? numPixels - firstOut : firstOut + 1);
+
+        const uint8_t *inPtr = msg.data + (firstOPC * 3);
+        unsigned outIndex = firstOut;
+
+        if (inst.swizzle[0] == '\0') {
+            // Plain RGB copy
+            while (count--) {
+                writer.writePixel(outIndex, inPtr[0], inPtr[1], inPtr[2]);
+                outIndex += inst.direction;
+                inPtr += 3;
+            }
+        } else if (inst.byteSwizzle) {
+            /*
+             * Pure color reordering (rgb/grb/bgr and friends). Shuffle one
+             * block of pixels at a time into a scratch buffer, vectorized
+             * where the hardware allows, then hand the reordered bytes to
+             * the writer.
+             */
+            uint8_t scratch[SWIZZLE_BLOCK * 3];
+            while (count) {
+                unsigned n = std::min<unsigned>(count, SWIZZLE_BLOCK);
+                swizzleBlock(scratch, inPtr, n, inst.shuffle);
+
+                const uint8_t *p = scratch;
+                for (unsigned i = 0; i != n; i++) {
+                    writer.writePixel(outIndex, p[0], p[1], p[2]);
+                    outIndex += inst.direction;
+                    p += 3;
+                }
+                inPtr += n * 3;
+                count -= n;
+            }
+        } else {
+            // Luminance ('l') selectors need arithmetic; scalar path
+            while (count--) {
+                uint8_t color[3];
+                OPC::pickColorChannel(color[0], inst.swizzle[0], inPtr);
+                OPC::pickColorChannel(color[1], inst.swizzle[1], inPtr);
+                OPC::pickColorChannel(color[2], inst.swizzle[2], inPtr);
+                writer.writePixel(outIndex, color[0], color[1], color[2]);
+                outIndex += inst.direction;
+                inPtr += 3;
+            }
+        }
+    }
+
+    /*
+     * Execute one compiled "resample" instruction: each output pixel is the
+     * weighted sum of its precomputed source taps. The weights sum to 256,
+     * so a rounded 8.8 accumulate and a shift produce the final color; the
+     * fixed-point loop has no per-frame divisions and vectorizes well.
+     */
+    template <typename Writer>
+    static void runResample(const Program &program, const Instruction &inst,
+        const OPC::Message &msg, Writer &writer)
+    {
+        if (inst.channel != msg.channel) {
+            return;
+        }
+
+        unsigned msgPixelCount = msg.length() / 3;
+        unsigned numPixels = writer.numPixels();
+        const uint8_t *src = msg.data + (inst.firstOPC * 3);
+        unsigned avail = msgPixelCount - inst.firstOPC;     // run() guarantees > 0
+
+        for (unsigned o = 0; o < inst.count; o++) {
+            unsigned outIndex = inst.firstOut + o;
+            if (outIndex >= numPixels) {
+                break;
+            }
+
+            uint32_t begin = program.tapOffsets[inst.tapIndex + o];
+            uint32_t end = program.tapOffsets[inst.tapIndex + o + 1];
+            if (end > begin && program.taps[end - 1].source >= avail) {
+                // This output reads past the end of the message. Taps are
+                // ascending and later outputs only read later sources.
+                break;
+            }
+
+            unsigned r = 128, g = 128, b = 128;
+            for (uint32_t t = begin; t != end; t++) {
+                const Program::ResampleTap &tap = program.taps[t];
+                const uint8_t *p = src + tap.source * 3;
+                r += tap.weight * p[0];
+                g += tap.weight * p[1];
+                b += tap.weight * p[2];
+            }
+            writer.writePixel(outIndex, r >> 8, g >> 8, b >> 8);
+        }
+    }
+
+    // 16-bit counterpart of runInstruction(); sources six-byte pixels
+    template <typename Writer>
+    static void runInstruction16(const Instruction &inst, const OPC::Message &msg,
+        unsigned msgPixelCount, Writer &writer)
+    {
+        if (inst.channel != msg.channel) {
+            return;
+        }
+
+        unsigned numPixels = writer.numPixels();
+
+        // Clamping, overflow-safe
+        unsigned firstOPC = std::min<unsigned>(inst.firstOPC, msgPixelCount);
+        unsigned firstOut = std::min<unsigned>(inst.firstOut, numPixels);
+        unsigned count = std::min<unsigned>(inst.count, msgPixelCount - firstOPC);
+        count = std::min<unsigned>(count,
+                inst.direction > 0 ? numPixels - firstOut : firstOut + 1);
+
+        const uint8_t *inPtr = msg.data + 4 + (firstOPC * 6);
+        unsigned outIndex = firstOut;
+
+        if (inst.swizzle[0] == '\0') {
+            // Plain RGB copy
+            while (count--) {
+                writer.writePixel16(outIndex,
+                    (uint16_t(inPtr[0]) << 8) | inPtr[1],
+                    (uint16_t(inPtr[2]) << 8) | inPtr[3],
+                    (uint16_t(inPtr[4]) << 8) | inPtr[5]);
+                outIndex += inst.direction;
+                inPtr += 6;
+            }
+        } else {
+            // Swizzled; component selection per pixel, luminance included
+            while (count--) {
+                uint16_t color[3];
+                OPC::pickColorChannel16(color[0], inst.swizzle[0], inPtr);
+                OPC::pickColorChannel16(color[1], inst.swizzle[1], inPtr);
+                OPC::pickColorChannel16(color[2], inst.swizzle[2], inPtr);
+                writer.writePixel16(outIndex, color[0], color[1], color[2]);
+                outIndex += inst.direction;
+                inPtr += 6;
+            }
+        }
+    }
+
+private:
+    // Pixels per swizzleBlock() scratch buffer
+    static const unsigned SWIZZLE_BLOCK = 128;
+
+    static bool compileInstruction(Program &program, const Value &inst);
+    static bool compileResample(Program &program, const Value &inst);
+    static bool instructionOrder(const Instruction &a, const Instruction &b);
+
+    /*
+     * Reorder the color bytes of 'count' pixels from 'in' to 'out',
+     * out[3i+k] = in[3i+shuffle[k]]. Uses SSSE3 or NEON byte shuffles when
+     * the compiler targets them. 'in' must have at least 'count' whole
+     * pixels readable, and 'out' must not alias 'in'.
+     */
+    static void swizzleBlock(uint8_t *out, const uint8_t *in, unsigned count, const uint8_t shuffle[3]);
+};
@@ -0,0 +1,170 @@
+/*
+ * Latency probe virtual device.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "probedevice.h"
+#include <string.h>
+#include <iostream>
+#include <sstream>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+#ifdef OS_LINUX
+#include <time.h>
+#endif
+
+
+const char *ProbeDevice::DEVICE_TYPE = "probe";
+
+
+static uint64_t monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+
+ProbeDevice::ProbeDevice(bool verbose)
+    : USBDevice(0, DEVICE_TYPE, verbose),
+      mPort(0), mHasPort(false), mFd(-1),
+      mSequence(0), mEchoesSent(0), mSendErrors(0)
+{}
+
+ProbeDevice::~ProbeDevice()
+{
+    // Stop the output worker; it's the thread that sends echoes.
+    mOutputWorker.stop();
+
+#ifndef _WIN32
+    if (mFd >= 0) {
+        close(mFd);
+    }
+#endif
+}
+
+int ProbeDevice::open()
+{
+#ifdef _WIN32
+    std::clog << "The probe device type is not supported on Windows.\n";
+    return -1;
+#else
+    if (!mHasPort) {
+        std::clog << "Probe device configuration needs a 'port' number.\n";
+        return -1;
+    }
+
+    mFd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (mFd < 0) {
+        std::clog << "Error creating probe socket: " << strerror(errno) << "\n";
+        return -1;
+    }
+
+    /*
+     * Connected UDP socket, so each echo is a plain send(). Nobody needs
+     * to be listening yet; sends just start failing individually, and the
+     * error counter shows up in describe().
+     */
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof addr);
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(mPort);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (connect(mFd, (struct sockaddr *) &addr, sizeof addr) < 0) {
+        std::clog << "Error connecting probe socket: " << strerror(errno) << "\n";
+        close(mFd);
+        mFd = -1;
+        return -1;
+    }
+
+    return 0;
+#endif
+}
+
+void ProbeDevice::loadConfiguration(const Value &config)
+{
+    const Value &vport = config["port"];
+
+    if (vport.IsUint() && vport.GetUint() <= 0xFFFF) {
+        mPort = vport.GetUint();
+        mHasPort = true;
+    } else if (mVerbose) {
+        std::clog << "Probe device configuration needs a 'port' number.\n";
+    }
+}
+
+void ProbeDevice::writeMessage(const OPC::Message &msg)
+{
+#ifndef _WIN32
+    if (mFd < 0) {
+        return;
+    }
+
+    Echo echo;
+    echo.receiveTimestamp = mReceiveTimestamp;
+    echo.echoTimestamp = monotonicMicroseconds();
+    echo.sequence = mSequence++;
+    echo.channel = msg.channel;
+    echo.command = msg.command;
+    echo.length = msg.length();
+
+    if (send(mFd, &echo, sizeof echo, 0) < 0) {
+        mSendErrors++;
+    } else {
+        mEchoesSent++;
+    }
+#endif
+}
+
+std::string ProbeDevice::getName()
+{
+    std::ostringstream s;
+    s << "Latency probe (UDP port " << mPort << ")";
+    return s.str();
+}
+
+void ProbeDevice::flush()
+{
+    // Echoes are sent as messages arrive; nothing is buffered here.
+}
+
+void ProbeDevice::describe(rapidjson::Value &object, Allocator &alloc)
+{
+    USBDevice::describe(object, alloc);
+
+    object.AddMember("port", mPort, alloc);
+    object.AddMember("echoes_sent", mEchoesSent, alloc);
+    object.AddMember("send_errors", mSendErrors, alloc);
+}
@@ -0,0 +1,77 @@
+/*
+ * Latency probe virtual device.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include "usbdevice.h"
+#include <string>
+
+
+/*
+ * ProbeDevice measures intra-server latency with no hardware attached.
+ * It sits in the unrouted list, so it sees every dispatched message, and
+ * echoes one small UDP datagram per message to a local listener:
+ *
+ *   { "type": "probe", "port": 7891 }
+ *
+ * The echo carries the transport receive timestamp and the probe's own
+ * send timestamp, both CLOCK_MONOTONIC microseconds; their difference is
+ * the time a message spent in dispatch and this device's delivery queue.
+ * A measurement client on the same machine can also compare against its
+ * own monotonic send time for an end-to-end figure. Fields are
+ * host-endian.
+ */
+
+class ProbeDevice : public USBDevice
+{
+public:
+    static const char *DEVICE_TYPE;
+
+    // Datagram sent to 127.0.0.1:<port> for every message received
+    struct Echo {
+        uint64_t receiveTimestamp;  // Transport receive time, monotonic us
+        uint64_t echoTimestamp;     // Time this echo was sent, monotonic us
+        uint32_t sequence;          // Counts echoes, for loss detection
+        uint8_t channel;            // OPC header of the message measured
+        uint8_t command;
+        uint16_t length;
+    };
+
+    ProbeDevice(bool verbose);
+    virtual ~ProbeDevice();
+
+    virtual int open();
+    virtual void loadConfiguration(const Value &config);
+    virtual void writeMessage(const OPC::Message &msg);
+    virtual std::string getName();
+    virtual void flush();
+    virtual void describe(rapidjson::Value &object, Allocator &alloc);
+
+private:
+    uint32_t mPort;
+    bool mHasPort;
+    int mFd;
+
+    uint32_t mSequence;
+    uint64_t mEchoesSent;
+    uint64_t mSendErrors;
+};
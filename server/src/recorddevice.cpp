@@ -0,0 +1,239 @@
+/*
+ * OPC stream recorder, presented to the server as a device.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "recorddevice.h"
+#include <string.h>
+#include <iostream>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+#ifdef OS_LINUX
+#include <time.h>
+#endif
+
+
+const char *RecordDevice::DEVICE_TYPE = "record";
+
+// One growth chunk: the span of file we keep mapped at a time
+static const size_t CHUNK_BYTES =
+    (size_t)RecordFile::GROW_BLOCKS * RecordFile::BLOCK_BYTES;
+
+
+static uint64_t monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+
+RecordDevice::RecordDevice(bool verbose)
+    : USBDevice(0, DEVICE_TYPE, verbose),
+      mFd(-1), mChunk(0), mChunkFirstBlock(0), mFileBlocks(0),
+      mBlock(0), mBlockUsed(0), mFailed(false),
+      mMessagesRecorded(0), mBytesRecorded(0)
+{}
+
+RecordDevice::~RecordDevice()
+{
+    // Stop the output worker; it's the thread that appends records.
+    mOutputWorker.stop();
+
+#ifndef _WIN32
+    if (mChunk) {
+        munmap(mChunk, CHUNK_BYTES);
+    }
+    if (mFd >= 0) {
+        // Trim the unused tail of the final growth chunk
+        if (ftruncate(mFd, (mBlock + 1) * (uint64_t)RecordFile::BLOCK_BYTES) < 0) {
+            // The capture is still valid, just padded with empty blocks
+        }
+        close(mFd);
+    }
+#endif
+}
+
+int RecordDevice::open()
+{
+#ifdef _WIN32
+    std::clog << "The record device type is not supported on Windows.\n";
+    return -1;
+#else
+    if (mPath.empty()) {
+        std::clog << "Record device configuration needs a 'file' string.\n";
+        return -1;
+    }
+
+    mFd = ::open(mPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666);
+    if (mFd < 0) {
+        std::clog << "Error creating capture file " << mPath
+            << ": " << strerror(errno) << "\n";
+        return -1;
+    }
+
+    if (!advanceBlock()) {
+        close(mFd);
+        mFd = -1;
+        return -1;
+    }
+
+    // Block 0 holds the file header and nothing else
+    RecordFile::FileHeader *header = (RecordFile::FileHeader *) mChunk;
+    memcpy(header->magic, RecordFile::MAGIC, sizeof RecordFile::MAGIC);
+    header->version = RecordFile::VERSION;
+    header->blockBytes = RecordFile::BLOCK_BYTES;
+    header->startedAt = monotonicMicroseconds();
+
+    return 0;
+#endif
+}
+
+void RecordDevice::loadConfiguration(const Value &config)
+{
+    const Value &vfile = config["file"];
+
+    if (vfile.IsString()) {
+        if (mPath.empty()) {
+            mPath = vfile.GetString();
+        } else if (mPath != vfile.GetString() && mVerbose) {
+            std::clog << "Changing a record device's file requires a restart.\n";
+        }
+    } else if (mVerbose) {
+        std::clog << "Record device configuration needs a 'file' string.\n";
+    }
+}
+
+RecordFile::BlockHeader *RecordDevice::cursorBlockHeader()
+{
+    return (RecordFile::BlockHeader *)
+        &mChunk[(size_t)(mBlock - mChunkFirstBlock) * RecordFile::BLOCK_BYTES];
+}
+
+bool RecordDevice::advanceBlock()
+{
+#ifdef _WIN32
+    return false;
+#else
+    mBlock = mChunk ? mBlock + 1 : 1;
+    mBlockUsed = 0;
+
+    if (mBlock < mFileBlocks) {
+        // Still inside the mapped chunk
+        return true;
+    }
+
+    /*
+     * Grow the file by one chunk and map it, retiring the old mapping;
+     * finished blocks are never touched again. This is the only syscall
+     * path in the writer, taken once per CHUNK_BYTES of capture.
+     */
+
+    uint64_t offset = mFileBlocks * (uint64_t)RecordFile::BLOCK_BYTES;
+    if (ftruncate(mFd, offset + CHUNK_BYTES) < 0) {
+        std::clog << "Error growing capture file " << mPath
+            << ": " << strerror(errno) << "; recording stopped.\n";
+        return false;
+    }
+
+    void *mapping = mmap(0, CHUNK_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, offset);
+    if (mapping == MAP_FAILED) {
+        std::clog << "Error mapping capture file " << mPath
+            << ": " << strerror(errno) << "; recording stopped.\n";
+        return false;
+    }
+
+    if (mChunk) {
+        munmap(mChunk, CHUNK_BYTES);
+    }
+    mChunk = (uint8_t *) mapping;
+    mChunkFirstBlock = mFileBlocks;
+    mFileBlocks += RecordFile::GROW_BLOCKS;
+    return true;
+#endif
+}
+
+void RecordDevice::writeMessage(const OPC::Message &msg)
+{
+    if (mFailed || !mChunk) {
+        return;
+    }
+
+    // Transport receive time; transports that don't timestamp get append time
+    uint64_t timestamp = mReceiveTimestamp ? mReceiveTimestamp : monotonicMicroseconds();
+
+    size_t need = RecordFile::recordBytes(msg.length());
+    if (mBlockUsed + need > RecordFile::BLOCK_BYTES - sizeof(RecordFile::BlockHeader)) {
+        if (!advanceBlock()) {
+            mFailed = true;
+            return;
+        }
+    }
+
+    RecordFile::BlockHeader *bh = cursorBlockHeader();
+    uint8_t *record = (uint8_t *)(bh + 1) + mBlockUsed;
+    memcpy(record, &timestamp, RecordFile::RECORD_TIMESTAMP_BYTES);
+    memcpy(record + RecordFile::RECORD_TIMESTAMP_BYTES, &msg,
+        OPC::HEADER_BYTES + msg.length());
+
+    if (!bh->messageCount) {
+        bh->firstTimestamp = timestamp;
+    }
+    bh->messageCount++;
+    mBlockUsed += need;
+    bh->bytesUsed = mBlockUsed;
+
+    mMessagesRecorded++;
+    mBytesRecorded += need;
+}
+
+std::string RecordDevice::getName()
+{
+    return "OPC stream recorder (" + mPath + ")";
+}
+
+void RecordDevice::flush()
+{
+    // Nothing to do; the kernel writes dirty capture pages back on its own.
+}
+
+void RecordDevice::describe(rapidjson::Value &object, Allocator &alloc)
+{
+    USBDevice::describe(object, alloc);
+
+    rapidjson::Value file(mPath.c_str(), mPath.length(), alloc);
+    object.AddMember("file", file, alloc);
+    object.AddMember("messages_recorded", mMessagesRecorded, alloc);
+    object.AddMember("bytes_recorded", mBytesRecorded, alloc);
+}
@@ -0,0 +1,80 @@
+/*
+ * OPC stream recorder, presented to the server as a device.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include "usbdevice.h"
+#include "recordfile.h"
+#include <string>
+
+
+/*
+ * RecordDevice captures the OPC stream to a file, for replay through
+ * fcserver-bench and for postmortem analysis of what a client actually
+ * sent. Configured like any other device:
+ *
+ *   { "type": "record", "file": "/tmp/capture.fcrec" }
+ *
+ * It enumerates no channels, so it sits in the unrouted list and sees
+ * every dispatched message, each stamped with its transport receive time.
+ * Appends happen on the recorder's own output worker thread, into an
+ * mmap-grown capture file (format in recordfile.h), so recording adds no
+ * per-message heap allocation or syscall and no latency on the dispatch
+ * path or the other devices.
+ */
+
+class RecordDevice : public USBDevice
+{
+public:
+    static const char *DEVICE_TYPE;
+
+    RecordDevice(bool verbose);
+    virtual ~RecordDevice();
+
+    virtual int open();
+    virtual void loadConfiguration(const Value &config);
+    virtual void writeMessage(const OPC::Message &msg);
+    virtual std::string getName();
+    virtual void flush();
+    virtual void describe(rapidjson::Value &object, Allocator &alloc);
+
+private:
+    std::string mPath;
+    int mFd;
+
+    /*
+     * The writer maps one growth chunk at a time and retires the mapping
+     * when it's full; finished blocks are never touched again.
+     */
+    uint8_t *mChunk;                // Mapped span of the file, or 0
+    uint64_t mChunkFirstBlock;      // File block index of mChunk's first block
+    uint64_t mFileBlocks;           // Current file size, in blocks
+    uint64_t mBlock;                // Block the cursor is in
+    uint32_t mBlockUsed;            // Record bytes used in the cursor block
+    bool mFailed;                   // A grow failed; recording has stopped
+
+    uint64_t mMessagesRecorded;
+    uint64_t mBytesRecorded;
+
+    RecordFile::BlockHeader *cursorBlockHeader();
+    bool advanceBlock();
+};
@@ -0,0 +1,153 @@
+/*
+ * On-disk format and reader for OPC stream captures.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "recordfile.h"
+#include <string.h>
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+
+RecordFile::Reader::Reader()
+    : mData(0), mSize(0), mMessageCount(0), mNumBlocks(0), mBlock(1), mOffset(0)
+{}
+
+RecordFile::Reader::~Reader()
+{
+#ifndef _WIN32
+    if (mData) {
+        munmap(mData, mSize);
+    }
+#endif
+}
+
+bool RecordFile::Reader::probe(const char *path)
+{
+    char magic[sizeof MAGIC];
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return false;
+    }
+    bool match = fread(magic, 1, sizeof magic, f) == sizeof magic &&
+        !memcmp(magic, MAGIC, sizeof magic);
+    fclose(f);
+    return match;
+}
+
+bool RecordFile::Reader::open(const char *path)
+{
+#ifdef _WIN32
+    fprintf(stderr, "Capture files are not supported on Windows.\n");
+    return false;
+#else
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error opening capture %s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < BLOCK_BYTES) {
+        fprintf(stderr, "Capture %s is too short to hold a header\n", path);
+        ::close(fd);
+        return false;
+    }
+    mSize = st.st_size;
+
+    /*
+     * Private copy-on-write mapping: replay code is free to pass records
+     * through interfaces that take OPC::Message by non-const reference.
+     */
+    void *mapping = mmap(0, mSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        fprintf(stderr, "Error mapping capture %s: %s\n", path, strerror(errno));
+        mSize = 0;
+        return false;
+    }
+    mData = (uint8_t *) mapping;
+
+    const FileHeader *header = (const FileHeader *) mData;
+    if (memcmp(header->magic, MAGIC, sizeof MAGIC) ||
+        header->version != VERSION || header->blockBytes != BLOCK_BYTES) {
+        fprintf(stderr, "%s is not a version %u capture file\n", path, VERSION);
+        munmap(mData, mSize);
+        mData = 0;
+        mSize = 0;
+        return false;
+    }
+
+    // The block headers double as the message index; total them up front.
+    mNumBlocks = mSize / BLOCK_BYTES;
+    mMessageCount = 0;
+    for (unsigned i = 1; i < mNumBlocks; i++) {
+        mMessageCount += blockHeader(i)->messageCount;
+    }
+
+    rewind();
+    return true;
+#endif
+}
+
+bool RecordFile::Reader::next(uint64_t &timestamp, OPC::Message *&msg)
+{
+    while (mBlock < mNumBlocks) {
+        const BlockHeader *bh = blockHeader(mBlock);
+        if (mOffset >= bh->bytesUsed) {
+            mBlock++;
+            mOffset = 0;
+            continue;
+        }
+
+        uint8_t *record = &mData[(size_t)mBlock * BLOCK_BYTES + sizeof(BlockHeader) + mOffset];
+        memcpy(&timestamp, record, RECORD_TIMESTAMP_BYTES);
+        msg = (OPC::Message *) (record + RECORD_TIMESTAMP_BYTES);
+        mOffset += recordBytes(msg->length());
+        return true;
+    }
+    return false;
+}
+
+void RecordFile::Reader::rewind()
+{
+    mBlock = 1;
+    mOffset = 0;
+}
+
+void RecordFile::Reader::seekToTime(uint64_t timestamp)
+{
+    rewind();
+    while (mBlock + 1 < mNumBlocks) {
+        const BlockHeader *nextBlock = blockHeader(mBlock + 1);
+        if (!nextBlock->messageCount || nextBlock->firstTimestamp > timestamp) {
+            break;
+        }
+        mBlock++;
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ * On-disk format and reader for OPC stream captures.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "opc.h"
+
+/*
+ * Capture files are written by RecordDevice and read back by the replay
+ * benchmark and offline analysis tools.
+ *
+ * The file is a sequence of fixed-size blocks. Block 0 begins with the
+ * FileHeader; every later block begins with a BlockHeader followed by
+ * records, each a monotonic microsecond timestamp and one raw OPC message,
+ * padded to a 4-byte boundary. A record never spans blocks, and the file
+ * is grown and filled through a shared mapping, so the writer performs no
+ * per-message syscall and a crash leaves at worst one partial record,
+ * which the trailing zero padding of its block makes detectable.
+ *
+ * The per-block headers are the index: a reader seeking a time range skips
+ * whole blocks on their first timestamp without touching their records.
+ * All fields are host-endian; captures are analyzed on the architecture
+ * that wrote them.
+ */
+
+namespace RecordFile {
+
+    static const char MAGIC[8] = { 'F', 'C', 'O', 'P', 'C', 'R', 'E', 'C' };
+    static const uint32_t VERSION = 1;
+
+    // Large enough that a maximum-length OPC message fits in one block
+    static const uint32_t BLOCK_BYTES = 128 * 1024;
+
+    // File growth granularity, in blocks (16 MB)
+    static const uint32_t GROW_BLOCKS = 128;
+
+    struct FileHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t blockBytes;
+        uint64_t startedAt;         // Monotonic microseconds when recording began
+        uint8_t reserved[40];       // Zero; rounds the header to 64 bytes
+    };
+
+    struct BlockHeader {
+        uint64_t firstTimestamp;    // Timestamp of the first record, or 0 while empty
+        uint32_t bytesUsed;         // Record bytes following this header
+        uint32_t messageCount;      // Records in this block
+    };
+
+    static const unsigned RECORD_TIMESTAMP_BYTES = 8;
+
+    // Bytes one record occupies in a block, padding included
+    inline size_t recordBytes(unsigned messageLength)
+    {
+        return (RECORD_TIMESTAMP_BYTES + OPC::HEADER_BYTES + messageLength + 3) & ~(size_t)3;
+    }
+
+    /*
+     * Sequential reader over a capture file. The file is mapped
+     * copy-on-write, so callers may hand the returned messages to code
+     * that takes them non-const without touching the file on disk.
+     */
+    class Reader {
+    public:
+        Reader();
+        ~Reader();
+
+        // Does this file start with a capture header?
+        static bool probe(const char *path);
+
+        // Map the capture. Returns false, with a message on stderr, if the
+        // file can't be mapped or isn't a capture.
+        bool open(const char *path);
+
+        uint64_t messageCount() const { return mMessageCount; }
+
+        // Step the cursor. Returns false at end of capture; the message
+        // pointer stays valid until the Reader is destroyed.
+        bool next(uint64_t &timestamp, OPC::Message *&msg);
+
+        // Rewind the cursor to the first record
+        void rewind();
+
+        // Position the cursor on the first block whose records start at or
+        // after 'timestamp'. Block-index granularity: a few earlier records
+        // from within that block's predecessor are never returned, a few
+        // from the chosen block may precede 'timestamp'.
+        void seekToTime(uint64_t timestamp);
+
+    private:
+        uint8_t *mData;
+        size_t mSize;
+        uint64_t mMessageCount;
+        unsigned mNumBlocks;
+        unsigned mBlock;            // Cursor: block index, starting at 1
+        uint32_t mOffset;           // Cursor: record offset within the block
+
+        const BlockHeader *blockHeader(unsigned index) const {
+            return (const BlockHeader *) &mData[(size_t)index * BLOCK_BYTES];
+        }
+    };
+}
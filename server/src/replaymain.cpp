@@ -0,0 +1,318 @@
+/*
+ * Replay tool: streams a recorded OPC capture to a server.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * fcserver-replay streams a RecordDevice capture to any OPC server over
+ * TCP, reproducing the original message timing — so last year's show
+ * content can load-test a new rig before the LEDs are mounted. The pacing
+ * can be scaled, replaced with a maximum-rate firehose, grouped into
+ * synthetic bursts, or thinned by a deterministic message drop, to probe
+ * how a server behaves under clients worse than the one recorded.
+ *
+ * usage: fcserver-replay [options] <capture.fcrec> [host] [port]
+ *
+ *   -s SPEED   playback speed multiplier (default 1.0)
+ *   -f         firehose: ignore timestamps, send at maximum rate
+ *   -b COUNT   send messages in back-to-back bursts of COUNT, pacing
+ *              only between bursts
+ *   -d PERCENT drop PERCENT of messages, chosen by a fixed-seed PRNG so
+ *              every run drops the same ones
+ *   -l COUNT   play the capture COUNT times (0 = until interrupted)
+ *
+ * Host and port default to 127.0.0.1 7890. Every run with the same
+ * options sends the same byte stream; only the pacing depends on the
+ * machine.
+ */
+
+#include "recordfile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/time.h>
+#endif
+
+
+#ifndef _WIN32
+
+static uint64_t monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+static void sleepUntil(uint64_t deadline)
+{
+    uint64_t now = monotonicMicroseconds();
+    if (deadline <= now) {
+        return;
+    }
+    uint64_t us = deadline - now;
+    struct timespec ts;
+    ts.tv_sec = us / 1000000;
+    ts.tv_nsec = (us % 1000000) * 1000;
+    nanosleep(&ts, 0);
+}
+
+// Fixed-seed PRNG for the drop decision, so replays are repeatable
+static uint64_t gRandomState = 0x853c49e6748fea9bULL;
+
+static unsigned randomPermille()
+{
+    gRandomState = gRandomState * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (unsigned)((gRandomState >> 33) % 1000);
+}
+
+static bool sendAll(int fd, const uint8_t *data, size_t length)
+{
+    while (length) {
+        ssize_t sent = send(fd, data, length, 0);
+        if (sent <= 0) {
+            if (sent < 0 && errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += sent;
+        length -= sent;
+    }
+    return true;
+}
+
+static int connectTo(const char *host, const char *port)
+{
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof hints);
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    struct addrinfo *info;
+    int err = getaddrinfo(host, port, &hints, &info);
+    if (err) {
+        fprintf(stderr, "Error resolving %s: %s\n", host, gai_strerror(err));
+        return -1;
+    }
+
+    int fd = -1;
+    for (struct addrinfo *i = info; i; i = i->ai_next) {
+        fd = socket(i->ai_family, i->ai_socktype, i->ai_protocol);
+        if (fd < 0) {
+            continue;
+        }
+        if (!connect(fd, i->ai_addr, i->ai_addrlen)) {
+            break;
+        }
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(info);
+
+    if (fd < 0) {
+        fprintf(stderr, "Error connecting to %s:%s: %s\n", host, port, strerror(errno));
+        return -1;
+    }
+
+    // The capture's pacing is the point; don't let Nagle re-batch it.
+    int flag = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof flag);
+
+    return fd;
+}
+
+#endif  // !_WIN32
+
+
+static void usage()
+{
+    fprintf(stderr,
+        "usage: fcserver-replay [options] <capture.fcrec> [host] [port]\n"
+        "  -s SPEED   playback speed multiplier (default 1.0)\n"
+        "  -f         firehose: ignore timestamps, send at maximum rate\n"
+        "  -b COUNT   send back-to-back bursts of COUNT messages\n"
+        "  -d PERCENT drop PERCENT of messages, deterministically\n"
+        "  -l COUNT   play the capture COUNT times (0 = until interrupted)\n");
+}
+
+int main(int argc, char **argv)
+{
+#ifdef _WIN32
+    fprintf(stderr, "fcserver-replay is not supported on Windows.\n");
+    return 1;
+#else
+    double speed = 1.0;
+    bool firehose = false;
+    unsigned burst = 1;
+    unsigned dropPermille = 0;
+    unsigned loops = 1;
+    const char *capturePath = 0;
+    const char *host = "127.0.0.1";
+    const char *port = "7890";
+
+    int positional = 0;
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (!strcmp(arg, "-s") && i + 1 < argc) {
+            speed = strtod(argv[++i], 0);
+            if (speed <= 0) {
+                fprintf(stderr, "Speed must be positive\n");
+                return 1;
+            }
+        } else if (!strcmp(arg, "-f")) {
+            firehose = true;
+        } else if (!strcmp(arg, "-b") && i + 1 < argc) {
+            burst = strtoul(argv[++i], 0, 10);
+            if (!burst) {
+                burst = 1;
+            }
+        } else if (!strcmp(arg, "-d") && i + 1 < argc) {
+            double percent = strtod(argv[++i], 0);
+            if (percent < 0 || percent > 100) {
+                fprintf(stderr, "Drop percentage must be between 0 and 100\n");
+                return 1;
+            }
+            dropPermille = (unsigned)(percent * 10 + 0.5);
+        } else if (!strcmp(arg, "-l") && i + 1 < argc) {
+            loops = strtoul(argv[++i], 0, 10);
+        } else if (arg[0] == '-' && arg[1]) {
+            usage();
+            return 1;
+        } else {
+            switch (positional++) {
+                case 0: capturePath = arg; break;
+                case 1: host = arg; break;
+                case 2: port = arg; break;
+                default: usage(); return 1;
+            }
+        }
+    }
+
+    if (!capturePath) {
+        usage();
+        return 1;
+    }
+
+    RecordFile::Reader capture;
+    if (!capture.open(capturePath)) {
+        return 2;
+    }
+    if (!capture.messageCount()) {
+        fprintf(stderr, "Capture holds no messages.\n");
+        return 2;
+    }
+
+    int fd = connectTo(host, port);
+    if (fd < 0) {
+        return 3;
+    }
+
+    fprintf(stderr, "Replaying %llu message(s) to %s:%s",
+        (unsigned long long) capture.messageCount(), host, port);
+    if (firehose) {
+        fprintf(stderr, " at maximum rate");
+    } else if (speed != 1.0) {
+        fprintf(stderr, " at %gx speed", speed);
+    }
+    fprintf(stderr, "...\n");
+
+    uint64_t sentMessages = 0;
+    uint64_t sentBytes = 0;
+    uint64_t droppedMessages = 0;
+    uint64_t started = monotonicMicroseconds();
+
+    for (unsigned loop = 0; !loops || loop < loops; loop++) {
+        capture.rewind();
+
+        /*
+         * Pace each burst by its first message: send time is the stream
+         * start plus the message's offset into the capture, scaled by the
+         * speed factor. Sleeping toward absolute deadlines keeps the
+         * schedule from drifting, and on underrun (a burst that took
+         * longer to send than its slot) the replay runs late rather than
+         * compressing the remaining intervals.
+         */
+
+        uint64_t timestamp;
+        OPC::Message *msg;
+        uint64_t baseTimestamp = 0;
+        uint64_t loopStarted = monotonicMicroseconds();
+        unsigned inBurst = 0;
+
+        while (capture.next(timestamp, msg)) {
+            if (!baseTimestamp) {
+                baseTimestamp = timestamp;
+            }
+
+            if (dropPermille && randomPermille() < dropPermille) {
+                droppedMessages++;
+                continue;
+            }
+
+            if (!firehose && inBurst == 0) {
+                uint64_t offset = (uint64_t)((timestamp - baseTimestamp) / speed);
+                sleepUntil(loopStarted + offset);
+            }
+            if (++inBurst >= burst) {
+                inBurst = 0;
+            }
+
+            size_t length = OPC::HEADER_BYTES + msg->length();
+            if (!sendAll(fd, (const uint8_t *) msg, length)) {
+                fprintf(stderr, "Error sending to %s:%s: %s\n", host, port, strerror(errno));
+                close(fd);
+                return 3;
+            }
+            sentMessages++;
+            sentBytes += length;
+        }
+    }
+
+    uint64_t elapsed = monotonicMicroseconds() - started;
+    close(fd);
+
+    fprintf(stderr, "Sent %llu message(s), %llu bytes in %.3f s (%.0f msg/s)",
+        (unsigned long long) sentMessages, (unsigned long long) sentBytes,
+        elapsed / 1e6, sentMessages * 1e6 / (elapsed ? elapsed : 1));
+    if (droppedMessages) {
+        fprintf(stderr, ", dropped %llu", (unsigned long long) droppedMessages);
+    }
+    fprintf(stderr, "\n");
+
+    return 0;
+#endif
+}
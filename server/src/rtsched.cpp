@@ -0,0 +1,107 @@
+/*
+ * Optional real-time scheduling for latency-sensitive threads.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "rtsched.h"
+#include <iostream>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+int RtSched::sPriority = 0;
+std::map<std::string, std::vector<int> > RtSched::sThreadCpus;
+
+
+bool RtSched::enable(int priority)
+{
+    sPriority = priority;
+
+    /*
+     * Lock everything we've already mapped and everything we'll map later,
+     * so framebuffers and transfer pools allocated at device attach time
+     * are covered too. The per-device buffers are written in full during
+     * initialization, which faults their pages in while we're not yet on
+     * the frame path.
+     */
+
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) < 0) {
+        std::clog << "Error locking memory for real-time mode: "
+            << strerror(errno) << " (try raising RLIMIT_MEMLOCK, or run as root)\n";
+        return false;
+    }
+
+    return true;
+}
+
+void RtSched::setThreadCpus(const char *name, const std::vector<int> &cpus)
+{
+    sThreadCpus[name] = cpus;
+}
+
+void RtSched::applyToCurrentThread(const char *name)
+{
+    placeCurrentThread(name);
+
+    if (!sPriority) {
+        return;
+    }
+
+    struct sched_param param;
+    memset(&param, 0, sizeof param);
+    param.sched_priority = sPriority;
+
+    int err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (err) {
+        // Report per thread; this is a one-time event at thread start
+        std::clog << "Error setting SCHED_FIFO priority " << sPriority
+            << ": " << strerror(err) << "\n";
+    }
+}
+
+void RtSched::placeCurrentThread(const char *name)
+{
+    std::map<std::string, std::vector<int> >::const_iterator iter = sThreadCpus.find(name);
+    if (iter == sThreadCpus.end()) {
+        return;
+    }
+
+#ifdef OS_LINUX
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (std::vector<int>::const_iterator cpu = iter->second.begin(),
+            e = iter->second.end(); cpu != e; ++cpu) {
+        CPU_SET(*cpu, &set);
+    }
+
+    int err = pthread_setaffinity_np(pthread_self(), sizeof set, &set);
+    if (err) {
+        // Report per thread; this is a one-time event at thread start
+        std::clog << "Error setting CPU affinity for thread '" << name
+            << "': " << strerror(err) << "\n";
+    }
+#else
+    std::clog << "CPU affinity for thread '" << name
+        << "' ignored; not supported on this platform\n";
+#endif
+}
@@ -0,0 +1,78 @@
+/*
+ * Optional real-time scheduling for latency-sensitive threads.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include <map>
+#include <string>
+#include <vector>
+
+
+/*
+ * On a loaded system, frame jitter mostly comes from two places: fcserver
+ * threads losing the CPU to ordinary time-sharing processes, and cold or
+ * reclaimed pages faulting in the middle of a frame. The optional
+ * "rtPriority" configuration key addresses both: it locks the process's
+ * memory so nothing pages out, and runs the USB event loop and the device
+ * writer threads under SCHED_FIFO, ahead of everything time-shared.
+ *
+ * RtSched::enable() is called once at startup if the option is set; each
+ * latency-sensitive thread then calls applyToCurrentThread() as it starts.
+ * Threads that only do background work, like the logger, stay time-shared.
+ *
+ * The optional "threads" configuration section additionally pins named
+ * threads to CPU sets, so ingest and output work can be placed on separate
+ * cores. Names: "usb" (the libusb event loop), "net" (TCP service shards),
+ * "relay" (the relay service thread), "output" (per-device writer threads),
+ * "spi" and "dmx" (the APA102 and Enttec writer loops), and "tasks" (the
+ * shared task pool workers). Pinning is
+ * independent of "rtPriority"; network threads keep normal scheduling even
+ * when pinned.
+ */
+
+class RtSched
+{
+public:
+    /*
+     * Record the configured SCHED_FIFO priority (1..99) and lock current
+     * and future memory. Returns false, with an explanation on the log,
+     * if memory locking is refused; scheduling failures are reported per
+     * thread instead, since permissions are checked on each call.
+     */
+    static bool enable(int priority);
+
+    // Record a CPU set for the named thread, from the "threads" config
+    // section. Called before any of the affected threads start.
+    static void setThreadCpus(const char *name, const std::vector<int> &cpus);
+
+    // Move the calling thread to SCHED_FIFO at the configured priority
+    // and pin it to its configured CPU set. Either half does nothing when
+    // the corresponding option isn't configured.
+    static void applyToCurrentThread(const char *name);
+
+    // Pin only. For threads that should be placed but stay time-shared.
+    static void placeCurrentThread(const char *name);
+
+private:
+    static int sPriority;
+    static std::map<std::string, std::vector<int> > sThreadCpus;
+};
@@ -0,0 +1,80 @@
+/*
+ * Sequence lock for lock-free snapshots of writer-owned buffers.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "spscqueue.h"      // For SPSC_MEMORY_BARRIER()
+
+
+/*
+ * Seqlock: lets an occasional reader take a consistent copy of a buffer
+ * that one writer updates continuously, without the writer ever taking a
+ * lock. The writer brackets each update with writeBegin()/writeEnd() --
+ * two counter increments, nothing more -- leaving the counter odd while
+ * an update is in progress. A reader copies the buffer between
+ * readBegin() and readRetry(), and repeats the copy if the counter moved;
+ * a torn copy is retried, never returned. The same publish protocol backs
+ * the shared memory frame slots in shmserver.h.
+ *
+ * Readers can starve if updates are continuous and the copy is slow, so
+ * keep the copy to a memcpy and do any conversion on the snapshot.
+ */
+
+class Seqlock
+{
+public:
+    Seqlock() : mSequence(0) {}
+
+    void writeBegin()
+    {
+        mSequence++;
+        SPSC_MEMORY_BARRIER();
+    }
+
+    void writeEnd()
+    {
+        SPSC_MEMORY_BARRIER();
+        mSequence++;
+    }
+
+    uint32_t readBegin() const
+    {
+        for (;;) {
+            uint32_t seq = mSequence;
+            if (!(seq & 1)) {
+                SPSC_MEMORY_BARRIER();
+                return seq;
+            }
+        }
+    }
+
+    bool readRetry(uint32_t seq) const
+    {
+        SPSC_MEMORY_BARRIER();
+        return mSequence != seq;
+    }
+
+private:
+    volatile uint32_t mSequence;
+};
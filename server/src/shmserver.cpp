@@ -0,0 +1,174 @@
+/*
+ * Shared memory Open Pixel Control transport for Fadecandy.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "shmserver.h"
+#include "spscqueue.h"
+#include <string.h>
+#include <iostream>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+
+ShmServer::ShmServer(OPC::callback_t opcCallback, void *context, bool verbose)
+    : mOpcCallback(opcCallback), mUserContext(context),
+      mThread(0), mVerbose(verbose), mHeader(0), mSlots(0)
+{
+    memset(mLastFrameCount, 0, sizeof mLastFrameCount);
+}
+
+bool ShmServer::start(const char *path)
+{
+#ifdef _WIN32
+    std::clog << "Shared memory transport is not supported on Windows.\n";
+    return false;
+#else
+
+    size_t size = sizeof(Header) + CHANNEL_COUNT * sizeof(Slot);
+
+    int fd = open(path, O_RDWR | O_CREAT, 0666);
+    if (fd < 0) {
+        std::clog << "Error opening shared memory file " << path << ": " << strerror(errno) << "\n";
+        return false;
+    }
+
+    if (ftruncate(fd, size) < 0) {
+        std::clog << "Error sizing shared memory file " << path << ": " << strerror(errno) << "\n";
+        close(fd);
+        return false;
+    }
+
+    void *mapping = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED) {
+        std::clog << "Error mapping shared memory file " << path << ": " << strerror(errno) << "\n";
+        return false;
+    }
+
+    mHeader = (Header*) mapping;
+    mSlots = (Slot*) (mHeader + 1);
+
+    if (mHeader->magic != MAGIC || mHeader->version != VERSION ||
+        mHeader->channelCount != CHANNEL_COUNT || mHeader->slotBytes != sizeof(Slot)) {
+        // Fresh or incompatible file; initialize it.
+        memset(mapping, 0, size);
+        mHeader->channelCount = CHANNEL_COUNT;
+        mHeader->slotBytes = sizeof(Slot);
+        mHeader->version = VERSION;
+        SPSC_MEMORY_BARRIER();
+        mHeader->magic = MAGIC;
+    }
+
+    // Start from the frames already published, without replaying them
+    for (unsigned i = 0; i < CHANNEL_COUNT; i++) {
+        mLastFrameCount[i] = mSlots[i].frameCount;
+    }
+
+    std::clog << "Shared memory OPC transport at " << path << "\n";
+
+    mThread = new tthread::thread(threadFunc, this);
+
+    return true;
+#endif
+}
+
+void ShmServer::threadFunc(void *arg)
+{
+    ShmServer *self = (ShmServer*) arg;
+    self->run();
+}
+
+void ShmServer::run()
+{
+    /*
+     * Scan for channels whose frameCount moved since we last looked, and
+     * dispatch their latest frame. The scan itself is just 256 word reads
+     * from shared memory; we only sleep when a pass finds nothing new, so
+     * an active client's frames are picked up within about a millisecond.
+     */
+
+    OPC::Message *msg = new OPC::Message;
+    msg->command = OPC::SetPixelColors;
+
+    for (;;) {
+        bool idle = true;
+
+        for (unsigned channel = 0; channel < CHANNEL_COUNT; channel++) {
+            uint32_t frameCount = mSlots[channel].frameCount;
+            if (frameCount == mLastFrameCount[channel]) {
+                continue;
+            }
+
+            if (readSlot(channel, *msg)) {
+                mLastFrameCount[channel] = frameCount;
+                msg->channel = channel;
+                mOpcCallback(*msg, mUserContext);
+                idle = false;
+            }
+        }
+
+        if (idle) {
+            tthread::this_thread::sleep_for(tthread::chrono::milliseconds(1));
+        }
+    }
+}
+
+bool ShmServer::readSlot(unsigned channel, OPC::Message &msg)
+{
+    /*
+     * Seqlock read: sample the sequence, copy the frame, and check that the
+     * sequence didn't move. An odd sequence means a writer is mid-update.
+     * A handful of retries is plenty; if a writer is republishing this fast,
+     * we'll see the slot's newer frameCount on the next scan anyway.
+     */
+
+    Slot &slot = mSlots[channel];
+
+    for (unsigned attempt = 0; attempt < 4; attempt++) {
+        uint32_t seqBefore = slot.sequence;
+        if (seqBefore & 1) {
+            continue;
+        }
+        SPSC_MEMORY_BARRIER();
+
+        uint32_t length = slot.length;
+        if (length > sizeof slot.data - 1) {
+            length = sizeof slot.data - 1;
+        }
+        msg.setLength(length);
+        memcpy(msg.data, (const void*) slot.data, length);
+
+        SPSC_MEMORY_BARRIER();
+        if (slot.sequence == seqBefore) {
+            return true;
+        }
+    }
+
+    return false;
+}
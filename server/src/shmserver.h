@@ -0,0 +1,94 @@
+/*
+ * Shared memory Open Pixel Control transport for Fadecandy.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include <stdint.h>
+#include "tinythread.h"
+#include "opc.h"
+
+
+/*
+ * ShmServer is a local transport for clients running on the same machine
+ * as fcserver: an mmap'd file holding one latest-frame slot per OPC
+ * channel, each guarded by a seqlock. Publishing a frame is two memory
+ * barriers and a memcpy on the client side; no socket, no syscalls.
+ *
+ * Writer protocol, for client implementations:
+ *
+ *   1. Increment 'sequence' to an odd value (a memory barrier follows).
+ *   2. Write 'length' and 'data' (pixel bytes, as in a SetPixelColors
+ *      message body).
+ *   3. Memory barrier, then increment 'sequence' again (now even) and
+ *      increment 'frameCount'.
+ *
+ * Slots always hold the latest frame only; if fcserver falls behind, old
+ * frames are simply never seen. The server polls frameCount and dispatches
+ * changed slots through the same OPC callback as the network transports.
+ */
+
+class ShmServer {
+public:
+    ShmServer(OPC::callback_t opcCallback, void *context, bool verbose = false);
+
+    // Map the shared file (creating it if needed) and start the poll thread
+    bool start(const char *path);
+
+    /*
+     * On-disk layout, public so in-process writers (like the supervisor's
+     * per-bus ring fan-out) can share it with external clients.
+     */
+    struct Slot {
+        volatile uint32_t sequence;     // Seqlock; odd while a writer is mid-update
+        volatile uint32_t frameCount;   // Bumped once per published frame
+        volatile uint32_t length;       // Pixel data bytes in this frame
+        uint32_t reserved;
+        uint8_t data[0xFFFF + 1];
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t channelCount;
+        uint32_t slotBytes;
+    };
+
+    static const uint32_t MAGIC = 0x46435348;   // "FCSH"
+    static const uint32_t VERSION = 1;
+    static const unsigned CHANNEL_COUNT = 256;
+
+private:
+    OPC::callback_t mOpcCallback;
+    void *mUserContext;
+    tthread::thread *mThread;
+    bool mVerbose;
+
+    Header *mHeader;
+    Slot *mSlots;
+    uint32_t mLastFrameCount[CHANNEL_COUNT];
+
+    static void threadFunc(void *arg);
+    void run();
+
+    // Consistent seqlock'd read of one slot. False if a writer kept interfering.
+    bool readSlot(unsigned channel, OPC::Message &msg);
+};
@@ -0,0 +1,284 @@
+/*
+ * Hotplug-versus-streaming soak test for the fcserver dispatch path.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * fcserver-soak streams frames at full rate from one thread while another
+ * thread attaches and detaches devices thousands of times, reproducing the
+ * production failure mode where hotplug work stalls dispatch. Every
+ * attach and detach rebuilds the routing table and waits out the dispatch
+ * grace period, just like a real arrival or removal; the streamer times
+ * each injection, and the run fails if the worst-case dispatch latency
+ * exceeds the bound. Any change to the routing or event locking should
+ * hold this green.
+ *
+ * usage: fcserver-soak <config.json> [hotplug events] [max dispatch ms]
+ *
+ * Devices from the config file stay attached for the whole run; the churn
+ * devices come and go around them. The hotplug schedule is driven by a
+ * fixed-seed generator, so runs are reproducible.
+ */
+
+#include "rapidjson/document.h"
+#include "rapidjson/filestream.h"
+#include "fcserver.h"
+#include "nulldevice.h"
+#include "opc.h"
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "tinythread.h"
+
+#ifdef OS_LINUX
+#include <time.h>
+#else
+#include <sys/time.h>
+#endif
+
+
+static uint64_t monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+// Fixed-seed PCG-style generator; the churn schedule is part of the test
+static uint64_t gRandomState = 0x853c49e6748fea9bULL;
+
+static uint32_t randomBits()
+{
+    gRandomState = gRandomState * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (uint32_t)(gRandomState >> 33);
+}
+
+
+/*
+ * The streamer injects one synthetic frame after another through the
+ * transport callback, timing each call. The histogram is log2 microsecond
+ * buckets, since the run is unbounded in length; the maximum is exact.
+ */
+
+static const unsigned DISPATCH_BUCKETS = 32;
+static const unsigned NUM_PIXELS = 512;
+
+struct Streamer {
+    FCServer *server;
+    OPC::Message *msg;
+    volatile int stop;
+    uint64_t injected;
+    uint64_t maxLatency;
+    uint64_t histogram[DISPATCH_BUCKETS];
+};
+
+static void streamerThreadFunc(void *arg)
+{
+    Streamer *s = (Streamer*) arg;
+
+    while (!s->stop) {
+        uint64_t before = monotonicMicroseconds();
+        s->server->injectOpcMessage(*s->msg);
+        uint64_t delta = monotonicMicroseconds() - before;
+
+        if (delta > s->maxLatency) {
+            s->maxLatency = delta;
+        }
+        uint64_t d = delta;
+        unsigned bucket = 0;
+        while (d > 1 && bucket < DISPATCH_BUCKETS - 1) {
+            d >>= 1;
+            bucket++;
+        }
+        s->histogram[bucket]++;
+        s->injected++;
+    }
+}
+
+// Lower bound of the bucket holding the requested percentile, in microseconds
+static uint64_t histogramPercentile(const uint64_t *histogram, unsigned percent)
+{
+    uint64_t total = 0;
+    for (unsigned i = 0; i < DISPATCH_BUCKETS; i++) {
+        total += histogram[i];
+    }
+    if (!total) {
+        return 0;
+    }
+
+    uint64_t target = (total * percent + 99) / 100;
+    uint64_t seen = 0;
+    for (unsigned i = 0; i < DISPATCH_BUCKETS; i++) {
+        seen += histogram[i];
+        if (seen >= target) {
+            return (uint64_t)1 << i;
+        }
+    }
+    return (uint64_t)1 << (DISPATCH_BUCKETS - 1);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2 || argc > 4) {
+        fprintf(stderr, "usage: fcserver-soak <config.json> [hotplug events] [max dispatch ms]\n");
+        return 1;
+    }
+
+    rapidjson::Document config;
+    FILE *configFile = fopen(argv[1], "r");
+    if (!configFile) {
+        perror("Error opening config file");
+        return 2;
+    }
+    rapidjson::FileStream istr(configFile);
+    config.ParseStream<0>(istr);
+    fclose(configFile);
+
+    if (config.HasParseError()) {
+        fprintf(stderr, "Parse error at character %d: %s\n",
+            int(config.GetErrorOffset()), config.GetParseError());
+        return 3;
+    }
+
+    FCServer server(config);
+    if (server.hasError()) {
+        fprintf(stderr, "Configuration errors:\n%s", server.errorText().c_str());
+        return 5;
+    }
+
+    uint64_t totalEvents = argc >= 3 ? strtoull(argv[2], 0, 10) : 5000;
+    uint64_t maxDispatchMs = argc >= 4 ? strtoull(argv[3], 0, 10) : 50;
+
+    // Devices from the config stay attached for the whole run, so routing
+    // always has stable entries alongside the churn.
+    const rapidjson::Value &devices = config["devices"];
+    std::vector<NullDevice*> persistent;
+    if (devices.IsArray()) {
+        for (unsigned i = 0; i < devices.Size(); ++i) {
+            NullDevice *dev = new NullDevice(false);
+            dev->loadConfiguration(devices[i]);
+            server.attachBenchmarkDevice(dev);
+            persistent.push_back(dev);
+        }
+    }
+
+    // Churn devices carry no map, so they sit in the unrouted list and
+    // receive every streamed message while they're attached.
+    rapidjson::Document emptyConfig;
+    emptyConfig.Parse<0>("{}");
+
+    // Synthetic frame: full 512-pixel SetPixelColors on channel 0
+    std::vector<uint8_t> frame(OPC::HEADER_BYTES + NUM_PIXELS * 3);
+    OPC::Message *msg = (OPC::Message*) &frame[0];
+    msg->channel = 0;
+    msg->command = OPC::SetPixelColors;
+    msg->setLength(NUM_PIXELS * 3);
+    for (unsigned i = 0; i < NUM_PIXELS * 3; ++i) {
+        msg->data[i] = (uint8_t) i;
+    }
+
+    Streamer streamer;
+    memset(&streamer, 0, sizeof streamer);
+    streamer.server = &server;
+    streamer.msg = msg;
+
+    fprintf(stderr, "Soaking: %llu hotplug events against a full-rate stream, "
+        "%u persistent device(s), bound %llu ms...\n",
+        (unsigned long long) totalEvents, (unsigned) persistent.size(),
+        (unsigned long long) maxDispatchMs);
+
+    tthread::thread streamerThread(streamerThreadFunc, &streamer);
+
+    /*
+     * The churn loop plays the part of the hotplug thread: each event takes
+     * mEventMutex, mutates the device list, and republishes the routing
+     * table. No pacing; the point is maximum contention with dispatch.
+     */
+    static const unsigned MAX_CHURN_DEVICES = 16;
+    std::vector<NullDevice*> churn;
+    uint64_t attaches = 0, detaches = 0;
+    uint64_t churnStarted = monotonicMicroseconds();
+
+    for (uint64_t n = 0; n < totalEvents; ++n) {
+        bool attach = churn.empty() ||
+            (churn.size() < MAX_CHURN_DEVICES && (randomBits() & 1));
+
+        if (attach) {
+            NullDevice *dev = new NullDevice(false);
+            dev->loadConfiguration(emptyConfig);
+            dev->open();
+            server.attachBenchmarkDevice(dev);
+            churn.push_back(dev);
+            attaches++;
+        } else {
+            unsigned victim = randomBits() % churn.size();
+            NullDevice *dev = churn[victim];
+            churn.erase(churn.begin() + victim);
+            server.detachBenchmarkDevice(dev);
+            detaches++;
+        }
+    }
+
+    // Leave the tree the way we found it before stopping the stream
+    while (!churn.empty()) {
+        NullDevice *dev = churn.back();
+        churn.pop_back();
+        server.detachBenchmarkDevice(dev);
+    }
+    uint64_t churnElapsed = monotonicMicroseconds() - churnStarted;
+
+    streamer.stop = 1;
+    streamerThread.join();
+
+    uint64_t p50 = histogramPercentile(streamer.histogram, 50);
+    uint64_t p99 = histogramPercentile(streamer.histogram, 99);
+
+    printf("hotplug events:     %llu (%llu attach, %llu detach) in %.3f s\n",
+        (unsigned long long) totalEvents, (unsigned long long) attaches,
+        (unsigned long long) detaches, churnElapsed / 1e6);
+    printf("messages injected:  %llu (%.0f msg/s against the churn)\n",
+        (unsigned long long) streamer.injected,
+        streamer.injected * 1e6 / (churnElapsed ? churnElapsed : 1));
+    printf("dispatch latency:   p50 %llu us, p99 %llu us (log2-quantized), max %llu us\n",
+        (unsigned long long) p50, (unsigned long long) p99,
+        (unsigned long long) streamer.maxLatency);
+
+    if (!streamer.injected) {
+        printf("FAIL: the streamer never got a message through\n");
+        return 1;
+    }
+    if (streamer.maxLatency > maxDispatchMs * 1000) {
+        printf("FAIL: max dispatch latency %llu us exceeds the %llu ms bound\n",
+            (unsigned long long) streamer.maxLatency,
+            (unsigned long long) maxDispatchMs);
+        return 1;
+    }
+    printf("PASS\n");
+    return 0;
+}
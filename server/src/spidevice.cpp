@@ -23,11 +23,20 @@
 */
 
 #include "spidevice.h"
+#include "pixelmapper.h"
 #include <iostream>
+#include <string.h>
 
 #ifdef FCSERVER_HAS_WIRINGPI
 #include <wiringPi.h>
 #include <wiringPiSPI.h>
+#include <linux/spi/spidev.h>
+#include <sys/ioctl.h>
+#include <string.h>
+#endif
+
+#ifdef FCSERVER_USE_IO_URING
+#include <errno.h>
 #endif
 
 #ifndef SPI_FREQUENCY_MHZ
@@ -36,17 +45,32 @@
 
 #define SPI_FREQUENCY (SPI_FREQUENCY_MHZ*1000000)
 
+#ifdef FCSERVER_USE_IO_URING
+// Plenty for a frame's worth of segments; the ring is drained every call
+#define URING_QUEUE_ENTRIES 16
+#endif
+
 SPIDevice::SPIDevice(const char *type, bool verbose)
     : mTypeString(type),
       mVerbose(verbose),
-      mPort(0)
+      mPort(0),
+      mOutputWorker(workerWriteMessage, this)
 {
+    memset(&mSubmitTrace, 0, sizeof mSubmitTrace);
     gettimeofday(&mTimestamp, NULL);
+
+#ifdef FCSERVER_USE_IO_URING
+    mRingReady = false;
+#endif
 }
 
 SPIDevice::~SPIDevice()
 {
-
+#ifdef FCSERVER_USE_IO_URING
+    if (mRingReady) {
+        io_uring_queue_exit(&mRing);
+    }
+#endif
 }
 
 int SPIDevice::open(uint32_t port)
@@ -54,7 +78,19 @@ int SPIDevice::open(uint32_t port)
     mPort = port;
 
 #ifdef FCSERVER_HAS_WIRINGPI
-    return wiringPiSPISetup(mPort, SPI_FREQUENCY);
+    int fd = wiringPiSPISetup(mPort, SPI_FREQUENCY);
+
+#ifdef FCSERVER_USE_IO_URING
+    if (fd >= 0 && !mRingReady) {
+        if (io_uring_queue_init(URING_QUEUE_ENTRIES, &mRing, 0) == 0) {
+            mRingReady = true;
+        } else if (mVerbose) {
+            std::clog << "io_uring unavailable; using synchronous SPI writes\n";
+        }
+    }
+#endif
+
+    return fd;
 #else
     return -1;
 #endif
@@ -67,6 +103,118 @@ void SPIDevice::write(void* buffer, int length)
 #endif
 }
 
+void SPIDevice::writeVectored(void **buffers, const int *lengths, unsigned count)
+{
+#ifdef FCSERVER_HAS_WIRINGPI
+#ifdef FCSERVER_USE_IO_URING
+    if (mRingReady && writeVectoredUring(buffers, lengths, count)) {
+        return;
+    }
+    // On failure, fall through and repeat the frame synchronously. LED
+    // strips are idempotent targets, so a partial duplicate is harmless.
+#endif
+
+    // One segment per buffer, submitted as a single multi-segment message
+    static const unsigned MAX_SEGMENTS = 4;
+    struct spi_ioc_transfer xfer[MAX_SEGMENTS];
+
+    if (count > MAX_SEGMENTS) {
+        count = MAX_SEGMENTS;
+    }
+
+    memset(xfer, 0, sizeof xfer);
+    for (unsigned i = 0; i < count; i++) {
+        xfer[i].tx_buf = (uintptr_t) buffers[i];
+        xfer[i].len = lengths[i];
+    }
+
+    if (ioctl(wiringPiSPIGetFd(mPort), SPI_IOC_MESSAGE(count), xfer) >= 0) {
+        return;
+    }
+
+    // Fall through to sequential writes if the vectored submission failed
+    for (unsigned i = 0; i < count; i++) {
+        write(buffers[i], lengths[i]);
+    }
+#else
+    (void) buffers;
+    (void) lengths;
+    (void) count;
+#endif
+}
+
+#ifdef FCSERVER_USE_IO_URING
+bool SPIDevice::writeVectoredUring(void **buffers, const int *lengths, unsigned count)
+{
+    /*
+     * Queue one transmit-only write per buffer and submit the lot with a
+     * single io_uring_enter(). Each spidev write() is its own SPI message,
+     * so the entries are linked to keep them in bus order; our SPI LED
+     * devices don't latch on chip select, making the inter-segment gap
+     * harmless. IORING_OP_WRITE needs Linux 5.6 or later; on older kernels
+     * every entry completes with -EINVAL, and we disable the ring for good
+     * rather than paying for the round trip on every frame.
+     */
+
+    if (count > URING_QUEUE_ENTRIES) {
+        return false;
+    }
+
+    int fd = wiringPiSPIGetFd(mPort);
+
+    for (unsigned i = 0; i < count; i++) {
+        struct io_uring_sqe *sqe = io_uring_get_sqe(&mRing);
+        if (!sqe) {
+            // Can't happen while the ring is drained per call, but don't
+            // leave a partial chain queued if it somehow does.
+            io_uring_submit(&mRing);
+            return false;
+        }
+        io_uring_prep_write(sqe, fd, buffers[i], lengths[i], 0);
+        if (i + 1 < count) {
+            sqe->flags |= IOSQE_IO_LINK;
+        }
+    }
+
+    if (io_uring_submit_and_wait(&mRing, count) < (int)count) {
+        return false;
+    }
+
+    bool ok = true;
+    for (unsigned i = 0; i < count; i++) {
+        struct io_uring_cqe *cqe;
+        if (io_uring_wait_cqe(&mRing, &cqe) < 0) {
+            return false;
+        }
+        if (cqe->res < 0) {
+            if (cqe->res == -EINVAL) {
+                mRingReady = false;
+            }
+            ok = false;
+        }
+        io_uring_cqe_seen(&mRing, cqe);
+    }
+
+    return ok;
+}
+#endif // FCSERVER_USE_IO_URING
+
+void SPIDevice::writeMessageAsync(const OPC::Message &msg, uint64_t timestamp)
+{
+    mOutputWorker.enqueue(msg, timestamp);
+}
+
+unsigned SPIDevice::getQueueDepth()
+{
+    return mOutputWorker.depth();
+}
+
+void SPIDevice::workerWriteMessage(const OPC::Message &msg, uint64_t timestamp, void *context)
+{
+    (void) timestamp;
+    static_cast<SPIDevice*>(context)->writeMessage(msg);
+}
+
 void SPIDevice::writeColorCorrection(const Value &color)
 {
     // Optional. By default, ignore color correction messages.
@@ -92,6 +240,23 @@ bool SPIDevice::matchConfiguration(const Value &config)
     return true;
 }
 
+bool SPIDevice::getOPCChannels(std::set<unsigned> &channels)
+{
+    // By default we can't enumerate channels; the server delivers all messages.
+    return false;
+}
+
+bool SPIDevice::findMapChannels(const Value *map, std::set<unsigned> &channels)
+{
+    /*
+     * Common helper for getOPCChannels() implementations, for backends that
+     * haven't compiled their mapping. The real logic lives in PixelMapper,
+     * shared with the USB device hierarchy.
+     */
+
+    return PixelMapper::findMapChannels(map, channels);
+}
+
 const SPIDevice::Value *SPIDevice::findConfigMap(const Value &config)
 {
     const Value &vmap = config["map"];
@@ -108,6 +273,11 @@ const SPIDevice::Value *SPIDevice::findConfigMap(const Value &config)
     return 0;
 }
 
+void SPIDevice::writeDevicePixels(const uint8_t *rgb, unsigned numPixels)
+{
+    // Devices without a raw pixel framebuffer ignore this
+}
+
 void SPIDevice::writeMessage(Document &msg)
 {
     const char *type = msg["type"].GetString();
@@ -137,4 +307,7 @@ void SPIDevice::describe(rapidjson::Value &object, Allocator &alloc)
 
     uint64_t timestamp = (uint64_t)mTimestamp.tv_sec * 1000 + mTimestamp.tv_usec / 1000;
     object.AddMember("timestamp", timestamp, alloc);
+
+    // How many messages the delivery queue has dropped, for bus load monitoring
+    object.AddMember("dropped_frames", mOutputWorker.droppedFrames(), alloc);
 }
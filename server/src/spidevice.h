@@ -26,9 +26,16 @@
 
 #include "rapidjson/document.h"
 #include "opc.h"
+#include "outputworker.h"
+#include "pacinganalyzer.h"
 #include <string>
+#include <set>
 #include <libusb.h> // Also brings in gettimeofday() in a portable way
 
+#ifdef FCSERVER_USE_IO_URING
+#include <liburing.h>
+#endif
+
 class SPIDevice
 {
 public:
@@ -44,21 +51,47 @@ public:
 
     virtual void write(void* buffer, int length);
 
+    /*
+     * Write several buffers as one scatter-gather SPI message, in a single
+     * spidev ioctl with no inter-segment gap on the bus. Transmit-only;
+     * unlike write(), the buffers are not clobbered with read data. Falls
+     * back to sequential write() calls when spidev isn't available.
+     */
+    virtual void writeVectored(void **buffers, const int *lengths, unsigned count);
+
     // Check a configuration. Does it describe this device?
     virtual bool matchConfiguration(const Value &config);
 
     // Load a matching configuration
     virtual void loadConfiguration(const Value &config) = 0;
 
+    // List the OPC channels this device's configuration maps, so the server
+    // can route SetPixelColors messages only to interested devices. Returns
+    // false if the channels can't be enumerated; the device then receives
+    // all messages.
+    virtual bool getOPCChannels(std::set<unsigned> &channels);
+
     // Handle an incoming OPC message
     virtual void writeMessage(const OPC::Message &msg) = 0;
 
+    // Queue an OPC message for this device's output worker thread, so one
+    // slow device can't delay delivery to the others. The dispatch thread
+    // never blocks; if the device has fallen too far behind, the message
+    // is dropped.
+    void writeMessageAsync(const OPC::Message &msg, uint64_t timestamp = 0);
+
+    // Frames queued for this device but not yet on the wire
+    unsigned getQueueDepth();
+
     // Handle a device-specific JSON message
     virtual void writeMessage(Document &msg);
 
     // Write color LUT from parsed JSON
     virtual void writeColorCorrection(const Value &color);
 
+    // Write raw unmapped RGB pixel data straight into the framebuffer
+    virtual void writeDevicePixels(const uint8_t *rgb, unsigned numPixels);
+
     // Describe this device by adding keys to a JSON object
     virtual void describe(Value &object, Allocator &alloc);
 
@@ -66,12 +99,31 @@ public:
 
     const char *getTypeString() { return mTypeString; }
 
+    // Submission pacing trace; see USBDevice::submitTrace()
+    PacingAnalyzer::Trace &submitTrace() { return mSubmitTrace; }
+
 protected:
+    PacingAnalyzer::Trace mSubmitTrace;
     struct timeval mTimestamp;
     const char *mTypeString;
     bool mVerbose;
     uint32_t mPort;
+    OutputWorker mOutputWorker;
 
     // Utilities
     const Value *findConfigMap(const Value &config);
+    static void workerWriteMessage(const OPC::Message &msg, uint64_t timestamp, void *context);
+    static bool findMapChannels(const Value *map, std::set<unsigned> &channels);
+
+#ifdef FCSERVER_USE_IO_URING
+    /*
+     * Optional io_uring backend for spidev output, behind the USE_IO_URING
+     * build option. Batches a frame's buffers into one ring submission, so
+     * a multi-segment frame costs a single syscall. Requires Linux 5.6;
+     * falls back to the synchronous paths when setup or submission fails.
+     */
+    struct io_uring mRing;
+    bool mRingReady;
+    bool writeVectoredUring(void **buffers, const int *lengths, unsigned count);
+#endif
 };
@@ -0,0 +1,112 @@
+/*
+ * Bounded lock-free single-producer single-consumer queue.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+/*
+ * Full memory barrier. Like fast_mutex.h, we prefer compiler intrinsics over
+ * system APIs, and fall back to Win32 when GCC builtins aren't available.
+ */
+#if defined(__GNUC__)
+  #define SPSC_MEMORY_BARRIER() __sync_synchronize()
+#elif defined(_MSC_VER)
+  #include <intrin.h>
+  #define SPSC_MEMORY_BARRIER() _ReadWriteBarrier()
+#else
+  #error No memory barrier implementation for this compiler
+#endif
+
+
+/*
+ * Fixed-size ring buffer, safe for concurrent use by exactly one producer
+ * thread and one consumer thread, with no locks on either side.
+ *
+ * The producer reserves a slot with head(), fills it in place, and publishes
+ * it with push(). The consumer inspects the oldest item with front() and
+ * releases it with pop(). head() and front() return 0 when the queue is full
+ * or empty, respectively. One slot is always left unused to distinguish the
+ * two states.
+ */
+
+template <typename T, unsigned DEPTH>
+class SPSCQueue
+{
+public:
+    SPSCQueue() : mHead(0), mTail(0) {}
+
+    // Producer side: slot to fill next, or 0 if the queue is full.
+    T *head()
+    {
+        unsigned next = increment(mHead);
+        if (next == mTail) {
+            return 0;
+        }
+        return &mSlots[mHead];
+    }
+
+    // Producer side: publish the slot returned by head().
+    void push()
+    {
+        SPSC_MEMORY_BARRIER();
+        mHead = increment(mHead);
+    }
+
+    // Consumer side: oldest item, or 0 if the queue is empty.
+    T *front()
+    {
+        if (mTail == mHead) {
+            return 0;
+        }
+        SPSC_MEMORY_BARRIER();
+        return &mSlots[mTail];
+    }
+
+    // Consumer side: release the item returned by front().
+    void pop()
+    {
+        SPSC_MEMORY_BARRIER();
+        mTail = increment(mTail);
+    }
+
+    bool empty() const
+    {
+        return mTail == mHead;
+    }
+
+    // Number of queued items. Approximate when called concurrently.
+    unsigned count() const
+    {
+        unsigned head = mHead, tail = mTail;
+        return head >= tail ? head - tail : head + DEPTH - tail;
+    }
+
+private:
+    static unsigned increment(unsigned index)
+    {
+        return index + 1 == DEPTH ? 0 : index + 1;
+    }
+
+    volatile unsigned mHead;    // Next slot the producer will write
+    volatile unsigned mTail;    // Next slot the consumer will read
+    T mSlots[DEPTH];
+};
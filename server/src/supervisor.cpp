@@ -0,0 +1,524 @@
+/*
+ * Multi-process supervisor for per-USB-bus fcserver workers.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifdef OS_LINUX
+
+#include "supervisor.h"
+#include "fcserver.h"
+#include "spscqueue.h"
+#include "version.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+#include <iostream>
+#include <set>
+#include <string.h>
+#include <stdio.h>
+#include <signal.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/wait.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <libusb.h>
+
+
+/*
+ * Signal plumbing. Each process installs only the handlers it needs; the
+ * handlers just set flags, in the same style as main.cpp.
+ */
+static volatile sig_atomic_t gShutdownRequested = 0;
+static volatile sig_atomic_t gReloadRequested = 0;
+
+static void handleSupervisorSignal(int sig)
+{
+    if (sig == SIGHUP) {
+        gReloadRequested = 1;
+    } else {
+        gShutdownRequested = 1;
+    }
+}
+
+// Worker-process handlers, mirroring the ones in main.cpp
+static FCServer *gWorkerServer = 0;
+
+static void handleWorkerSighup(int sig)
+{
+    if (gWorkerServer) {
+        gWorkerServer->requestConfigReload();
+    }
+}
+
+static void handleWorkerShutdown(int sig)
+{
+    if (gWorkerServer) {
+        gWorkerServer->requestShutdown();
+    }
+}
+
+
+Supervisor::Supervisor(Document &config, const char *configPath)
+    : mConfig(config),
+      mConfigPath(configPath ? configPath : ""),
+      mVerbose(config["verbose"].IsTrue()),
+      mSpawnerPid(0),
+      mTcpNetServer(cbOpcMessage, cbJsonMessage, this, mVerbose),
+      mUdpNetServer(cbOpcMessage, this, mVerbose)
+{
+    // Serialize the configuration once; each worker reparses its own copy,
+    // since a Document can't cross fork-then-modify cleanly.
+    rapidjson::GenericStringBuffer<rapidjson::UTF8<> > buffer;
+    rapidjson::Writer<rapidjson::GenericStringBuffer<rapidjson::UTF8<> > > writer(buffer);
+    config.Accept(writer);
+    mConfigText.assign(buffer.GetString(), buffer.Size());
+}
+
+bool Supervisor::enumerateBuses()
+{
+    /*
+     * One worker per USB root bus present at startup. Buses without LED
+     * hardware cost one idle worker each, which is cheap; enumerating by
+     * bus rather than by attached board means a board hotplugged later
+     * lands in the right worker without any coordination.
+     */
+
+    libusb_context *usb;
+    if (libusb_init(&usb)) {
+        std::clog << "Error initializing USB library!\n";
+        return false;
+    }
+
+    libusb_device **list;
+    ssize_t listSize = libusb_get_device_list(usb, &list);
+    std::set<unsigned> buses;
+    for (ssize_t i = 0; i < listSize; i++) {
+        buses.insert(libusb_get_bus_number(list[i]));
+    }
+    if (listSize >= 0) {
+        libusb_free_device_list(list, true);
+    }
+    libusb_exit(usb);
+
+    if (buses.empty()) {
+        std::clog << "No USB buses found; nothing to supervise.\n";
+        return false;
+    }
+
+    const Value &listen = mConfig["listen"];
+    int basePort = listen.IsArray() && listen[1].IsUint() ? listen[1].GetUint() : 7890;
+
+    unsigned index = 0;
+    for (std::set<unsigned>::iterator i = buses.begin(); i != buses.end(); ++i, ++index) {
+        WorkerSlot slot;
+        slot.bus = *i;
+        slot.controlPort = basePort + 1 + index;
+        char path[64];
+        snprintf(path, sizeof path, "/dev/shm/fcserver-bus%u", *i);
+        slot.ringPath = path;
+        slot.slots = 0;
+        mWorkers.push_back(slot);
+    }
+
+    return true;
+}
+
+bool Supervisor::openRing(WorkerSlot &slot)
+{
+    /*
+     * Create and initialize the worker's frame ring, in the same format
+     * ShmServer consumes. The master initializes the file before the
+     * worker is forked, so neither side ever has to wait for the other.
+     */
+
+    size_t size = sizeof(ShmServer::Header) +
+        ShmServer::CHANNEL_COUNT * sizeof(ShmServer::Slot);
+
+    int fd = open(slot.ringPath.c_str(), O_RDWR | O_CREAT, 0666);
+    if (fd < 0) {
+        std::clog << "Error opening ring " << slot.ringPath << ": " << strerror(errno) << "\n";
+        return false;
+    }
+    if (ftruncate(fd, size) < 0) {
+        std::clog << "Error sizing ring " << slot.ringPath << ": " << strerror(errno) << "\n";
+        close(fd);
+        return false;
+    }
+
+    void *mapping = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        std::clog << "Error mapping ring " << slot.ringPath << ": " << strerror(errno) << "\n";
+        return false;
+    }
+
+    ShmServer::Header *header = (ShmServer::Header*) mapping;
+    if (header->magic != ShmServer::MAGIC || header->version != ShmServer::VERSION ||
+        header->channelCount != ShmServer::CHANNEL_COUNT ||
+        header->slotBytes != sizeof(ShmServer::Slot)) {
+        memset(mapping, 0, size);
+        header->channelCount = ShmServer::CHANNEL_COUNT;
+        header->slotBytes = sizeof(ShmServer::Slot);
+        header->version = ShmServer::VERSION;
+        SPSC_MEMORY_BARRIER();
+        header->magic = ShmServer::MAGIC;
+    }
+
+    slot.slots = (ShmServer::Slot*) (header + 1);
+    return true;
+}
+
+int Supervisor::run()
+{
+    if (!enumerateBuses()) {
+        return 7;
+    }
+
+    for (unsigned i = 0; i < mWorkers.size(); i++) {
+        if (!openRing(mWorkers[i])) {
+            return 9;
+        }
+        std::clog << "Supervisor: worker for USB bus " << mWorkers[i].bus
+            << ", ring " << mWorkers[i].ringPath
+            << ", control port " << mWorkers[i].controlPort << "\n";
+    }
+
+    /*
+     * Fork the spawner while this process is still single-threaded. The
+     * spawner stays single-threaded forever, so every later fork -- the
+     * initial workers and any respawn -- happens from a safe state, never
+     * from under the master's network threads.
+     */
+    mSpawnerPid = fork();
+    if (mSpawnerPid < 0) {
+        perror("Error forking spawner");
+        return 7;
+    }
+    if (mSpawnerPid == 0) {
+        spawnerMain();      // Never returns
+    }
+
+    if (!startNetwork()) {
+        kill(mSpawnerPid, SIGTERM);
+        return 9;
+    }
+
+    return superviseLoop();
+}
+
+bool Supervisor::startNetwork()
+{
+    // Same listener setup as FCServer::start(), minus USB and SPI
+    const Value &listen = mConfig["listen"];
+    const Value &host = listen[0u];
+    const Value &port = listen[1];
+    const char *hostStr = host.IsString() ? host.GetString() : NULL;
+
+    const Value &listenShards = mConfig["listenShards"];
+    unsigned shards = listenShards.IsUint() ? listenShards.GetUint() : 1;
+
+    if (!mTcpNetServer.start(hostStr, port.GetUint(), shards)) {
+        return false;
+    }
+
+    const Value &relay = mConfig["relay"];
+    if (!relay.IsNull()) {
+        const Value &relayHost = relay[0u];
+        const Value &relayPort = relay[1];
+        const char *relayHostStr = relayHost.IsString() ? relayHost.GetString() : NULL;
+        mTcpNetServer.startRelay(relayHostStr, relayPort.GetUint());
+    }
+
+    const Value &udpListen = mConfig["udpListen"];
+    if (!udpListen.IsNull()) {
+        const Value &udpHost = udpListen[0u];
+        const Value &udpPort = udpListen[1];
+        const char *udpHostStr = udpHost.IsString() ? udpHost.GetString() : NULL;
+        if (!mUdpNetServer.start(udpHostStr, udpPort.GetUint())) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int Supervisor::superviseLoop()
+{
+    signal(SIGTERM, handleSupervisorSignal);
+    signal(SIGINT, handleSupervisorSignal);
+    signal(SIGHUP, handleSupervisorSignal);
+
+    /*
+     * The spawner owns the workers; the master only relays signals to it
+     * and notices if it dies. Frame traffic flows on the network threads
+     * the whole time.
+     */
+    for (;;) {
+        int status;
+        pid_t pid = waitpid(mSpawnerPid, &status, 0);
+
+        if (pid == mSpawnerPid) {
+            if (gShutdownRequested) {
+                return 0;
+            }
+            std::clog << "Supervisor: spawner exited unexpectedly\n";
+            return 8;
+        }
+
+        // EINTR: a signal arrived; act on the flags and wait again
+        if (gReloadRequested) {
+            gReloadRequested = 0;
+            kill(mSpawnerPid, SIGHUP);
+        }
+        if (gShutdownRequested) {
+            kill(mSpawnerPid, SIGTERM);
+        }
+    }
+}
+
+void Supervisor::spawnerMain()
+{
+    /*
+     * Fork one worker per bus, then reap and respawn. A dead worker comes
+     * back after a one-second backoff, so a crash-looping bus can't spin
+     * the controller, and the other buses' workers are never touched --
+     * which is the whole point of the exercise.
+     */
+
+    signal(SIGTERM, handleSupervisorSignal);
+    signal(SIGINT, handleSupervisorSignal);
+    signal(SIGHUP, handleSupervisorSignal);
+
+    std::vector<pid_t> pids(mWorkers.size(), 0);
+    for (unsigned i = 0; i < mWorkers.size(); i++) {
+        pids[i] = forkWorker(mWorkers[i]);
+    }
+
+    for (;;) {
+        if (gShutdownRequested) {
+            for (unsigned i = 0; i < mWorkers.size(); i++) {
+                if (pids[i] > 0) {
+                    kill(pids[i], SIGTERM);
+                }
+            }
+            for (unsigned i = 0; i < mWorkers.size(); i++) {
+                int status;
+                if (pids[i] > 0) {
+                    waitpid(pids[i], &status, 0);
+                }
+            }
+            _exit(0);
+        }
+        if (gReloadRequested) {
+            gReloadRequested = 0;
+            for (unsigned i = 0; i < mWorkers.size(); i++) {
+                if (pids[i] > 0) {
+                    kill(pids[i], SIGHUP);
+                }
+            }
+        }
+
+        int status;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0) {
+            continue;       // EINTR; the flags above take it from here
+        }
+
+        for (unsigned i = 0; i < mWorkers.size(); i++) {
+            if (pids[i] == pid) {
+                std::clog << "Supervisor: worker for USB bus " << mWorkers[i].bus
+                    << " exited with status " << status << ", respawning\n";
+                sleep(1);
+                pids[i] = forkWorker(mWorkers[i]);
+                break;
+            }
+        }
+    }
+}
+
+pid_t Supervisor::forkWorker(const WorkerSlot &slot)
+{
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("Error forking worker");
+        return -1;
+    }
+    if (pid == 0) {
+        workerMain(slot);   // Never returns
+    }
+    return pid;
+}
+
+void Supervisor::replaceConfigMember(Document &config, const char *key, Value &value)
+{
+    if (config.HasMember(key)) {
+        config.RemoveMember(key);
+    }
+    config.AddMember(key, value, config.GetAllocator());
+}
+
+void Supervisor::workerMain(const WorkerSlot &slot)
+{
+    /*
+     * Build this worker's configuration: the operator's config with the
+     * transports swapped out. Frames come in over our ring through the
+     * ordinary shmListen transport; the network listeners collapse to one
+     * loopback control port, for device-targeted JSON messages and
+     * per-worker diagnostics; and the bus filter keeps this process from
+     * claiming another worker's boards.
+     */
+
+    Document config;
+    config.Parse<0>(mConfigText.c_str());
+    Document::AllocatorType &alloc = config.GetAllocator();
+
+    Value listen(rapidjson::kArrayType);
+    Value listenHost("127.0.0.1");
+    Value listenPort(slot.controlPort);
+    listen.PushBack(listenHost, alloc);
+    listen.PushBack(listenPort, alloc);
+    replaceConfigMember(config, "listen", listen);
+
+    Value relay;
+    replaceConfigMember(config, "relay", relay);
+    Value udpListen;
+    replaceConfigMember(config, "udpListen", udpListen);
+    Value listenShards;
+    replaceConfigMember(config, "listenShards", listenShards);
+
+    Value shmListen;
+    shmListen.SetString(slot.ringPath.c_str(), slot.ringPath.size(), alloc);
+    replaceConfigMember(config, "shmListen", shmListen);
+
+    Value busFilter(slot.bus);
+    replaceConfigMember(config, "usbBusFilter", busFilter);
+
+    FCServer server(config);
+    if (server.hasError()) {
+        std::clog << "Worker configuration errors:\n" << server.errorText();
+        _exit(5);
+    }
+    if (!mConfigPath.empty()) {
+        server.setConfigPath(mConfigPath.c_str());
+    }
+
+    libusb_context *usb;
+    if (libusb_init(&usb)) {
+        std::clog << "Worker: error initializing USB library!\n";
+        _exit(7);
+    }
+
+    gWorkerServer = &server;
+    signal(SIGHUP, handleWorkerSighup);
+    signal(SIGTERM, handleWorkerShutdown);
+    signal(SIGINT, handleWorkerShutdown);
+
+    if (!server.start(usb)) {
+        _exit(9);
+    }
+    server.mainLoop();
+    _exit(8);
+}
+
+void Supervisor::publishFrame(OPC::Message &msg)
+{
+    /*
+     * Fan the frame out to every worker's ring, using the seqlock writer
+     * protocol documented in shmserver.h. Every worker sees every channel;
+     * each one's compiled pixel maps decide what it actually renders, so
+     * no routing knowledge lives in the master.
+     *
+     * Frames arrive here on every TCP shard thread and the UDP thread,
+     * but the seqlock allows only one writer per slot: racing increments
+     * can leave a sequence odd forever, and the workers would skip that
+     * channel from then on. mPublishMutex serializes the publishes.
+     */
+
+    mPublishMutex.lock();
+
+    unsigned length = msg.length();
+
+    for (unsigned i = 0; i < mWorkers.size(); i++) {
+        ShmServer::Slot &slot = mWorkers[i].slots[msg.channel];
+
+        slot.sequence = slot.sequence + 1;      // Odd: writer in progress
+        SPSC_MEMORY_BARRIER();
+        slot.length = length;
+        memcpy(slot.data, msg.data, length);
+        SPSC_MEMORY_BARRIER();
+        slot.sequence = slot.sequence + 1;      // Even again: consistent
+        slot.frameCount = slot.frameCount + 1;
+    }
+
+    mPublishMutex.unlock();
+}
+
+void Supervisor::cbOpcMessage(OPC::Message &msg, void *context)
+{
+    Supervisor *self = (Supervisor*) context;
+
+    if (msg.command == OPC::SetPixelColors) {
+        self->publishFrame(msg);
+    }
+
+    self->mTcpNetServer.relayMessage(msg);
+}
+
+void Supervisor::cbJsonMessage(libwebsocket *wsi, rapidjson::Document &message, void *context)
+{
+    /*
+     * The master's control surface is deliberately small: enough to see
+     * the supervisor topology and find the per-worker control ports, where
+     * the full JSON API lives.
+     */
+
+    Supervisor *self = (Supervisor*) context;
+
+    const Value &vtype = message["type"];
+    if (!vtype.IsString()) {
+        return;
+    }
+
+    if (!strcmp(vtype.GetString(), "server_info")) {
+        message.AddMember("version", kFCServerVersion, message.GetAllocator());
+        message.AddMember("supervisor", true, message.GetAllocator());
+        message.AddMember("workers", rapidjson::kArrayType, message.GetAllocator());
+        Value &list = message["workers"];
+        for (unsigned i = 0; i < self->mWorkers.size(); i++) {
+            list.PushBack(rapidjson::kObjectType, message.GetAllocator());
+            Value &entry = list[i];
+            entry.AddMember("usb_bus", self->mWorkers[i].bus, message.GetAllocator());
+            entry.AddMember("control_port", self->mWorkers[i].controlPort, message.GetAllocator());
+            Value ring(self->mWorkers[i].ringPath.c_str(),
+                self->mWorkers[i].ringPath.size(), message.GetAllocator());
+            entry.AddMember("ring", ring, message.GetAllocator());
+        }
+    } else {
+        message.AddMember("error",
+            "Not available in supervisor mode; use a worker's control port",
+            message.GetAllocator());
+    }
+
+    self->mTcpNetServer.jsonReply(wsi, message);
+}
+
+#endif  // OS_LINUX
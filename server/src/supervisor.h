@@ -0,0 +1,119 @@
+/*
+ * Multi-process supervisor for per-USB-bus fcserver workers.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#ifdef OS_LINUX
+
+#include "rapidjson/document.h"
+#include "tcpnetserver.h"
+#include "udpnetserver.h"
+#include "shmserver.h"
+#include "opc.h"
+#include "tinythread.h"
+#include <string>
+#include <vector>
+#include <sys/types.h>
+
+
+/*
+ * Supervisor mode ("shardByBus": true) isolates USB faults by bus: one
+ * worker process per USB root bus, each running an ordinary FCServer with
+ * its own libusb context, main loop, and device set, so a libusb stall or
+ * crash on one bus costs only that bus's output. It also spreads USB event
+ * handling across cores on multi-bus controllers.
+ *
+ * Process tree:
+ *
+ *   master   - owns the TCP (and optional UDP/relay) listeners and fans
+ *              incoming SetPixelColors frames out to every worker over a
+ *              shared-memory ring in the ShmServer format.
+ *   spawner  - forked from the master before any threads exist, stays
+ *              single-threaded forever, and does nothing but fork workers
+ *              and respawn them when they die. Keeping all fork() calls in
+ *              a single-threaded process sidesteps the usual hazards of
+ *              forking a threaded server.
+ *   workers  - one per bus, ingesting frames from their ring through the
+ *              ordinary "shmListen" transport, restricted to their bus by
+ *              "usbBusFilter". Each also gets its own loopback control
+ *              port (configured port + 1 + worker index).
+ *
+ * Rings carry SetPixelColors payloads only; global color correction and
+ * device options come from each worker's copy of the config file, and SysEx
+ * control messages should go to the per-worker control ports.
+ */
+class Supervisor
+{
+public:
+    typedef rapidjson::Value Value;
+    typedef rapidjson::Document Document;
+
+    Supervisor(Document &config, const char *configPath);
+
+    // Fork the workers and run the master's ingest loop. Only returns on
+    // error or orderly shutdown; the process exit code is the return value.
+    int run();
+
+private:
+    struct WorkerSlot {
+        unsigned bus;               // USB root bus this worker owns
+        int controlPort;            // Worker's loopback control port
+        std::string ringPath;       // Shared-memory ring file
+        ShmServer::Slot *slots;     // Master's writer mapping, 0 until open
+    };
+
+    Document &mConfig;
+    std::string mConfigPath;
+    std::string mConfigText;        // Serialized config, reparsed per worker
+    bool mVerbose;
+
+    std::vector<WorkerSlot> mWorkers;
+    pid_t mSpawnerPid;
+
+    // Serializes publishFrame: the seqlock writer protocol allows one
+    // writer per slot, but frames arrive on every TCP shard thread and
+    // the UDP thread. This is off the workers' USB fast path.
+    tthread::mutex mPublishMutex;
+
+    TcpNetServer mTcpNetServer;
+    UDPNetServer mUdpNetServer;
+
+    // Master side
+    bool enumerateBuses();
+    bool openRing(WorkerSlot &slot);
+    bool startNetwork();
+    int superviseLoop();
+    void publishFrame(OPC::Message &msg);
+    static void cbOpcMessage(OPC::Message &msg, void *context);
+    static void cbJsonMessage(libwebsocket *wsi, rapidjson::Document &message, void *context);
+
+    // Spawner process: fork and respawn workers; never returns
+    void spawnerMain();
+    pid_t forkWorker(const WorkerSlot &slot);
+
+    // Worker process: build the per-bus config and run FCServer; never returns
+    void workerMain(const WorkerSlot &slot);
+    static void replaceConfigMember(Document &config, const char *key, Value &value);
+};
+
+#endif  // OS_LINUX
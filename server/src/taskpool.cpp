@@ -0,0 +1,154 @@
+/*
+ * Shared work-stealing task pool for server-side parallel work.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "taskpool.h"
+#include "rtsched.h"
+
+
+TaskPool &TaskPool::shared()
+{
+    // Constructed on first use; the pool lives until process exit, like
+    // the process-wide LUT cache in FCDevice.
+    static TaskPool *pool = new TaskPool();
+    return *pool;
+}
+
+TaskPool::TaskPool(unsigned numWorkers)
+    : mNextQueue(0), mPending(0), mShutdown(false)
+{
+    if (!numWorkers) {
+        numWorkers = tthread::thread::hardware_concurrency();
+        if (!numWorkers) {
+            numWorkers = 1;
+        }
+    }
+
+    for (unsigned i = 0; i < numWorkers; i++) {
+        Worker *w = new Worker;
+        w->pool = this;
+        w->thread = 0;
+        mWorkers.push_back(w);
+    }
+
+    // Start the threads only after the worker vector is complete, since
+    // an idle worker scans every peer's deque.
+    for (unsigned i = 0; i < numWorkers; i++) {
+        mWorkers[i]->thread = new tthread::thread(workerThreadFunc, mWorkers[i]);
+    }
+}
+
+TaskPool::~TaskPool()
+{
+    mSleepMutex.lock();
+    mShutdown = true;
+    mSleepCond.notify_all();
+    mSleepMutex.unlock();
+
+    for (unsigned i = 0; i < mWorkers.size(); i++) {
+        mWorkers[i]->thread->join();
+        delete mWorkers[i]->thread;
+        delete mWorkers[i];
+    }
+}
+
+void TaskPool::submit(task_t task, void *arg)
+{
+    Task t = { task, arg };
+
+    unsigned i = __sync_fetch_and_add(&mNextQueue, 1) % mWorkers.size();
+    Worker &w = *mWorkers[i];
+    w.lock.lock();
+    w.queue.push_back(t);
+    w.lock.unlock();
+
+    // Raise the pending count before signaling; see the header comment
+    __sync_add_and_fetch(&mPending, 1);
+    mSleepMutex.lock();
+    mSleepCond.notify_one();
+    mSleepMutex.unlock();
+}
+
+bool TaskPool::take(Worker *self, Task &task)
+{
+    // Own deque first, newest task first: freshly submitted work tends to
+    // have its data still warm in this worker's cache.
+    self->lock.lock();
+    if (!self->queue.empty()) {
+        task = self->queue.back();
+        self->queue.pop_back();
+        self->lock.unlock();
+        return true;
+    }
+    self->lock.unlock();
+
+    // Steal the oldest task from a busy peer; oldest has waited longest
+    // and is least likely to be cache-warm anywhere.
+    for (unsigned i = 0; i < mWorkers.size(); i++) {
+        Worker *peer = mWorkers[i];
+        if (peer == self) {
+            continue;
+        }
+        peer->lock.lock();
+        if (!peer->queue.empty()) {
+            task = peer->queue.front();
+            peer->queue.pop_front();
+            peer->lock.unlock();
+            return true;
+        }
+        peer->lock.unlock();
+    }
+
+    return false;
+}
+
+void TaskPool::workerThreadFunc(void *arg)
+{
+    Worker *self = (Worker*) arg;
+    self->pool->workerLoop(self);
+}
+
+void TaskPool::workerLoop(Worker *self)
+{
+    // Pool workers run background work; schedulable via the "tasks" name
+    RtSched::applyToCurrentThread("tasks");
+
+    for (;;) {
+        Task task;
+        if (take(self, task)) {
+            __sync_sub_and_fetch(&mPending, 1);
+            task.fn(task.arg);
+            continue;
+        }
+
+        mSleepMutex.lock();
+        while (!mPending && !mShutdown) {
+            mSleepCond.wait(mSleepMutex);
+        }
+        bool shutdown = mShutdown;
+        mSleepMutex.unlock();
+
+        if (shutdown) {
+            return;
+        }
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * Shared work-stealing task pool for server-side parallel work.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include "tinythread.h"
+#include "adaptivemutex.h"
+#include <deque>
+#include <vector>
+
+
+/*
+ * TaskPool runs one-shot tasks on a small set of threads sized to the
+ * machine, so the server's occasional parallel work -- device attach,
+ * benchmark runs, and future parallel frame stages -- shares one
+ * scheduler instead of each feature spawning its own threads and
+ * oversubscribing a small controller.
+ *
+ * Scheduling is work-stealing over per-worker deques: submission
+ * round-robins tasks across the workers, each worker serves its own deque
+ * newest-first, and an idle worker steals the oldest task from a busy
+ * one. Each deque has its own lock, so submitters and unrelated workers
+ * rarely contend, and tasks queued behind a long-running one (a device
+ * attach can take hundreds of milliseconds) are picked up by whichever
+ * worker goes idle first.
+ *
+ * Tasks must not block indefinitely: a task that waits forever occupies a
+ * worker forever. Long-running service loops (transport polling, device
+ * writers) keep their own dedicated threads.
+ */
+class TaskPool
+{
+public:
+    typedef void (*task_t)(void *arg);
+
+    // The process-wide pool, created on first use, one worker per CPU.
+    // Intended for everything except tests; lives until process exit.
+    static TaskPool &shared();
+
+    TaskPool(unsigned numWorkers = 0);      // 0: one per CPU
+    ~TaskPool();
+
+    // Queue one task to run on some pool worker. Never blocks.
+    void submit(task_t task, void *arg);
+
+    unsigned numWorkers() const { return mWorkers.size(); }
+
+private:
+    struct Task {
+        task_t fn;
+        void *arg;
+    };
+
+    struct Worker {
+        TaskPool *pool;
+        tthread::thread *thread;
+        AdaptiveMutex lock;
+        std::deque<Task> queue;
+    };
+
+    std::vector<Worker*> mWorkers;
+    volatile uint32_t mNextQueue;       // Round-robin submission cursor
+
+    /*
+     * Sleep bookkeeping. mPending counts queued-but-unclaimed tasks;
+     * submit() raises it before signaling, and a worker lowers it as it
+     * claims a task, so a wakeup can never be lost between a worker's
+     * last empty scan and its wait.
+     */
+    volatile uint32_t mPending;
+    volatile bool mShutdown;
+    tthread::mutex mSleepMutex;
+    tthread::condition_variable mSleepCond;
+
+    static void workerThreadFunc(void *arg);
+    void workerLoop(Worker *self);
+    bool take(Worker *self, Task &task);
+};
@@ -26,6 +26,7 @@
  */
 
 #include "tcpnetserver.h"
+#include "rtsched.h"
 #include "version.h"
 #include "libwebsockets.h"
 #include "rapidjson/stringbuffer.h"
@@ -35,13 +36,17 @@
 
 
 TcpNetServer::TcpNetServer(OPC::callback_t opcCallback, jsonCallback_t jsonCallback,
-    void *context, bool verbose)
-    : mOpcCallback(opcCallback), mJsonCallback(jsonCallback),
-      mUserContext(context), mThread(0), mVerbose(verbose)
+    void *context, bool verbose, OPC::batch_callback_t opcBatchCallback)
+    : mOpcCallback(opcCallback), mOpcBatchCallback(opcBatchCallback),
+      mJsonCallback(jsonCallback), mMetricsCallback(0),
+      mUserContext(context), mVerbose(verbose),
+      mOpcMessagesTotal(0), mOpcBytesTotal(0)
 {}
 
-bool TcpNetServer::start(const char *host, int port)
+bool TcpNetServer::start(const char *host, int port, unsigned shards)
 {
+    buildHTTPCache();
+
     const int llNormal = LLL_ERR | LLL_WARN;
     const int llVerbose = llNormal | LLL_NOTICE;
 
@@ -51,28 +56,37 @@ bool TcpNetServer::start(const char *host, int port)
             "fcserver",             // Name
             lwsCallback,            // Callback
             sizeof(Client),         // Protocol-specific data size
-            sizeof(OPC::Message),   // Max frame size / rx buffer
+            RX_BUFFER_BYTES,        // Rx buffer; OPC reassembles larger packets
         },
 
         { NULL, NULL, 0, 0 }    // terminator
     };
 
-    struct lws_context_creation_info info;
-    memset(&info, 0, sizeof info);
-    info.gid = -1;
-    info.uid = -1;
-    info.host = host;
-    info.port = port;
-    info.protocols = protocols;
-    info.user = this;
-
     // Quieter during create_context, since it's kind of chatty.
     lws_set_log_level(llNormal, NULL);
 
-    struct libwebsocket_context *context = libwebsocket_create_context(&info);
-    if (!context) {
-        lwsl_err("libwebsocket init failed\n");
-        return false;
+    for (unsigned i = 0; i < shards; i++) {
+        Shard *shard = new Shard;
+        shard->server = this;
+        shard->thread = 0;
+
+        struct lws_context_creation_info info;
+        memset(&info, 0, sizeof info);
+        info.gid = -1;
+        info.uid = -1;
+        info.host = host;
+        info.port = port + i;
+        info.protocols = protocols;
+        info.user = shard;
+
+        shard->context = libwebsocket_create_context(&info);
+        if (!shard->context) {
+            lwsl_err("libwebsocket init failed\n");
+            delete shard;
+            return false;
+        }
+
+        mShards.push_back(shard);
     }
 
     // Maybe set up a more verbose log level now.
@@ -80,11 +94,18 @@ bool TcpNetServer::start(const char *host, int port)
         lws_set_log_level(llVerbose, NULL);
     }
 
-    lwsl_notice("Server listening on %s:%d\n", host ? host : "*", port);
+    if (shards > 1) {
+        lwsl_notice("Server listening on %s:%d through %d (%d shards)\n",
+            host ? host : "*", port, port + shards - 1, shards);
+    } else {
+        lwsl_notice("Server listening on %s:%d\n", host ? host : "*", port);
+    }
 
-    // Note that we pass ownership of all libwebsockets state to this new thread.
+    // Note that we pass ownership of each context to its service thread.
     // We shouldn't access it on the other threads afterwards.
-    mThread = new tthread::thread(threadFunc, context);
+    for (std::vector<Shard*>::iterator i = mShards.begin(), e = mShards.end(); i != e; ++i) {
+        (*i)->thread = new tthread::thread(threadFunc, *i);
+    }
 
     return true;
 }
@@ -95,12 +116,24 @@ bool TcpNetServer::startRelay(const char *host, int port)
     const int llVerbose = llNormal | LLL_NOTICE;
 
     static struct libwebsocket_protocols protocols[] = {
-        // Only one protocol for now. Handles HTTP as well as our default WebSockets protocol.
         {
             "fcserver-relay",       // Name
             lwsRelayCallback,       // Callback
             sizeof(Client),         // Protocol-specific data size
-            sizeof(OPC::Message),   // Max frame size / rx buffer
+            RX_BUFFER_BYTES,        // Rx buffer; OPC reassembles larger packets
+        },
+
+        /*
+         * Same relay stream, but each message is run-length encoded (PackBits)
+         * before transmission. Clients opt in at connect time by requesting
+         * this subprotocol; useful over WAN links, where LED frames compress
+         * very well. The local uncompressed path is untouched.
+         */
+        {
+            "fcserver-relay-packbits",
+            lwsRelayCallback,
+            sizeof(Client),
+            RX_BUFFER_BYTES,
         },
 
         { NULL, NULL, 0, 0 }    // terminator
@@ -133,15 +166,18 @@ bool TcpNetServer::startRelay(const char *host, int port)
 
     // Note that we pass ownership of all libwebsockets state to this new thread.
     // We shouldn't access it on the other threads afterwards.
-    mRelayThread = new tthread::thread(threadFunc, context);
+    mRelayThread = new tthread::thread(relayThreadFunc, context);
 
     return true;
 }
 
 void TcpNetServer::threadFunc(void *arg)
 {
-    struct libwebsocket_context *context = (libwebsocket_context*) arg;
-    TcpNetServer *self = (TcpNetServer*) libwebsocket_context_user(context);
+    Shard *shard = (Shard*) arg;
+
+    // Ingest threads stay time-shared, but can be pinned away from the
+    // output threads via the "threads" config section.
+    RtSched::placeCurrentThread("net");
 
     /*
      * Mostly we're just handling incoming events from libwebsocket's poll(),
@@ -153,8 +189,22 @@ void TcpNetServer::threadFunc(void *arg)
      * that much. During normal operation we'll be receiving lots of data over the
      * network anyway.
      */
+    while (libwebsocket_service(shard->context, 100) >= 0) {
+        shard->server->flushBroadcastList(*shard);
+    }
+
+    libwebsocket_context_destroy(shard->context);
+}
+
+void TcpNetServer::relayThreadFunc(void *arg)
+{
+    struct libwebsocket_context *context = (libwebsocket_context*) arg;
+    TcpNetServer *self = (TcpNetServer*) libwebsocket_context_user(context);
+
+    RtSched::placeCurrentThread("relay");
+
     while (libwebsocket_service(context, 100) >= 0) {
-        self->flushBroadcastList();
+        self->flushRelayQueues();
     }
 
     libwebsocket_context_destroy(context);
@@ -173,7 +223,8 @@ int TcpNetServer::lwsCallback(libwebsocket_context *context, libwebsocket *wsi,
      * from the 'http' directory. Our web UI interacts with the server via the public WebSockets API.
      */
 
-    TcpNetServer *self = (TcpNetServer*) libwebsocket_context_user(context);
+    Shard *shard = (Shard*) libwebsocket_context_user(context);
+    TcpNetServer *self = shard->server;
     Client *client = (Client*) user;
 
     switch (reason) {
@@ -181,14 +232,18 @@ int TcpNetServer::lwsCallback(libwebsocket_context *context, libwebsocket *wsi,
         case LWS_CALLBACK_CLOSED_HTTP:
         case LWS_CALLBACK_DEL_POLL_FD:
             if (client && client->opcBuffer) {
-                free(client->opcBuffer);
+                self->releaseOPCBuffer(client->opcBuffer);
                 client->opcBuffer = NULL;
             }
-            self->mClients.erase(wsi);
+            if (client && client->httpAllocated) {
+                delete [] client->httpAllocated;
+                client->httpAllocated = NULL;
+            }
+            shard->clients.erase(wsi);
             break;
 
         case LWS_CALLBACK_ESTABLISHED:
-            self->mClients.insert(wsi);
+            shard->clients.insert(wsi);
             break;
 
         case LWS_CALLBACK_HTTP:
@@ -240,17 +295,63 @@ int TcpNetServer::lwsRelayCallback(libwebsocket_context *context, libwebsocket *
         case LWS_CALLBACK_CLOSED_HTTP:
         case LWS_CALLBACK_DEL_POLL_FD:
             if (client && client->opcBuffer) {
-                free(client->opcBuffer);
+                self->releaseOPCBuffer(client->opcBuffer);
                 client->opcBuffer = NULL;
             }
-            if (self->mRelayClients.erase(wsi) > 0) {
-                lwsl_notice("Relay client disconnected!\n");
+            if (client && client->httpAllocated) {
+                delete [] client->httpAllocated;
+                client->httpAllocated = NULL;
+            }
+            {
+                self->mRelayMutex.lock();
+                std::map<libwebsocket*, RelayClient>::iterator entry = self->mRelayClients.find(wsi);
+                if (entry != self->mRelayClients.end()) {
+                    // Release anything still queued for this client
+                    std::vector<RelayBuffer*> &queue = entry->second.queue;
+                    for (std::vector<RelayBuffer*>::iterator buf = queue.begin(); buf != queue.end(); ++buf) {
+                        self->releaseRelayBuffer(*buf);
+                    }
+                    self->mRelayClients.erase(entry);
+                    lwsl_notice("Relay client disconnected!\n");
+                }
+                self->mRelayMutex.unlock();
             }
             break;
 
         case LWS_CALLBACK_ESTABLISHED:
-            lwsl_notice("Relay client connected!\n");
-            self->mRelayClients.insert(wsi);
+            {
+                const struct libwebsocket_protocols *proto = libwebsockets_get_protocol(wsi);
+                bool compressed = proto && proto->name && !strcmp(proto->name, "fcserver-relay-packbits");
+                lwsl_notice("Relay client connected%s!\n", compressed ? " (packbits)" : "");
+                self->mRelayMutex.lock();
+                RelayClient &relay = self->mRelayClients[wsi];
+                relay.filtered = false;
+                relay.compressed = compressed;
+                self->mRelayMutex.unlock();
+            }
+            break;
+
+        case LWS_CALLBACK_RECEIVE:
+            /*
+             * Channel subscription: a binary frame listing the OPC channel
+             * numbers this client wants. An empty frame reverts to the
+             * default, relaying everything.
+             */
+            {
+                self->mRelayMutex.lock();
+                RelayClient &relay = self->mRelayClients[wsi];
+                if (len == 0) {
+                    relay.filtered = false;
+                } else {
+                    uint8_t *channels = (uint8_t*) in;
+                    memset(relay.channelMask, 0, sizeof relay.channelMask);
+                    for (size_t i = 0; i != len; i++) {
+                        relay.channelMask[channels[i] >> 3] |= 1 << (channels[i] & 7);
+                    }
+                    relay.filtered = true;
+                }
+                self->mRelayMutex.unlock();
+            }
             break;
 
         default:
@@ -266,43 +367,27 @@ int TcpNetServer::opcRead(libwebsocket_context *context, libwebsocket *wsi,
     /*
      * Open Pixel Control packet dispatch, and protocol detection.
      *
-     * Store the new packet in our protocol buffer. This should be large enough to never overflow,
-     * since our OPC buffer is large enough for two packets and the OPC max packet size is much larger
-     * than the network receive buffer.
-     *
-     * If we have no buffered data yet, we can do this without copying.
+     * Complete packets are parsed in place in the socket receive buffer and
+     * dispatched without an intermediate copy. The per-client reassembly
+     * buffer only ever holds one partial packet: when new data arrives we
+     * copy just enough bytes to finish that packet, dispatch it, and go
+     * back to parsing in place.
      */
 
     OPCBuffer *opcb;
-    uint8_t *buffer;
-    unsigned bufferLength;    
 
     // Allocate the buffer we use for OPC reassembly and protocol-detect.
     if (client.opcBuffer == NULL) {
-        opcb = (OPCBuffer*) malloc(sizeof *client.opcBuffer);
+        opcb = allocOPCBuffer();
         if (opcb == NULL) {
             lwsl_err("ERROR: Out of memory allocating OPC reassembly buffer.\n");
             return -1;
         }
-        opcb->bufferLength = 0;
         client.opcBuffer = opcb;
     } else {
         opcb = client.opcBuffer;
     }
 
-    if (len + opcb->bufferLength > sizeof opcb->buffer) {
-        return -1;
-    }
-
-    if (opcb->bufferLength) {
-        memcpy(opcb->bufferLength + opcb->buffer, in, len);
-        buffer = opcb->buffer;
-        bufferLength = opcb->bufferLength + len;
-    } else {
-        buffer = in;
-        bufferLength = len;
-    }
-
     if (client.state == CLIENT_STATE_PROTOCOL_DETECT) {
         /*
          * It's a new connection, and we aren't sure yet whether it's native OPC
@@ -310,67 +395,132 @@ int TcpNetServer::opcRead(libwebsocket_context *context, libwebsocket *wsi,
          * "GET ", we assume this is HTTP. (Other HTTP methods are not needed).
          * If it's anything else, we interpret the connection as native OPC and these
          * are the first four bytes of the first OPC packet.
+         *
+         * Data is staged in the reassembly buffer until we've made the call;
+         * this copy only ever happens for a connection's first read or two.
          */
 
-        if (bufferLength < 4) {
-            // Not enough data for protocol detect yet. Save this data for later.
+        if (len + opcb->bufferLength > sizeof opcb->buffer) {
+            return -1;
+        }
 
-            if (buffer != opcb->buffer) {
-                memcpy(opcb->buffer, buffer, bufferLength);
-                opcb->bufferLength = bufferLength;
-            }
+        memcpy(opcb->buffer + opcb->bufferLength, in, len);
+        opcb->bufferLength += len;
 
+        if (opcb->bufferLength < 4) {
+            // Not enough data for protocol detect yet.
             // Do not pass this data on to libwebsocket yet
             return 1;
         }
 
+        uint8_t *buffer = opcb->buffer;
         if (buffer[0] == 'G' && buffer[1] == 'E' && buffer[2] == 'T' && buffer[3] == ' ') {
             // Detected HTTP. Convert this to an HTTP client, and let libwebsockets handle
             // all data received so far. We can jettison the OPC buffer at this point.
 
-            free(client.opcBuffer);
-            client.opcBuffer = 0;
+            unsigned bufferLength = opcb->bufferLength;
             client.state = CLIENT_STATE_HTTP;
 
-            if (libwebsocket_read(context, wsi, buffer, bufferLength) < 0) {
+            int r = libwebsocket_read(context, wsi, buffer, bufferLength);
+
+            releaseOPCBuffer(client.opcBuffer);
+            client.opcBuffer = 0;
+
+            if (r < 0) {
                 return -1;
             }
             return 1;
         }
 
-        // Not HTTP. Handle this as an OPC socket.
+        // Not HTTP. Handle this as an OPC socket, parsing the staged bytes in place.
         client.state = CLIENT_STATE_OPEN_PIXEL_CONTROL;
         lwsl_notice("New Open Pixel Control connection\n");
+
+        in = opcb->buffer;
+        len = opcb->bufferLength;
+        opcb->bufferLength = 0;
     }
 
-    // Process any and all complete packets from our buffer
-    while (1) {
+    /*
+     * Finish any partial packet left over from previous reads, copying the
+     * minimum number of bytes: first enough to see the header, then enough
+     * to complete the packet. Whatever remains of this read is parsed in
+     * place below. The loop exits with either the reassembly buffer or the
+     * read drained, never both holding data.
+     */
+
+    while (opcb->bufferLength && len) {
+        OPC::Message *msg = (OPC::Message*) opcb->buffer;
+        unsigned needed;
 
-        if (bufferLength < OPC::HEADER_BYTES) {
-            // Still waiting for a header
-            break;
+        if (opcb->bufferLength < OPC::HEADER_BYTES) {
+            needed = OPC::HEADER_BYTES - opcb->bufferLength;
+        } else {
+            needed = OPC::HEADER_BYTES + msg->length() - opcb->bufferLength;
         }
 
-        OPC::Message *msg = (OPC::Message*) buffer;
+        unsigned take = std::min<size_t>(needed, len);
+        memcpy(opcb->buffer + opcb->bufferLength, in, take);
+        opcb->bufferLength += take;
+        in += take;
+        len -= take;
+
+        if (opcb->bufferLength >= OPC::HEADER_BYTES &&
+            opcb->bufferLength == OPC::HEADER_BYTES + msg->length()) {
+            // Completed the buffered packet
+            __sync_fetch_and_add(&mOpcMessagesTotal, 1);
+            __sync_fetch_and_add(&mOpcBytesTotal, opcb->bufferLength);
+            mOpcCallback(*msg, mUserContext);
+            opcb->bufferLength = 0;
+        }
+    }
+
+    /*
+     * Process any and all complete packets directly from the receive buffer.
+     * High-rate senders batch several messages per TCP segment, so complete
+     * messages are collected and handed to the dispatcher as a batch,
+     * amortizing its per-dispatch overhead across the read.
+     */
+
+    OPC::Message *batch[MAX_OPC_BATCH];
+    unsigned batchCount = 0;
+
+    while (len >= OPC::HEADER_BYTES) {
+        OPC::Message *msg = (OPC::Message*) in;
         unsigned msgLength = OPC::HEADER_BYTES + msg->length();
 
-        if (bufferLength < msgLength) {
+        if (len < msgLength) {
             // Waiting for more data
             break;
         }
 
-        // Complete packet.
-        mOpcCallback(*msg, mUserContext);
+        __sync_fetch_and_add(&mOpcMessagesTotal, 1);
+        __sync_fetch_and_add(&mOpcBytesTotal, msgLength);
+
+        if (mOpcBatchCallback) {
+            batch[batchCount++] = msg;
+            if (batchCount == MAX_OPC_BATCH) {
+                mOpcBatchCallback(batch, batchCount, mUserContext);
+                batchCount = 0;
+            }
+        } else {
+            mOpcCallback(*msg, mUserContext);
+        }
+
+        in += msgLength;
+        len -= msgLength;
+    }
 
-        buffer += msgLength;
-        bufferLength -= msgLength;
+    if (batchCount) {
+        mOpcBatchCallback(batch, batchCount, mUserContext);
     }
 
-    // If we have any residual data, save it for later.
-    if (bufferLength && buffer != opcb->buffer) {
-        memmove(opcb->buffer, buffer, bufferLength);
+    // If we have any residual data, save it for later. (memmove: 'in' may
+    // point into the reassembly buffer after the protocol-detect handoff.)
+    if (len) {
+        memmove(opcb->buffer, in, len);
+        opcb->bufferLength = len;
     }
-    opcb->bufferLength = bufferLength;
 
     // Don't pass data on to libwebsockets
     return 1;
@@ -405,33 +555,87 @@ int TcpNetServer::httpBegin(libwebsocket_context *context, libwebsocket *wsi,
      *       them back with deflate content-encoding.
      */
 
+    if (mMetricsCallback && httpPathEqual("/metrics", path)) {
+        /*
+         * Dynamically generated plaintext counters, in Prometheus format.
+         * Unlike the compiled-in documents this body is built per request,
+         * so the client owns its copy.
+         */
+
+        std::string text;
+        mMetricsCallback(text, mUserContext);
+
+        char buffer[1024];
+        int size = snprintf(buffer, sizeof buffer,
+            "HTTP/1.1 200 OK\r\n"
+            "Server: %s\r\n"
+            "Content-Type: text/plain; version=0.0.4\r\n"
+            "Content-Length: %u\r\n"
+            "Connection: close\r\n"
+            "\r\n",
+            kFCServerVersion,
+            (unsigned) text.size()
+        );
+
+        if (libwebsocket_write(wsi, (unsigned char*) buffer, size, LWS_WRITE_HTTP) < 0) {
+            return -1;
+        }
+
+        client.httpAllocated = new char[text.size()];
+        memcpy(client.httpAllocated, text.data(), text.size());
+        client.httpBody = client.httpAllocated;
+        client.httpLength = text.size();
+        libwebsocket_callback_on_writable(context, wsi);
+
+        return 0;
+    }
+
     HTTPDocument *doc = httpDocumentList;
+    unsigned index = 0;
 
     // Look for this path in the document list. If it isn't found, we'll serve the 404 doc.
-    while (doc->path && !httpPathEqual(doc->path, path))
+    while (doc->path && !httpPathEqual(doc->path, path)) {
         doc++;
+        index++;
+    }
 
     if (!doc->path) {
         lwsl_notice("HTTP document not found, \"%s\"\n", path);
     }
 
-    char buffer[1024];
-    int size = snprintf(buffer, sizeof buffer,
-        "HTTP/1.1 %d %s\r\n"
-        "Server: %s\r\n"
-        "Content-Type: %s\r\n"
-        "Content-Length: %u\r\n"
-        "Content-Encoding: deflate\r\n"
-        "Connection: close\r\n"
-        "\r\n",
-        doc->path ? 200 : 404,
-        doc->path ? "OK" : "Not Found",
-        kFCServerVersion,
-        doc->contentType,
-        doc->contentLength
-    );
-
-    if (libwebsocket_write(wsi, (unsigned char*) buffer, size, LWS_WRITE_HTTP) < 0) {
+    HTTPCacheEntry &entry = mHTTPCache[index];
+
+    if (doc->path) {
+        // Revalidation: a matching If-None-Match saves sending the body
+        char inm[sizeof entry.etag];
+        if (lws_hdr_copy(wsi, inm, sizeof inm, WSI_TOKEN_HTTP_IF_NONE_MATCH) > 0 &&
+            !strcmp(inm, entry.etag)) {
+
+            char buffer[256];
+            int size = snprintf(buffer, sizeof buffer,
+                "HTTP/1.1 304 Not Modified\r\n"
+                "Server: %s\r\n"
+                "ETag: %s\r\n"
+                "Connection: close\r\n"
+                "\r\n",
+                kFCServerVersion,
+                entry.etag
+            );
+
+            if (libwebsocket_write(wsi, (unsigned char*) buffer, size, LWS_WRITE_HTTP) < 0) {
+                return -1;
+            }
+
+            // No body; the writable callback sees a NULL httpBody and closes
+            client.httpBody = 0;
+            libwebsocket_callback_on_writable(context, wsi);
+            return 0;
+        }
+    }
+
+    // Headers were preformatted at startup; just send the blob
+    if (libwebsocket_write(wsi, (unsigned char*) entry.header, entry.headerLength,
+        LWS_WRITE_HTTP) < 0) {
         return -1;
     }
 
@@ -443,6 +647,50 @@ int TcpNetServer::httpBegin(libwebsocket_context *context, libwebsocket *wsi,
     return 0;
 }
 
+void TcpNetServer::buildHTTPCache()
+{
+    /*
+     * Preformat the response for every compiled-in document, 404 sentinel
+     * included. The ETag is a 64-bit FNV-1a hash of the (compressed) body,
+     * strong because the body it tags is exactly the body we serve.
+     */
+
+    for (HTTPDocument *doc = httpDocumentList; ; doc++) {
+        HTTPCacheEntry entry;
+
+        uint64_t hash = 14695981039346656037ULL;
+        for (int i = 0; i < doc->contentLength; i++) {
+            hash ^= (uint8_t) doc->body[i];
+            hash *= 1099511628211ULL;
+        }
+        snprintf(entry.etag, sizeof entry.etag, "\"%016llx\"", (unsigned long long) hash);
+
+        entry.headerLength = snprintf(entry.header, sizeof entry.header,
+            "HTTP/1.1 %d %s\r\n"
+            "Server: %s\r\n"
+            "Content-Type: %s\r\n"
+            "Content-Length: %u\r\n"
+            "Content-Encoding: deflate\r\n"
+            "ETag: %s\r\n"
+            "Cache-Control: max-age=300, must-revalidate\r\n"
+            "Connection: close\r\n"
+            "\r\n",
+            doc->path ? 200 : 404,
+            doc->path ? "OK" : "Not Found",
+            kFCServerVersion,
+            doc->contentType,
+            doc->contentLength,
+            entry.etag
+        );
+
+        mHTTPCache.push_back(entry);
+
+        if (!doc->path) {
+            break;
+        }
+    }
+}
+
 int TcpNetServer::httpWrite(libwebsocket_context *context, libwebsocket *wsi, Client &client)
 {
     if (!client.httpBody) {
@@ -489,13 +737,20 @@ int TcpNetServer::wsRead(libwebsocket_context *context, libwebsocket *wsi, Clien
         }
 
         msg->setLength(len - OPC::HEADER_BYTES);
+        __sync_fetch_and_add(&mOpcMessagesTotal, 1);
+        __sync_fetch_and_add(&mOpcBytesTotal, len);
         mOpcCallback(*msg, mUserContext);
 
         return 0;
     }
 
     // Text frames are JSON encoded. Does that parse?
-    rapidjson::Document message;
+    // The document draws from the shard's arena, so steady-state control
+    // messages don't churn the heap while pixels are streaming. Replies
+    // built onto this document share the arena too.
+    Shard *shard = (Shard*) libwebsocket_context_user(context);
+    rapidjson::MemoryPoolAllocator<> arena(shard->jsonArena, sizeof shard->jsonArena);
+    rapidjson::Document message(&arena);
     message.ParseInsitu<0>((char*) in);
 
     if (message.HasParseError()) {
@@ -520,6 +775,42 @@ int TcpNetServer::jsonReply(libwebsocket *wsi, rapidjson::Document &message)
     return jsonBufferSend(buffer, wsi);
 }
 
+int TcpNetServer::jsonReplySpliced(libwebsocket *wsi, rapidjson::Document &message,
+    const char *key, const std::string &json)
+{
+    /*
+     * Serialize the reply object, then rewrite its closing brace to append
+     * one more member whose value is already-serialized JSON text. The
+     * cached text is copied byte-for-byte into the send buffer, so the
+     * cost is independent of how complex the spliced value is.
+     */
+
+    jsonBuffer_t buffer;
+
+    rapidjson::PutN<>(buffer, 0, LWS_SEND_BUFFER_PRE_PADDING);
+
+    rapidjson::Writer<rapidjson::GenericStringBuffer<rapidjson::UTF8<> > > writer(buffer);
+    message.Accept(writer);
+
+    // Replace the object's closing '}' with ,"key":<json>}
+    buffer.stack_.template Pop<char>(1);
+    buffer.Put(',');
+    buffer.Put('"');
+    for (const char *p = key; *p; ++p) {
+        buffer.Put(*p);
+    }
+    buffer.Put('"');
+    buffer.Put(':');
+    for (std::string::const_iterator p = json.begin(); p != json.end(); ++p) {
+        buffer.Put(*p);
+    }
+    buffer.Put('}');
+
+    rapidjson::PutN<>(buffer, 0, LWS_SEND_BUFFER_POST_PADDING);
+
+    return jsonBufferSend(buffer, wsi);
+}
+
 void TcpNetServer::jsonBufferPrepare(jsonBuffer_t &buffer, rapidjson::Value &value)
 {
     // Pre-packet padding
@@ -540,47 +831,246 @@ int TcpNetServer::jsonBufferSend(jsonBuffer_t &buffer, libwebsocket *wsi)
     return libwebsocket_write(wsi, (unsigned char *) string, len, LWS_WRITE_TEXT);
 }
 
-void TcpNetServer::flushBroadcastList()
+void TcpNetServer::flushBroadcastList(Shard &shard)
 {
-    // Send any pending broadcast packets. These are enqueued by other threads on a list
-    // protected by mBroadcastMutex.
+    // Send this shard's pending broadcast packets to the clients it owns.
+    // The packets are enqueued by other threads under mBroadcastMutex.
 
     mBroadcastMutex.lock();
-    for (std::vector<jsonBuffer_t*>::iterator buf = mBroadcastList.begin(); buf != mBroadcastList.end(); ++buf) {
-        for (std::set<libwebsocket*>::iterator cli = mClients.begin(); cli != mClients.end(); ++cli) {
-            jsonBufferSend(**buf, *cli);
+    for (std::vector<BroadcastBuffer*>::iterator buf = shard.broadcastList.begin(); buf != shard.broadcastList.end(); ++buf) {
+        for (std::set<libwebsocket*>::iterator cli = shard.clients.begin(); cli != shard.clients.end(); ++cli) {
+            jsonBufferSend((*buf)->data, *cli);
+        }
+        if (--(*buf)->refCount == 0) {
+            delete *buf;
         }
-        delete *buf;
     }
-    mBroadcastList.clear();
+    shard.broadcastList.clear();
     mBroadcastMutex.unlock();
 }
 
 void TcpNetServer::jsonBroadcast(rapidjson::Document &message)
 {
-    jsonBuffer_t *buffer = new jsonBuffer_t();
-    jsonBufferPrepare(*buffer, message);
+    /*
+     * Serialize once, then share the same buffer with every shard. Each
+     * shard's service thread writes it to the clients that shard owns and
+     * drops its reference; the last one out frees it. Broadcast cost is one
+     * serialization plus O(clients) writes, regardless of fan-out.
+     */
+
+    BroadcastBuffer *buffer = new BroadcastBuffer;
+    jsonBufferPrepare(buffer->data, message);
 
     mBroadcastMutex.lock();
-    mBroadcastList.push_back(buffer);
+    buffer->refCount = mShards.size();
+    for (std::vector<Shard*>::iterator i = mShards.begin(), e = mShards.end(); i != e; ++i) {
+        (*i)->broadcastList.push_back(buffer);
+    }
     mBroadcastMutex.unlock();
+
+    if (buffer->refCount == 0) {
+        // No shards to deliver to (not started yet)
+        delete buffer;
+    }
 }
 
 void TcpNetServer::relayMessage(OPC::Message &msg)
 {
-    if (mRelayClients.size()) {
-        int headerLen = 4;
-        int bufferLen = headerLen + msg.length();
-        unsigned char buffer[bufferLen];
-        buffer[0] = (unsigned char)msg.channel;
-        buffer[1] = (unsigned char)msg.command;
-        buffer[2] = (unsigned char)msg.lenHigh;
-        buffer[3] = (unsigned char)msg.lenLow;
-        for (int i=0; i < msg.length(); i++) {
-            buffer[headerLen+i] = (unsigned char)msg.data[i];
+    /*
+     * Pack the message once into an immutable reference-counted buffer and
+     * queue it for every relay client; the relay service thread does the
+     * writes. The dispatch thread's cost is one copy per message instead of
+     * one per client, and a slow relay consumer drops its oldest messages
+     * rather than stalling anyone.
+     */
+
+    mRelayMutex.lock();
+
+    if (mRelayClients.empty()) {
+        mRelayMutex.unlock();
+        return;
+    }
+
+    // Plain and PackBits encodings each packed at most once, on first use
+    RelayBuffer *plain = 0;
+    RelayBuffer *packed = 0;
+
+    for (std::map<libwebsocket*, RelayClient>::iterator cli = mRelayClients.begin(); cli != mRelayClients.end(); ++cli) {
+        RelayClient &relay = cli->second;
+
+        // Per-client channel filter; channel 0 broadcasts always pass
+        if (relay.filtered && msg.channel != 0 &&
+            !(relay.channelMask[msg.channel >> 3] & (1 << (msg.channel & 7)))) {
+            continue;
+        }
+
+        RelayBuffer *&buffer = relay.compressed ? packed : plain;
+        if (!buffer) {
+            buffer = packRelayBuffer(msg, relay.compressed);
+            if (!buffer) {
+                continue;
+            }
         }
-        for (std::set<libwebsocket*>::iterator cli = mRelayClients.begin(); cli != mRelayClients.end(); ++cli) {
-            libwebsocket_write(*cli, buffer, bufferLen, LWS_WRITE_BINARY);
+
+        if (relay.queue.size() >= MAX_RELAY_BACKLOG) {
+            // Drop-oldest: a newer message always supersedes a stale one
+            releaseRelayBuffer(relay.queue.front());
+            relay.queue.erase(relay.queue.begin());
         }
+
+        relay.queue.push_back(buffer);
+        buffer->refCount++;
+    }
+
+    mRelayMutex.unlock();
+}
+
+TcpNetServer::RelayBuffer *TcpNetServer::packRelayBuffer(const OPC::Message &msg, bool compress)
+{
+    unsigned length = OPC::HEADER_BYTES + msg.length();
+
+    // PackBits worst case grows by one control byte per 128 input bytes,
+    // plus one more since the header and payload are encoded separately.
+    unsigned capacity = compress ? length + (length / 128) + 2 : length;
+
+    RelayBuffer *buffer = (RelayBuffer*) malloc(sizeof(RelayBuffer) +
+        LWS_SEND_BUFFER_PRE_PADDING + capacity + LWS_SEND_BUFFER_POST_PADDING);
+    if (!buffer) {
+        return 0;
+    }
+
+    buffer->refCount = 0;
+    uint8_t *payload = buffer->data + LWS_SEND_BUFFER_PRE_PADDING;
+
+    if (compress) {
+        uint8_t header[OPC::HEADER_BYTES] = { msg.channel, msg.command, msg.lenHigh, msg.lenLow };
+        unsigned packedLen = packBits(header, OPC::HEADER_BYTES, payload);
+        packedLen += packBits(msg.data, msg.length(), payload + packedLen);
+        buffer->length = packedLen;
+    } else {
+        payload[0] = msg.channel;
+        payload[1] = msg.command;
+        payload[2] = msg.lenHigh;
+        payload[3] = msg.lenLow;
+        memcpy(payload + OPC::HEADER_BYTES, msg.data, msg.length());
+        buffer->length = length;
+    }
+
+    return buffer;
+}
+
+unsigned TcpNetServer::packBits(const uint8_t *in, unsigned length, uint8_t *out)
+{
+    /*
+     * PackBits run-length encoding. Control byte n in [0, 127] means a
+     * literal run of n+1 bytes follows; n in [129, 255] means the next byte
+     * repeats 257-n times. LED frames are full of solid colors and black,
+     * which collapse into two-byte runs.
+     */
+
+    unsigned pos = 0;
+    unsigned outPos = 0;
+
+    while (pos < length) {
+        // Measure the run of identical bytes starting here
+        unsigned run = 1;
+        while (pos + run < length && run < 128 && in[pos + run] == in[pos]) {
+            run++;
+        }
+
+        if (run >= 2) {
+            out[outPos++] = 257 - run;
+            out[outPos++] = in[pos];
+            pos += run;
+            continue;
+        }
+
+        // Literal segment: scan ahead until the next run of 3+, or 128 bytes
+        unsigned literal = 1;
+        while (pos + literal < length && literal < 128) {
+            if (pos + literal + 2 < length &&
+                in[pos + literal] == in[pos + literal + 1] &&
+                in[pos + literal] == in[pos + literal + 2]) {
+                break;
+            }
+            literal++;
+        }
+
+        out[outPos++] = literal - 1;
+        memcpy(&out[outPos], &in[pos], literal);
+        outPos += literal;
+        pos += literal;
+    }
+
+    return outPos;
+}
+
+void TcpNetServer::flushRelayQueues()
+{
+    // Deliver queued relay messages, stopping early on clients whose
+    // send pipe is choked. Runs on the relay service thread.
+
+    mRelayMutex.lock();
+
+    for (std::map<libwebsocket*, RelayClient>::iterator cli = mRelayClients.begin(); cli != mRelayClients.end(); ++cli) {
+        std::vector<RelayBuffer*> &queue = cli->second.queue;
+
+        while (!queue.empty()) {
+            RelayBuffer *buffer = queue.front();
+            libwebsocket_write(cli->first, buffer->data + LWS_SEND_BUFFER_PRE_PADDING,
+                buffer->length, LWS_WRITE_BINARY);
+            queue.erase(queue.begin());
+            releaseRelayBuffer(buffer);
+
+            if (lws_send_pipe_choked(cli->first)) {
+                break;
+            }
+        }
+    }
+
+    mRelayMutex.unlock();
+}
+
+void TcpNetServer::releaseRelayBuffer(RelayBuffer *buffer)
+{
+    // Call with mRelayMutex held
+    if (--buffer->refCount == 0) {
+        free(buffer);
+    }
+}
+
+TcpNetServer::OPCBuffer *TcpNetServer::allocOPCBuffer()
+{
+    OPCBuffer *opcb = 0;
+
+    mOpcBufferPoolMutex.lock();
+    if (!mOpcBufferPool.empty()) {
+        opcb = mOpcBufferPool.back();
+        mOpcBufferPool.pop_back();
+    }
+    mOpcBufferPoolMutex.unlock();
+
+    if (!opcb) {
+        opcb = (OPCBuffer*) malloc(sizeof *opcb);
+        if (!opcb) {
+            return 0;
+        }
+    }
+
+    opcb->bufferLength = 0;
+    return opcb;
+}
+
+void TcpNetServer::releaseOPCBuffer(OPCBuffer *opcb)
+{
+    mOpcBufferPoolMutex.lock();
+    if (mOpcBufferPool.size() < MAX_POOLED_OPC_BUFFERS) {
+        mOpcBufferPool.push_back(opcb);
+        opcb = 0;
+    }
+    mOpcBufferPoolMutex.unlock();
+
+    if (opcb) {
+        free(opcb);
     }
 }
@@ -25,9 +25,11 @@
 #include <stdint.h>
 #include <vector>
 #include <set>
+#include <map>
 #include "rapidjson/document.h"
 #include "rapidjson/stringbuffer.h"
 #include "tinythread.h"
+#include "adaptivemutex.h"
 #include "libwebsockets.h"
 #include "opc.h"
 
@@ -36,11 +38,22 @@ class TcpNetServer {
 public:
     typedef void (*jsonCallback_t)(libwebsocket *wsi, rapidjson::Document &message, void *context);
 
+    // Produces the plaintext body for the /metrics HTTP endpoint
+    typedef void (*metricsCallback_t)(std::string &text, void *context);
+
     TcpNetServer(OPC::callback_t opcCallback, jsonCallback_t jsonCallback,
-        void *context, bool verbose = false);
+        void *context, bool verbose = false,
+        OPC::batch_callback_t opcBatchCallback = 0);
+
+    void setMetricsCallback(metricsCallback_t callback) { mMetricsCallback = callback; }
+
+    // Totals for OPC traffic received over TCP, for the metrics endpoint
+    uint64_t opcMessagesTotal() const { return mOpcMessagesTotal; }
+    uint64_t opcBytesTotal() const { return mOpcBytesTotal; }
 
-    // Start the event loop on a separate thread
-    bool start(const char *host, int port);
+    // Start the event loop. With more than one shard, additional service
+    // threads listen on consecutive ports following the configured one.
+    bool start(const char *host, int port, unsigned shards = 1);
 
     // Initialize the relay socket
     bool startRelay(const char *host, int port);
@@ -48,6 +61,11 @@ public:
     // Reply callback, for use only on the TcpNetServer thread. Call this inside jsonCallback.
     int jsonReply(libwebsocket *wsi, rapidjson::Document &message);
 
+    // As jsonReply, but splice a pre-serialized JSON value into the reply
+    // object as member 'key', avoiding a deep copy of large cached values.
+    int jsonReplySpliced(libwebsocket *wsi, rapidjson::Document &message,
+        const char *key, const std::string &json);
+
     // Broadcast JSON to all clients, from any thread.
     void jsonBroadcast(rapidjson::Document &message);
 
@@ -69,11 +87,39 @@ private:
         int contentLength;
     };
 
-    // Buffer used for protocol-detection and Open Pixel Control. Big enough for two OPC packets.
-    // This buffer is jettisonned 
+    /*
+     * Response cache built once at startup, one entry per compiled-in
+     * document (including the trailing 404 sentinel). The full header
+     * blob is preformatted with a strong ETag over the body, so serving
+     * a UI asset is two writes and zero formatting, and a matching
+     * If-None-Match turns into a 304 with no body at all.
+     */
+    struct HTTPCacheEntry {
+        char etag[24];
+        char header[512];
+        int headerLength;
+    };
+    std::vector<HTTPCacheEntry> mHTTPCache;
+
+    void buildHTTPCache();
+
+    /*
+     * The socket receive buffer handed to libwebsockets is deliberately
+     * small: a full OPC::Message per connection would cost 64 kB even for
+     * idle dashboard WebSockets and HTTP requests. OPC packets larger than
+     * one read are reassembled in an OPCBuffer, below.
+     */
+    static const unsigned RX_BUFFER_BYTES = 4096;
+
+    // Buffer used for protocol-detection and Open Pixel Control reassembly.
+    // Only ever holds one partial packet (or, during protocol detection, one
+    // read), so one OPC packet plus one read's worth of slack is enough.
+    // This buffer is jettisonned once a client turns out to be HTTP, and
+    // recycled through a small pool since it's a large allocation that only
+    // OPC clients ever need.
     struct OPCBuffer {
         unsigned bufferLength;
-        uint8_t buffer[2 * sizeof(OPC::Message)];
+        uint8_t buffer[sizeof(OPC::Message) + OPC::HEADER_BYTES];
     };
 
     struct Client {
@@ -82,30 +128,97 @@ private:
         // HTTP response state
         const char *httpBody;
         int httpLength;
+        char *httpAllocated;    // Owned body for dynamically generated responses
 
         // OPC and protocol-detection receive buffer.
         OPCBuffer *opcBuffer;
     };
 
     OPC::callback_t mOpcCallback;
+    OPC::batch_callback_t mOpcBatchCallback;
     jsonCallback_t mJsonCallback;
+    metricsCallback_t mMetricsCallback;
     void *mUserContext;
-    tthread::thread *mThread;
     bool mVerbose;
-    std::set<libwebsocket*> mClients;
+
+    // Hot-path traffic counters, updated with atomic adds from the shard threads
+    volatile uint64_t mOpcMessagesTotal;
+    volatile uint64_t mOpcBytesTotal;
 
     void *mRelayContext;
     tthread::thread *mRelayThread;
-    std::set<libwebsocket*> mRelayClients;
+
+    /*
+     * Relay fan-out: each message is packed once into an immutable
+     * reference-counted buffer and queued for every relay client; the relay
+     * service thread owns the actual socket writes. A slow client's backlog
+     * is capped with a drop-oldest policy so it can't pin buffers forever.
+     * All of this state is guarded by mRelayMutex.
+     */
+    struct RelayBuffer {
+        unsigned length;      // Payload bytes, excluding lws padding
+        unsigned refCount;
+        uint8_t data[4];      // PRE_PADDING + payload + POST_PADDING, allocated to fit
+    };
+    static const unsigned MAX_RELAY_BACKLOG = 64;
+    static const unsigned RELAY_CHANNEL_MASK_BYTES = 256 / 8;
+
+    /*
+     * A relay client receives every channel by default, but may send a
+     * subscription message (a binary frame listing the channel numbers it
+     * wants) to filter the stream. Broadcast messages on channel 0 are
+     * always relayed.
+     */
+    struct RelayClient {
+        std::vector<RelayBuffer*> queue;
+        uint8_t channelMask[RELAY_CHANNEL_MASK_BYTES];
+        bool filtered;
+        bool compressed;    // Negotiated via the "fcserver-relay-packbits" subprotocol
+    };
+    tthread::mutex mRelayMutex;
+    std::map<libwebsocket*, RelayClient> mRelayClients;
 
     typedef rapidjson::GenericStringBuffer<rapidjson::UTF8<> > jsonBuffer_t;
-    std::vector<jsonBuffer_t*> mBroadcastList;
     tthread::mutex mBroadcastMutex;
 
+    // One serialized broadcast message, shared by every shard that still
+    // has it queued. The reference count is guarded by mBroadcastMutex.
+    struct BroadcastBuffer {
+        jsonBuffer_t data;
+        unsigned refCount;
+    };
+
+    /*
+     * Each service shard owns one libwebsockets context, one thread, and the
+     * clients accepted on its port, so connection state is only ever touched
+     * by its owning thread. Broadcasts hand each shard its own serialized
+     * copy, queued under mBroadcastMutex. The vendored libwebsockets can't
+     * share a listening socket between threads, so shards listen on
+     * consecutive ports starting at the configured one.
+     */
+    /*
+     * Backing store for the per-message JSON arena. Each shard's service
+     * thread parses and replies to one message at a time, so a control
+     * message that fits here costs no heap allocations; larger ones spill
+     * into ordinary pool chunks that are freed when the message is done.
+     */
+    static const size_t JSON_ARENA_BYTES = 16 * 1024;
+
+    struct Shard {
+        TcpNetServer *server;
+        libwebsocket_context *context;
+        tthread::thread *thread;
+        std::set<libwebsocket*> clients;
+        std::vector<BroadcastBuffer*> broadcastList;
+        char jsonArena[JSON_ARENA_BYTES];
+    };
+    std::vector<Shard*> mShards;
+
     static HTTPDocument httpDocumentList[];
 
     // libwebsockets server
     static void threadFunc(void *arg);
+    static void relayThreadFunc(void *arg);
     static int lwsCallback(libwebsocket_context *context, libwebsocket *wsi,
         enum libwebsocket_callback_reasons reason, void *user, void *in, size_t len);
     static int lwsRelayCallback(libwebsocket_context *context, libwebsocket *wsi,
@@ -117,11 +230,27 @@ private:
     static bool httpPathEqual(const char *a, const char *b);
 
     // Open Pixel Control server
+    // Largest number of complete OPC messages dispatched per batch
+    static const unsigned MAX_OPC_BATCH = 16;
+
     int opcRead(libwebsocket_context *context, libwebsocket *wsi, Client &client, uint8_t *in, size_t len);
 
+    // OPC reassembly buffer pool, shared by the shard and relay threads
+    static const unsigned MAX_POOLED_OPC_BUFFERS = 8;
+    AdaptiveMutex mOpcBufferPoolMutex;
+    std::vector<OPCBuffer*> mOpcBufferPool;
+    OPCBuffer *allocOPCBuffer();
+    void releaseOPCBuffer(OPCBuffer *opcb);
+
     // WebSockets server
     int wsRead(libwebsocket_context *context, libwebsocket *wsi, Client &client, uint8_t *in, size_t len);
     void jsonBufferPrepare(jsonBuffer_t &buffer, rapidjson::Value &value);
     int jsonBufferSend(jsonBuffer_t &buffer, libwebsocket *wsi);
-    void flushBroadcastList();
+    void flushBroadcastList(Shard &shard);
+
+    // Relay delivery, on the relay service thread
+    void flushRelayQueues();
+    void releaseRelayBuffer(RelayBuffer *buffer);
+    RelayBuffer *packRelayBuffer(const OPC::Message &msg, bool compress);
+    static unsigned packBits(const uint8_t *in, unsigned length, uint8_t *out);
 };
@@ -0,0 +1,180 @@
+/*
+ * UDP Open Pixel Control server for Fadecandy.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "udpnetserver.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <iostream>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netdb.h>
+#include <unistd.h>
+#endif
+
+
+UDPNetServer::UDPNetServer(OPC::callback_t opcCallback, void *context, bool verbose)
+    : mOpcCallback(opcCallback), mUserContext(context),
+      mThread(0), mVerbose(verbose), mSocket(-1)
+{}
+
+bool UDPNetServer::start(const char *host, int port)
+{
+    char portStr[16];
+    snprintf(portStr, sizeof portStr, "%d", port);
+
+#ifdef _WIN32
+    WSADATA wsaData;
+    WSAStartup(MAKEWORD(2, 2), &wsaData);
+#endif
+
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof hints);
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+    hints.ai_flags = AI_PASSIVE;
+
+    struct addrinfo *addr = 0;
+    int r = getaddrinfo(host, portStr, &hints, &addr);
+    if (r != 0 || !addr) {
+        std::clog << "Error resolving UDP listen address: " << gai_strerror(r) << "\n";
+        return false;
+    }
+
+    mSocket = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
+    if (mSocket < 0) {
+        std::clog << "Error creating UDP socket: " << strerror(errno) << "\n";
+        freeaddrinfo(addr);
+        return false;
+    }
+
+    if (bind(mSocket, addr->ai_addr, addr->ai_addrlen) < 0) {
+        std::clog << "Error binding UDP socket on port " << port << ": " << strerror(errno) << "\n";
+        freeaddrinfo(addr);
+        return false;
+    }
+
+    freeaddrinfo(addr);
+
+    std::clog << "UDP OPC server listening on " << (host ? host : "*") << ":" << port << "\n";
+
+    mThread = new tthread::thread(threadFunc, this);
+
+    return true;
+}
+
+void UDPNetServer::threadFunc(void *arg)
+{
+    UDPNetServer *self = (UDPNetServer*) arg;
+    self->run();
+}
+
+void UDPNetServer::run()
+{
+#ifdef __linux__
+    /*
+     * Drain up to RECV_BATCH datagrams per syscall. MSG_WAITFORONE blocks
+     * until at least one datagram arrives, then grabs whatever else is
+     * already queued without blocking again.
+     */
+
+    uint8_t *buffers = new uint8_t[RECV_BATCH * sizeof(OPC::Message)];
+    struct mmsghdr msgs[RECV_BATCH];
+    struct iovec iovs[RECV_BATCH];
+
+    memset(msgs, 0, sizeof msgs);
+    for (unsigned i = 0; i < RECV_BATCH; i++) {
+        iovs[i].iov_base = buffers + i * sizeof(OPC::Message);
+        iovs[i].iov_len = sizeof(OPC::Message);
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    for (;;) {
+        int n = recvmmsg(mSocket, msgs, RECV_BATCH, MSG_WAITFORONE, NULL);
+
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::clog << "Error receiving UDP datagrams: " << strerror(errno) << "\n";
+            return;
+        }
+
+        for (int i = 0; i < n; i++) {
+            dispatchDatagram(buffers + i * sizeof(OPC::Message), msgs[i].msg_len);
+        }
+    }
+
+#else
+    // One datagram per wakeup on platforms without recvmmsg()
+
+    uint8_t *buffer = new uint8_t[sizeof(OPC::Message)];
+
+    for (;;) {
+        int n = recvfrom(mSocket, (char*) buffer, sizeof(OPC::Message), 0, NULL, NULL);
+
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::clog << "Error receiving UDP datagram: " << strerror(errno) << "\n";
+            return;
+        }
+
+        dispatchDatagram(buffer, n);
+    }
+#endif
+}
+
+void UDPNetServer::dispatchDatagram(uint8_t *data, unsigned len)
+{
+    /*
+     * One datagram holds one or more complete OPC packets, back to back.
+     * Datagram boundaries are packet boundaries; there's no cross-datagram
+     * reassembly, so a truncated trailing packet is simply dropped.
+     */
+
+    while (len >= OPC::HEADER_BYTES) {
+        OPC::Message *msg = (OPC::Message*) data;
+        unsigned msgLength = OPC::HEADER_BYTES + msg->length();
+
+        if (len < msgLength) {
+            break;
+        }
+
+        mOpcCallback(*msg, mUserContext);
+
+        data += msgLength;
+        len -= msgLength;
+    }
+
+    if (len && mVerbose) {
+        std::clog << "Dropping truncated OPC packet in UDP datagram (" << len << " bytes)\n";
+    }
+}
@@ -0,0 +1,62 @@
+/*
+ * UDP Open Pixel Control server for Fadecandy.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include <stdint.h>
+#include "tinythread.h"
+#include "opc.h"
+
+
+/*
+ * UDPNetServer is an optional datagram transport for Open Pixel Control,
+ * alongside the TCP/WebSockets server. Each datagram carries one or more
+ * complete OPC packets; there's no reassembly, so a lossy-but-fresh pixel
+ * stream never stalls behind retransmits the way TCP does.
+ *
+ * On Linux we drain a whole batch of datagrams per wakeup with recvmmsg(),
+ * cutting the per-message syscall overhead for high-rate LAN sources.
+ */
+
+class UDPNetServer {
+public:
+    UDPNetServer(OPC::callback_t opcCallback, void *context, bool verbose = false);
+
+    // Start the receive loop on a separate thread
+    bool start(const char *host, int port);
+
+private:
+    // Datagrams drained per recvmmsg() wakeup
+    static const unsigned RECV_BATCH = 32;
+
+    OPC::callback_t mOpcCallback;
+    void *mUserContext;
+    tthread::thread *mThread;
+    bool mVerbose;
+    int mSocket;
+
+    static void threadFunc(void *arg);
+    void run();
+
+    // Dispatch every complete OPC packet in one received datagram
+    void dispatchDatagram(uint8_t *data, unsigned len);
+};
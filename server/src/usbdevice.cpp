@@ -22,16 +22,41 @@
  */
 
 #include "usbdevice.h"
+#include "pixelmapper.h"
 #include <iostream>
+#include <string.h>
 
 
+AdaptiveMutex USBDevice::mSerialCacheMutex;
+std::vector<USBDevice::SerialCacheEntry*> USBDevice::mSerialCache;
+
+static uint64_t monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000000ULL + tv.tv_usec;
+#endif
+}
+
 USBDevice::USBDevice(libusb_device *device, const char *type, bool verbose)
-    : mDevice(libusb_ref_device(device)),
+    : mDevice(device ? libusb_ref_device(device) : 0),
       mHandle(0),
       mTypeString(type),
       mSerialString(0),
-      mVerbose(verbose)
+      mVerbose(verbose),
+      mLossless(false),
+      mDevMemBuffer(false),
+      mBusSlot(0),
+      mSyncGroup(0),
+      mOutputWorker(workerWriteMessage, this),
+      mReceiveTimestamp(0)
 {
+    memset(&mSubmitTrace, 0, sizeof mSubmitTrace);
     gettimeofday(&mTimestamp, NULL);
 }
 
@@ -45,6 +70,239 @@ USBDevice::~USBDevice()
     }
 }
 
+uint8_t *USBDevice::allocTransferBuffer(size_t size)
+{
+#if defined(LIBUSB_API_VERSION) && LIBUSB_API_VERSION >= 0x01000105
+    uint8_t *mem = libusb_dev_mem_alloc(mHandle, size);
+    if (mem) {
+        mDevMemBuffer = true;
+        return mem;
+    }
+#endif
+
+    // No device memory on this platform or kernel; plain heap memory works
+    // everywhere, at the cost of a bounce buffer inside usbfs.
+    return new uint8_t[size];
+}
+
+void USBDevice::freeTransferBuffer(uint8_t *buffer, size_t size)
+{
+    if (!buffer) {
+        return;
+    }
+
+#if defined(LIBUSB_API_VERSION) && LIBUSB_API_VERSION >= 0x01000105
+    if (mDevMemBuffer) {
+        libusb_dev_mem_free(mHandle, buffer, size);
+        return;
+    }
+#endif
+
+    delete [] buffer;
+}
+
+void USBDevice::busScheduleDelay()
+{
+    /*
+     * When several boards share one bus, an OPC frame fans out to all of
+     * their output workers at once and the submissions collide at the hub,
+     * producing bursty latency. Each device waits out its slot's offset
+     * before submitting; a millisecond is roughly one full-speed frame
+     * transfer, so consecutive slots land back to back instead of fighting
+     * for the wire. A device alone on its bus has slot zero and never waits.
+     */
+
+    if (mBusSlot) {
+        tthread::this_thread::sleep_for(tthread::chrono::milliseconds(mBusSlot));
+    }
+}
+
+void USBDevice::writeDevicePixels(const uint8_t *rgb, unsigned numPixels)
+{
+    // Devices without a raw pixel framebuffer ignore this
+}
+
+void USBDevice::submitDeferredFrame()
+{
+    // Devices without deferred frame submission have nothing to do here
+}
+
+void USBDevice::syncFrameReady()
+{
+    /*
+     * Genlock barrier. Record that this device holds a completed frame; the
+     * last group member to arrive releases everyone's deferred frames
+     * back-to-back, on this worker thread. If we were already waiting when
+     * a new frame landed — a member stopped receiving, or the sources are
+     * mismatched — release whatever is ready rather than holding frames
+     * hostage to a missing member.
+     */
+
+    SyncGroup *group = mSyncGroup;
+    std::vector<USBDevice*> flip;
+
+    group->mutex.lock();
+
+    bool alreadyWaiting = false;
+    for (std::vector<USBDevice*>::iterator i = group->ready.begin(), e = group->ready.end(); i != e; ++i) {
+        if (*i == this) {
+            alreadyWaiting = true;
+            break;
+        }
+    }
+    if (!alreadyWaiting) {
+        group->ready.push_back(this);
+    }
+
+    if (alreadyWaiting || group->ready.size() >= group->memberCount) {
+        flip.swap(group->ready);
+    }
+
+    group->mutex.unlock();
+
+    for (std::vector<USBDevice*>::iterator i = flip.begin(), e = flip.end(); i != e; ++i) {
+        (*i)->submitDeferredFrame();
+    }
+}
+
+void USBDevice::writeMessageAsync(const OPC::Message &msg, uint64_t timestamp)
+{
+    if (mLossless) {
+        /*
+         * Lossless delivery: wait for queue space instead of dropping.
+         * Stalling here holds up the transport's read loop, so TCP flow
+         * control propagates the backpressure all the way to the client.
+         */
+        while (!mOutputWorker.enqueue(msg, timestamp, false)) {
+            tthread::this_thread::sleep_for(tthread::chrono::milliseconds(1));
+        }
+        return;
+    }
+
+    mOutputWorker.enqueue(msg, timestamp);
+}
+
+unsigned USBDevice::getQueueDepth()
+{
+    return mOutputWorker.depth();
+}
+
+void USBDevice::workerWriteMessage(const OPC::Message &msg, uint64_t timestamp, void *context)
+{
+    USBDevice *self = static_cast<USBDevice*>(context);
+    self->mReceiveTimestamp = timestamp;
+    self->writeMessage(msg);
+}
+
+int USBDevice::getSerialDescriptor(const libusb_device_descriptor &dd, char *buffer, size_t size)
+{
+    SerialCacheEntry key;
+    key.bus = libusb_get_bus_number(mDevice);
+    key.portCount = 0;
+#if defined(LIBUSB_API_VERSION) && LIBUSB_API_VERSION >= 0x01000102
+    key.portCount = libusb_get_port_numbers(mDevice, key.ports, sizeof key.ports);
+#endif
+    key.idVendor = dd.idVendor;
+    key.idProduct = dd.idProduct;
+    key.bcdDevice = dd.bcdDevice;
+
+    uint64_t now = monotonicMicroseconds();
+
+    // A port path is the stable half of the key; without one (old libusb,
+    // or a root device) every attach pays the descriptor round-trip.
+    if (key.portCount > 0) {
+        mSerialCacheMutex.lock();
+        for (std::vector<SerialCacheEntry*>::iterator i = mSerialCache.begin(), e = mSerialCache.end(); i != e; ++i) {
+            SerialCacheEntry *entry = *i;
+            if (entry->bus == key.bus &&
+                entry->portCount == key.portCount &&
+                !memcmp(entry->ports, key.ports, key.portCount) &&
+                entry->idVendor == key.idVendor &&
+                entry->idProduct == key.idProduct &&
+                entry->bcdDevice == key.bcdDevice &&
+                now - entry->lastSeen < SERIAL_CACHE_TTL_USEC) {
+
+                entry->lastSeen = now;
+                strncpy(buffer, entry->serial, size);
+                buffer[size - 1] = '\0';
+                mSerialCacheMutex.unlock();
+                return strlen(buffer);
+            }
+        }
+        mSerialCacheMutex.unlock();
+    }
+
+    int r = libusb_get_string_descriptor_ascii(mHandle, dd.iSerialNumber, (uint8_t*)buffer, size);
+    if (r < 0 || key.portCount <= 0) {
+        return r;
+    }
+
+    mSerialCacheMutex.lock();
+
+    // One entry per physical port: a different board at the same port
+    // replaces its predecessor rather than accumulating beside it.
+    SerialCacheEntry *entry = 0;
+    for (std::vector<SerialCacheEntry*>::iterator i = mSerialCache.begin(), e = mSerialCache.end(); i != e; ++i) {
+        if ((*i)->bus == key.bus &&
+            (*i)->portCount == key.portCount &&
+            !memcmp((*i)->ports, key.ports, key.portCount)) {
+            entry = *i;
+            break;
+        }
+    }
+    if (!entry) {
+        entry = new SerialCacheEntry;
+        if (mSerialCache.size() >= MAX_CACHED_SERIALS) {
+            // Drop the oldest entry; 16 ports of recently seen boards is plenty
+            delete mSerialCache.front();
+            mSerialCache.erase(mSerialCache.begin());
+        }
+        mSerialCache.push_back(entry);
+    }
+
+    *entry = key;
+    entry->lastSeen = now;
+    strncpy(entry->serial, buffer, sizeof entry->serial);
+    entry->serial[sizeof entry->serial - 1] = '\0';
+
+    mSerialCacheMutex.unlock();
+    return r;
+}
+
+void USBDevice::invalidateCachedSerial(libusb_device *device)
+{
+    /*
+     * Drop the cached serial for this device's physical port. Without
+     * this, a different board of the same model swapped onto the port
+     * within the TTL would inherit its predecessor's serial, attaching
+     * the wrong per-serial configuration. The cache still earns its keep
+     * within one attach, where every driver probing the device would
+     * otherwise re-read the descriptor.
+     */
+
+    uint8_t bus = libusb_get_bus_number(device);
+    uint8_t ports[7];
+    int portCount = 0;
+#if defined(LIBUSB_API_VERSION) && LIBUSB_API_VERSION >= 0x01000102
+    portCount = libusb_get_port_numbers(device, ports, sizeof ports);
+#endif
+    if (portCount <= 0) {
+        return;
+    }
+
+    mSerialCacheMutex.lock();
+    for (std::vector<SerialCacheEntry*>::iterator i = mSerialCache.begin(), e = mSerialCache.end(); i != e; ++i) {
+        if ((*i)->bus == bus &&
+            (*i)->portCount == portCount &&
+            !memcmp((*i)->ports, ports, portCount)) {
+            delete *i;
+            mSerialCache.erase(i);
+            break;
+        }
+    }
+    mSerialCacheMutex.unlock();
+}
+
 bool USBDevice::probeAfterOpening()
 {
     // By default, any device is supported by the time we get to opening it.
@@ -77,6 +335,23 @@ bool USBDevice::matchConfiguration(const Value &config)
     return true;
 }
 
+bool USBDevice::getOPCChannels(std::set<unsigned> &channels)
+{
+    // By default we can't enumerate channels; the server delivers all messages.
+    return false;
+}
+
+bool USBDevice::findMapChannels(const Value *map, std::set<unsigned> &channels)
+{
+    /*
+     * Common helper for getOPCChannels() implementations, for backends that
+     * haven't compiled their mapping. The real logic lives in PixelMapper,
+     * shared with the SPI device hierarchy.
+     */
+
+    return PixelMapper::findMapChannels(map, channels);
+}
+
 const USBDevice::Value *USBDevice::findConfigMap(const Value &config)
 {
     const Value &vmap = config["map"];
@@ -123,4 +398,43 @@ void USBDevice::describe(rapidjson::Value &object, Allocator &alloc)
 
     uint64_t timestamp = (uint64_t)mTimestamp.tv_sec*1000 + mTimestamp.tv_usec/1000;
     object.AddMember("timestamp", timestamp, alloc);
+
+    // How many messages the delivery queue has dropped, for bus load monitoring
+    object.AddMember("dropped_frames", mOutputWorker.droppedFrames(), alloc);
+
+    // Frames queued but not yet on the wire. A depth that stays nonzero
+    // across polls means the device isn't keeping up with its clients.
+    object.AddMember("queue_depth", getQueueDepth(), alloc);
+}
+
+uint64_t USBDevice::latencyHistogramMin(const uint64_t *buckets, unsigned numBuckets)
+{
+    for (unsigned i = 0; i < numBuckets; i++) {
+        if (buckets[i]) {
+            return (uint64_t)1 << i;
+        }
+    }
+    return 0;
+}
+
+uint64_t USBDevice::latencyHistogramPercentile(const uint64_t *buckets, unsigned numBuckets, unsigned percent)
+{
+    uint64_t total = 0;
+    for (unsigned i = 0; i < numBuckets; i++) {
+        total += buckets[i];
+    }
+    if (!total) {
+        return 0;
+    }
+
+    // Smallest bucket whose cumulative count covers the requested fraction
+    uint64_t target = (total * percent + 99) / 100;
+    uint64_t seen = 0;
+    for (unsigned i = 0; i < numBuckets; i++) {
+        seen += buckets[i];
+        if (seen >= target) {
+            return (uint64_t)1 << i;
+        }
+    }
+    return (uint64_t)1 << (numBuckets - 1);
 }
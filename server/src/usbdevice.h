@@ -25,7 +25,13 @@
 
 #include "rapidjson/document.h"
 #include "opc.h"
+#include "outputworker.h"
+#include "pacinganalyzer.h"
 #include <string>
+#include <set>
+#include <string>
+#include <vector>
+#include "adaptivemutex.h"
 #include <libusb.h> // Also brings in gettimeofday() in a portable way
 
 
@@ -74,15 +80,34 @@ public:
     // Load a matching configuration
     virtual void loadConfiguration(const Value &config) = 0;
 
+    // List the OPC channels this device's configuration maps, so the server
+    // can route SetPixelColors messages only to interested devices. Returns
+    // false if the channels can't be enumerated; the device then receives
+    // all messages.
+    virtual bool getOPCChannels(std::set<unsigned> &channels);
+
     // Handle an incoming OPC message
     virtual void writeMessage(const OPC::Message &msg) = 0;
 
+    // Queue an OPC message for this device's output worker thread, so one
+    // slow device can't delay delivery to the others. Normally the dispatch
+    // thread never blocks, and if the device has fallen too far behind the
+    // message is dropped. In lossless mode we instead wait for queue space,
+    // so transport-level flow control paces the client.
+    void writeMessageAsync(const OPC::Message &msg, uint64_t timestamp = 0);
+
+    // Frames queued for this device but not yet on the wire
+    virtual unsigned getQueueDepth();
+
     // Handle a device-specific JSON message
     virtual void writeMessage(Document &msg);
 
     // Write color LUT from parsed JSON
     virtual void writeColorCorrection(const Value &color);
 
+    // Write raw unmapped RGB pixel data straight into the framebuffer
+    virtual void writeDevicePixels(const uint8_t *rgb, unsigned numPixels);
+
     // Deal with any I/O that results from completed transfers, outside the context of a completion callback
     virtual void flush() = 0;
 
@@ -92,17 +117,117 @@ public:
     virtual std::string getName() = 0;
 
     libusb_device *getDevice() { return mDevice; };
+
+    // Drop the cached serial for this device's physical port; called on
+    // disconnect, before the port can host a different board.
+    static void invalidateCachedSerial(libusb_device *device);
+
+    // Frame submission slot among the devices sharing this device's USB bus
+    void setBusSchedule(unsigned slot) { mBusSlot = slot; }
+
+    /*
+     * Frame-flip synchronization (genlock). Devices configured with the
+     * same "syncGroup" name defer their frame submission until every member
+     * of the group holds a completed frame, then submit back-to-back, so
+     * panels driven by different boards flip coherently instead of tearing
+     * against each other.
+     */
+    struct SyncGroup {
+        AdaptiveMutex mutex;
+        unsigned memberCount;
+        std::vector<USBDevice*> ready;      // Members holding a deferred frame
+        SyncGroup() : memberCount(0) {}
+    };
+    void setSyncGroup(SyncGroup *group) { mSyncGroup = group; }
+    const std::string &getSyncGroupName() const { return mSyncGroupName; }
+
+    // Submit the frame a sync group barrier deferred, if any
+    virtual void submitDeferredFrame();
+
     const char *getSerial() { return mSerialString; }
     const char *getTypeString() { return mTypeString; }
 
+    // Submission pacing trace: drivers record() into it as each frame is
+    // handed to the transport, and the pacing_info message reads it out.
+    PacingAnalyzer::Trace &submitTrace() { return mSubmitTrace; }
+
 protected:
+    PacingAnalyzer::Trace mSubmitTrace;
     libusb_device *mDevice;
     libusb_device_handle *mHandle;
     struct timeval mTimestamp;
     const char *mTypeString;
     const char *mSerialString;
     bool mVerbose;
+    bool mLossless;
+    bool mDevMemBuffer;
+    unsigned mBusSlot;
+    std::string mSyncGroupName;
+    SyncGroup *mSyncGroup;
+    OutputWorker mOutputWorker;
+
+    // Arrival time of the message the worker is currently delivering, in
+    // monotonic microseconds; 0 when the source didn't stamp one. Only
+    // touched on the worker thread.
+    uint64_t mReceiveTimestamp;
+
+    /*
+     * Allocate a buffer for USB transfer data, preferring DMA-capable device
+     * memory when libusb offers it. Submitting from device memory lets the
+     * usbfs layer map the pages straight into the host controller instead of
+     * bounce-buffering every frame. Each device makes one allocation, carved
+     * up by the caller; freeTransferBuffer() must be given the same size.
+     */
+    uint8_t *allocTransferBuffer(size_t size);
+    void freeTransferBuffer(uint8_t *buffer, size_t size);
+
+    // Stagger this device's frame submission within its bus schedule.
+    // Call only from the output worker thread, before submitting a frame.
+    void busScheduleDelay();
+
+    // Arrive at this device's sync group barrier with a completed frame.
+    // The last member to arrive submits the whole group back-to-back.
+    void syncFrameReady();
 
     // Utilities
     const Value *findConfigMap(const Value &config);
+    static void workerWriteMessage(const OPC::Message &msg, uint64_t timestamp, void *context);
+    static bool findMapChannels(const Value *map, std::set<unsigned> &channels);
+
+    /*
+     * Summary figures over a log2-microsecond latency histogram, for the
+     * describe() overrides that keep one. Each result is the lower bound of
+     * the bucket it lands in, so values are quantized to powers of two --
+     * plenty for spotting a latency tail, without a second data structure.
+     */
+    static uint64_t latencyHistogramMin(const uint64_t *buckets, unsigned numBuckets);
+    static uint64_t latencyHistogramPercentile(const uint64_t *buckets, unsigned numBuckets, unsigned percent);
+
+    /*
+     * Process-wide serial descriptor cache. Fetching the serial string is
+     * a synchronous control round-trip to the device, and every driver
+     * that probes an attached device pays it again. Entries are keyed by
+     * bus, port path and device identity; a port's entry is dropped when
+     * its device disconnects, so a board physically swapped at a port is
+     * never reported under its predecessor's serial, and the TTL is a
+     * backstop for removals the hotplug path never saw.
+     */
+    struct SerialCacheEntry {
+        uint8_t bus;
+        uint8_t ports[7];           // Physical port path; see libusb_get_port_numbers()
+        int portCount;
+        uint16_t idVendor;
+        uint16_t idProduct;
+        uint16_t bcdDevice;
+        uint64_t lastSeen;
+        char serial[256];
+    };
+    static const unsigned MAX_CACHED_SERIALS = 16;
+    static const uint64_t SERIAL_CACHE_TTL_USEC = 60 * 1000000ULL;
+    static AdaptiveMutex mSerialCacheMutex;
+    static std::vector<SerialCacheEntry*> mSerialCache;
+
+    // Fetch the device's serial string into |buffer|, consulting the cache.
+    // Same return convention as libusb_get_string_descriptor_ascii().
+    int getSerialDescriptor(const libusb_device_descriptor &dd, char *buffer, size_t size);
 };
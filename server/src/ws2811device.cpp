@@ -0,0 +1,331 @@
+/*
+ * Fadecandy driver for WS2811/WS2812 strips on Raspberry Pi GPIO,
+ * using the rpi_ws281x library's DMA-paced PWM/PCM output.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ws2811device.h"
+#include "opc.h"
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <string.h>
+
+const char* WS2811Device::DEVICE_TYPE = "ws2811";
+
+// DMA channel for the library's buffer feed. 10 is the rpi_ws281x
+// default, clear of the channels the firmware and SD controller use.
+#define WS2811_DMA_CHANNEL 10
+
+static uint64_t monotonicMicroseconds()
+{
+#ifdef OS_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000000ULL + tv.tv_usec;
+#endif
+}
+
+WS2811Device::WS2811Device(uint32_t numLights, bool verbose)
+    : SPIDevice(DEVICE_TYPE, verbose),
+      mConfigMap(0),
+      mNumLights(numLights),
+      mFramesWritten(0)
+{
+    mFrameBuffer.resize(numLights, 0);
+
+#ifdef FCSERVER_HAS_RPI_WS281X
+    memset(&mString, 0, sizeof mString);
+    mChannel = 0;
+    mStringReady = false;
+#endif
+}
+
+WS2811Device::~WS2811Device()
+{
+    // Stop the output worker before tearing down any state it might touch
+    mOutputWorker.stop();
+
+#ifdef FCSERVER_HAS_RPI_WS281X
+    if (mStringReady) {
+        ws2811_wait(&mString);
+        ws2811_fini(&mString);
+    }
+#endif
+}
+
+int WS2811Device::open(uint32_t port)
+{
+    mPort = port;
+
+#ifdef FCSERVER_HAS_RPI_WS281X
+    /*
+     * The library picks the generating peripheral from the pin: PWM for
+     * 12/18, PCM for 21/31, SPI for 10. Pins 13/19/41/45 are only
+     * reachable from the second PWM channel, so place our string there
+     * when one of them is configured.
+     */
+    mChannel = (port == 13 || port == 19 || port == 41 || port == 45) ? 1 : 0;
+
+    mString.freq = WS2811_TARGET_FREQ;
+    mString.dmanum = WS2811_DMA_CHANNEL;
+    mString.channel[mChannel].gpionum = int(port);
+    mString.channel[mChannel].count = int(mNumLights);
+    mString.channel[mChannel].brightness = 255;
+    mString.channel[mChannel].strip_type = WS2811_STRIP_GRB;
+
+    ws2811_return_t r = ws2811_init(&mString);
+    if (r != WS2811_SUCCESS) {
+        if (mVerbose) {
+            std::clog << "Error opening WS2811 DMA output on GPIO " << port
+                << ": " << ws2811_get_return_t_str(r) << "\n";
+        }
+        return -1;
+    }
+
+    mStringReady = true;
+    return 0;
+#else
+    if (mVerbose) {
+        std::clog << "fcserver was built without rpi_ws281x; can't drive WS2811 strips from GPIO\n";
+    }
+    return -1;
+#endif
+}
+
+void WS2811Device::loadConfiguration(const Value &config)
+{
+    mConfigMap = findConfigMap(config);
+    PixelMapper::compile(mCompiledMap, mConfigMap, mVerbose);
+}
+
+bool WS2811Device::getOPCChannels(std::set<unsigned> &channels)
+{
+    // The compiled mapping knows exactly which channels we listen to.
+    PixelMapper::programChannels(mCompiledMap, channels);
+    return true;
+}
+
+std::string WS2811Device::getName()
+{
+    std::ostringstream s;
+    s << "WS2811 via GPIO " << mPort;
+    return s.str();
+}
+
+void WS2811Device::flush()
+{
+#ifdef FCSERVER_HAS_RPI_WS281X
+    // Let the DMA engine finish streaming the frame it holds. The mutex
+    // keeps the wait from overlapping a concurrent render.
+    mWriteMutex.lock();
+    if (mStringReady) {
+        ws2811_wait(&mString);
+    }
+    mWriteMutex.unlock();
+#endif
+}
+
+void WS2811Device::writeBuffer()
+{
+    /*
+     * Hand the mapped frame to the DMA engine. render() blocks only if
+     * the previous frame is still on the wire, then expands our pixels
+     * into the peripheral's bit pattern and starts the transfer; at
+     * 800 kHz the strip itself is the bottleneck, and we run on the
+     * output worker thread, so that wait never stalls dispatch.
+     *
+     * Caller holds mWriteMutex: the library's render/wait state can't
+     * tolerate concurrent calls from the websocket thread's raw writes.
+     */
+
+#ifdef FCSERVER_HAS_RPI_WS281X
+    if (!mStringReady) {
+        return;
+    }
+
+    memcpy(mString.channel[mChannel].leds, &mFrameBuffer[0],
+        mNumLights * sizeof(ws2811_led_t));
+
+    mSubmitTrace.record(monotonicMicroseconds());
+    ws2811_render(&mString);
+    mFramesWritten++;
+#endif
+}
+
+void WS2811Device::writeMessage(Document &msg)
+{
+    // Dispatch a device-specific JSON command; see FCDevice::writeMessage().
+
+    const char *type = msg["type"].GetString();
+
+    if (!strcmp(type, "device_pixels")) {
+        // Write raw pixels, without any mapping
+        writeDevicePixels(msg);
+        return;
+    }
+
+    if (!strcmp(type, "device_pixel_snapshot")) {
+        // Report what the device is currently showing, for live monitoring
+        jsonPixelSnapshot(msg);
+        return;
+    }
+
+    // Chain to default handler
+    SPIDevice::writeMessage(msg);
+}
+
+void WS2811Device::writeDevicePixels(const uint8_t *rgb, unsigned numPixels)
+{
+    // Raw binary pixel write; see FCDevice::writeDevicePixels().
+
+    if (numPixels > mNumLights) {
+        numPixels = mNumLights;
+    }
+
+    mWriteMutex.lock();
+    mFrameBufferSeqlock.writeBegin();
+    for (unsigned i = 0; i < numPixels; i++) {
+        mFrameBuffer[i] = (uint32_t(rgb[i*3 + 0]) << 16) |
+                          (uint32_t(rgb[i*3 + 1]) << 8)  |
+                           uint32_t(rgb[i*3 + 2]);
+    }
+    mFrameBufferSeqlock.writeEnd();
+
+    writeBuffer();
+    mWriteMutex.unlock();
+}
+
+void WS2811Device::writeDevicePixels(Document &msg)
+{
+    /*
+     * Write pixels without mapping, from a JSON integer array in
+     * msg["pixels"]. Values are clamped to [0, 255], for convenience.
+     */
+
+    const Value &pixels = msg["pixels"];
+    if (!pixels.IsArray()) {
+        msg.AddMember("error", "Pixel array is missing", msg.GetAllocator());
+        return;
+    }
+
+    // Truncate to the framebuffer size, and only deal in whole pixels.
+    uint32_t numPixels = pixels.Size() / 3;
+    if (numPixels > mNumLights)
+        numPixels = mNumLights;
+
+    // This path runs on the websocket thread, so the mutex matters here:
+    // it keeps the fill and render from racing the output worker's.
+    mWriteMutex.lock();
+    mFrameBufferSeqlock.writeBegin();
+    for (uint32_t i = 0; i < numPixels; i++) {
+        const Value &r = pixels[i * 3 + 0];
+        const Value &g = pixels[i * 3 + 1];
+        const Value &b = pixels[i * 3 + 2];
+
+        uint32_t rv = std::max(0, std::min(255, r.IsInt() ? r.GetInt() : 0));
+        uint32_t gv = std::max(0, std::min(255, g.IsInt() ? g.GetInt() : 0));
+        uint32_t bv = std::max(0, std::min(255, b.IsInt() ? b.GetInt() : 0));
+        mFrameBuffer[i] = (rv << 16) | (gv << 8) | bv;
+    }
+    mFrameBufferSeqlock.writeEnd();
+
+    writeBuffer();
+    mWriteMutex.unlock();
+}
+
+void WS2811Device::writeMessage(const OPC::Message &msg)
+{
+    /*
+     * Dispatch an incoming OPC command
+     */
+
+    switch (msg.command) {
+
+        case OPC::SetPixelColors:
+            mWriteMutex.lock();
+            opcSetPixelColors(msg);
+            writeBuffer();
+            mWriteMutex.unlock();
+            return;
+
+        case OPC::SystemExclusive:
+            // No relevant SysEx for this device
+            return;
+    }
+
+    if (mVerbose) {
+        std::clog << "Unsupported OPC command: " << unsigned(msg.command) << "\n";
+    }
+}
+
+void WS2811Device::opcSetPixelColors(const OPC::Message &msg)
+{
+    /*
+     * Run through our compiled mapping, and store any relevant portions
+     * of 'msg' in the framebuffer.
+     */
+
+    FramebufferWriter writer(*this);
+    mFrameBufferSeqlock.writeBegin();
+    PixelMapper::run(mCompiledMap, msg, writer);
+    mFrameBufferSeqlock.writeEnd();
+}
+
+void WS2811Device::jsonPixelSnapshot(Document &msg)
+{
+    /*
+     * Report the mapped frame as a flat RGB integer array in
+     * msg["snapshot"]; see FCDevice::jsonPixelSnapshot(). The raw copy
+     * happens inside the seqlock read and the JSON conversion outside it,
+     * so a slow monitor connection can't force extra retries.
+     */
+
+    std::vector<uint32_t> snapshot(mNumLights);
+    uint32_t seq;
+
+    do {
+        seq = mFrameBufferSeqlock.readBegin();
+        memcpy(&snapshot[0], &mFrameBuffer[0], mNumLights * sizeof(uint32_t));
+    } while (mFrameBufferSeqlock.readRetry(seq));
+
+    rapidjson::Value pixels(rapidjson::kArrayType);
+    for (uint32_t i = 0; i < mNumLights; i++) {
+        rapidjson::Value r(unsigned((snapshot[i] >> 16) & 0xFF));
+        rapidjson::Value g(unsigned((snapshot[i] >> 8) & 0xFF));
+        rapidjson::Value b(unsigned(snapshot[i] & 0xFF));
+        pixels.PushBack(r, msg.GetAllocator());
+        pixels.PushBack(g, msg.GetAllocator());
+        pixels.PushBack(b, msg.GetAllocator());
+    }
+    msg.AddMember("snapshot", pixels, msg.GetAllocator());
+}
+
+void WS2811Device::describe(rapidjson::Value &object, Allocator &alloc)
+{
+    SPIDevice::describe(object, alloc);
+    object.AddMember("numLights", mNumLights, alloc);
+    object.AddMember("frames_written", mFramesWritten, alloc);
+}
@@ -0,0 +1,114 @@
+/*
+ * Fadecandy driver for WS2811/WS2812 strips on Raspberry Pi GPIO,
+ * using the rpi_ws281x library's DMA-paced PWM/PCM output.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include "spidevice.h"
+#include "opc.h"
+#include "pixelmapper.h"
+#include "seqlock.h"
+#include "tinythread.h"
+#include <set>
+#include <vector>
+
+#ifdef FCSERVER_HAS_RPI_WS281X
+#include <ws2811.h>
+#endif
+
+
+/*
+ * WS2811 strips driven straight from a Pi GPIO pin, with no Fadecandy
+ * board in between. The one-wire waveform is generated by the PWM, PCM,
+ * or SPI peripheral (chosen by the library from the pin number) and
+ * paced by DMA from a kernel-contiguous buffer, so the CPU's only
+ * per-frame work is one copy. For strips wired to the controller this
+ * removes the USB hop entirely, which both shortens the path from
+ * mapping to light and leaves the USB bandwidth to the remote boards.
+ *
+ * SPIDevice is the base for all the locally-attached output types; the
+ * spidev-specific pieces of it are simply unused here.
+ */
+
+class WS2811Device : public SPIDevice
+{
+public:
+    WS2811Device(uint32_t numLights, bool verbose);
+    virtual ~WS2811Device();
+
+    // 'port' is the BCM GPIO number wired to the strip's data line
+    virtual int open(uint32_t port);
+
+    virtual void loadConfiguration(const Value &config);
+    virtual bool getOPCChannels(std::set<unsigned> &channels);
+    virtual void writeMessage(const OPC::Message &msg);
+    virtual void writeMessage(Document &msg);
+    virtual std::string getName();
+    virtual void flush();
+
+    static const char* DEVICE_TYPE;
+
+    virtual void describe(rapidjson::Value &object, Allocator &alloc);
+    virtual void writeDevicePixels(const uint8_t *rgb, unsigned numPixels);
+
+private:
+    // Pixel writer adapter for PixelMapper, targeting mFrameBuffer
+    struct FramebufferWriter {
+        WS2811Device &device;
+        FramebufferWriter(WS2811Device &device) : device(device) {}
+        unsigned numPixels() const { return device.mNumLights; }
+        void writePixel(unsigned index, uint8_t r, uint8_t g, uint8_t b) {
+            device.mFrameBuffer[index] =
+                (uint32_t(r) << 16) | (uint32_t(g) << 8) | uint32_t(b);
+        }
+    };
+
+    const Value *mConfigMap;
+    PixelMapper::Program mCompiledMap;
+
+    /*
+     * mWriteMutex serializes the framebuffer fill and the render against
+     * rpi_ws281x, whose render/wait state is not thread-safe: the OPC
+     * path runs on the output worker while raw JSON device_pixels writes
+     * run on the websocket thread. The seqlock publishes mFrameBuffer to
+     * "device_pixel_snapshot" readers; its writes happen under the mutex
+     * too (the protocol allows one writer at a time), and readers never
+     * block the writers, which pay two increments per frame.
+     */
+    tthread::mutex mWriteMutex;
+    Seqlock mFrameBufferSeqlock;
+    std::vector<uint32_t> mFrameBuffer;     // 0x00RRGGBB, the mapping target
+    uint32_t mNumLights;
+    uint64_t mFramesWritten;
+
+#ifdef FCSERVER_HAS_RPI_WS281X
+    ws2811_t mString;
+    unsigned mChannel;          // PWM channel index; pin-dependent
+    bool mStringReady;
+#endif
+
+    void writeBuffer();
+    void writeDevicePixels(Document &msg);
+    void jsonPixelSnapshot(Document &msg);
+
+    void opcSetPixelColors(const OPC::Message &msg);
+};
@@ -33,6 +33,60 @@ import intelhex, time, hashlib, struct, subprocess
 # Flash memory sector size
 SECTOR_SIZE = 1024
 
+# LZSS parameters, matching the decoder in production/firmware_stream.cpp.
+# The stream is a sequence of flag bytes (LSB first), each bit introducing
+# either a literal byte or a two-byte match token: low 8 bits of
+# (distance - 1), then the top 3 bits of (distance - 1) alongside
+# (length - MIN_MATCH) in the low 5 bits.
+LZSS_WINDOW = 2048
+LZSS_MIN_MATCH = 3
+LZSS_MAX_MATCH = 34
+
+def lzssCompress(data):
+    data = bytearray(data)
+    out = bytearray()
+    index = {}
+    flagPos = 0
+    flagCount = 0
+    i = 0
+    while i < len(data):
+        if flagCount == 0:
+            flagPos = len(out)
+            out.append(0)
+            flagCount = 8
+
+        # Longest match among previous occurrences of the next three bytes
+        bestLen = 0
+        bestDist = 0
+        if i + LZSS_MIN_MATCH <= len(data):
+            key = bytes(data[i:i+LZSS_MIN_MATCH])
+            for j in index.get(key, ()):
+                if i - j > LZSS_WINDOW:
+                    continue
+                l = 0
+                while l < LZSS_MAX_MATCH and i + l < len(data) and data[j + l] == data[i + l]:
+                    l += 1
+                if l > bestLen:
+                    bestLen = l
+                    bestDist = i - j
+
+        if bestLen >= LZSS_MIN_MATCH:
+            out[flagPos] |= 1 << (8 - flagCount)
+            d = bestDist - 1
+            out.append(d & 0xFF)
+            out.append(((d >> 8) << 5) | (bestLen - LZSS_MIN_MATCH))
+            step = bestLen
+        else:
+            out.append(data[i])
+            step = 1
+        flagCount -= 1
+
+        for k in range(i, min(i + step, len(data) - LZSS_MIN_MATCH + 1)):
+            index.setdefault(bytes(data[k:k+LZSS_MIN_MATCH]), []).append(k)
+        i += step
+
+    return out
+
 output = open(OUTPUT_FILE, 'w')
 output.write("""/*
  * Firmware data for Fadecandy production.
@@ -74,7 +128,6 @@ image = loader.tobinstr()
 # Pad to a sector boundary
 numSectors = (len(image) + SECTOR_SIZE - 1) // SECTOR_SIZE
 numBytes = numSectors * SECTOR_SIZE
-numWords = numBytes / 4
 image += chr(loader.padding) * (numBytes - len(image))
 
 # Use a GDB subprocess to evaluate symbols, and write those out to the file
@@ -90,21 +143,19 @@ for i, (name, expression) in enumerate(DEFINITIONS):
 
 output.write("\n")
 
-# Write the combined firmware image
+# Compress the combined firmware image. The testjig decompresses it one
+# sector at a time while streaming to the target, so neither the jig nor
+# the SWD link carries the raw image.
+compressed = lzssCompress(image)
+
+output.write("// %d sectors (%d bytes), LZSS compressed to %d bytes\n"
+    % (numSectors, numBytes, len(compressed)))
 output.write("static const unsigned fw_sectorCount = %d;\n" % numSectors)
-output.write("static const uint32_t fw_data[%d] = {\n" % numWords)
-
-wordsPerLine = 4
-numLines = numWords / wordsPerLine
-
-for line in range(numLines):
-    addr = line * wordsPerLine * 4
-    words = [
-        "0x%08x, " % struct.unpack('<I',
-            image[addr+4*x:addr+4*(x+1)]
-        )[0]
-        for x in range(wordsPerLine)
-    ]
-    output.write("    %s  // 0x%08x\n" % (''.join(words), addr))
+output.write("static const uint8_t fw_compressedData[%d] = {\n" % len(compressed))
+
+bytesPerLine = 12
+for i in range(0, len(compressed), bytesPerLine):
+    line = compressed[i:i+bytesPerLine]
+    output.write("    %s\n" % ''.join("0x%02x, " % b for b in line))
 
 output.write("};\n")
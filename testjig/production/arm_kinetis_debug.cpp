@@ -395,6 +395,158 @@ bool ARMKinetisDebug::ftfl_programSection(uint32_t address, uint32_t numLWords)
         ftfl_handleCommandStatus("FLASH: Error verifying sector! (FSTAT: %08x)");
 }
 
+/*
+ * Flash programming stub, assembled Thumb code loaded at the bottom of the
+ * target's upper SRAM bank. It disables the watchdog (the erased target runs
+ * no startup code of its own), then loops on a mailbox: for each command it
+ * copies one sector from an SRAM buffer into FlexRAM, runs an FTFL Program
+ * Section command, records the resulting FSTAT in the mailbox, and clears the
+ * command word to signal completion.
+ *
+ * Assembled by hand from the following source (ARMv6-M subset):
+ *
+ *          ldr  r6, =0x40052000    @ WDOG base
+ *          movs r5, #0xC5          @ Unlock sequence, then clear WDOGEN
+ *          lsls r5, r5, #8
+ *          adds r5, #0x20          @ r5 = 0xC520
+ *          strh r5, [r6, #0x0E]
+ *          movs r5, #0xD9
+ *          lsls r5, r5, #8
+ *          adds r5, #0x28          @ r5 = 0xD928
+ *          strh r5, [r6, #0x0E]
+ *          nop
+ *          movs r5, #0x01
+ *          lsls r5, r5, #8
+ *          adds r5, #0xD2          @ r5 = 0x01D2 = STCTRLH default minus WDOGEN
+ *          strh r5, [r6, #0]
+ *          ldr  r0, =0x20000100    @ Mailbox: +0 cmd/addr, +4 source, +8 status
+ *          ldr  r1, =0x40020000    @ FTFL base
+ *          ldr  r2, =0x14000000    @ FlexRAM section buffer
+ *          movs r7, #1
+ *          lsls r7, r7, #10        @ r7 = sector size
+ *  loop:   ldr  r3, [r0, #0]       @ Wait for a command: flash address | 1,
+ *          cmp  r3, #0             @ tagged so that sector 0 isn't mistaken
+ *          beq  loop               @ for the idle mailbox
+ *          subs r3, #1
+ *          ldr  r4, [r0, #4]
+ *          movs r5, #0
+ *  copy:   ldr  r6, [r4, r5]       @ Copy the sector into FlexRAM
+ *          str  r6, [r2, r5]
+ *          adds r5, #4
+ *          cmp  r5, r7
+ *          bne  copy
+ *          movs r6, #0x70          @ Clear FSTAT error flags
+ *          strb r6, [r1, #0]
+ *          ldr  r6, =0x0B000000    @ Program Section command
+ *          lsls r3, r3, #8
+ *          lsrs r3, r3, #8
+ *          orrs r3, r6
+ *          str  r3, [r1, #4]       @ FCCOB3-0: command + address
+ *          movs r6, #1
+ *          lsls r6, r6, #24
+ *          str  r6, [r1, #8]       @ FCCOB7-4: 256 longwords
+ *          movs r6, #0x80
+ *          strb r6, [r1, #0]       @ Launch
+ *  wait:   ldrb r6, [r1, #0]
+ *          lsrs r6, r6, #7         @ CCIF set when complete
+ *          beq  wait
+ *          ldrb r6, [r1, #0]
+ *          str  r6, [r0, #8]       @ Report FSTAT
+ *          movs r6, #0
+ *          str  r6, [r0, #0]       @ Signal idle
+ *          b    loop
+ */
+static const uint32_t stubImage[] = {
+    0x25C54E18, 0x3520022D, 0x25D981F5, 0x3528022D,
+    0xBF0081F5, 0x022D2501, 0x803535D2, 0x49134812,
+    0x27014A13, 0x680302BF, 0xD0FC2B00, 0x68443B01,
+    0x59662500, 0x35045156, 0xD1FA42BD, 0x700E2670,
+    0x021B4E0C, 0x43330A1B, 0x2601604B, 0x608E0636,
+    0x700E2680, 0x09F6780E, 0x780ED0FC, 0x26006086,
+    0xE7E06006,
+    // Literal pool
+    0x40052000, 0x20000100, 0x40020000, 0x14000000, 0x0B000000,
+};
+
+// Target SRAM layout used by the stub
+static const uint32_t STUB_BASE      = 0x20000000;
+static const uint32_t STUB_MAILBOX   = 0x20000100;
+static const uint32_t STUB_BUFFER_A  = 0x20000200;
+static const uint32_t STUB_BUFFER_B  = 0x20000600;
+static const uint32_t STUB_STACK_TOP = 0x20001F00;
+
+bool ARMKinetisDebug::coreWriteReg(unsigned reg, uint32_t value)
+{
+    // Write one core register through the DCRSR/DCRDR window. Requires halt.
+    uint32_t dhcsr;
+    return
+        memStore(REG_SCB_DCRDR, value) &&
+        memStore(REG_SCB_DCRSR, 0x00010000 | reg) &&
+        memPoll(REG_SCB_DHCSR, dhcsr, 1 << 16, -1);
+}
+
+bool ARMKinetisDebug::coreResume()
+{
+    // Leave halt state, keeping debug enabled so we can halt again later.
+    return memStore(REG_SCB_DHCSR, 0xA05F0001);
+}
+
+bool ARMKinetisDebug::flashStubLoad()
+{
+    // Install the stub and an idle mailbox, then point the halted core at it
+    // and let it run. The Thumb bit lives in xPSR, not the PC value.
+    return
+        memStore(STUB_BASE, stubImage, sizeof stubImage / sizeof stubImage[0]) &&
+        memStore(STUB_MAILBOX, 0) &&
+        coreWriteReg(13, STUB_STACK_TOP) &&
+        coreWriteReg(16, 0x01000000) &&
+        coreWriteReg(15, STUB_BASE) &&
+        coreResume();
+}
+
+bool ARMKinetisDebug::flashStubWait()
+{
+    // Wait for the stub to finish its current sector, then check the FSTAT
+    // value it reported. Programming takes a few milliseconds per sector, so
+    // give the poll plenty of retries.
+    uint32_t cmd, fstat;
+
+    if (!memPoll(STUB_MAILBOX, cmd, -1, 0, 10000)) {
+        log(LOG_ERROR, "FLASH: Timed out waiting for programming stub");
+        return false;
+    }
+
+    if (!memLoad(STUB_MAILBOX + 8, fstat))
+        return false;
+    if (fstat & (REG_FTFL_FSTAT_RDCOLERR | REG_FTFL_FSTAT_ACCERR |
+                 REG_FTFL_FSTAT_FPVIOL | REG_FTFL_FSTAT_MGSTAT0)) {
+        log(LOG_ERROR, "FLASH: Programming stub reported error (FSTAT: %08x)", fstat);
+        return false;
+    }
+
+    return true;
+}
+
+bool ARMKinetisDebug::flashStubProgram(uint32_t address, const uint32_t *data)
+{
+    if (address & (FLASH_SECTOR_SIZE-1)) {
+        log(LOG_ERROR, "ARMKinetisDebug::flashStubProgram alignment error");
+        return false;
+    }
+
+    // Sequential sectors alternate buffers, so this sector's upload
+    // streams over SWD into the idle buffer while the stub is still
+    // programming the previous one from the other; only then do we wait
+    // for the stub, which by that point has normally long finished.
+    uint32_t buffer = (address & FLASH_SECTOR_SIZE) ? STUB_BUFFER_B : STUB_BUFFER_A;
+
+    return
+        memStore(buffer, data, FLASH_SECTOR_SIZE/4) &&
+        flashStubWait() &&
+        memStore(STUB_MAILBOX + 4, buffer) &&
+        memStore(STUB_MAILBOX, address | 1);    // Bit 0 marks the command valid
+}
+
 bool ARMKinetisDebug::ftfl_handleCommandStatus(const char *cmdSpecificError)
 {
     /*
@@ -427,8 +579,8 @@ bool ARMKinetisDebug::ftfl_handleCommandStatus(const char *cmdSpecificError)
 }
 
 ARMKinetisDebug::FlashProgrammer::FlashProgrammer(
-    ARMKinetisDebug &target, const uint32_t *image, unsigned numSectors)
-    : target(target), image(image), numSectors(numSectors)
+    ARMKinetisDebug &target, ImageSource &source, unsigned numSectors)
+    : target(target), source(source), numSectors(numSectors)
 {}
 
 bool ARMKinetisDebug::FlashProgrammer::begin()
@@ -448,6 +600,11 @@ bool ARMKinetisDebug::FlashProgrammer::begin()
     if (!target.flashSectorBufferInit())
         return false;
 
+    // Run the programming stub on the target, so sector data streams over
+    // SWD while the stub drives the flash controller locally
+    if (!target.flashStubLoad())
+        return false;
+
     return true;
 }
 
@@ -459,7 +616,12 @@ bool ARMKinetisDebug::FlashProgrammer::isComplete()
 bool ARMKinetisDebug::FlashProgrammer::next()
 {
     uint32_t address = nextSector * FLASH_SECTOR_SIZE;
-    const uint32_t *ptr = image + (nextSector * FLASH_SECTOR_SIZE/4);
+    uint32_t expected[FLASH_SECTOR_SIZE/4];
+
+    if (!source.getSector(nextSector, expected)) {
+        target.log(LOG_ERROR, "FLASH: Error decoding image data for sector at %08x", address);
+        return false;
+    }
 
     if (isVerifying) {
         target.log(LOG_NORMAL, "FLASH: Verifying sector at %08x", address);
@@ -471,9 +633,9 @@ bool ARMKinetisDebug::FlashProgrammer::next()
         bool okay = true;
 
         for (unsigned i = 0; i < FLASH_SECTOR_SIZE/4; i++) {
-            if (buffer[i] != ptr[i]) {
+            if (buffer[i] != expected[i]) {
                 target.log(LOG_ERROR, "FLASH: Verify error at %08x. Expected %08x, actual %08x",
-                    address + i*4, ptr[i], buffer[i]);
+                    address + i*4, expected[i], buffer[i]);
                 okay = false;
             }
         }
@@ -489,12 +651,14 @@ bool ARMKinetisDebug::FlashProgrammer::next()
     } else {
         target.log(LOG_NORMAL, "FLASH: Programming sector at %08x", address);
 
-        if (!target.flashSectorBufferWrite(0, ptr, FLASH_SECTOR_SIZE/4))
-            return false;
-        if (!target.flashSectorProgram(address))
+        if (!target.flashStubProgram(address, expected))
             return false;
 
         if (++nextSector == numSectors) {
+            // Let the stub finish the final sector before we reset it away.
+            if (!target.flashStubWait())
+                return false;
+
             // Done programming. Another reset! Load new protection flags.
             if (!(target.reset() && target.debugHalt() && target.peripheralInit()))
                 return false;
@@ -64,20 +64,46 @@ public:
     // Write one flash sector from the buffer
     bool flashSectorProgram(uint32_t address);
 
+    /*
+     * RAM-resident flash programming stub. The stub runs on the target and
+     * drives the FTFL controller locally, so the debugger only streams sector
+     * data over SWD instead of round-tripping every FCCOB write and busy poll.
+     * Sector uploads alternate between two SRAM buffers, overlapping SWD
+     * transfer of the next sector with programming of the previous one.
+     */
+    bool flashStubLoad();       // Load the stub into target SRAM and start it
+    bool flashStubProgram(uint32_t address, const uint32_t *data);  // Queue one sector
+    bool flashStubWait();       // Wait for the stub to go idle, checking flash status
+
+    // Core register access and run control, for starting the stub
+    bool coreWriteReg(unsigned reg, uint32_t value);
+    bool coreResume();
+
     /*
      * High-level flash programming manager. Handles the entire programming process,
      * including protection resets and verification.
      */
     class FlashProgrammer {
         public:
-            FlashProgrammer(ARMKinetisDebug &target, const uint32_t *image, unsigned numSectors);
+            /*
+             * Source of flash image data, one sector at a time. Sectors are
+             * requested in ascending order within each pass, and each pass
+             * restarts from sector zero, so streaming decompressors work here
+             * without random access.
+             */
+            class ImageSource {
+                public:
+                    virtual bool getSector(unsigned sector, uint32_t *data) = 0;
+            };
+
+            FlashProgrammer(ARMKinetisDebug &target, ImageSource &source, unsigned numSectors);
             bool begin();
             bool isComplete();
             bool next();
 
         private:
             ARMKinetisDebug &target;
-            const uint32_t *image;
+            ImageSource &source;
             unsigned numSectors;
             unsigned nextSector;
             bool isVerifying;
@@ -27,7 +27,7 @@
 #include "arm_kinetis_reg.h"
 
 
-float ElectricalTest::analogVolts(int pin)
+float ElectricalTest::adcVolts(int raw)
 {
     // Analog input and voltage divider constants
     const float reference = 1.2;
@@ -36,7 +36,44 @@ float ElectricalTest::analogVolts(int pin)
     const int adcMax = 1023;
 
     const float scale = (reference / adcMax) * ((dividerA + dividerB) / dividerA);
-    return analogRead(pin) * scale;
+    return raw * scale;
+}
+
+float ElectricalTest::analogVolts(int pin)
+{
+    return adcVolts(analogRead(pin));
+}
+
+// ADC0 input channel for each Teensy 3.x analog pin we use, matching the
+// map in the core's analog_init.
+static const uint8_t adcChannel[] = { 5, 14, 8, 9, 13, 12, 6, 7, 15, 4 };
+
+void ElectricalTest::analogBegin(int pin)
+{
+    // Start a software-triggered conversion without waiting for it.
+    // Assumes the core's lazy ADC init and calibration have already run;
+    // initTarget() takes care of that.
+    ADC0_SC1A = adcChannel[pin];
+}
+
+float ElectricalTest::analogCollect()
+{
+    while (!(ADC0_SC1A & ADC_SC1_COCO));
+    return adcVolts(ADC0_RA);
+}
+
+void ElectricalTest::analogScan(const int *pins, float *volts, unsigned count)
+{
+    // Sample a list of nets back-to-back. The next conversion is started
+    // as soon as the previous result is collected, so the ADC stays busy
+    // while results are scaled and stored.
+    analogBegin(pins[0]);
+    for (unsigned n = 0; n < count; n++) {
+        float v = analogCollect();
+        if (n + 1 < count)
+            analogBegin(pins[n + 1]);
+        volts[n] = v;
+    }
 }
 
 bool ElectricalTest::analogThreshold(int pin, float nominal, float tolerance)
@@ -65,18 +102,31 @@ bool ElectricalTest::testOutputPattern(uint8_t bits)
 {
     // Set the target's 8-bit output port to the given value, and check all analog values
 
+    // The power rails are expected at their nominal voltage under every
+    // pattern, so their conversion doesn't depend on the new port state and
+    // can run while the SWD port write is still in flight.
+    analogBegin(analogTarget33vPin);
+
     // Write the port all at once
     if (!target.digitalWritePort(outPin(0), bits))
         return false;
 
     // Check power supply each time
-    if (!analogThreshold(analogTarget33vPin, 3.3)) return false;
-    if (!analogThreshold(analogTargetVUsbPin, 5.0)) return false;
-
-    // Check all data signal levels
+    float vcc = analogCollect();
+    analogBegin(analogTargetVUsbPin);
+    if (!analogThresholdFromSample(vcc, analogTarget33vPin, 3.3)) return false;
+    float vusb = analogCollect();
+    analogBegin(0);
+    if (!analogThresholdFromSample(vusb, analogTargetVUsbPin, 5.0)) return false;
+
+    // Check all data signal levels, keeping a conversion in flight while
+    // each collected sample is checked against its threshold.
     for (unsigned n = 0; n < 8; n++) {
+        float volts = analogCollect();
+        if (n < 7)
+            analogBegin(n + 1);
         bool bit = (bits >> n) & 1;
-        if (!analogThreshold(n, bit ? 5.0 : 0.0))
+        if (!analogThresholdFromSample(volts, n, bit ? 5.0 : 0.0))
             return false;
     }
 
@@ -111,6 +161,10 @@ bool ElectricalTest::initTarget()
 {
     // Target setup that's needed only once per test run
 
+    // One throwaway blocking read, so the core's lazy ADC init and
+    // calibration have run before analogBegin() drives ADC0_SC1A directly.
+    analogRead(analogTarget33vPin);
+
     // Output pin directions
     for (unsigned n = 0; n < 8; n++) {
         if (!target.pinMode(outPin(n), OUTPUT))
@@ -154,39 +208,31 @@ bool ElectricalTest::testBoostConverter()
         // Adjust power supply
         setPowerSupplyVoltage(supply);
 
-        // Collect all relevant voltages
-        float vusb = analogVolts(analogTargetVUsbPin);
-        float vcc = analogVolts(analogTarget33vPin);
-        float v0 = analogVolts(0);
-        float v1 = analogVolts(1);
-        float v2 = analogVolts(2);
-        float v3 = analogVolts(3);
-        float v4 = analogVolts(4);
-        float v5 = analogVolts(5);
-        float v6 = analogVolts(6);
-        float v7 = analogVolts(7);
+        // Collect all relevant voltages in one pipelined scan
+        static const int scanPins[] = {
+            analogTargetVUsbPin, analogTarget33vPin, 0, 1, 2, 3, 4, 5, 6, 7
+        };
+        float volts[10];
+        analogScan(scanPins, volts, 10);
 
         target.log(logLevel,
             "  Supply at %.1fv : Target vusb=%.2fv vcc=%.2fv outputs=["
             "%.2fv %.2fv %.2fv %.2fv %.2fv %.2fv %.2fv %.2fv]",
-            supply, vusb, vcc, v0, v1, v2, v3, v4, v5, v6, v7);
-
-        if (!analogThresholdFromSample(vusb, analogTargetVUsbPin, supply)) return false;
-        if (!analogThresholdFromSample(vcc, analogTarget33vPin, 3.3)) return false;
-        if (!analogThresholdFromSample(v0, 0, 5.0)) return false;
-        if (!analogThresholdFromSample(v1, 1, 5.0)) return false;
-        if (!analogThresholdFromSample(v2, 2, 5.0)) return false;
-        if (!analogThresholdFromSample(v3, 3, 5.0)) return false;
-        if (!analogThresholdFromSample(v4, 4, 5.0)) return false;
-        if (!analogThresholdFromSample(v5, 5, 5.0)) return false;
-        if (!analogThresholdFromSample(v6, 6, 5.0)) return false;
-        if (!analogThresholdFromSample(v7, 7, 5.0)) return false;
+            supply, volts[0], volts[1], volts[2], volts[3], volts[4],
+            volts[5], volts[6], volts[7], volts[8], volts[9]);
+
+        if (!analogThresholdFromSample(volts[0], analogTargetVUsbPin, supply)) return false;
+        if (!analogThresholdFromSample(volts[1], analogTarget33vPin, 3.3)) return false;
+        for (unsigned n = 0; n < 8; n++)
+            if (!analogThresholdFromSample(volts[2 + n], n, 5.0))
+                return false;
 
         // Also make sure we can turn outputs off properly
         if (!target.digitalWritePort(outPin(0), 0x00))
             return false;
+        analogScan(&scanPins[2], volts, 8);
         for (unsigned n = 0; n < 8; n++)
-            if (!analogThreshold(n, 0))
+            if (!analogThresholdFromSample(volts[n], n, 0))
                 return false;
     }
 
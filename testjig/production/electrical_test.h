@@ -47,7 +47,18 @@ private:
     }
 
     void setPowerSupplyVoltage(float volts);
+    float adcVolts(int raw);
     float analogVolts(int pin);
+
+    /*
+     * Non-blocking ADC interface. A conversion started with analogBegin()
+     * runs in hardware while the CPU bit-bangs SWD or checks thresholds;
+     * analogCollect() waits for it and returns the scaled voltage.
+     * analogScan() batches several nets, keeping the ADC busy back-to-back.
+     */
+    void analogBegin(int pin);
+    float analogCollect();
+    void analogScan(const int *pins, float *volts, unsigned count);
     bool analogThresholdFromSample(float volts, int pin, float nominal, float tolerance = 0.30);
     bool analogThreshold(int pin, float nominal, float tolerance = 0.30);
 
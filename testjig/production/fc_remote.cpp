@@ -24,15 +24,19 @@
 #include <Arduino.h>
 #include "fc_remote.h"
 #include "testjig.h"
+#include "firmware_stream.h"
 #include "firmware_data.h"
 
 
 bool FcRemote::installFirmware()
 {
     // Install firmware, blinking both target and local LEDs in unison.
+    // The embedded image is LZSS compressed; decompress it sector by
+    // sector as the programmer streams it to the target.
 
     bool blink = false;
-    ARMKinetisDebug::FlashProgrammer programmer(target, fw_data, fw_sectorCount);
+    FirmwareStream image(fw_compressedData, sizeof fw_compressedData);
+    ARMKinetisDebug::FlashProgrammer programmer(target, image, fw_sectorCount);
 
     if (!programmer.begin())
         return false;
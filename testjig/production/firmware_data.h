@@ -32,1158 +32,1160 @@ static const uint32_t fw_pFbNext = 0x20000f1c;  // &buffers.fbNext
 static const uint32_t fw_pLUT = 0x20000910;  // &buffers.lutCurrent.entries[0]
 static const uint32_t fw_usbPacketBufOffset = 0x4;  // &((usb_packet_t*)0)->buf
 
+// 18 sectors (18432 bytes), LZSS compressed to 13834 bytes
 static const unsigned fw_sectorCount = 18;
-static const uint32_t fw_data[4608] = {
-    0x20001ffc, 0x000000f9, 0x1fffe203, 0x1fffe203,   // 0x00000000
-    0x1fffe203, 0x1fffe203, 0x1fffe203, 0x1fffe201,   // 0x00000010
-    0x1fffe201, 0x1fffe201, 0x1fffe201, 0x1fffe203,   // 0x00000020
-    0x1fffe203, 0x1fffe201, 0x1fffe203, 0x1fffe203,   // 0x00000030
-    0x1fffe203, 0x1fffe203, 0x1fffe203, 0x1fffe203,   // 0x00000040
-    0x1fffe203, 0x1fffe203, 0x1fffe203, 0x1fffe203,   // 0x00000050
-    0x1fffe203, 0x1fffe203, 0x1fffe203, 0x1fffe203,   // 0x00000060
-    0x1fffe203, 0x1fffe203, 0x1fffe203, 0x1fffe203,   // 0x00000070
-    0x1fffe709, 0x1fffe203, 0x1fffe203, 0x1fffe203,   // 0x00000080
-    0x1fffe203, 0x1fffe203, 0x1fffe203, 0x1fffe203,   // 0x00000090
-    0x1fffe203, 0x1fffe203, 0x1fffe203, 0x1fffe203,   // 0x000000a0
-    0x1fffe203, 0x1fffe203, 0x1fffe203, 0x1fffe203,   // 0x000000b0
-    0x1fffe203, 0x1fffe203, 0x1fffe203, 0x1fffe245,   // 0x000000c0
-    0x1fffe203, 0x1fffe203, 0x1fffe203, 0x1fffe203,   // 0x000000d0
-    0x1fffe203, 0x1fffe203, 0x1fffe203, 0x1fffe203,   // 0x000000e0
-    0x1fffe203, 0x1fffe203, 0xf24c4b43, 0xf64d5220,   // 0x000000f0
-    0x801a1028, 0xbf008018, 0x21d3bf00, 0x1c0ef823,   // 0x00000100
-    0x20072200, 0x41a6f44f, 0xf823811a, 0x4a3b0c0a,   // 0x00000110
-    0x1c08f823, 0x4b3b483a, 0x601a493b, 0x780a6058,   // 0x00000120
-    0x0308f002, 0xb118b2d8, 0xf042780a, 0x700b0308,   // 0x00000130
-    0x4b374836, 0x7001210a, 0x21a02224, 0xf803701a,   // 0x00000140
-    0x48341c01, 0xf0027802, 0xb2d90302, 0xd0f82900,   // 0x00000150
-    0x78024830, 0x0310f002, 0x2900b2d9, 0x482dd1f8,   // 0x00000160
-    0xf0027802, 0x2b08030c, 0x482bd1f9, 0x22402103,   // 0x00000170
-    0x23007001, 0x4a297042, 0x18984929, 0xd2044288,   // 0x00000180
-    0x58584928, 0x33045098, 0x4827e7f5, 0x42984b27,   // 0x00000190
-    0x0300f04f, 0xf840d202, 0xe7f73b04, 0x4a254824,   // 0x000001a0
-    0x50995819, 0xf5b33304, 0xd1f77f80, 0x60024822,   // 0x000001b0
-    0x78114a18, 0x0320f001, 0x2800b2d8, 0x4a15d0f8,   // 0x000001c0
-    0xf0017811, 0xb2d80340, 0xd0f82800, 0x491c4a1b,   // 0x000001d0
-    0x600a4b1c, 0x70182020, 0x78114a0e, 0x000cf001,   // 0x000001e0
-    0xd1f9280c, 0x49194b18, 0x601a2202, 0x60193b44,   // 0x000001f0
-    0xf000b662, 0xbf00b8e9, 0x4005200e, 0x00043f82,   // 0x00000200
-    0x2b000001, 0x40048038, 0x4007d002, 0x40065000,   // 0x00000210
-    0x40064001, 0x40064006, 0x40064004, 0x1fffe200,   // 0x00000220
-    0x1fffecd4, 0x00000410, 0x1ffff000, 0x1ffff530,   // 0x00000230
-    0x00000000, 0x1ffff000, 0xe000ed08, 0x11030000,   // 0x00000240
-    0x40048044, 0x40064000, 0x40048048, 0x000510c0,   // 0x00000250
-    0x681a4b18, 0x6180f442, 0x60194a17, 0x70132300,   // 0x00000260
-    0x4a174916, 0x7013700b, 0x4a174916, 0x7013700b,   // 0x00000270
-    0xf2404b16, 0xf44f3113, 0x60197251, 0x4b14605a,   // 0x00000280
-    0x3144f3c0, 0x1247f3c0, 0xf0007019, 0x705a001f,   // 0x00000290
-    0x72984a10, 0x23042102, 0x74517013, 0x4b0e74d3,   // 0x000002a0
-    0x70182088, 0x223c480d, 0x3180f44f, 0x2c0df803,   // 0x000002b0
-    0x47706001, 0x40048034, 0x1ffff522, 0x1ffff4a1,   // 0x000002c0
-    0x1ffff524, 0x1ffff523, 0x1ffff4a0, 0x4004a040,   // 0x000002d0
-    0x4006a000, 0x4006a002, 0x4006a010, 0xe000e100,   // 0x000002e0
-    0x68194b11, 0xd51e054b, 0x78134a10, 0x2b3f3301,   // 0x000002f0
-    0x2300bf88, 0x780a490e, 0xd109429a, 0x4a0db672,   // 0x00000300
-    0x6102f24a, 0xf24b8011, 0x80114180, 0xe7f1b662,   // 0x00000310
-    0x4a0a4909, 0x200154c8, 0x49047010, 0xb2db4a08,   // 0x00000320
-    0x700b20bc, 0x47707010, 0x40048034, 0x1ffff524,   // 0x00000330
-    0x1ffff523, 0x4005200c, 0x1ffff4a2, 0x1ffff4a0,   // 0x00000340
-    0x4006a003, 0x1845b538, 0x42ac4604, 0xf814d004,   // 0x00000350
-    0xf7ff0b01, 0xe7f8ffc5, 0x4b07bd38, 0xb1487818,   // 0x00000360
-    0x4906b672, 0x6202f24a, 0x4380f24b, 0x800b800a,   // 0x00000370
-    0xe7f2b662, 0xbf004770, 0x1ffff4a0, 0x4005200c,   // 0x00000380
-    0x4b0bb508, 0x05426818, 0xf7ffd511, 0x4909ffe6,   // 0x00000390
-    0xf44f4809, 0x600a3280, 0x23004908, 0x1203f240,   // 0x000003a0
-    0x600a7003, 0x604a4806, 0x70034a06, 0xbd087013,   // 0x000003b0
-    0x40048034, 0xe000e180, 0x4006a003, 0x4004a040,   // 0x000003c0
-    0x1ffff522, 0x1ffff4a1, 0x4802b401, 0xbc014684,   // 0x000003d0
-    0xbf004760, 0x1fffe815, 0xffffffff, 0xffffffff,   // 0x000003e0
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x000003f0
-    0xffffffff, 0xffffffff, 0xfffffffe, 0x40fffffe,   // 0x00000400
-    0xe7fee7fe, 0x4b0cb5f0, 0x781a4c0c, 0x0502f042,   // 0x00000410
-    0x06c5eb04, 0x0201f082, 0x48096070, 0x7806701a,   // 0x00000420
-    0xbf0c2e00, 0x27c82788, 0x4101ea47, 0x0601f086,   // 0x00000430
-    0x1035f844, 0xbdf07006, 0x1ffff448, 0x1fffe000,   // 0x00000440
-    0x1ffff49f, 0x43f7e92d, 0x78134a92, 0x0104f003,   // 0x00000450
-    0xb108b2c8, 0x70112104, 0x0208f003, 0x2a00b2d2,   // 0x00000460
-    0x8190f000, 0x782d4d8c, 0xf040092b, 0x08ad8187,   // 0x00000470
-    0xf8544c8a, 0xeb041035, 0xf3c107c5, 0x28090083,   // 0x00000480
-    0xf000687f, 0x280d8158, 0x2801d003, 0x8173f040,   // 0x00000490
-    0x6879e11c, 0x683a4882, 0x49826041, 0xf8446002,   // 0x000004a0
-    0x4c811035, 0x60234981, 0x700c2401, 0x4980b292,   // 0x000004b0
-    0x6fa0f5b2, 0xd068800b, 0xf240d821, 0x429a1321,   // 0x000004c0
-    0x808bf000, 0x2a82d80c, 0xf5b2d03f, 0xd04e7f81,   // 0x000004d0
-    0xf0402a80, 0x4c7780ae, 0x70262600, 0xe0ab7066,   // 0x000004e0
-    0x33a1f240, 0xf000429a, 0x33808088, 0xf000429a,   // 0x000004f0
-    0xf240808b, 0x42823002, 0x809bf040, 0xf240e047,   // 0x00000500
-    0x428a6181, 0xf5b2d80b, 0xd24e6fd0, 0x53a1f240,   // 0x00000510
-    0xd07f429a, 0x429a3380, 0x808bf040, 0xf5b2e082,   // 0x00000520
-    0xd00f6f10, 0xf5b2d808, 0xf0406f08, 0x4c628082,   // 0x00000530
-    0x4c607826, 0xe0737026, 0x43fdf5a2, 0x2b013b40,   // 0x00000540
-    0xe045d877, 0x4d5c7881, 0x8880e01e, 0xb1084b5b,   // 0x00000550
-    0xe10f210f, 0x26004c57, 0x70667026, 0xf003781b,   // 0x00000560
-    0xb2d50202, 0xd0672d00, 0x70212101, 0x484ce064,   // 0x00000570
-    0x06518882, 0x8843d15d, 0xd15a2b00, 0x00954c4f,   // 0x00000580
-    0x7829192d, 0x0102f021, 0x461c7029, 0x4944e05b,   // 0x00000590
-    0x0650888a, 0x884bd14d, 0xd14a2b00, 0x00944e47,   // 0x000005a0
-    0x782819a5, 0x0102f040, 0x8842e7ee, 0xf8534b44,   // 0x000005b0
-    0xf1a34c08, 0x2c00010c, 0x330cd03b, 0x0c18f833,   // 0x000005c0
-    0xd1f44290, 0x2d030a15, 0x7823bf0c, 0xe03a890b,   // 0x000005d0
-    0x88914a33, 0xd12c2904, 0x8881e030, 0x88c1bb49,   // 0x000005e0
-    0x8840b949, 0x460a9100, 0xf000460b, 0xb910fad5,   // 0x000005f0
-    0x240f4e32, 0x23007034, 0x8880e7c7, 0x482db9c8,   // 0x00000600
-    0xfb2ef000, 0xe014b9e8, 0x889a4b25, 0xf000b98a,   // 0x00000610
-    0xe00cfb91, 0xb9618881, 0xfab8f000, 0x70204c25,   // 0x00000620
-    0xe0102301, 0x88904a1e, 0xf000b918, 0x2800fb99,   // 0x00000630
-    0x210fd1e1, 0xe09d4b21, 0xe0042302, 0x4c212328,   // 0x00000640
-    0x4c1ce001, 0x48162306, 0x42b388c6, 0x461ebf38,   // 0x00000650
-    0xbf342e40, 0x25404635, 0x46294620, 0xfed2f7ff,   // 0x00000660
-    0x442c1b76, 0x2d40d104, 0x8085f040, 0xe0034635,   // 0x00000670
-    0xbf342e40, 0x25404635, 0x46294620, 0xfec2f7ff,   // 0x00000680
-    0x442c1b76, 0x2d40d101, 0x4b07d175, 0x601c4a0e,   // 0x00000690
-    0xe0708016, 0x40072080, 0x40072090, 0x1fffe000,   // 0x000006a0
-    0x1ffff48c, 0x00400080, 0x1ffff400, 0x1ffff49f,   // 0x000006b0
-    0x1ffff404, 0x1ffff496, 0x1ffff49e, 0x400720c0,   // 0x000006c0
-    0x1fffebd4, 0x1fffec6e, 0x1ffff494, 0x88194b4c,   // 0x000006d0
-    0x1221f240, 0xd12a4291, 0x4a4a8898, 0x8811b118,   // 0x000006e0
-    0x429988db, 0x4e46d820, 0x88f18812, 0x97008870,   // 0x000006f0
-    0x0901ebc2, 0x0f40f1b9, 0xf04fbf28, 0x464b0940,   // 0x00000700
-    0x8100f8df, 0xfa48f000, 0xf8b8b170, 0x88f20000,   // 0x00000710
-    0xfa1f4481, 0x454af989, 0x9000f8a8, 0x483ad807,   // 0x00000720
-    0xf7ff2100, 0xe002fe6f, 0x210f4b38, 0x48387019,   // 0x00000730
-    0x0035f844, 0x4d37e01f, 0xb195682d, 0x88374e36,   // 0x00000740
-    0xbf342f40, 0x2440463c, 0x46214628, 0xfe5af7ff,   // 0x00000750
-    0xb2881b39, 0xb9088030, 0xd1002c40, 0x4b2d1928,   // 0x00000760
-    0x49276018, 0xf5b2880a, 0xd1046fa0, 0x70482000,   // 0x00000770
-    0x78894b2a, 0x482a7019, 0x70022201, 0x21084b29,   // 0x00000780
-    0xe6617019, 0xd51f07d9, 0x4b274925, 0x24024820,   // 0x00000790
-    0x701a700c, 0x4c264b25, 0x60986018, 0x611a4825,   // 0x000007a0
-    0x619a60d8, 0x4b19605c, 0x7018200d, 0x23ff4822,   // 0x000007b0
-    0xf8007003, 0x74023c08, 0x70134a20, 0x209f4b20,   // 0x000007c0
-    0x70182201, 0xe018700a, 0xd505061a, 0x200d4a0f,   // 0x000007d0
-    0x70102180, 0x1c40f802, 0x0002f003, 0xb12ab2c2,   // 0x000007e0
-    0x78014815, 0x70012202, 0x2c08f800, 0x0310f003,   // 0x000007f0
-    0xb110b2d8, 0x21104a0b, 0xe8bd7011, 0xbf0083fe,   // 0x00000800
-    0x1ffff48c, 0x1ffff404, 0x1ffff496, 0x400720c0,   // 0x00000810
-    0x00400080, 0x1ffff400, 0x1ffff494, 0x40072098,   // 0x00000820
-    0x40072094, 0x40072080, 0x1ffff448, 0x1fffe000,   // 0x00000830
-    0x1ffff408, 0x1ffff44c, 0x40072088, 0x4007208c,   // 0x00000840
-    0x40072084, 0x681a4b17, 0x2080f442, 0x4b166018,   // 0x00000850
-    0x70192180, 0x4a147818, 0xd4fb0600, 0x49144b13,   // 0x00000860
-    0x2007f3c3, 0xf3c37008, 0x75084007, 0x20ff0e1b,   // 0x00000870
-    0xf801760b, 0xf8010c1c, 0xf8010c14, 0x78110c8c,   // 0x00000880
-    0xf0412001, 0x21000340, 0xf8027013, 0x4b090c78,   // 0x00000890
-    0x1c0cf802, 0xf8024908, 0x22080c88, 0x601a2010,   // 0x000008a0
-    0x47707008, 0x40048034, 0x4007210c, 0x1fffe000,   // 0x000008b0
-    0x4007209c, 0xe000e104, 0x40072108, 0x49054b04,   // 0x000008c0
-    0x780a7818, 0xbf384290, 0x1a803040, 0xbf004770,   // 0x000008d0
-    0x1ffff522, 0x1ffff4a1, 0x78194b08, 0x781a4b08,   // 0x000008e0
-    0xd0084291, 0xb2c21c50, 0xbf882a3f, 0x49052200,   // 0x000008f0
-    0x701a5c88, 0xf04f4770, 0x477030ff, 0x1ffff522,   // 0x00000900
-    0x1ffff4a1, 0x1ffff4e2, 0x4b30b510, 0xf0107818,   // 0x00000910
-    0xd0210f30, 0x492eb672, 0xb932780a, 0x780b390f,   // 0x00000920
-    0x21404b2c, 0xb6627019, 0xb662e016, 0x482b4c2a,   // 0x00000930
-    0x78007823, 0x780c492a, 0xb2c91c59, 0xbf88293f,   // 0x00000940
-    0x42812100, 0x4b27d002, 0x460b545c, 0xf0123a01,   // 0x00000950
-    0xd1ef02ff, 0x70034820, 0x78104a23, 0x2900b241,   // 0x00000960
-    0xda21b2c2, 0x78184b19, 0xd51d0603, 0x49204c1f,   // 0x00000970
-    0x780b7824, 0xd00e42a3, 0x48143301, 0x7801b2db,   // 0x00000980
-    0x2b3f491c, 0x2300bf88, 0x49155cc8, 0x310d7008,   // 0x00000990
-    0x28077808, 0x4916d9ee, 0x4b0c700b, 0x06007818,   // 0x000009a0
-    0x4b11d502, 0x7019217c, 0x0240f002, 0xb158b2d0,   // 0x000009b0
-    0x780b4906, 0x0240f003, 0xb128b2d0, 0x480a4b0e,   // 0x000009c0
-    0x223c2100, 0x70027019, 0xbf00bd10, 0x4006a004,   // 0x000009d0
-    0x4006a016, 0x4006a011, 0x1ffff522, 0x1ffff4a1,   // 0x000009e0
-    0x4006a007, 0x1ffff4e2, 0x4006a003, 0x1ffff524,   // 0x000009f0
-    0x1ffff523, 0x1ffff4a2, 0x1ffff4a0, 0x4b04b672,   // 0x00000a00
-    0x6202f24a, 0x4080f24b, 0x8018801a, 0x4770b662,   // 0x00000a10
-    0x4005200c, 0xf242b538, 0xf0007010, 0x2107f9ad,   // 0x00000a20
-    0xf000482e, 0x200af9b1, 0xf9bef000, 0xf9c4f000,   // 0x00000a30
-    0xf7ff2400, 0xb140ff43, 0xff4ef7ff, 0x5ce14b27,   // 0x00000a40
-    0xd1024288, 0x2c073401, 0xf000d1f3, 0x2c07f9a5,   // 0x00000a50
-    0x4c23d00b, 0xf5a06860, 0xf5b25280, 0xd2043ff8,   // 0x00000a60
-    0x49214d20, 0x428b682b, 0x4a20d127, 0x20204c20,   // 0x00000a70
-    0x75a2f44f, 0x60106025, 0x0c14f842, 0xf86ef000,   // 0x00000a80
-    0xfee0f7ff, 0xf882f000, 0xd0022807, 0xffb6f7ff,   // 0x00000a90
-    0x4b14e7f8, 0x60192100, 0x4816240b, 0x60052520,   // 0x00000aa0
-    0xf7ff4d15, 0x3d01ffab, 0x3c01d1fb, 0xf7ffd1f5,   // 0x00000ab0
-    0xb672ffa5, 0x70144a11, 0xb672e7fe, 0x60044810,   // 0x00000ac0
-    0xff9cf7ff, 0x602a2200, 0x68616820, 0x33fff04f,   // 0x00000ad0
-    0x4685469e, 0x20004708, 0xbf00bd38, 0x1fffecc4,   // 0x00000ae0
-    0x00001000, 0x20001ffc, 0x74624346, 0x400ff094,   // 0x00000af0
-    0x4004b014, 0x400ff08c, 0x000186a0, 0x40072108,   // 0x00000b00
-    0xe000ed08, 0xb5100603, 0xf010d520, 0xd0070440,   // 0x00000b10
-    0x4b10480f, 0x210e220a, 0x70197002, 0xe0132200,   // 0x00000b20
-    0x0230f010, 0x4a0ad008, 0x210a4b0a, 0x490a7011,   // 0x00000b30
-    0x70182008, 0xe009700c, 0x0001f010, 0x4b04d007,   // 0x00000b40
-    0x7018200a, 0x70014803, 0x70024803, 0xbd102001,   // 0x00000b50
-    0x1fffeccc, 0x1ffff52d, 0x1ffff52c, 0x781a4b09,   // 0x00000b60
-    0xd5fb0611, 0x21814808, 0x700122ff, 0x2c01f800,   // 0x00000b70
-    0x20802170, 0x70187019, 0x781a4b02, 0xd5fb0612,   // 0x00000b80
-    0xbf004770, 0x40020000, 0x40020007, 0x78184b01,   // 0x00000b90
-    0xbf004770, 0x1fffeccc, 0x189cb5f0, 0x6f80f5b4,   // 0x00000ba0
-    0xd8019e05, 0xd904428c, 0x210a4b26, 0x22087019,   // 0x00000bb0
-    0x4d25e020, 0x250018aa, 0xd003429d, 0x55575d77,   // 0x00000bc0
-    0xe7f93501, 0xd13b428c, 0x781a4b1e, 0xd0052a02,   // 0x00000bd0
-    0xd0032a05, 0x7018200a, 0xe00b220f, 0x4a19491b,   // 0x00000be0
-    0xf013780b, 0xd0020f80, 0x78334e19, 0x210ab133,   // 0x00000bf0
-    0x220e7011, 0x70024817, 0xbdf02000, 0x4815b924,   // 0x00000c00
-    0x70132306, 0xe01b7004, 0x48130284, 0x5480f504,   // 0x00000c10
-    0x25016004, 0x70354811, 0x70062609, 0x4607f3c4,   // 0x00000c20
-    0xb2e40a24, 0x6c01f800, 0x4c02f800, 0x3c03f800,   // 0x00000c30
-    0x70082070, 0x70082080, 0x70112103, 0x70134a05,   // 0x00000c40
-    0xbdf02001, 0x1fffeccc, 0x14000000, 0x40020000,   // 0x00000c50
-    0x1ffff52c, 0x1ffff52d, 0x1ffff528, 0x40020007,   // 0x00000c60
-    0xb5f84a2c, 0x2b037813, 0xd3424604, 0xd9082b04,   // 0x00000c70
-    0xd13e2b06, 0x70102007, 0xf44f4a27, 0x6011717a,   // 0x00000c80
-    0x4d26e037, 0x782f4e26, 0x2f017830, 0x2f02d002,   // 0x00000c90
-    0xe01ed124, 0xf7ff2104, 0xb9f8ff35, 0x4a224921,   // 0x00000ca0
-    0x702b2302, 0x210b680b, 0xf3c37011, 0xf8024107,   // 0x00000cb0
-    0xf3c31c01, 0xb2db2107, 0x1c02f802, 0x3c03f802,   // 0x00000cc0
-    0x21804a1a, 0xf8027017, 0x20700c01, 0x70317030,   // 0x00000cd0
-    0x2107e004, 0xff16f7ff, 0x7028b900, 0x781a4b0d,   // 0x00000ce0
-    0xd0062a0a, 0x7801480d, 0x2205b909, 0x2204e000,   // 0x00000cf0
-    0x4b0f701a, 0x78184908, 0x4906680b, 0x0a1a7020,   // 0x00000d00
-    0x70630c18, 0x70a2780b, 0x70e02200, 0x71627123,   // 0x00000d10
-    0xbdf82001, 0x1fffeccc, 0x1fffecd0, 0x1ffff52c,   // 0x00000d20
-    0x40020000, 0x1ffff528, 0x40020007, 0x4002000b,   // 0x00000d30
-    0x1ffff52d, 0x48094b08, 0x2a0a781a, 0x2202d105,   // 0x00000d40
-    0x70012100, 0x2001701a, 0x210a4770, 0x230f7019,   // 0x00000d50
-    0x20007003, 0xbf004770, 0x1fffeccc, 0x1ffff52d,   // 0x00000d60
-    0x49044b03, 0x22022000, 0x701a7008, 0x47702001,   // 0x00000d70
-    0x1fffeccc, 0x1ffff52d, 0x4802b401, 0xbc014684,   // 0x00000d80
-    0xbf004760, 0x00000261, 0x4802b401, 0xbc014684,   // 0x00000d90
-    0xbf004760, 0x00000355, 0x4802b401, 0xbc014684,   // 0x00000da0
-    0xbf004760, 0x00000391, 0x4802b401, 0xbc014684,   // 0x00000db0
-    0xbf004760, 0x000002f1, 0x4802b401, 0xbc014684,   // 0x00000dc0
-    0xbf004760, 0x0000036b, 0x00000100, 0x1fffec1c,   // 0x00000dd0
-    0x00000012, 0x00000200, 0x1fffec40, 0x0000001b,   // 0x00000de0
-    0x00000300, 0x1fffecc0, 0x00000000, 0x00000301,   // 0x00000df0
-    0x1fffec2e, 0x00000000, 0x00000302, 0x1fffec96,   // 0x00000e00
-    0x00000000, 0x000003ee, 0x1fffec5c, 0x00000000,   // 0x00000e10
-    0x00000000, 0x00000000, 0x00000000, 0x02000112,   // 0x00000e20
-    0x40000000, 0x60821d50, 0x02010101, 0x03120100,   // 0x00000e30
-    0x00630073, 0x006e0061, 0x0069006c, 0x0065006d,   // 0x00000e40
-    0x001b0209, 0x80020101, 0x00040932, 0x01fe0000,   // 0x00000e50
-    0x21090202, 0x0027100d, 0x00010104, 0x004d0312,   // 0x00000e60
-    0x00460053, 0x00310054, 0x00300030, 0x0028007e,   // 0x00000e70
-    0x01000000, 0x00010004, 0x00000000, 0x01000000,   // 0x00000e80
-    0x554e4957, 0x00004253, 0x00000000, 0x00000000,   // 0x00000e90
-    0x00000000, 0x032a0000, 0x00610046, 0x00650064,   // 0x00000ea0
-    0x00610063, 0x0064006e, 0x00200079, 0x006f0042,   // 0x00000eb0
-    0x0074006f, 0x006f006c, 0x00640061, 0x00720065,   // 0x00000ec0
-    0x04090304, 0x422d4346, 0x00746f6f, 0x00000002,   // 0x00000ed0
-    0x00000001, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000ee0
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000ef0
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000f00
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000f10
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000f20
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000f30
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000f40
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000f50
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000f60
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000f70
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000f80
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000f90
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000fa0
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000fb0
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000fc0
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000fd0
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000fe0
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,   // 0x00000ff0
-    0x20001ffc, 0x0000110d, 0x000010fb, 0x000010fb,   // 0x00001000
-    0x000010fb, 0x000010fb, 0x000010fb, 0x000010f9,   // 0x00001010
-    0x000010f9, 0x000010f9, 0x000010f9, 0x000010fb,   // 0x00001020
-    0x000010fb, 0x000010f9, 0x000010fb, 0x000010fd,   // 0x00001030
-    0x000010fb, 0x000010fb, 0x000010fb, 0x00004421,   // 0x00001040
-    0x000010fb, 0x000010fb, 0x000010fb, 0x000010fb,   // 0x00001050
-    0x000010fb, 0x000010fb, 0x000010fb, 0x000010fb,   // 0x00001060
-    0x000010fb, 0x000010fb, 0x000010fb, 0x000010fb,   // 0x00001070
-    0x00001e59, 0x000010fb, 0x000010fb, 0x000010fb,   // 0x00001080
-    0x000010fb, 0x000010fb, 0x000010fb, 0x000010fb,   // 0x00001090
-    0x000010fb, 0x000010fb, 0x000010fb, 0x000010fb,   // 0x000010a0
-    0x000010fb, 0x000010fb, 0x000010fb, 0x000010fb,   // 0x000010b0
-    0x000010fb, 0x000010fb, 0x000010fb, 0x000016b5,   // 0x000010c0
-    0x000010fb, 0x000010fb, 0x000010fb, 0x000010fb,   // 0x000010d0
-    0x000010fb, 0x000010fb, 0x000010fb, 0x000010fb,   // 0x000010e0
-    0x000010fb, 0x000010fb, 0xe7fee7fe, 0x681a4b02,   // 0x000010f0
-    0x60181c50, 0xbf004770, 0x200007e0, 0x2300b510,   // 0x00001100
-    0x49214a20, 0x42881898, 0x4920d204, 0x50985858,   // 0x00001110
-    0xe7f53304, 0x4c1f481e, 0xd20342a0, 0xf8402400,   // 0x00001120
-    0xe7f84b04, 0xf64b4b1c, 0x2007327f, 0xf843601a,   // 0x00001130
-    0x4c1a0c04, 0x060a7821, 0x4a19d5fb, 0x70132381,   // 0x00001140
-    0x217020ff, 0xf8022380, 0x70210c01, 0x4c137023,   // 0x00001150
-    0x06137822, 0x4913d5fb, 0x42814813, 0x2200d203,   // 0x00001160
-    0x2b04f841, 0xb662e7f8, 0xf864f000, 0x49104c0f,   // 0x00001170
-    0xd003428c, 0x3b04f854, 0xe7f84798, 0xf83af001,   // 0x00001180
-    0xbf00e7fe, 0x200007e0, 0x200007e0, 0x00004800,   // 0x00001190
-    0x200007e0, 0x20001cec, 0xe000e014, 0x40020000,   // 0x000011a0
-    0x40020007, 0x14000000, 0x14000800, 0x000047fc,   // 0x000011b0
-    0x00004800, 0x68184b01, 0xbf004770, 0x4003d000,   // 0x000011c0
-    0x49054b04, 0x601a2200, 0x4a04600a, 0x20106010,   // 0x000011d0
-    0x47706018, 0x4003d014, 0x4003d004, 0x4003d000,   // 0x000011e0
-    0xdb0e2800, 0xf44f0202, 0xf5b27380, 0xd3064f00,   // 0x000011f0
-    0x2b013b01, 0x0102ebc0, 0x460ad001, 0x0a10e7f5,   // 0x00001200
-    0x4240e010, 0xf44f0202, 0xf5b27380, 0xd3064f01,   // 0x00001210
-    0x2b013b01, 0x0102ebc0, 0x460ad001, 0x0a11e7f5,   // 0x00001220
-    0x7080f5c1, 0x49023b01, 0x2003ea40, 0x47706008,   // 0x00001230
-    0x4003d00c, 0x4a114b10, 0xf64b2000, 0xb51071ff,   // 0x00001240
-    0x4c0f6018, 0x23286059, 0x60936013, 0x61936113,   // 0x00001250
-    0x62936213, 0x63936313, 0x60222209, 0x60204c09,   // 0x00001260
-    0x60014809, 0x600b4909, 0x4b09608b, 0xe8bd601a,   // 0x00001270
-    0xf0004010, 0xbf00bc31, 0x40038004, 0x4003800c,   // 0x00001280
-    0x40038000, 0x40039004, 0x40039008, 0x4003900c,   // 0x00001290
-    0x40039000, 0x2300b510, 0x7237f44f, 0xf203fa42,   // 0x000012a0
-    0xd8024291, 0x2b073301, 0x4a16d1f6, 0xf203fa42,   // 0x000012b0
-    0x0251eb02, 0xf1f1fbb2, 0xf64f3901, 0x429172ff,   // 0x000012c0
-    0x4611bf28, 0x2a011ec2, 0x4a0fd806, 0x20004c0f,   // 0x000012d0
-    0x60206010, 0xe00f480e, 0x2a011f42, 0x2809d906,   // 0x000012e0
-    0x280ad004, 0x3814d002, 0xd8092803, 0x4c0a4a09,   // 0x000012f0
-    0x60102000, 0x48096020, 0x0308f043, 0x60136001,   // 0x00001300
-    0xbf00bd10, 0x02dc6c00, 0x40039000, 0x40039004,   // 0x00001310
-    0x40039008, 0x40038000, 0x40038004, 0x40038008,   // 0x00001320
-    0xb5102821, 0x4a0dd818, 0x3030f852, 0x4280f893,   // 0x00001330
-    0x2001b13c, 0xf883b111, 0xbd100080, 0x0100f883,   // 0x00001340
-    0xeb02bd10, 0x684300c0, 0xb111681a, 0x0103f042,   // 0x00001350
-    0xf022e001, 0x60190102, 0xbf00bd10, 0x000044f0,   // 0x00001360
-    0xd8052821, 0xf8534b03, 0xf8900030, 0x47700200,   // 0x00001370
-    0x47702000, 0x000044f0, 0xd8162821, 0xeb024a0b,   // 0x00001380
-    0x290103c0, 0xf852685b, 0xd1042030, 0x1280f882,   // 0x00001390
-    0x71a2f44f, 0x2000e008, 0x0280f882, 0xf44fb911,   // 0x000013a0
-    0xe0017180, 0x1103f240, 0x47706019, 0x000044f0,   // 0x000013b0
-    0xb5102900, 0xdc014604, 0xe05e2100, 0xd90129ff,   // 0x000013c0
-    0xe05a2101, 0xb2d31ec2, 0xbf942b01, 0x4b304b2f,   // 0x000013d0
-    0x1c436818, 0x0a1b434b, 0xd8492a14, 0xf002e8df,   // 0x000013e0
-    0x1d17110b, 0x29234848, 0x48484848, 0x48484848,   // 0x000013f0
-    0x3b352f48, 0x48270041, 0x7251f44f, 0x48266003,   // 0x00001400
-    0x4a26e034, 0x60134826, 0x7251f44f, 0x4925e02e,   // 0x00001410
-    0x600b4825, 0x4244f240, 0x4824e028, 0x4244f240,   // 0x00001420
-    0x48236003, 0x4a23e022, 0x60134823, 0x4244f240,   // 0x00001430
-    0x4922e01c, 0x600b4822, 0x4244f240, 0x4821e016,   // 0x00001440
-    0x4244f240, 0x48206003, 0x4a20e010, 0x60134820,   // 0x00001450
-    0x4244f240, 0x491fe00a, 0x600b481f, 0x4244f240,   // 0x00001460
-    0x491ee004, 0x600b481e, 0x4244f240, 0xbd106002,   // 0x00001470
-    0x4620297f, 0x2100bfd4, 0xf7ff2101, 0x4620ff51,   // 0x00001480
-    0xe8bd2101, 0xf7ff4010, 0xbf00bf77, 0x40039008,   // 0x00001490
-    0x40038008, 0x40039010, 0x40049030, 0x40039018,   // 0x000014a0
-    0x40049034, 0x40038048, 0x4004c01c, 0x40038030,   // 0x000014b0
-    0x4004c010, 0x40038020, 0x4004b00c, 0x40038028,   // 0x000014c0
-    0x4004b010, 0x40038038, 0x4004c014, 0x40038040,   // 0x000014d0
-    0x4004c018, 0x40038010, 0x4004b004, 0x40038018,   // 0x000014e0
-    0x4004b008, 0x4b0bb672, 0x490c480b, 0x6803681a,   // 0x000014f0
-    0xb6626808, 0xd5020141, 0xbf882a32, 0xf5c23301,   // 0x00001500
-    0x327f423b, 0xfbb22130, 0xf44ff2f1, 0xfb00707a,   // 0x00001510
-    0x47702003, 0xe000e018, 0x200007e0, 0xe000ed04,   // 0x00001520
-    0x4604b538, 0xffdef7ff, 0xb1544605, 0xffdaf7ff,   // 0x00001530
-    0xf5b01b40, 0xd3f97f7a, 0xd0023c01, 0x757af505,   // 0x00001540
-    0xbd38e7f4, 0x4b17b51f, 0x22224917, 0x70582003,   // 0x00001550
-    0x680c701a, 0x94034b15, 0x4815681a, 0x68019202,   // 0x00001560
-    0x91014c14, 0x93006823, 0x22004b13, 0x0002f81d,   // 0x00001570
-    0x40434912, 0x434b3201, 0xd1f72a10, 0xf81d2200,   // 0x00001580
-    0x480e4002, 0x40634907, 0xeb014343, 0x211a0042,   // 0x00001590
-    0xf4f1fbb3, 0x3114fb01, 0x31413201, 0x80412a10,   // 0x000015a0
-    0xbd1fd1ed, 0x14000000, 0x40048054, 0x40048058,   // 0x000015b0
-    0x4004805c, 0x40048060, 0x811c9dc5, 0x01000193,   // 0x000015c0
-    0x4c13b570, 0x2080f894, 0x0540f104, 0xbf082a00,   // 0x000015d0
-    0x23004625, 0xd003428b, 0x54ee5cc6, 0xe7f93301,   // 0x000015e0
-    0x1081f894, 0xbf0c2900, 0x20c82088, 0x4303ea40,   // 0x000015f0
-    0x0502f042, 0xf8404807, 0x4b053035, 0x0101f081,   // 0x00001600
-    0x0201f082, 0x1081f883, 0x2080f883, 0xbf00bd70,   // 0x00001610
-    0x200007e4, 0x1fffe000, 0x4604b570, 0xf8564e12,   // 0x00001620
-    0xeb063034, 0x0c1905c0, 0xd0146868, 0x1d04f820,   // 0x00001630
-    0xfdd8f000, 0xb672b958, 0x2001490c, 0x3082f891,   // 0x00001640
-    0xf404fa00, 0xf881431c, 0xb6624082, 0xf000bd70,   // 0x00001650
-    0x3004fa99, 0x4b066068, 0xf0154a06, 0xbf080f08,   // 0x00001660
-    0xf8464613, 0xbd703034, 0x1fffe000, 0x200007e4,   // 0x00001670
-    0x004000c8, 0x00400088, 0xb672b538, 0x25004b08,   // 0x00001680
-    0x4082f893, 0x5082f883, 0xb13cb662, 0xd50207e3,   // 0x00001690
-    0xf7ff4628, 0x3501ffc1, 0xe7f60864, 0xbf00bd38,   // 0x000016a0
-    0x200007e4, 0x4ab7b5f8, 0xf0037813, 0xb2c80104,   // 0x000016b0
-    0x2104b108, 0xf0037011, 0xb2d20208, 0xf0002a00,   // 0x000016c0
-    0x48b181b4, 0x09117802, 0x2900460b, 0x81a2f040,   // 0x000016d0
-    0x4dae0890, 0x2030f855, 0x06c0eb05, 0x0283f3c2,   // 0x000016e0
-    0x68762a09, 0x816cf000, 0xd0062a0d, 0xf0402a01,   // 0x000016f0
-    0x49a7818d, 0x1030f845, 0x4ca6e188, 0x68766832,   // 0x00001700
-    0x208cf8c4, 0x6090f8c4, 0xf8c44ea1, 0xf8451094,   // 0x00001710
-    0x20016030, 0x0081f884, 0xf500b292, 0x42827068,   // 0x00001720
-    0x80d4f000, 0xf5b2d81a, 0xf0007f81, 0xd8078082,   // 0x00001730
-    0xd0602a80, 0xd0632a82, 0xf0402a21, 0xe0e380ee,   // 0x00001740
-    0x7fe0f5b2, 0x80e9f0c0, 0x7fe1f5b2, 0x80a8f0c0,   // 0x00001750
-    0x3302f240, 0xf040429a, 0xe07b80e0, 0x6081f240,   // 0x00001760
-    0xd80d4282, 0x6fd0f5b2, 0x8087f080, 0x6fa0f5b2,   // 0x00001770
-    0x80d7f000, 0x53a1f240, 0xf040429a, 0xe0b980ce,   // 0x00001780
-    0x6f10f5b2, 0xd80ad012, 0x6f08f5b2, 0x80c5f040,   // 0x00001790
-    0xf8944c80, 0x23016098, 0x6f83f804, 0xf5a2e0c8,   // 0x000017a0
-    0x3a4042fd, 0xf2002a01, 0xe08380b8, 0x008ef894,   // 0x000017b0
-    0x0098f884, 0x06206a2c, 0x6a68d503, 0xf0003808,   // 0x000017c0
-    0x4d75fa07, 0x782e4a75, 0x0308f006, 0x7016b2d9,   // 0x000017d0
-    0xf000b161, 0x4c6df9d7, 0x30044d71, 0x62256260,   // 0x000017e0
-    0xf9d0f000, 0x1d064a6a, 0x62a262e6, 0x23004967,   // 0x000017f0
-    0x638b630b, 0xf884e095, 0xf8841083, 0xe0921084,   // 0x00001800
-    0xf8b44c64, 0x28010090, 0x8087f200, 0x00864a65,   // 0x00001810
-    0x18b32500, 0x5083f884, 0x5084f884, 0xf0017819,   // 0x00001820
-    0xb2c50002, 0xd07e2d00, 0xf8042601, 0x23026f83,   // 0x00001830
-    0xf8b4e07e, 0xf0000090, 0x2a01027f, 0xf8b4dc6d,   // 0x00001840
-    0x2b00308e, 0x4d57d169, 0x19660084, 0xf0217831,   // 0x00001850
-    0xe0100202, 0xf8b0484f, 0xf0022090, 0x2901017f,   // 0x00001860
-    0xf8b0dc5b, 0x2b00308e, 0x4d4ed157, 0x19660094,   // 0x00001870
-    0xf0407830, 0x70320202, 0xf8b4e053, 0x4b4a208e,   // 0x00001880
-    0x4c08f853, 0x010cf1a3, 0xd0462c00, 0xf833330c,   // 0x00001890
-    0x42900c18, 0x0a15d1f4, 0xd0152d03, 0xe047890b,   // 0x000018a0
-    0xf8b34b3c, 0xb1111090, 0xd1362901, 0x2304e03e,   // 0x000018b0
-    0xe03d4c3e, 0xf8b34b37, 0x29041090, 0x4c3cd101,   // 0x000018c0
-    0x2905e002, 0x4c3bd129, 0xe0317823, 0x3090f8b4,   // 0x000018d0
-    0xd1222b01, 0x0099f894, 0x3084f884, 0x1083f884,   // 0x000018e0
-    0x1085f884, 0x1086f884, 0x0087f884, 0x1088f884,   // 0x000018f0
-    0xe0192306, 0xf8b44c27, 0x2b013090, 0xf894d10d,   // 0x00001900
-    0xf8046099, 0xe0136f83, 0xf8b34b22, 0x29011090,   // 0x00001910
-    0xf883d103, 0x23001099, 0x4b22e003, 0x7019210f,   // 0x00001920
-    0x461ce02d, 0x2302e004, 0xe0013483, 0x23044c22,   // 0x00001930
-    0xf8b54d18, 0x42b36092, 0x461ebf38, 0xbf342e40,   // 0x00001940
-    0x25404635, 0x46294620, 0xfe3af7ff, 0x442c1b76,   // 0x00001950
-    0x2d40d103, 0x4635d113, 0x2e40e003, 0x4635bf34,   // 0x00001960
-    0x46202540, 0xf7ff4629, 0x1b76fe2b, 0xd101442c,   // 0x00001970
-    0xd1042d40, 0xf8c24a07, 0xf8a24094, 0x2201609a,   // 0x00001980
-    0xe0424b0e, 0x40072080, 0x40072090, 0x1fffe000,   // 0x00001990
-    0x004000c8, 0x200007e4, 0x00004600, 0x400720c4,   // 0x000019a0
-    0x00400088, 0x400720c0, 0x00004610, 0x20001ce4,   // 0x000019b0
-    0x00004702, 0x00004670, 0x20001ce8, 0x40072094,   // 0x000019c0
-    0xf8d64e3b, 0xb1a55094, 0x709af8b6, 0xbf342f40,   // 0x000019d0
-    0x2440463c, 0x46214628, 0xfdf2f7ff, 0xb2811b38,   // 0x000019e0
-    0x109af8a6, 0x2c40b909, 0x1929d100, 0xf8c24a30,   // 0x000019f0
-    0x4b2f1094, 0x008cf8b3, 0x6fa0f5b0, 0x2100d106,   // 0x00001a00
-    0x108df883, 0x208ef893, 0x701a4b2a, 0x2001492a,   // 0x00001a10
-    0xe0067008, 0x0308f002, 0xb910b2d8, 0xf7ff0890,   // 0x00001a20
-    0x4b26fdfb, 0x701a2208, 0x07d9e63d, 0x4822d525,   // 0x00001a30
-    0x491f4b23, 0x70042402, 0x61594c22, 0x609c601c,   // 0x00001a40
-    0x2080f881, 0x059cf101, 0x04dcf101, 0x611a3140,   // 0x00001a50
-    0x61d9619a, 0x60dc605d, 0x210d4b1b, 0x491b7019,   // 0x00001a60
-    0x700b23ff, 0x3c08f801, 0x4a19740a, 0x4b197013,   // 0x00001a70
-    0x2201219f, 0x70027019, 0x061abdf8, 0x4a12d505,   // 0x00001a80
-    0x2180200d, 0xf8027010, 0xf0031c40, 0xb2c20002,   // 0x00001a90
-    0x480eb12a, 0x22027801, 0xf8007001, 0xf0032c08,   // 0x00001aa0
-    0xb2d80310, 0x4a05b110, 0x70112110, 0xbf00bdf8,   // 0x00001ab0
-    0x200007e4, 0x40072098, 0x40072094, 0x40072080,   // 0x00001ac0
-    0x1fffe000, 0x00400088, 0x400720c0, 0x40072088,   // 0x00001ad0
-    0x4007208c, 0x40072084, 0xf000b508, 0xf7fff849,   // 0x00001ae0
-    0x4b1dfd31, 0x2200481d, 0x609a601a, 0x619a611a,   // 0x00001af0
-    0x6801621a, 0x60da605a, 0x61da615a, 0xf441625a,   // 0x00001b00
-    0x60022280, 0x21804816, 0x78017001, 0x06094a14,   // 0x00001b10
-    0x4914d4fb, 0x2007f3c3, 0xf3c37008, 0x75084007,   // 0x00001b20
-    0x20ff0e1b, 0xf801760b, 0xf8010c1c, 0xf8010c14,   // 0x00001b30
-    0x78110c8c, 0xf0412001, 0x21000340, 0xf8027013,   // 0x00001b40
-    0x4b090c78, 0x1c0cf802, 0xf8024908, 0x22080c88,   // 0x00001b50
-    0x601a2010, 0xbd087008, 0x1fffe000, 0x40048034,   // 0x00001b60
-    0x4007210c, 0x4007209c, 0xe000e104, 0x40072108,   // 0x00001b70
-    0xf04f4b03, 0x601a32ff, 0x609a605a, 0x477060da,   // 0x00001b80
-    0x20000900, 0xb672b510, 0x4a0f2300, 0x1023f852,   // 0x00001b90
-    0x3301b911, 0xd1f82b04, 0xf081fab1, 0x1243eb00,   // 0x00001ba0
-    0xd9002a67, 0xf002e7fe, 0xf04f001f, 0xfa244400,   // 0x00001bb0
-    0xea21f000, 0x48040100, 0x1023f840, 0x4b03b662,   // 0x00001bc0
-    0xfb012144, 0xbd103002, 0x20000900, 0x1fffec40,   // 0x00001bd0
-    0x22444b0b, 0xfbb01ac0, 0x2967f1f2, 0x094ad80e,   // 0x00001be0
-    0x4b08b672, 0x001ff001, 0x4100f04f, 0xf000fa21,   // 0x00001bf0
-    0x1022f853, 0xf8434308, 0xb6620022, 0xbf004770,   // 0x00001c00
-    0x1fffec40, 0x20000900, 0x4b04b672, 0x6202f24a,   // 0x00001c10
-    0x4080f24b, 0x8018801a, 0x4770b662, 0x4005200c,   // 0x00001c20
-    0x681a4b16, 0x6180f442, 0x4b156019, 0x701a2200,   // 0x00001c30
-    0x709a705a, 0x711a70da, 0xf2404b12, 0xf44f3113,   // 0x00001c40
-    0x60197251, 0x4b10605a, 0x3144f3c0, 0x1247f3c0,   // 0x00001c50
-    0xf0007019, 0x705a001f, 0x72984a0c, 0x23042102,   // 0x00001c60
-    0x74517013, 0x4b0a74d3, 0x70182088, 0x223c4809,   // 0x00001c70
-    0x3180f44f, 0x2c0df803, 0x47706001, 0x40048034,   // 0x00001c80
-    0x14000022, 0x4004a040, 0x4006a000, 0x4006a002,   // 0x00001c90
-    0x4006a010, 0xe000e100, 0x4b0cb508, 0x05436818,   // 0x00001ca0
-    0xbd08d400, 0x79134a0a, 0xf7ffb113, 0xe7f9ffad,   // 0x00001cb0
-    0xf44f4908, 0x60083080, 0x70034807, 0xf2404807,   // 0x00001cc0
-    0x60011103, 0x70136041, 0xbd087053, 0x40048034,   // 0x00001cd0
-    0x14000022, 0xe000e180, 0x4006a003, 0x4004a040,   // 0x00001ce0
-    0xb5704b0e, 0x68184606, 0xd5160542, 0x788c490c,   // 0x00001cf0
-    0x460d3401, 0xbf882c07, 0x78ea2400, 0x42a24b08,   // 0x00001d00
-    0xf7ffd102, 0xe7f8ff81, 0x21011918, 0x7146b2e4,   // 0x00001d10
-    0x709c7119, 0x22bc4b03, 0xbd70701a, 0x40048034,   // 0x00001d20
-    0x14000022, 0x4006a003, 0x000ff000, 0xd8012809,   // 0x00001d30
-    0xe0003030, 0xf7ff3037, 0x4b17bfd3, 0x41f0e92d,   // 0x00001d40
-    0x68184606, 0x05414688, 0x4634d524, 0x0108eb06,   // 0x00001d50
-    0xd21c428c, 0x78bd4f11, 0x350178ff, 0xbf882d07,   // 0x00001d60
-    0x42af2500, 0x490dd009, 0x0b01f814, 0x2301194a,   // 0x00001d70
-    0x7150b2ed, 0x708d710b, 0x4909e7e8, 0x700820bc,   // 0x00001d80
-    0xff42f7ff, 0x78d34a05, 0xd0f942bb, 0x4b04e7eb,   // 0x00001d90
-    0x701a22bc, 0x81f0e8bd, 0x40048034, 0x14000022,   // 0x00001da0
-    0x4006a003, 0x4b03b508, 0xb1107918, 0xff2cf7ff,   // 0x00001db0
-    0xbd08e7f9, 0x14000022, 0x78104a03, 0x42987853,   // 0x00001dc0
-    0x3008bf38, 0x47701ac0, 0x14000022, 0x78194b08,   // 0x00001dd0
-    0x4291785a, 0x1c50d008, 0x2a07b2c2, 0x2200bf88,   // 0x00001de0
-    0x7b481899, 0x4770705a, 0x30fff04f, 0xbf004770,   // 0x00001df0
-    0x14000022, 0x78194b05, 0x4291785a, 0x1898d002,   // 0x00001e00
-    0x47707b40, 0x30fff04f, 0xbf004770, 0x14000022,   // 0x00001e10
-    0x68184b09, 0xd50e0540, 0x781a4b08, 0x01cbf002,   // 0x00001e20
-    0x70194a07, 0x70102040, 0xf0417819, 0x70180034,   // 0x00001e30
-    0x785a4b04, 0x4770701a, 0x40048034, 0x4006a003,   // 0x00001e40
-    0x4006a011, 0x14000022, 0x4b30b510, 0xf0107818,   // 0x00001e50
-    0xd0210f30, 0x492eb672, 0xb932780a, 0x780b390f,   // 0x00001e60
-    0x21404b2c, 0xb6627019, 0xb662e016, 0x78234c2a,   // 0x00001e70
-    0x492a7860, 0x1c59780c, 0x2907b2c9, 0x2100bf88,   // 0x00001e80
-    0xd0034281, 0x185b4b24, 0x460b735c, 0xf0123a01,   // 0x00001e90
-    0xd1ee02ff, 0x70034820, 0x78104a21, 0x2900b241,   // 0x00001ea0
-    0xda21b2c2, 0x78184b19, 0xd51d0601, 0x788c491a,   // 0x00001eb0
-    0x42a378cb, 0x4815d00f, 0x78013301, 0xb2db4916,   // 0x00001ec0
-    0xbf882b07, 0x18c82300, 0x79404914, 0x310d7008,   // 0x00001ed0
-    0x28077808, 0x4910d9ed, 0x4b0c70cb, 0x06037818,   // 0x00001ee0
-    0x4b0fd502, 0x7019217c, 0x0240f002, 0xb158b2d0,   // 0x00001ef0
-    0x780b4906, 0x0240f003, 0xb128b2d0, 0x48084b06,   // 0x00001f00
-    0x223c2100, 0x70027119, 0xbf00bd10, 0x4006a004,   // 0x00001f10
-    0x4006a016, 0x4006a011, 0x14000022, 0x4006a007,   // 0x00001f20
-    0x4006a003, 0x1e45b538, 0x4f01f815, 0x2c0ab144,   // 0x00001f30
-    0x200dd102, 0xfed4f7ff, 0xf7ff4620, 0xe7f3fed1,   // 0x00001f40
-    0xb510bd38, 0x09004604, 0xfeeef7ff, 0xe8bd4620,   // 0x00001f50
-    0xf7ff4010, 0xb510bee9, 0x0a004604, 0xfff1f7ff,   // 0x00001f60
-    0xe8bd4620, 0xf7ff4010, 0xb510bfec, 0x0e004604,   // 0x00001f70
-    0xffe7f7ff, 0xf7ff0c20, 0x0a20ffe4, 0xffe1f7ff,   // 0x00001f80
-    0xe8bd4620, 0xf7ff4010, 0xbf00bfdc, 0x7816b5f0,   // 0x00001f90
-    0x785f781d, 0x9c05789b, 0xfb014346, 0x78556605,   // 0x00001fa0
-    0x43457892, 0xfb014350, 0xfb015507, 0xf3c60103,   // 0x00001fb0
-    0x04024007, 0x7780f100, 0x0e361abf, 0xea4f4a25,   // 0x00001fc0
-    0x0c0b4c15, 0x0016f852, 0xf710fb27, 0xf08cfa5f,   // 0x00001fd0
-    0x7680f100, 0x04000e2d, 0xeb021a30, 0x09ff0645,   // 0x00001fe0
-    0x5202f8d6, 0xf015fb20, 0xb2db0e09, 0x0241eb02,   // 0x00001ff0
-    0xf10309c6, 0x04187580, 0xf8d21a2b, 0xfb235404,   // 0x00002000
-    0xf9b4f015, 0xf9b43000, 0xf9b41002, 0x18ff2004,   // 0x00002010
-    0x15d0eb02, 0xf1071876, 0xf1060080, 0xf3800180,   // 0x00002020
-    0xf3810310, 0x0a180210, 0xf1050a11, 0xf3830380,   // 0x00002030
-    0xf46f0210, 0xfb037380, 0x0a127700, 0xfb030200,   // 0x00002040
-    0xea406601, 0xfb034001, 0x80275302, 0x80a38066,   // 0x00002050
-    0xbdf04310, 0x20000910, 0x68184b0a, 0xb0824b0a,   // 0x00002060
-    0x160cf8d3, 0x3608f8d3, 0x6e4a9001, 0x6e599801,   // 0x00002070
-    0x1a531a80, 0xbf284298, 0x04024618, 0xf0f3fbb2,   // 0x00002080
-    0x4770b002, 0x200007e0, 0x20000910, 0x4b107802,   // 0x00002090
-    0x1012f833, 0x3280004a, 0x0110f382, 0x78807842,   // 0x000020a0
-    0x0242eb03, 0x0340eb03, 0x2202f8b2, 0x0404f8b3,   // 0x000020b0
-    0x00430052, 0xf0213280, 0xf38201ff, 0x0a120210,   // 0x000020c0
-    0xf3833380, 0xea410010, 0xea434302, 0x47702010,   // 0x000020d0
-    0x20000910, 0x7815b570, 0x785e781c, 0x4345789b,   // 0x000020e0
-    0x5504fb01, 0x78927854, 0x43504344, 0x4406fb01,   // 0x000020f0
-    0x0103fb01, 0x4307f3c5, 0x7080f103, 0x1ac0041b,   // 0x00002100
-    0x4b190e2d, 0x0c0a0c26, 0x5015f853, 0xf515fb20,   // 0x00002110
-    0xb2f00e24, 0x0444eb03, 0x7680f100, 0x1a300400,   // 0x00002120
-    0x4202f8d4, 0xf414fb20, 0xb2d20e09, 0x0341eb03,   // 0x00002130
-    0x7080f102, 0x1a820412, 0x0404f8d3, 0xf110fb22,   // 0x00002140
-    0x09e009ea, 0x30803280, 0x0310f382, 0xf38009c9,   // 0x00002150
-    0xf0230210, 0x0a1203ff, 0xf3813180, 0xea430010,   // 0x00002160
-    0xea414102, 0xbd702010, 0x20000910, 0x4b1cb5f0,   // 0x00002170
-    0x78447802, 0xf8337880, 0xeb037012, 0xeb030544,   // 0x00002180
-    0xf8b50340, 0xf8b36202, 0xf9b12404, 0xf9b14000,   // 0x00002190
-    0xf9b15002, 0xeb040004, 0xeb050747, 0xeb000646,   // 0x000021a0
-    0xf1070542, 0xf1060380, 0xf3830080, 0xf3800210,   // 0x000021b0
-    0x0a140310, 0xf1050a18, 0xf3820280, 0x0a1a0310,   // 0x000021c0
-    0x7380f46f, 0x7704fb03, 0xfb030224, 0xfb036600,   // 0x000021d0
-    0xea445302, 0x800f4000, 0x808b804e, 0xbdf04310,   // 0x000021e0
-    0x20000910, 0xb5084601, 0xf0014801, 0xbd08ff85,   // 0x000021f0
-    0x20000f18, 0x4ff0e92d, 0x2101b0ab, 0xf8cd200d,   // 0x00002200
-    0xf7ffc040, 0x48e6f8b9, 0xf81ef002, 0x3041f240,   // 0x00002210
-    0xfd06f7ff, 0xf7ff48e3, 0x4be3fe85, 0xc040f8dd,   // 0x00002220
-    0x2a00781a, 0x8703f041, 0x4be0b672, 0x6002f24a,   // 0x00002230
-    0x4180f24b, 0x80198018, 0x4bddb662, 0xf89349dd,   // 0x00002240
-    0xf00007b4, 0x28020003, 0x838cf000, 0xf0012803,   // 0x00002250
-    0x28018307, 0x92129113, 0x8752f000, 0xf8cd9311,   // 0x00002260
-    0xf7ffc040, 0x9a13fef9, 0xc040f8dd, 0xf46f6813,   // 0x00002270
-    0x43417180, 0x7280f101, 0x99119327, 0x3380f502,   // 0x00002280
-    0x9b129326, 0x2000eb00, 0x62f7f501, 0x92159025,   // 0x00002290
-    0x98149314, 0xfbb02215, 0xfb02f1f2, 0x20030311,   // 0x000022a0
-    0x48c34343, 0x2608f8d0, 0x060cf8d0, 0x2021f852,   // 0x000022b0
-    0x1021f850, 0xf8cd9815, 0x3301c040, 0x18cb18d2,   // 0x000022c0
-    0x33043204, 0x99259000, 0xf7ff9826, 0x0842fe5f,   // 0x000022d0
-    0x6b18f360, 0xf3620881, 0x09024b10, 0xf36108c3,   // 0x000022e0
-    0xf3622b08, 0x09416a18, 0x0b00f363, 0x4a10f361,   // 0x000022f0
-    0x0a010983, 0xf36309c2, 0xf3612a08, 0x0a436918,   // 0x00002300
-    0x0a00f362, 0x4910f363, 0x0b030a82, 0xf3620ac1,   // 0x00002310
-    0xf3632908, 0x0b426818, 0x0900f361, 0x4810f362,   // 0x00002320
-    0x0c020b81, 0xf3610bc3, 0xf3622808, 0x0c416718,   // 0x00002330
-    0x0800f363, 0x4710f361, 0x0d010c83, 0x2708f363,   // 0x00002340
-    0x6618f361, 0x0cc20d43, 0x4610f363, 0xf3629b14,   // 0x00002350
-    0x0d820700, 0xf3623340, 0x22152608, 0xf1f2fbb3,   // 0x00002360
-    0xfb020dc0, 0xf3603311, 0x20030600, 0x48904343,   // 0x00002370
-    0x2608f8d0, 0x060cf8d0, 0x2021f852, 0x1021f850,   // 0x00002380
-    0x33019815, 0x18cb18d2, 0x71c0f500, 0x33043204,   // 0x00002390
-    0x98269100, 0xf7ff9925, 0x0842fdf9, 0x6b59f360,   // 0x000023a0
-    0xf3620883, 0x09024b51, 0xf36308c1, 0xf3622b49,   // 0x000023b0
-    0x09436a59, 0x0b41f361, 0x4a51f363, 0x0a030981,   // 0x000023c0
-    0xf36109c2, 0xf3632a49, 0x0a416959, 0x0a41f362,   // 0x000023d0
-    0x4951f361, 0x0b010a82, 0xf3620ac3, 0xf3612949,   // 0x000023e0
-    0x0b426859, 0x0941f363, 0x4851f362, 0x0c020b83,   // 0x000023f0
-    0xf3630bc1, 0xf3622849, 0x0c436759, 0x0841f361,   // 0x00002400
-    0x4751f363, 0x0d030c81, 0xf3610cc2, 0xf3632749,   // 0x00002410
-    0x0d416659, 0xf3629b14, 0xf3610741, 0x0d824651,   // 0x00002420
-    0xf3623380, 0x22152649, 0xf1f2fbb3, 0xfb020dc0,   // 0x00002430
-    0xf3603311, 0x20030641, 0x485d4343, 0x2608f8d0,   // 0x00002440
-    0x060cf8d0, 0x2021f852, 0x1021f850, 0x33019815,   // 0x00002450
-    0x18cb18d2, 0x7140f500, 0x91003204, 0x99253304,   // 0x00002460
-    0xf7ff9826, 0x0842fd93, 0x6b9af360, 0xf3620883,   // 0x00002470
-    0x09024b92, 0xf36308c1, 0xf3622b8a, 0x09436a9a,   // 0x00002480
-    0x0b82f361, 0x4a92f363, 0x0a030981, 0xf36109c2,   // 0x00002490
-    0xf3632a8a, 0x0a41699a, 0x0a82f362, 0x4992f361,   // 0x000024a0
-    0x0b010a82, 0xf3620ac3, 0xf361298a, 0x0b42689a,   // 0x000024b0
-    0x0982f363, 0x4892f362, 0x0c020b83, 0xf3630bc1,   // 0x000024c0
-    0xf362288a, 0x0c43679a, 0x0882f361, 0x4792f363,   // 0x000024d0
-    0x0d030c81, 0xf3610cc2, 0xf363278a, 0x0d41669a,   // 0x000024e0
-    0xf3629b14, 0xf3610782, 0x0d824692, 0xf36233c0,   // 0x000024f0
-    0x2215268a, 0xf1f2fbb3, 0xfb020dc0, 0xf3603311,   // 0x00002500
-    0x20030682, 0x482a4343, 0x2608f8d0, 0x060cf8d0,   // 0x00002510
-    0x2021f852, 0x1021f850, 0x33019815, 0x18cb18d2,   // 0x00002520
-    0x6190f500, 0x32049100, 0x98269925, 0xf7ff3304,   // 0x00002530
-    0x0842fd2d, 0x6bdbf360, 0xf3620883, 0x09024bd3,   // 0x00002540
-    0xf36308c1, 0xf3622bcb, 0x09436adb, 0x0bc3f361,   // 0x00002550
-    0x4ad3f363, 0x0a030981, 0xf36109c2, 0xf3632acb,   // 0x00002560
-    0x0a4169db, 0x0ac3f362, 0x49d3f361, 0x0b010a82,   // 0x00002570
-    0xf3620ac3, 0xf36129cb, 0x0b4268db, 0x09c3f363,   // 0x00002580
-    0x48d3f362, 0x0c020b83, 0xf3630bc1, 0xf36228cb,   // 0x00002590
-    0x0c4367db, 0x08c3f361, 0x47d3f363, 0xe00b0c81,   // 0x000025a0
-    0x20001cc8, 0x000047e8, 0x2000087d, 0x4005200c,   // 0x000025b0
-    0x20000910, 0x20001cd4, 0x0cc20d03, 0x27cbf361,   // 0x000025c0
-    0x66dbf363, 0x9b140d41, 0x07c3f362, 0x46d3f361,   // 0x000025d0
-    0xf3620d82, 0x0dc026cb, 0xf3602215, 0xf50306c3,   // 0x000025e0
-    0xfbb07080, 0xfb02f1f2, 0x20030311, 0x48d94343,   // 0x000025f0
-    0x2608f8d0, 0x060cf8d0, 0x2021f852, 0x1021f850,   // 0x00002600
-    0x33019815, 0x18cb18d2, 0x61c0f500, 0x33043204,   // 0x00002610
-    0x98269100, 0xf7ff9925, 0x0842fcb9, 0x7b1cf360,   // 0x00002620
-    0xf3620883, 0x08c15b14, 0xf3630902, 0xf3623b0c,   // 0x00002630
-    0x09437a1c, 0x1b04f361, 0x5a14f363, 0x0a030981,   // 0x00002640
-    0xf36109c2, 0xf3633a0c, 0x0a41791c, 0x1a04f362,   // 0x00002650
-    0x5914f361, 0x0b010a82, 0xf3620ac3, 0xf361390c,   // 0x00002660
-    0x0b42781c, 0x1904f363, 0x5814f362, 0x0c020b83,   // 0x00002670
-    0xf3630bc1, 0xf362380c, 0x0c43771c, 0x1804f361,   // 0x00002680
-    0x5714f363, 0x0d030c81, 0xf3610cc2, 0xf363370c,   // 0x00002690
-    0x0d41761c, 0xf3629b14, 0xf3611704, 0x0d825614,   // 0x000026a0
-    0x360cf362, 0x22150dc0, 0x1604f360, 0x70a0f503,   // 0x000026b0
-    0xf1f2fbb0, 0x0311fb02, 0x43432003, 0xf8d048a5,   // 0x000026c0
-    0xf8d02608, 0xf852060c, 0xf8502021, 0x98151021,   // 0x000026d0
-    0x18d23301, 0xf50018cb, 0x320461f0, 0x91003304,   // 0x000026e0
-    0x99259826, 0xfc52f7ff, 0xf3600842, 0x08837b5d,   // 0x000026f0
-    0x5b55f362, 0x08c10902, 0x3b4df363, 0x7a5df362,   // 0x00002700
-    0xf3610943, 0xf3631b45, 0x09815a55, 0x09c20a03,   // 0x00002710
-    0x3a4df361, 0x795df363, 0xf3620a41, 0xf3611a45,   // 0x00002720
-    0x0a825955, 0x0ac30b01, 0x394df362, 0x785df361,   // 0x00002730
-    0xf3630b42, 0xf3621945, 0x0b835855, 0x0bc10c02,   // 0x00002740
-    0x384df363, 0x775df362, 0xf3610c43, 0xf3631845,   // 0x00002750
-    0x0c815755, 0x0cc20d03, 0x374df361, 0x765df363,   // 0x00002760
-    0x9b140d41, 0x1745f362, 0x5655f361, 0xf3620d82,   // 0x00002770
-    0x0dc0364d, 0xf3602215, 0xf5031645, 0xfbb070c0,   // 0x00002780
-    0xfb02f1f2, 0x20030311, 0x48724343, 0x2608f8d0,   // 0x00002790
-    0x060cf8d0, 0x2021f852, 0x1021f850, 0x33019815,   // 0x000027a0
-    0x18cb18d2, 0x6110f500, 0x33043204, 0x98269100,   // 0x000027b0
-    0xf7ff9925, 0x0842fbeb, 0x7b9ef360, 0xf3620883,   // 0x000027c0
-    0x09025b96, 0xf36308c1, 0xf3623b8e, 0x09437a9e,   // 0x000027d0
-    0x1b86f361, 0x5a96f363, 0x0a030981, 0xf36109c2,   // 0x000027e0
-    0xf3633a8e, 0x0a41799e, 0x1a86f362, 0x5996f361,   // 0x000027f0
-    0x0b010a82, 0xf3620ac3, 0xf361398e, 0x0b42789e,   // 0x00002800
-    0x1986f363, 0x5896f362, 0x0c020b83, 0xf3630bc1,   // 0x00002810
-    0xf362388e, 0x0c43779e, 0x1886f361, 0x5796f363,   // 0x00002820
-    0x0d030c81, 0xf3610cc2, 0xf363378e, 0x0d41769e,   // 0x00002830
-    0xf3629b14, 0xf3611786, 0x0d825696, 0x368ef362,   // 0x00002840
-    0x22150dc0, 0x1686f360, 0x70e0f503, 0xf1f2fbb0,   // 0x00002850
-    0x0311fb02, 0x43432003, 0xf8d0483e, 0xf8d02608,   // 0x00002860
-    0xf852e60c, 0x98152021, 0x1021f85e, 0x18d23301,   // 0x00002870
-    0xf50018cb, 0x32046128, 0x91003304, 0x99259826,   // 0x00002880
-    0xfb84f7ff, 0xf3600842, 0x08837bdf, 0x5bd7f362,   // 0x00002890
-    0x08c10902, 0x3bcff363, 0x7adff362, 0xf3610943,   // 0x000028a0
-    0xf3631bc7, 0x09815ad7, 0x09c20a03, 0x3acff361,   // 0x000028b0
-    0x79dff363, 0x0ac30a41, 0x1ac7f362, 0x59d7f361,   // 0x000028c0
-    0x0b010a82, 0x39cff362, 0x78dff361, 0xf3630b42,   // 0x000028d0
-    0xf36219c7, 0x0b8358d7, 0x0bc10c02, 0x38cff363,   // 0x000028e0
-    0x77dff362, 0xf3610c43, 0xf36318c7, 0x0c8157d7,   // 0x000028f0
-    0x0cc20d03, 0x37cff361, 0x76dff363, 0xf3620d41,   // 0x00002900
-    0xf36117c7, 0x0d8256d7, 0x99149b27, 0xa010f8c3,   // 0x00002910
-    0xf3620dc0, 0xf36036cf, 0x981516c7, 0xb014f8c3,   // 0x00002920
-    0xe8831c4a, 0x331803c0, 0x1d839327, 0x92142a40,   // 0x00002930
-    0xf8dd9315, 0xf47fc040, 0x4807acac, 0xc040f8cd,   // 0x00002940
-    0xfd88f001, 0xf0014805, 0x4805fc43, 0x1c4b6801,   // 0x00002950
-    0xe4626003, 0x20000910, 0x20001cc8, 0x20000f18,   // 0x00002960
-    0x20001ce4, 0x92146809, 0x63f7f503, 0x93159126,   // 0x00002970
-    0xe050f8dd, 0x23154ae5, 0xf1f3fbbe, 0xe011fb03,   // 0x00002980
-    0xf8d29025, 0xf8dd060c, 0xf850e094, 0x92121021,   // 0x00002990
-    0xfb002003, 0x1d48110e, 0x93119915, 0xc040f8cd,   // 0x000029a0
-    0xfbe4f7ff, 0xf3600842, 0x08836518, 0x4510f362,   // 0x000029b0
-    0xf3630902, 0xf3622508, 0x09436418, 0x4410f363,   // 0x000029c0
-    0x08c19b24, 0x2c10ea4f, 0x2e50ea4f, 0x0500f361,   // 0x000029d0
-    0x6318f36c, 0x09c20981, 0x2408f361, 0x4310f36e,   // 0x000029e0
-    0x2190ea4f, 0x0400f362, 0x2308f361, 0x22d0ea4f,   // 0x000029f0
-    0x0300f362, 0x93249923, 0x3310ea4f, 0x3c50ea4f,   // 0x00002a00
-    0x6118f363, 0x3e90ea4f, 0x4110f36c, 0x32d0ea4f,   // 0x00002a10
-    0x2108f36e, 0x0100f362, 0x99229123, 0x4310ea4f,   // 0x00002a20
-    0x4c50ea4f, 0x6118f363, 0x4e90ea4f, 0x4110f36c,   // 0x00002a30
-    0x42d0ea4f, 0x2108f36e, 0x0100f362, 0x99219122,   // 0x00002a40
-    0xea4f9a12, 0xea4f5310, 0xf3635c50, 0xea4f6118,   // 0x00002a50
-    0xf36c5e90, 0x0dc04110, 0x2108f36e, 0x0100f360,   // 0x00002a60
-    0x9b119814, 0x30409121, 0xf1f3fbb0, 0x0011fb03,   // 0x00002a70
-    0x260cf8d2, 0xf8529025, 0xf8dd3021, 0xf8ddc094,   // 0x00002a80
-    0x2103e054, 0x300cfb01, 0xf50e3005, 0xf7ff71c0,   // 0x00002a90
-    0x0843fb6d, 0x6559f360, 0xf3630881, 0x09034551,   // 0x00002aa0
-    0x2549f361, 0x6459f363, 0xf3610941, 0x99244451,   // 0x00002ab0
-    0xea4f08c2, 0xea4f2c10, 0xf3622e50, 0xf36c0541,   // 0x00002ac0
-    0x09826159, 0xf36209c3, 0xf36e2449, 0xea4f4151,   // 0x00002ad0
-    0xf3632290, 0xf3620441, 0xea4f2149, 0xf36323d0,   // 0x00002ae0
-    0x91240141, 0xea4f9923, 0xea4f3c10, 0xf36c3e50,   // 0x00002af0
-    0xea4f6159, 0xf36e3290, 0xea4f4151, 0xf36233d0,   // 0x00002b00
-    0xf3632149, 0x91230141, 0xea4f9922, 0xea4f4c10,   // 0x00002b10
-    0xf36c4e50, 0xea4f6159, 0xf36e4290, 0xea4f4151,   // 0x00002b20
-    0xf36243d0, 0xf3632149, 0x91220141, 0x9b119921,   // 0x00002b30
-    0x5c10ea4f, 0x5e50ea4f, 0x6159f36c, 0x5290ea4f,   // 0x00002b40
-    0x4151f36e, 0xf3620dc0, 0xf3602149, 0x98140141,   // 0x00002b50
-    0x91219a12, 0xfbb03080, 0xfb03f1f3, 0xf8d20011,   // 0x00002b60
-    0x9025260c, 0x3021f852, 0xc094f8dd, 0xe054f8dd,   // 0x00002b70
-    0xfb012103, 0x3005300c, 0x7140f50e, 0xfaf6f7ff,   // 0x00002b80
-    0xf3600843, 0x0881659a, 0x4592f363, 0xf3610903,   // 0x00002b90
-    0xf363258a, 0x0941649a, 0x4492f361, 0x08c29924,   // 0x00002ba0
-    0x2c10ea4f, 0x2e50ea4f, 0x0582f362, 0x619af36c,   // 0x00002bb0
-    0xf3620982, 0x09c3248a, 0x2290ea4f, 0x4192f36e,   // 0x00002bc0
-    0x0482f363, 0x218af362, 0x23d0ea4f, 0x0182f363,   // 0x00002bd0
-    0x99239124, 0x3c10ea4f, 0x3e50ea4f, 0x619af36c,   // 0x00002be0
-    0x3290ea4f, 0x4192f36e, 0x33d0ea4f, 0x218af362,   // 0x00002bf0
-    0x0182f363, 0x99229123, 0x4c10ea4f, 0x4e50ea4f,   // 0x00002c00
-    0x619af36c, 0x4290ea4f, 0x4192f36e, 0x43d0ea4f,   // 0x00002c10
-    0x218af362, 0x0182f363, 0x99219122, 0xea4f9b11,   // 0x00002c20
-    0xea4f5c10, 0xf36c5e50, 0xea4f619a, 0xf36e5290,   // 0x00002c30
-    0x0dc04192, 0x218af362, 0x0182f360, 0x9a129814,   // 0x00002c40
-    0x30c09121, 0xf1f3fbb0, 0x0011fb03, 0x260cf8d2,   // 0x00002c50
-    0xf8529025, 0xf8dd3021, 0xf8ddc094, 0x2103e054,   // 0x00002c60
-    0x300cfb01, 0xf50e3005, 0xf7ff6190, 0x0843fa7f,   // 0x00002c70
-    0x65dbf360, 0xf3630881, 0x090345d3, 0x25cbf361,   // 0x00002c80
-    0x64dbf363, 0xf3610941, 0x992444d3, 0xea4f08c2,   // 0x00002c90
-    0xea4f2c10, 0xf3622e50, 0xf36c05c3, 0x098261db,   // 0x00002ca0
-    0xf36209c3, 0xf36e24cb, 0xea4f41d3, 0xf3632290,   // 0x00002cb0
-    0xf36204c3, 0xea4f21cb, 0xf36323d0, 0x912401c3,   // 0x00002cc0
-    0xea4f9923, 0xea4f3c10, 0xf36c3e50, 0xea4f61db,   // 0x00002cd0
-    0xf36e3290, 0xea4f41d3, 0xf36233d0, 0xf36321cb,   // 0x00002ce0
-    0x912301c3, 0xea4f9922, 0xea4f4c10, 0xf36c4e50,   // 0x00002cf0
-    0xea4f61db, 0xf36e4290, 0xea4f41d3, 0xf36243d0,   // 0x00002d00
-    0xf36321cb, 0x912201c3, 0xe0019921, 0x20000910,   // 0x00002d10
-    0xea4f9b11, 0xea4f5c10, 0xf36c5e50, 0xea4f61db,   // 0x00002d20
-    0xf8dd5290, 0xf36ec050, 0x0dc041d3, 0x21cbf362,   // 0x00002d30
-    0x01c3f360, 0x91219a12, 0x7080f50c, 0xf1f3fbb0,   // 0x00002d40
-    0x0011fb03, 0x260cf8d2, 0xf8529025, 0xf8dd3021,   // 0x00002d50
-    0xf8dde094, 0x2103c054, 0x300efb01, 0xf50c3005,   // 0x00002d60
-    0xf7ff61c0, 0x0843fa03, 0x751cf360, 0xf3630881,   // 0x00002d70
-    0x09035514, 0x350cf361, 0x741cf363, 0x08c20941,   // 0x00002d80
-    0x5414f361, 0xea4f9924, 0xf3622e10, 0x09821504,   // 0x00002d90
-    0xf36209c3, 0xf36e340c, 0xea4f711c, 0xf3632250,   // 0x00002da0
-    0xf3621404, 0xea4f5114, 0xea4f2390, 0xf3632cd0,   // 0x00002db0
-    0xf36c310c, 0x91241104, 0xea4f9923, 0xea4f3e10,   // 0x00002dc0
-    0xf36e3250, 0xea4f711c, 0xf3623390, 0xea4f5114,   // 0x00002dd0
-    0xf3633cd0, 0xf36c310c, 0x91231104, 0xea4f9922,   // 0x00002de0
-    0xea4f4e10, 0xf36e4250, 0xea4f711c, 0xf3624390,   // 0x00002df0
-    0xea4f5114, 0xf3634cd0, 0xf36c310c, 0x91221104,   // 0x00002e00
-    0xf8dd9921, 0xea4fc050, 0xea4f5e10, 0xf36e5250,   // 0x00002e10
-    0xea4f711c, 0xf3625390, 0x0dc05114, 0x310cf363,   // 0x00002e20
-    0x9a129b11, 0x1104f360, 0x70a0f50c, 0xfbb09121,   // 0x00002e30
-    0xfb03f1f3, 0xf8d20011, 0x9025260c, 0x3021f852,   // 0x00002e40
-    0xe094f8dd, 0xc054f8dd, 0xfb012103, 0x3005300e,   // 0x00002e50
-    0x61f0f50c, 0xf98af7ff, 0xf3600843, 0x0881755d,   // 0x00002e60
-    0x5555f363, 0x08c20903, 0x354df361, 0x745df363,   // 0x00002e70
-    0xf3610941, 0x99245455, 0x2e10ea4f, 0x1545f362,   // 0x00002e80
-    0x09c30982, 0x344df362, 0x715df36e, 0x2250ea4f,   // 0x00002e90
-    0x1445f363, 0x5155f362, 0x2390ea4f, 0x2cd0ea4f,   // 0x00002ea0
-    0x314df363, 0x1145f36c, 0x99239124, 0x3e10ea4f,   // 0x00002eb0
-    0x3250ea4f, 0x715df36e, 0x3390ea4f, 0x5155f362,   // 0x00002ec0
-    0x3cd0ea4f, 0x314df363, 0x1145f36c, 0x99229123,   // 0x00002ed0
-    0x4e10ea4f, 0x4250ea4f, 0x715df36e, 0x4390ea4f,   // 0x00002ee0
-    0x5155f362, 0x4cd0ea4f, 0x314df363, 0x1145f36c,   // 0x00002ef0
-    0x99219122, 0xc050f8dd, 0x5e10ea4f, 0x5250ea4f,   // 0x00002f00
-    0x715df36e, 0x5390ea4f, 0x5155f362, 0xf3630dc0,   // 0x00002f10
-    0x9b11314d, 0xf3609a12, 0xf50c1145, 0x912170c0,   // 0x00002f20
-    0xf1f3fbb0, 0x0011fb03, 0x260cf8d2, 0xf8529025,   // 0x00002f30
-    0xf8dd3021, 0xf8dde094, 0x2103c054, 0x300efb01,   // 0x00002f40
-    0xf50c3005, 0xf7ff6110, 0x0843f911, 0x759ef360,   // 0x00002f50
-    0xf3630881, 0x09035596, 0x358ef361, 0x749ef363,   // 0x00002f60
-    0x08c20941, 0x5496f361, 0xea4f9924, 0xf3622e10,   // 0x00002f70
-    0x09821586, 0xf36209c3, 0xf36e348e, 0xea4f719e,   // 0x00002f80
-    0xf3632250, 0xf3621486, 0xea4f5196, 0xea4f2390,   // 0x00002f90
-    0xf3632cd0, 0xf36c318e, 0x91241186, 0xea4f9923,   // 0x00002fa0
-    0xea4f3e10, 0xf36e3250, 0xea4f719e, 0xf3623390,   // 0x00002fb0
-    0xea4f5196, 0xf3633cd0, 0xf36c318e, 0x91231186,   // 0x00002fc0
-    0xea4f9922, 0xea4f4e10, 0xf36e4250, 0xea4f719e,   // 0x00002fd0
-    0xf3624390, 0xea4f5196, 0xf3634cd0, 0xf36c318e,   // 0x00002fe0
-    0x91221186, 0xf8dd9921, 0xea4fc050, 0xea4f5e10,   // 0x00002ff0
-    0xf36e5250, 0xea4f719e, 0xf3625390, 0x0dc05196,   // 0x00003000
-    0x318ef363, 0x1186f360, 0x9b119a12, 0xf50c9121,   // 0x00003010
-    0xf8d271e0, 0xfbb1060c, 0xfb03f2f3, 0xf8501312,   // 0x00003020
-    0x21030022, 0x0203fb01, 0x1d509b15, 0x6128f503,   // 0x00003030
-    0xf89cf7ff, 0xf3600841, 0x088275df, 0x55d7f361,   // 0x00003040
-    0x08c30901, 0x35cff362, 0x74dff361, 0xf3630942,   // 0x00003050
-    0xf36215c7, 0x098354d7, 0xf36309c1, 0xf36134cf,   // 0x00003060
-    0x992414c7, 0xc040f8dd, 0x0a430a02, 0x71dff362,   // 0x00003070
-    0x51d7f363, 0x0ac30a82, 0x31cff362, 0x11c7f363,   // 0x00003080
-    0x91249a23, 0x0b430b01, 0x72dff361, 0x52d7f363,   // 0x00003090
-    0x0bc30b81, 0x32cff361, 0x12c7f363, 0x92239922,   // 0x000030a0
-    0xf3620c02, 0x0c4371df, 0xf3630c82, 0xf36251d7,   // 0x000030b0
-    0x0cc331cf, 0xf3639a21, 0x0d0311c7, 0x72dff363,   // 0x000030c0
-    0xf3630d43, 0x0d8352d7, 0x32cff363, 0x9b260dc0,   // 0x000030d0
-    0xf3609122, 0x601a12c7, 0x92216059, 0x9a249923,   // 0x000030e0
-    0x60da6099, 0x611c9814, 0x3318615d, 0x9b159326,   // 0x000030f0
-    0x1d9a1c41, 0x91142940, 0xf47f9215, 0xe41cac39,   // 0x00003100
-    0xc040f8cd, 0xffa8f7fe, 0xf8dd9913, 0x680ac040,   // 0x00003110
-    0x7380f46f, 0xf1034343, 0x9b127180, 0xeb009225,   // 0x00003120
-    0xf5012000, 0x92153280, 0x93149026, 0xe050f8dd,   // 0x00003130
-    0xfbbe2215, 0xfb02f1f2, 0x2303e011, 0x1c434358,   // 0x00003140
-    0xf8d048de, 0xf8d02608, 0xf852060c, 0xf8502021,   // 0x00003150
-    0x98151021, 0xc040f8cd, 0x18cb18d2, 0x33043204,   // 0x00003160
-    0xf7fe9926, 0x9a20ffb7, 0xf3600841, 0x08836218,   // 0x00003170
-    0x4210f361, 0x2208f363, 0xf36108c1, 0x92200200,   // 0x00003180
-    0x09039a1f, 0xf3630941, 0xf3616218, 0x09834210,   // 0x00003190
-    0xf36309c1, 0xf3612208, 0x991e0200, 0x0a02921f,   // 0x000031a0
-    0xf3620a43, 0xf3636118, 0x0a824110, 0xf3620ac3,   // 0x000031b0
-    0xf3632108, 0x9a1d0100, 0x0b01911e, 0xf3610b43,   // 0x000031c0
-    0xf3636218, 0x0b814210, 0xf3610bc3, 0xf3632208,   // 0x000031d0
-    0x991c0200, 0x0c02921d, 0xf3620c43, 0xf3636118,   // 0x000031e0
-    0x0c824110, 0xf3620cc3, 0xf3632108, 0x9a1b0100,   // 0x000031f0
-    0x0d01911c, 0xf3610d43, 0xf3636218, 0x0d814210,   // 0x00003200
-    0x2208f361, 0xf3600dc0, 0x921b0200, 0xf04f9a14,   // 0x00003210
-    0x32400c15, 0xf1fcfbb2, 0x2311fb0c, 0x43432003,   // 0x00003220
-    0xf8d048a6, 0xf8d02608, 0xf852060c, 0xf8502021,   // 0x00003230
-    0x98151021, 0x18d23301, 0x320418cb, 0x99263304,   // 0x00003240
-    0xff48f7fe, 0x08419a20, 0x6259f360, 0xf3610883,   // 0x00003250
-    0xf3634251, 0x08c12249, 0x0241f361, 0x9a1f9220,   // 0x00003260
-    0x09410903, 0x6259f363, 0x4251f361, 0x09c10983,   // 0x00003270
-    0x2249f363, 0x0241f361, 0x921f991e, 0x0a430a02,   // 0x00003280
-    0x6159f362, 0x4151f363, 0x0ac30a82, 0x2149f362,   // 0x00003290
-    0x0141f363, 0x911e9a1d, 0x0b430b01, 0x6259f361,   // 0x000032a0
-    0x4251f363, 0x0bc30b81, 0x2249f361, 0x0241f363,   // 0x000032b0
-    0x921d991c, 0x0c430c02, 0x6159f362, 0x4151f363,   // 0x000032c0
-    0x0cc30c82, 0x2149f362, 0x0141f363, 0x911c9a1b,   // 0x000032d0
-    0x0d430d01, 0x6259f361, 0x4251f363, 0xf3610d81,   // 0x000032e0
-    0x0dc02249, 0x0241f360, 0x9a14921b, 0x0e15f04f,   // 0x000032f0
-    0xfbb23280, 0xfb0ef1fe, 0x20032311, 0x486f4343,   // 0x00003300
-    0x2608f8d0, 0x060cf8d0, 0x2021f852, 0x1021f850,   // 0x00003310
-    0x33019815, 0x18cb18d2, 0x99263204, 0xf7fe3304,   // 0x00003320
-    0x9a20fed9, 0xf3600841, 0x0883629a, 0x4292f361,   // 0x00003330
-    0x228af363, 0xf36108c1, 0x92200282, 0x09039a1f,   // 0x00003340
-    0xf3630941, 0xf361629a, 0x09834292, 0xf36309c1,   // 0x00003350
-    0xf361228a, 0x991e0282, 0x0a02921f, 0xf3620a43,   // 0x00003360
-    0xf363619a, 0x0a824192, 0xf3620ac3, 0xf363218a,   // 0x00003370
-    0x9a1d0182, 0x0b01911e, 0xf3610b43, 0xf363629a,   // 0x00003380
-    0x0b814292, 0xf3610bc3, 0xf363228a, 0x991c0282,   // 0x00003390
-    0x0c02921d, 0xf3620c43, 0xf363619a, 0x0c824192,   // 0x000033a0
-    0xf3620cc3, 0xf363218a, 0x9a1b0182, 0x0d01911c,   // 0x000033b0
-    0xf3610d43, 0xf363629a, 0x0d814292, 0x228af361,   // 0x000033c0
-    0xf3600dc0, 0x921b0282, 0xf04f9a14, 0x32c00c15,   // 0x000033d0
-    0xf1fcfbb2, 0x2311fb0c, 0x43432003, 0xf8d04837,   // 0x000033e0
-    0xf8d02608, 0xf852060c, 0xf8502021, 0x98151021,   // 0x000033f0
-    0x18d23301, 0x320418cb, 0x99263304, 0xfe6af7fe,   // 0x00003400
-    0xf8dd9a20, 0x0841e050, 0x62dbf360, 0xf3610883,   // 0x00003410
-    0xf36342d3, 0x08c122cb, 0x02c3f361, 0x9a1f9220,   // 0x00003420
-    0x09410903, 0x62dbf363, 0x42d3f361, 0x09c10983,   // 0x00003430
-    0x22cbf363, 0x02c3f361, 0x921f991e, 0x0a430a02,   // 0x00003440
-    0x61dbf362, 0x41d3f363, 0x0ac30a82, 0x21cbf362,   // 0x00003450
-    0x01c3f363, 0x911e9a1d, 0x0b430b01, 0x62dbf361,   // 0x00003460
-    0x42d3f363, 0x0bc30b81, 0x22cbf361, 0x02c3f363,   // 0x00003470
-    0x921d991c, 0x0c430c02, 0x61dbf362, 0x41d3f363,   // 0x00003480
-    0x0cc30c82, 0x21cbf362, 0x01c3f363, 0x911c9a1b,   // 0x00003490
-    0x0d430d01, 0x62dbf361, 0x42d3f363, 0xf3610d81,   // 0x000034a0
-    0x0dc022cb, 0x02c3f360, 0x921b2315, 0x7280f50e,   // 0x000034b0
-    0xf1f3fbb2, 0x2011fb03, 0xe0012203, 0x20000910,   // 0x000034c0
-    0x1c434350, 0xf8d048dd, 0xf8d02608, 0xf852060c,   // 0x000034d0
-    0xf8502021, 0x98151021, 0x18cb18d2, 0x33043204,   // 0x000034e0
-    0xf7fe9926, 0x9a20fdf7, 0xc050f8dd, 0xf3600841,   // 0x000034f0
-    0x0883721c, 0x5214f361, 0x320cf363, 0xf36108c1,   // 0x00003500
-    0x92201204, 0x09039a1f, 0xf3630941, 0xf361721c,   // 0x00003510
-    0x09835214, 0x320cf363, 0xf36109c1, 0x991e1204,   // 0x00003520
-    0x0a02921f, 0xf3620a43, 0xf363711c, 0x0a825114,   // 0x00003530
-    0xf3620ac3, 0xf363310c, 0x9a1d1104, 0x0b01911e,   // 0x00003540
-    0xf3610b43, 0xf363721c, 0x0b815214, 0xf3610bc3,   // 0x00003550
-    0xf363320c, 0x991c1204, 0x0c02921d, 0xf3620c43,   // 0x00003560
-    0xf363711c, 0x0c825114, 0xf3620cc3, 0xf363310c,   // 0x00003570
-    0x9a1b1104, 0x0d01911c, 0xf3610d43, 0xf363721c,   // 0x00003580
-    0x0d815214, 0x320cf361, 0xf3600dc0, 0x23151204,   // 0x00003590
-    0xf50c921b, 0xfbb272a0, 0xfb03f1f3, 0x22032011,   // 0x000035a0
-    0x1c434350, 0xf8d048a5, 0xf8d02608, 0xf852060c,   // 0x000035b0
-    0xf8502021, 0x98151021, 0x18cb18d2, 0x33043204,   // 0x000035c0
-    0xf7fe9926, 0x9a20fd87, 0xe050f8dd, 0xf3600841,   // 0x000035d0
-    0x0883725d, 0x5255f361, 0x324df363, 0xf36108c1,   // 0x000035e0
-    0x92201245, 0x09039a1f, 0xf3630941, 0xf361725d,   // 0x000035f0
-    0x09835255, 0xf36309c1, 0xf361324d, 0x991e1245,   // 0x00003600
-    0x0a02921f, 0x715df362, 0xf3630a43, 0x0a825155,   // 0x00003610
-    0xf3620ac3, 0xf363314d, 0x9a1d1145, 0x0b01911e,   // 0x00003620
-    0xf3610b43, 0xf363725d, 0x0b815255, 0xf3610bc3,   // 0x00003630
-    0xf363324d, 0x991c1245, 0x0c02921d, 0xf3620c43,   // 0x00003640
-    0xf363715d, 0x0c825155, 0xf3620cc3, 0xf363314d,   // 0x00003650
-    0x9a1b1145, 0x0d01911c, 0xf3610d43, 0xf363725d,   // 0x00003660
-    0x0d815255, 0x324df361, 0xf3600dc0, 0x23151245,   // 0x00003670
-    0xf50e921b, 0xfbb272c0, 0xfb03f1f3, 0x22032011,   // 0x00003680
-    0x1c434350, 0xf8d0486d, 0xf8d02608, 0xf852060c,   // 0x00003690
-    0xf8502021, 0x98151021, 0x18cb18d2, 0x33043204,   // 0x000036a0
-    0xf7fe9926, 0x9a20fd17, 0xc050f8dd, 0xf3600841,   // 0x000036b0
-    0x0883729e, 0x5296f361, 0x328ef363, 0xf36108c1,   // 0x000036c0
-    0x92201286, 0x09039a1f, 0xf3630941, 0xf361729e,   // 0x000036d0
-    0x09835296, 0xf36309c1, 0xf361328e, 0x991e1286,   // 0x000036e0
-    0x0a02921f, 0xf3620a43, 0xf363719e, 0x0a825196,   // 0x000036f0
-    0xf3620ac3, 0xf363318e, 0x9a1d1186, 0x0b01911e,   // 0x00003700
-    0x729ef361, 0x0b810b43, 0x5296f363, 0x328ef361,   // 0x00003710
-    0xf3630bc3, 0x991c1286, 0x0c02921d, 0xf3620c43,   // 0x00003720
-    0xf363719e, 0x0c825196, 0xf3620cc3, 0xf363318e,   // 0x00003730
-    0x9a1b1186, 0x0d01911c, 0xf3610d43, 0xf363729e,   // 0x00003740
-    0x0d815296, 0x328ef361, 0xf3600dc0, 0x23151286,   // 0x00003750
-    0xf50c921b, 0xfbb272e0, 0xfb03f1f3, 0x22032011,   // 0x00003760
-    0x1c434350, 0xf8d04835, 0xf8d02608, 0xf852e60c,   // 0x00003770
-    0xf85e2021, 0x98151021, 0x18cb18d2, 0x33043204,   // 0x00003780
-    0xf7fe9926, 0x9a20fca7, 0xc040f8dd, 0xf3600841,   // 0x00003790
-    0x088372df, 0x52d7f361, 0x32cff363, 0xf36108c1,   // 0x000037a0
-    0x922012c7, 0x09039a1f, 0xf3630941, 0xf36172df,   // 0x000037b0
-    0x098352d7, 0xf36309c1, 0xf36132cf, 0x991e12c7,   // 0x000037c0
-    0x0a02921f, 0xf3620a43, 0xf36371df, 0x0a8251d7,   // 0x000037d0
-    0xf3620ac3, 0xf36331cf, 0x9a1d11c7, 0x0b01911e,   // 0x000037e0
-    0xf3610b43, 0xf36372df, 0x0b8152d7, 0x32cff361,   // 0x000037f0
-    0xf3630bc3, 0x991c12c7, 0x0c02921d, 0xf3620c43,   // 0x00003800
-    0xf36371df, 0x0c8251d7, 0xf3620cc3, 0x9a1b31cf,   // 0x00003810
-    0x11c7f363, 0xf3630d03, 0x0d4372df, 0x52d7f363,   // 0x00003820
-    0xf3630d83, 0x9b2532cf, 0x0dc0911c, 0x991d6059,   // 0x00003830
-    0x12c7f360, 0x6099601a, 0xe001921b, 0x20000910,   // 0x00003840
-    0x9a1e981f, 0x60da9920, 0x61596118, 0x93253318,   // 0x00003850
-    0x1c5a9b14, 0x92142a40, 0xac68f47f, 0xb86df7ff,   // 0x00003860
-    0x9214680b, 0xf8dd48e2, 0xf8d0e050, 0x2215160c,   // 0x00003870
-    0xfbbe9115, 0xfb02f1f2, 0x9025e011, 0xf8dd9815,   // 0x00003880
-    0xf850e094, 0x92121021, 0xfb002003, 0x1d48110e,   // 0x00003890
-    0xf8cd9311, 0xf7fec040, 0x9b1afbf9, 0xea4f9919,   // 0x000038a0
-    0xf3600250, 0xea4f6318, 0xf3620c90, 0xea4f4310,   // 0x000038b0
-    0xf36c0ed0, 0xf36e2308, 0x931a0300, 0x1310ea4f,   // 0x000038c0
-    0x1250ea4f, 0x6118f363, 0x1c90ea4f, 0x4110f362,   // 0x000038d0
-    0x1ed0ea4f, 0x2108f36c, 0x0100f36e, 0x99189119,   // 0x000038e0
-    0x2310ea4f, 0x2250ea4f, 0x6118f363, 0x2c90ea4f,   // 0x000038f0
-    0x4110f362, 0x2ed0ea4f, 0x2108f36c, 0x0100f36e,   // 0x00003900
-    0x99179118, 0x3310ea4f, 0x3250ea4f, 0x6118f363,   // 0x00003910
-    0x3c90ea4f, 0x4110f362, 0x3ed0ea4f, 0x2108f36c,   // 0x00003920
-    0x0100f36e, 0x99169117, 0x4310ea4f, 0x4250ea4f,   // 0x00003930
-    0x6118f363, 0x4c90ea4f, 0x4110f362, 0x4ed0ea4f,   // 0x00003940
-    0x2108f36c, 0xc040f8dd, 0xf36e0d03, 0x91160100,   // 0x00003950
-    0x6c18f363, 0x0d820d41, 0x4c10f361, 0xf3629b14,   // 0x00003960
-    0x9a122c08, 0xfbb33340, 0x0dc0f1f2, 0x0c00f360,   // 0x00003970
-    0x3011fb02, 0x90259b15, 0x2021f853, 0xe094f8dd,   // 0x00003980
-    0xc040f8cd, 0xfb012103, 0x3005200e, 0xfb7ef7fe,   // 0x00003990
-    0xea4f9a1a, 0xf3600c50, 0xea4f6259, 0xf36c0e90,   // 0x000039a0
-    0xea4f4251, 0xf36e01d0, 0xf3612249, 0x921a0241,   // 0x000039b0
-    0xea4f9a19, 0xea4f1310, 0xf3631c50, 0xea4f6259,   // 0x000039c0
-    0xf36c1e90, 0xea4f4251, 0xf36e11d0, 0xf3612249,   // 0x000039d0
-    0x92190241, 0xea4f9a18, 0xea4f2310, 0xf3632c50,   // 0x000039e0
-    0xea4f6259, 0xf36c2e90, 0xea4f4251, 0xf36e21d0,   // 0x000039f0
-    0xf3612249, 0x92180241, 0xea4f9a17, 0xea4f3310,   // 0x00003a00
-    0xf3633c50, 0xea4f6259, 0xf36c3e90, 0xea4f4251,   // 0x00003a10
-    0xf36e31d0, 0xf3612249, 0x92170241, 0xea4f9a16,   // 0x00003a20
-    0xea4f4310, 0xf3634c50, 0xea4f6259, 0xf36c4e90,   // 0x00003a30
-    0xea4f4251, 0xf36e41d0, 0xf8dd2249, 0x0d03c040,   // 0x00003a40
-    0x0241f361, 0xf3639216, 0x0d426c59, 0xf3629b14,   // 0x00003a50
-    0x9a124c51, 0x33800d81, 0xf3610dc0, 0xfbb32c49,   // 0x00003a60
-    0xf360f1f2, 0xfb020c41, 0x9b153011, 0xf8539025,   // 0x00003a70
-    0xf8dd2021, 0xf8cde094, 0x2103c040, 0x200efb01,   // 0x00003a80
-    0xf7fe3005, 0x9a1afb03, 0x0c50ea4f, 0x629af360,   // 0x00003a90
-    0x0e90ea4f, 0x4292f36c, 0x01d0ea4f, 0x228af36e,   // 0x00003aa0
-    0x0282f361, 0x9a19921a, 0x1310ea4f, 0x1c50ea4f,   // 0x00003ab0
-    0x629af363, 0x1e90ea4f, 0x4292f36c, 0x11d0ea4f,   // 0x00003ac0
-    0x228af36e, 0x0282f361, 0x9a189219, 0x2310ea4f,   // 0x00003ad0
-    0x2c50ea4f, 0x629af363, 0x2e90ea4f, 0x4292f36c,   // 0x00003ae0
-    0x21d0ea4f, 0x228af36e, 0x0282f361, 0x9a179218,   // 0x00003af0
-    0x3310ea4f, 0x3c50ea4f, 0x629af363, 0x3e90ea4f,   // 0x00003b00
-    0x4292f36c, 0x31d0ea4f, 0x228af36e, 0x0282f361,   // 0x00003b10
-    0x9a169217, 0x4310ea4f, 0x4c50ea4f, 0x629af363,   // 0x00003b20
-    0x4e90ea4f, 0x4292f36c, 0x41d0ea4f, 0xc040f8dd,   // 0x00003b30
-    0x228af36e, 0xf3610d03, 0x92160282, 0x6c9af363,   // 0x00003b40
-    0x9b140d42, 0x4c92f362, 0x0d819a12, 0x0dc033c0,   // 0x00003b50
-    0x2c8af361, 0xf1f2fbb3, 0x0c82f360, 0x3011fb02,   // 0x00003b60
-    0x90259b15, 0x2021f853, 0xe094f8dd, 0xc040f8cd,   // 0x00003b70
-    0xfb012103, 0x3005200e, 0xfa88f7fe, 0xea4f9a1a,   // 0x00003b80
-    0xf3600c50, 0xea4f62db, 0xf36c0e90, 0xea4f42d3,   // 0x00003b90
-    0xf36e01d0, 0xf36122cb, 0x921a02c3, 0xea4f9a19,   // 0x00003ba0
-    0xea4f1310, 0xf3631c50, 0xea4f62db, 0xf36c1e90,   // 0x00003bb0
-    0xea4f42d3, 0xf36e11d0, 0xf36122cb, 0x921902c3,   // 0x00003bc0
-    0xea4f9a18, 0xea4f2310, 0xf3632c50, 0xea4f62db,   // 0x00003bd0
-    0xf36c2e90, 0xea4f42d3, 0xf36e21d0, 0xf36122cb,   // 0x00003be0
-    0x921802c3, 0xea4f9a17, 0xea4f3310, 0xe0013c50,   // 0x00003bf0
-    0x20000910, 0x62dbf363, 0x3e90ea4f, 0x42d3f36c,   // 0x00003c00
-    0x31d0ea4f, 0x22cbf36e, 0x02c3f361, 0x9a169217,   // 0x00003c10
-    0x4310ea4f, 0x4c50ea4f, 0x62dbf363, 0x4e90ea4f,   // 0x00003c20
-    0x42d3f36c, 0x41d0ea4f, 0xc040f8dd, 0x22cbf36e,   // 0x00003c30
-    0xf3610d03, 0x921602c3, 0x6cdbf363, 0x0d810d42,   // 0x00003c40
-    0xf3629b14, 0x0dc04cd3, 0xf3619a12, 0xf3602ccb,   // 0x00003c50
-    0xf5030cc3, 0xfbb07080, 0xfb02f1f2, 0x98150311,   // 0x00003c60
-    0xf8509325, 0xf8dd2021, 0xf8cde094, 0x2103c040,   // 0x00003c70
-    0x230efb01, 0xf7fe1d58, 0x9a1afa09, 0x0c50ea4f,   // 0x00003c80
-    0x721cf360, 0x0e90ea4f, 0x5214f36c, 0x01d0ea4f,   // 0x00003c90
-    0x320cf36e, 0x1204f361, 0x9a19921a, 0x1310ea4f,   // 0x00003ca0
-    0x1c50ea4f, 0x721cf363, 0x1e90ea4f, 0x5214f36c,   // 0x00003cb0
-    0x11d0ea4f, 0x320cf36e, 0x1204f361, 0x9a189219,   // 0x00003cc0
-    0x2310ea4f, 0x2c50ea4f, 0x721cf363, 0x2e90ea4f,   // 0x00003cd0
-    0x5214f36c, 0x21d0ea4f, 0x320cf36e, 0x1204f361,   // 0x00003ce0
-    0x9a179218, 0x3310ea4f, 0x3c50ea4f, 0x721cf363,   // 0x00003cf0
-    0x3e90ea4f, 0x5214f36c, 0x31d0ea4f, 0x320cf36e,   // 0x00003d00
-    0x1204f361, 0x9a169217, 0x4310ea4f, 0x4c50ea4f,   // 0x00003d10
-    0x721cf363, 0x4e90ea4f, 0x5214f36c, 0x41d0ea4f,   // 0x00003d20
-    0x320cf36e, 0x1204f361, 0xf8dd9216, 0x0d03c040,   // 0x00003d30
-    0xf3630d42, 0x0d817c1c, 0xf3629b14, 0x0dc05c14,   // 0x00003d40
-    0xf3619a12, 0xf3603c0c, 0xf5031c04, 0xfbb070a0,   // 0x00003d50
-    0xfb02f1f2, 0x98150311, 0xf8509325, 0xf8dd2021,   // 0x00003d60
-    0xf8cde094, 0x2103c040, 0x230efb01, 0xf7fe1d58,   // 0x00003d70
-    0x9a1af98d, 0x0c50ea4f, 0x725df360, 0x0e90ea4f,   // 0x00003d80
-    0x5255f36c, 0x01d0ea4f, 0x324df36e, 0x1245f361,   // 0x00003d90
-    0x9a19921a, 0x1310ea4f, 0x1c50ea4f, 0x725df363,   // 0x00003da0
-    0x1e90ea4f, 0x5255f36c, 0x11d0ea4f, 0x324df36e,   // 0x00003db0
-    0x1245f361, 0x9a189219, 0x2310ea4f, 0x2c50ea4f,   // 0x00003dc0
-    0x725df363, 0x2e90ea4f, 0x5255f36c, 0x21d0ea4f,   // 0x00003dd0
-    0x324df36e, 0x1245f361, 0x9a179218, 0x3310ea4f,   // 0x00003de0
-    0x3c50ea4f, 0x725df363, 0x3e90ea4f, 0x5255f36c,   // 0x00003df0
-    0x31d0ea4f, 0x324df36e, 0x1245f361, 0x9a169217,   // 0x00003e00
-    0x4310ea4f, 0x4c50ea4f, 0x725df363, 0x4e90ea4f,   // 0x00003e10
-    0x5255f36c, 0x41d0ea4f, 0xc040f8dd, 0x324df36e,   // 0x00003e20
-    0xf3610d03, 0x92161245, 0x7c5df363, 0x0d810d42,   // 0x00003e30
-    0xf3629b14, 0x0dc05c55, 0xf3619a12, 0xf3603c4d,   // 0x00003e40
-    0xf5031c45, 0xfbb070c0, 0xfb02f1f2, 0x98150311,   // 0x00003e50
-    0xf8509325, 0xf8dd2021, 0xf8cde094, 0x2103c040,   // 0x00003e60
-    0x230efb01, 0xf7fe1d58, 0x9a1af911, 0x0c50ea4f,   // 0x00003e70
-    0x729ef360, 0x0e90ea4f, 0x5296f36c, 0x01d0ea4f,   // 0x00003e80
-    0x328ef36e, 0x1286f361, 0x9a19921a, 0x1310ea4f,   // 0x00003e90
-    0x1c50ea4f, 0x729ef363, 0x1e90ea4f, 0x5296f36c,   // 0x00003ea0
-    0x11d0ea4f, 0x328ef36e, 0x1286f361, 0x9a189219,   // 0x00003eb0
-    0x2310ea4f, 0x2c50ea4f, 0x729ef363, 0x2e90ea4f,   // 0x00003ec0
-    0x5296f36c, 0x21d0ea4f, 0x328ef36e, 0x1286f361,   // 0x00003ed0
-    0x9a179218, 0x3310ea4f, 0x3c50ea4f, 0x729ef363,   // 0x00003ee0
-    0x3e90ea4f, 0x5296f36c, 0x31d0ea4f, 0x328ef36e,   // 0x00003ef0
-    0x1286f361, 0x9a169217, 0x4310ea4f, 0x4c50ea4f,   // 0x00003f00
-    0x729ef363, 0x4e90ea4f, 0x5296f36c, 0x41d0ea4f,   // 0x00003f10
-    0x328ef36e, 0xc040f8dd, 0xf3610d03, 0x92161286,   // 0x00003f20
-    0x7c9ef363, 0x0d810d42, 0xf3629b14, 0x0dc05c96,   // 0x00003f30
-    0xf3619a12, 0xf3603c8e, 0xf5031c86, 0xfbb070e0,   // 0x00003f40
-    0xfb02f1f2, 0x98150311, 0x2021f850, 0xc040f8cd,   // 0x00003f50
-    0x0e03f04f, 0x2103fb0e, 0xf7fe1d48, 0x9b1af897,   // 0x00003f60
-    0xc040f8dd, 0xf3600842, 0x088173df, 0x53d7f362,   // 0x00003f70
-    0x33cff361, 0xf36208c2, 0x991913c7, 0x0903931a,   // 0x00003f80
-    0xf3630942, 0xf36271df, 0x098351d7, 0xf36309c2,   // 0x00003f90
-    0xf36231cf, 0x911911c7, 0x0a039918, 0xf3630a42,   // 0x00003fa0
-    0xf36271df, 0x0a8351d7, 0xf3630ac2, 0xf36231cf,   // 0x00003fb0
-    0x911811c7, 0x0b039917, 0x71dff363, 0x0b830b42,   // 0x00003fc0
-    0x51d7f362, 0x31cff363, 0xf3620bc2, 0x911711c7,   // 0x00003fd0
-    0x0c039916, 0xf3630c42, 0xf36271df, 0x0c8351d7,   // 0x00003fe0
-    0xf3630cc2, 0x0d0331cf, 0x11c7f362, 0x7cdff363,   // 0x00003ff0
-    0x0d830d42, 0x5cd7f362, 0x3ccff363, 0x9a189b11,   // 0x00004000
-    0x0dc06059, 0x99179116, 0xf36060da, 0x9a141cc7,   // 0x00004010
-    0x60999819, 0x6118991a, 0xf8c31c50, 0x6159c000,   // 0x00004020
-    0x28403318, 0xf47f9014, 0xf7feac1d, 0x4c0ebc86,   // 0x00004030
-    0x6825480e, 0x9529490e, 0x60089c29, 0x4e0a340a,   // 0x00004040
-    0x97286837, 0xb6729b28, 0xd20842a3, 0xf24a4d09,   // 0x00004050
-    0xf24b6102, 0x80294680, 0xb662802e, 0x4806e7ef,   // 0x00004060
-    0x70022200, 0xbf00e7fe, 0x200007e0, 0x74624346,   // 0x00004070
-    0x20001ffc, 0x4005200c, 0x40072108, 0x41f0e92d,   // 0x00004080
-    0xf5054d11, 0xf10464c1, 0xf104080c, 0x46400774,   // 0x00004090
-    0xf820f000, 0x06dcf104, 0xf0004638, 0x4630f81b,   // 0x000040a0
-    0xf818f000, 0x70a2f504, 0xf814f000, 0x4a084807,   // 0x000040b0
-    0x8608f8c5, 0x23002140, 0x760cf8c5, 0x6610f8c5,   // 0x000040c0
-    0x41f0e8bd, 0xb8b4f000, 0x20000910, 0x20001cc8,   // 0x000040d0
-    0x1fffe040, 0x4605b538, 0xf7fd2400, 0x2300fd53,   // 0x000040e0
-    0x330118c2, 0x2b402100, 0xd1f97111, 0x34045128,   // 0x000040f0
-    0xd1f22c64, 0xbd384628, 0x4604b538, 0xf0007908,   // 0x00004100
-    0xf0000520, 0xf000031f, 0x284000c0, 0xd014b2ed,   // 0x00004110
-    0xd0222880, 0xf894bb20, 0xbb3a21ae, 0x2b1868a2,   // 0x00004120
-    0xf852bf9a, 0xf8420023, 0x46081023, 0xfd50f7fd,   // 0x00004130
-    0x2101b1cd, 0x11aef884, 0x2b18e015, 0xeb04bf97,   // 0x00004140
-    0x46080383, 0x0144f8d3, 0x1144f8c3, 0xfd40f7fd,   // 0x00004150
-    0x2301b14d, 0x31aff884, 0x7948e005, 0x01acf884,   // 0x00004160
-    0xf7fd4608, 0x2001fd35, 0x01adf884, 0x4a09bd38,   // 0x00004170
-    0x68126883, 0xb0826801, 0x9a019201, 0x6842665a,   // 0x00004180
-    0xe8806081, 0x4b04000c, 0x1c416818, 0xb0026019,   // 0x00004190
-    0xbf004770, 0x200007e0, 0x20001ce8, 0x2300b510,   // 0x000041a0
-    0xfbb3211f, 0xeb00f2f1, 0xfb010482, 0xf8d43112,   // 0x000041b0
-    0xeb044144, 0x88d10241, 0x08494a04, 0x1013f822,   // 0x000041c0
-    0xf2403301, 0x428b3103, 0xbd10d1ea, 0x20000910,   // 0x000041d0
-    0xf890b538, 0xf00331ac, 0x46040204, 0xb118b2d0,   // 0x000041e0
-    0x0508f003, 0xe001b2e9, 0x11adf894, 0xb1092320,   // 0x000041f0
-    0xe0004a0d, 0xf8944a0d, 0x601301ae, 0xf8842500,   // 0x00004200
-    0xb12051ad, 0xf7ff4620, 0xf884ffb2, 0xf89451ae,   // 0x00004210
-    0xb12911af, 0xf7ff4620, 0x2300ffc1, 0x31aff884,   // 0x00004220
-    0x4038e8bd, 0xba28f7fd, 0x400ff084, 0x400ff088,   // 0x00004230
-    0x4c04b530, 0x80212518, 0x2101fb05, 0x60a16062,   // 0x00004240
-    0xbd307323, 0x20001ccc, 0x4b5bb5f8, 0x26188819,   // 0x00004250
-    0x2400434e, 0xd00742b4, 0x687d4f57, 0x55282000,   // 0x00004260
-    0x551868bb, 0xe7f53401, 0x20ff4e54, 0x60302101,   // 0x00004270
-    0xf7fd2002, 0x200ef881, 0xf7fd2101, 0x2007f87d,   // 0x00004280
-    0xf7fd2101, 0x2008f879, 0xf7fd2101, 0x2006f875,   // 0x00004290
-    0xf7fd2101, 0x2014f871, 0xf7fd2101, 0x2015f86d,   // 0x000042a0
-    0xf7fd2101, 0x2005f869, 0xf7fd2101, 0x4a42f865,   // 0x000042b0
-    0x7b154b43, 0xf0054843, 0xb2f90710, 0xbf0c2900,   // 0x000042c0
-    0x461d4605, 0x20034629, 0xffe4f7fc, 0x46292004,   // 0x000042d0
-    0xffe0f7fc, 0x2003213c, 0xf86af7fd, 0x21b02004,   // 0x000042e0
-    0xf866f7fd, 0x4a394f38, 0x603a4d39, 0x21022003,   // 0x000042f0
-    0xf842f7fd, 0x2100200f, 0xf83ef7fd, 0x4b364935,   // 0x00004300
-    0x60194f36, 0x7000f501, 0x683a6028, 0xf8df4d34,   // 0x00004310
-    0xf042c0f8, 0x60390120, 0x3c04f857, 0xf0434a31,   // 0x00004320
-    0xf8470002, 0x4f300c04, 0x23004830, 0x602b2101,   // 0x00004330
-    0x601760eb, 0x80d38093, 0x60d36091, 0x482c6110,   // 0x00004340
-    0xb2a28293, 0xf8c08002, 0x20083002, 0x0000f8ac,   // 0x00004350
-    0x2002f8ac, 0x1008f8ac, 0x300af8ac, 0x100cf8cc,   // 0x00004360
-    0x0c00f1c4, 0xf8c44c23, 0xf8dfc000, 0xf8c4c0a0,   // 0x00004370
-    0x8123c004, 0x60e38162, 0x82628220, 0x83236167,   // 0x00004380
-    0x61e18363, 0x461d491c, 0x604e600b, 0x814a810b,   // 0x00004390
-    0x4b1a60cb, 0x8019210a, 0x805a4919, 0x700d22b2,   // 0x000043a0
-    0x700a23b3, 0x704d22b1, 0x708d704b, 0x4915708a,   // 0x000043b0
-    0x6008341c, 0xbf00bdf8, 0x20001ccc, 0x400ff0c8,   // 0x000043c0
-    0x00061a80, 0x000c3500, 0x4004a000, 0x00010300,   // 0x000043d0
-    0x40049034, 0x00020100, 0x4004b000, 0x40048040,   // 0x000043e0
-    0x40008000, 0x40009020, 0x000047fa, 0x400ff0c4,   // 0x000043f0
-    0x40009036, 0x4000904c, 0x4000906c, 0x4000907c,   // 0x00004400
-    0x40021001, 0xe000e100, 0x4000903c, 0x400ff0c0,   // 0x00004410
-    0x4b05b508, 0x701a2203, 0xf864f7fd, 0x61084903,   // 0x00004420
-    0x75082000, 0xbf00bd08, 0x4000801f, 0x20001ccc,   // 0x00004430
-    0x4c07b510, 0xb9437d23, 0xf854f7fd, 0x1a406921,   // 0x00004440
-    0xbf8c2831, 0x20012000, 0x2001bd10, 0xbf00bd10,   // 0x00004450
-    0x20001ccc, 0x4b1bb508, 0x2a007d1a, 0x6898d1fb,   // 0x00004460
-    0x60586859, 0x4b186099, 0xf7fd6018, 0x4a15f83b,   // 0x00004470
-    0x1a406911, 0xd9f82831, 0x68194b14, 0x681b3318,   // 0x00004480
-    0x2001b672, 0x4a127510, 0x42986810, 0x6810d9fb,   // 0x00004490
-    0xd8fc4298, 0x42986810, 0x4b0cd3fc, 0xf001480d,   // 0x000044a0
-    0x601a02e7, 0x60022201, 0x5080f500, 0x4a0a6002,   // 0x000044b0
-    0x5000f44f, 0x4a096010, 0x6010200e, 0xb6626019,   // 0x000044c0
-    0xbf00bd08, 0x20001ccc, 0x40009040, 0x40039000,   // 0x000044d0
-    0x40039004, 0x4004a0a0, 0x400490a0, 0x4000800c,   // 0x000044e0
-    0x43fe0840, 0x4004a040, 0x43fe0844, 0x4004a044,   // 0x000044f0
-    0x43fe1800, 0x4004c000, 0x43fe0030, 0x40049030,   // 0x00004500
-    0x43fe0034, 0x40049034, 0x43fe181c, 0x4004c01c,   // 0x00004510
-    0x43fe1810, 0x4004c010, 0x43fe1808, 0x4004c008,   // 0x00004520
-    0x43fe180c, 0x4004c00c, 0x43fe100c, 0x4004b00c,   // 0x00004530
-    0x43fe1010, 0x4004b010, 0x43fe1018, 0x4004b018,   // 0x00004540
-    0x43fe101c, 0x4004b01c, 0x43fe1014, 0x4004b014,   // 0x00004550
-    0x43fe1804, 0x4004c004, 0x43fe1000, 0x4004b000,   // 0x00004560
-    0x43fe0800, 0x4004a000, 0x43fe0804, 0x4004a004,   // 0x00004570
-    0x43fe080c, 0x4004a00c, 0x43fe0808, 0x4004a008,   // 0x00004580
-    0x43fe1814, 0x4004c014, 0x43fe1818, 0x4004c018,   // 0x00004590
-    0x43fe1004, 0x4004b004, 0x43fe1008, 0x4004b008,   // 0x000045a0
-    0x43fe0014, 0x40049014, 0x43fe084c, 0x4004a04c,   // 0x000045b0
-    0x43fe2004, 0x4004d004, 0x43fe1024, 0x4004b024,   // 0x000045c0
-    0x43fe1020, 0x4004b020, 0x43fe1028, 0x4004b028,   // 0x000045d0
-    0x43fe102c, 0x4004b02c, 0x43fe2000, 0x4004d000,   // 0x000045e0
-    0x43fe0848, 0x4004a048, 0x43fe0010, 0x40049010,   // 0x000045f0
-    0x00000019, 0x00000100, 0x00004742, 0x00000012,   // 0x00004600
-    0x00000200, 0x00004754, 0x0000002b, 0x00000300,   // 0x00004610
-    0x00004780, 0x00000000, 0x00000301, 0x00004784,   // 0x00004620
-    0x00000000, 0x00000302, 0x00004796, 0x00000000,   // 0x00004630
-    0x00000303, 0x14000000, 0x00000000, 0x00000304,   // 0x00004640
-    0x000047aa, 0x00000000, 0x000003ee, 0x000047d4,   // 0x00004650
-    0x00000000, 0x00000000, 0x00000000, 0x00000000,   // 0x00004660
-    0x00000092, 0x00050100, 0x00880001, 0x00070000,   // 0x00004670
-    0x002a0000, 0x00650044, 0x00690076, 0x00650063,   // 0x00004680
-    0x006e0049, 0x00650074, 0x00660072, 0x00630061,   // 0x00004690
-    0x00470065, 0x00490055, 0x00730044, 0x00500000,   // 0x000046a0
-    0x007b0000, 0x00320036, 0x00640066, 0x00310034,   // 0x000046b0
-    0x00330032, 0x0038002d, 0x00650037, 0x002d0033,   // 0x000046c0
-    0x00370034, 0x00650066, 0x0039002d, 0x00360034,   // 0x000046d0
-    0x002d0061, 0x00300065, 0x00340034, 0x00330066,   // 0x000046e0
-    0x00660036, 0x00660032, 0x00330062, 0x0000007d,   // 0x000046f0
-    0x00400000, 0x01000000, 0x00020004, 0x00000000,   // 0x00004700
-    0x01000000, 0x554e4957, 0x00004253, 0x00000000,   // 0x00004710
-    0x00000000, 0x00000000, 0x01010000, 0x554e4957,   // 0x00004720
-    0x00004253, 0x00000000, 0x00000000, 0x00000000,   // 0x00004730
-    0x01120000, 0x00000200, 0x1d504000, 0x0107607a,   // 0x00004740
-    0x01030201, 0x002b0209, 0x80000102, 0x00040932,   // 0x00004750
-    0x00ff0100, 0x05070000, 0x00400201, 0x01040900,   // 0x00004760
-    0x01fe0000, 0x21090401, 0x0027100d, 0x00010104,   // 0x00004770
-    0x04090304, 0x00730312, 0x00610063, 0x006c006e,   // 0x00004780
-    0x006d0069, 0x03140065, 0x00610046, 0x00650064,   // 0x00004790
-    0x00610063, 0x0064006e, 0x032a0079, 0x00610046,   // 0x000047a0
-    0x00650064, 0x00610063, 0x0064006e, 0x00200079,   // 0x000047b0
-    0x006f0042, 0x0074006f, 0x006f006c, 0x00640061,   // 0x000047c0
-    0x00720065, 0x004d0312, 0x00460053, 0x00310054,   // 0x000047d0
-    0x00300030, 0x0000007e, 0x65646146, 0x646e6163,   // 0x000047e0
-    0x31762079, 0x0d37302e, 0xffff000a, 0x0000408d,   // 0x000047f0
+static const uint8_t fw_compressedData[13834] = {
+    0x00, 0xfc, 0x1f, 0x00, 0x20, 0xf9, 0x00, 0x00, 0x00, 0xd0, 0x03, 0xe2, 
+    0xff, 0x1f, 0x03, 0x0d, 0x01, 0x03, 0x0c, 0x17, 0x09, 0xe7, 0x2f, 0x11, 
+    0x13, 0x1f, 0x63, 0x0f, 0x09, 0xe7, 0x4b, 0x1f, 0x6b, 0x1f, 0xbb, 0x03, 
+    0x06, 0x45, 0x97, 0x1f, 0xe3, 0x06, 0x43, 0x4b, 0x4c, 0xf2, 0x20, 0x00, 
+    0x52, 0x4d, 0xf6, 0x28, 0x10, 0x1a, 0x80, 0x18, 0x00, 0x80, 0x00, 0xbf, 
+    0x00, 0xbf, 0xd3, 0x21, 0x23, 0x00, 0xf8, 0x0e, 0x1c, 0x00, 0x22, 0x07, 
+    0x20, 0x4f, 0x00, 0xf4, 0xa6, 0x41, 0x1a, 0x81, 0x23, 0xf8, 0x0a, 0x00, 
+    0x0c, 0x3b, 0x4a, 0x23, 0xf8, 0x08, 0x1c, 0x3a, 0x00, 0x48, 0x3b, 0x4b, 
+    0x3b, 0x49, 0x1a, 0x60, 0x58, 0x00, 0x60, 0x0a, 0x78, 0x02, 0xf0, 0x08, 
+    0x03, 0xd8, 0x40, 0xb2, 0x18, 0xb1, 0x0a, 0x78, 0x42, 0x09, 0x00, 0x0b, 
+    0x00, 0x70, 0x36, 0x48, 0x37, 0x4b, 0x0a, 0x21, 0x01, 0x00, 0x70, 0x24, 
+    0x22, 0xa0, 0x21, 0x1a, 0x70, 0x03, 0x40, 0xf8, 0x01, 0x1c, 0x34, 0x48, 
+    0x02, 0x25, 0x00, 0x02, 0x00, 0x03, 0xd9, 0xb2, 0x00, 0x29, 0xf8, 0xd0, 
+    0x30, 0x25, 0x0d, 0x02, 0x10, 0x0d, 0x03, 0xd1, 0x2d, 0x1b, 0x02, 0x0c, 
+    0x03, 0x00, 0x08, 0x2b, 0xf9, 0xd1, 0x2b, 0x48, 0x03, 0x21, 0x00, 0x40, 
+    0x22, 0x01, 0x70, 0x00, 0x23, 0x42, 0x70, 0x00, 0x29, 0x4a, 0x29, 0x49, 
+    0x98, 0x18, 0x88, 0x42, 0x00, 0x04, 0xd2, 0x28, 0x49, 0x58, 0x58, 0x98, 
+    0x50, 0x00, 0x04, 0x33, 0xf5, 0xe7, 0x27, 0x48, 0x27, 0x4b, 0x00, 0x98, 
+    0x42, 0x4f, 0xf0, 0x00, 0x03, 0x02, 0xd2, 0x00, 0x40, 0xf8, 0x04, 0x3b, 
+    0xf7, 0xe7, 0x24, 0x48, 0x20, 0x25, 0x4a, 0x19, 0x58, 0x99, 0x1d, 0x00, 
+    0xb3, 0xf5, 0x00, 0x80, 0x7f, 0xf7, 0xd1, 0x22, 0x48, 0x02, 0x60, 0x80, 
+    0x18, 0x4a, 0x11, 0x78, 0x01, 0xf0, 0x20, 0x93, 0x00, 0xa0, 0x00, 0x28, 
+    0xf8, 0xd0, 0x15, 0x0d, 0x02, 0x40, 0x0d, 0x04, 0x00, 0x1b, 0x4a, 0x1c, 
+    0x49, 0x1c, 0x4b, 0x0a, 0x60, 0x20, 0x20, 0x20, 0x18, 0x70, 0x0e, 0x27, 
+    0x02, 0x0c, 0x00, 0x00, 0x0c, 0x28, 0xf9, 0xd1, 0x18, 0x4b, 0x19, 0x49, 
+    0x00, 0x02, 0x22, 0x1a, 0x60, 0x44, 0x3b, 0x19, 0x60, 0x00, 0x62, 0xb6, 
+    0x00, 0xf0, 0xe9, 0xb8, 0x00, 0xbf, 0x00, 0x0e, 0x20, 0x05, 0x40, 0x82, 
+    0x3f, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2b, 0x38, 0x80, 0x04, 0x40, 
+    0x00, 0x02, 0xd0, 0x07, 0x40, 0x00, 0x50, 0x06, 0x40, 0xa8, 0x01, 0x40, 
+    0x06, 0x01, 0x02, 0x04, 0x07, 0x00, 0x00, 0x23, 0x40, 0x40, 0xd4, 0xec, 
+    0xff, 0x1f, 0x10, 0x04, 0x30, 0x40, 0xf0, 0xc0, 0xff, 0x1f, 0x30, 0xf5, 
+    0xff, 0x1f, 0x3a, 0x40, 0x0b, 0x02, 0x90, 0x08, 0xed, 0x00, 0xe0, 0x45, 
+    0x40, 0x11, 0x44, 0x3b, 0x00, 0x0a, 0x00, 0x33, 0x00, 0x48, 0x43, 0x00, 
+    0xc0, 0x10, 0x05, 0x00, 0x00, 0x18, 0x4b, 0x1a, 0x68, 0x42, 0xf4, 0x80, 
+    0x61, 0x00, 0x17, 0x4a, 0x19, 0x60, 0x00, 0x23, 0x13, 0x70, 0x40, 0x16, 
+    0x49, 0x17, 0x4a, 0x0b, 0x70, 0x07, 0x08, 0x4b, 0x00, 0x40, 0xf2, 0x13, 
+    0x31, 0x4f, 0xf4, 0x51, 0x72, 0x00, 0x19, 0x60, 0x5a, 0x60, 0x14, 0x4b, 
+    0xc0, 0xf3, 0x00, 0x44, 0x31, 0xc0, 0xf3, 0x47, 0x12, 0x19, 0x70, 0x00, 
+    0x00, 0xf0, 0x1f, 0x00, 0x5a, 0x70, 0x10, 0x4a, 0x20, 0x98, 0x72, 0x02, 
+    0x21, 0x04, 0x39, 0x00, 0x51, 0x74, 0x20, 0xd3, 0x74, 0x0e, 0x4b, 0x88, 
+    0xcb, 0x00, 0x0d, 0x48, 0x00, 0x3c, 0x22, 0x4f, 0xf4, 0x80, 0x31, 0x03, 
+    0xf8, 0x80, 0x0d, 0x2c, 0x01, 0x60, 0x70, 0x47, 0x34, 0xaf, 0x00, 0x82, 
+    0x22, 0x8b, 0x00, 0xa1, 0xf4, 0xff, 0x1f, 0x24, 0x93, 0x00, 0x4a, 0x23, 
+    0x97, 0x00, 0xa0, 0x0b, 0x00, 0x40, 0xa0, 0x8b, 0x00, 0xa0, 0x28, 0x06, 
+    0x40, 0x02, 0x03, 0x00, 0x10, 0x07, 0x00, 0x00, 0xe1, 0x00, 0x00, 0xe0, 
+    0x11, 0x4b, 0x19, 0x68, 0x4b, 0x05, 0x00, 0x1e, 0xd5, 0x10, 0x4a, 0x13, 
+    0x78, 0x01, 0x33, 0x00, 0x3f, 0x2b, 0x88, 0xbf, 0x00, 0x23, 0x0e, 0x49, 
+    0x00, 0x0a, 0x78, 0x9a, 0x42, 0x09, 0xd1, 0x72, 0xb6, 0x00, 0x0d, 0x4a, 
+    0x4a, 0xf2, 0x02, 0x61, 0x11, 0x80, 0x00, 0x4b, 0xf2, 0x80, 0x41, 0x11, 
+    0x80, 0x62, 0xb6, 0x00, 0xf1, 0xe7, 0x09, 0x49, 0x0a, 0x4a, 0xc8, 0x54, 
+    0x00, 0x01, 0x20, 0x10, 0x70, 0x04, 0x49, 0x08, 0x4a, 0x00, 0xdb, 0xb2, 
+    0xbc, 0x20, 0x0b, 0x70, 0x10, 0x70, 0x6b, 0x73, 0x03, 0x6b, 0x05, 0x0c, 
+    0x3b, 0x20, 0xa2, 0x7b, 0x00, 0x73, 0x01, 0x03, 0x01, 0x6f, 0x00, 0x38, 
+    0xb5, 0x45, 0x18, 0x04, 0x46, 0xac, 0x00, 0x42, 0x04, 0xd0, 0x14, 0xf8, 
+    0x01, 0x0b, 0xff, 0x00, 0xf7, 0xc5, 0xff, 0xf8, 0xe7, 0x38, 0xbd, 0x07, 
+    0x00, 0x4b, 0x18, 0x78, 0x48, 0xb1, 0x72, 0xb6, 0x06, 0x0a, 0x49, 0x63, 
+    0x00, 0x62, 0x61, 0x00, 0x43, 0x0a, 0x80, 0x0b, 0x81, 0x63, 0x00, 0xf2, 
+    0xe7, 0x70, 0x47, 0x00, 0xbf, 0xaf, 0x01, 0x01, 0x47, 0x01, 0x08, 0xb5, 
+    0x0b, 0x4b, 0x18, 0x68, 0x42, 0x00, 0x05, 0x11, 0xd5, 0xff, 0xf7, 0xe6, 
+    0xff, 0x09, 0x08, 0x49, 0x09, 0x48, 0xe9, 0x00, 0x32, 0x0a, 0x60, 0x08, 
+    0x00, 0x49, 0x00, 0x23, 0x40, 0xf2, 0x03, 0x12, 0x03, 0x00, 0x70, 0x0a, 
+    0x60, 0x06, 0x48, 0x4a, 0x60, 0x06, 0xa4, 0x4a, 0x03, 0x45, 0x20, 0x08, 
+    0xbd, 0xfb, 0x01, 0x80, 0xd7, 0x00, 0x07, 0x77, 0x01, 0xef, 0x01, 0x07, 
+    0x25, 0x01, 0xb4, 0x02, 0x48, 0x84, 0x10, 0x46, 0x01, 0xbc, 0x60, 0x5b, 
+    0x00, 0x15, 0xe8, 0xff, 0x14, 0x1f, 0xff, 0x00, 0x1c, 0xfe, 0x03, 0x03, 
+    0x40, 0xfe, 0xe7, 0x00, 0xfe, 0xe7, 0xf0, 0xb5, 0x0c, 0x4b, 0x0c, 0x4c, 
+    0x02, 0x1a, 0xe1, 0x40, 0x02, 0x05, 0x04, 0xeb, 0xc5, 0x06, 0x00, 0x82, 
+    0xf0, 0x01, 0x02, 0x70, 0x60, 0x09, 0x48, 0x00, 0x1a, 0x70, 0x06, 0x78, 
+    0x00, 0x2e, 0x0c, 0xbf, 0x00, 0x88, 0x27, 0xc8, 0x27, 0x47, 0xea, 0x01, 
+    0x41, 0x00, 0x86, 0xf0, 0x01, 0x06, 0x44, 0xf8, 0x35, 0x10, 0x20, 0x06, 
+    0x70, 0xf0, 0xbd, 0x48, 0x7b, 0x20, 0x00, 0xe0, 0x08, 0xff, 0x1f, 0x9f, 
+    0x83, 0x20, 0x2d, 0xe9, 0xf7, 0x43, 0x02, 0x92, 0x5f, 0x20, 0x03, 0xf0, 
+    0x04, 0x01, 0xc8, 0xb2, 0x00, 0x08, 0xb1, 0x04, 0x21, 0x11, 0x70, 0x03, 
+    0xf0, 0x00, 0x08, 0x02, 0xd2, 0xb2, 0x00, 0x2a, 0x00, 0xf0, 0x00, 0x90, 
+    0x81, 0x8c, 0x4d, 0x2d, 0x78, 0x2b, 0x09, 0x00, 0x40, 0xf0, 0x87, 0x81, 
+    0xad, 0x08, 0x8a, 0x4c, 0x06, 0x54, 0x41, 0x00, 0x65, 0x00, 0x07, 0xc1, 
+    0xf3, 0x83, 0x00, 0x00, 0x09, 0x28, 0x7f, 0x68, 0x00, 0xf0, 0x58, 0x81, 
+    0x00, 0x0d, 0x28, 0x03, 0xd0, 0x01, 0x28, 0x40, 0xf0, 0x00, 0x73, 0x81, 
+    0x1c, 0xe1, 0x79, 0x68, 0x82, 0x48, 0x00, 0x3a, 0x68, 0x41, 0x60, 0x82, 
+    0x49, 0x02, 0x60, 0x01, 0x6d, 0x01, 0x81, 0x4c, 0x81, 0x49, 0x23, 0x60, 
+    0x01, 0x00, 0x24, 0x0c, 0x70, 0x92, 0xb2, 0x80, 0x49, 0xb2, 0x00, 0xf5, 
+    0xa0, 0x6f, 0x0b, 0x80, 0x68, 0xd0, 0x21, 0x00, 0xd8, 0x40, 0xf2, 0x21, 
+    0x13, 0x9a, 0x42, 0x00, 0x00, 0xf0, 0x8b, 0x80, 0x0c, 0xd8, 0x82, 0x2a, 
+    0x3f, 0x00, 0xd0, 0xb2, 0xf5, 0x81, 0x7f, 0x4e, 0xd0, 0x80, 0x00, 0x2a, 
+    0x40, 0xf0, 0xae, 0x80, 0x77, 0x4c, 0x00, 0x00, 0x26, 0x26, 0x70, 0x66, 
+    0x70, 0xab, 0xe0, 0x40, 0x88, 0xf2, 0xa1, 0x33, 0x25, 0x01, 0x88, 0x80, 
+    0x80, 0x07, 0x02, 0x00, 0x8b, 0x80, 0x40, 0xf2, 0x02, 0x30, 0x82, 0x42, 
+    0x20, 0x40, 0xf0, 0x9b, 0x80, 0x47, 0x1d, 0x00, 0x81, 0x61, 0x00, 0x8a, 
+    0x42, 0x0b, 0xd8, 0xb2, 0xf5, 0xd0, 0x6f, 0x04, 0x4e, 0xd2, 0x2b, 0x00, 
+    0x53, 0x9a, 0x42, 0x7f, 0xd0, 0x05, 0x29, 0x01, 0x40, 0x57, 0x00, 0x82, 
+    0xe0, 0xb2, 0xf5, 0x10, 0x10, 0x6f, 0x0f, 0xd0, 0x08, 0x1f, 0x00, 0x08, 
+    0x6f, 0x40, 0x00, 0xf0, 0x82, 0x80, 0x62, 0x4c, 0x26, 0x78, 0x60, 0x00, 
+    0x4c, 0x26, 0x70, 0x73, 0xe0, 0xa2, 0xf5, 0xfd, 0x00, 0x43, 0x40, 0x3b, 
+    0x01, 0x2b, 0x77, 0xd8, 0x45, 0x00, 0xe0, 0x81, 0x78, 0x5c, 0x4d, 0x1e, 
+    0xe0, 0x80, 0x00, 0x88, 0x5b, 0x4b, 0x08, 0xb1, 0x0f, 0x21, 0x0f, 0x14, 
+    0xe1, 0x57, 0x7d, 0x04, 0x1b, 0x11, 0x20, 0x02, 0x02, 0xd5, 0x00, 0xb2, 
+    0x00, 0x2d, 0x67, 0xd0, 0x01, 0x21, 0x21, 0x00, 0x70, 0x64, 0xe0, 0x4c, 
+    0x48, 0x82, 0x88, 0x51, 0x00, 0x06, 0x5d, 0xd1, 0x43, 0x88, 0x00, 0x2b, 
+    0x5a, 0x00, 0xd1, 0x4f, 0x4c, 0x95, 0x00, 0x2d, 0x19, 0x29, 0x00, 0x78, 
+    0x21, 0xf0, 0x02, 0x01, 0x29, 0x70, 0x1c, 0x00, 0x46, 0x5b, 0xe0, 0x44, 
+    0x49, 0x8a, 0x88, 0x50, 0x10, 0x06, 0x4d, 0xd1, 0x4b, 0x1f, 0x00, 0x4a, 
+    0xd1, 0x47, 0x00, 0x4e, 0x94, 0x00, 0xa5, 0x19, 0x28, 0x78, 0x40, 0x01, 
+    0x1f, 0x00, 0xee, 0xe7, 0x42, 0x88, 0x44, 0x4b, 0x53, 0x00, 0xf8, 0x08, 
+    0x4c, 0xa3, 0xf1, 0x0c, 0x01, 0x00, 0x00, 0x2c, 0x3b, 0xd0, 0x0c, 0x33, 
+    0x33, 0xf8, 0x18, 0x00, 0x0c, 0x90, 0x42, 0xf4, 0xd1, 0x15, 0x0a, 0x03, 
+    0x00, 0x2d, 0x0c, 0xbf, 0x23, 0x78, 0x0b, 0x89, 0x3a, 0x00, 0xe0, 0x33, 
+    0x4a, 0x91, 0x88, 0x04, 0x29, 0x2c, 0x00, 0xd1, 0x30, 0xe0, 0x81, 0x88, 
+    0x49, 0xbb, 0xc1, 0x00, 0x88, 0x49, 0xb9, 0x40, 0x88, 0x00, 0x91, 0x0a, 
+    0x00, 0x46, 0x0b, 0x46, 0x00, 0xf0, 0xd5, 0xfa, 0x10, 0x40, 0xb9, 0x32, 
+    0x4e, 0x0f, 0x24, 0x34, 0x83, 0x80, 0xc7, 0x00, 0xe7, 0x80, 0x88, 0xc8, 
+    0xb9, 0x2d, 0x48, 0x00, 0x00, 0xf0, 0x2e, 0xfb, 0xe8, 0xb9, 0x14, 0xe0, 
+    0x25, 0x00, 0x4b, 0x9a, 0x88, 0x8a, 0xb9, 0x00, 0xf0, 0x91, 0x14, 0xfb, 
+    0x0c, 0x39, 0x00, 0x61, 0x09, 0x00, 0xb8, 0xfa, 0x25, 0x00, 0x4c, 0x20, 
+    0x70, 0x01, 0x23, 0x10, 0xe0, 0x1e, 0x10, 0x4a, 0x90, 0x88, 0x18, 0x1b, 
+    0x00, 0x99, 0xfb, 0x00, 0x00, 0x28, 0xe1, 0xd1, 0x0f, 0x21, 0x21, 0x4b, 
+    0x9d, 0x00, 0xe0, 0x02, 0x23, 0x04, 0xe0, 0x28, 0x23, 0x21, 0x00, 0x4c, 
+    0x01, 0xe0, 0x1c, 0x4c, 0x06, 0x23, 0x16, 0x00, 0x48, 0xc6, 0x88, 0xb3, 
+    0x42, 0x38, 0xbf, 0x1e, 0x00, 0x46, 0x40, 0x2e, 0x34, 0xbf, 0x35, 0x46, 
+    0x40, 0x00, 0x25, 0x20, 0x46, 0x29, 0x46, 0xff, 0xf7, 0xd2, 0x00, 0xfe, 
+    0x76, 0x1b, 0x2c, 0x44, 0x04, 0xd1, 0x40, 0x00, 0x2d, 0x40, 0xf0, 0x85, 
+    0x80, 0x35, 0x46, 0x03, 0x2a, 0xe0, 0x1f, 0x0b, 0xc2, 0x1f, 0x02, 0x01, 
+    0x1f, 0x00, 0x75, 0xd1, 0x00, 0x07, 0x4b, 0x0e, 0x4a, 0x1c, 0x60, 0x16, 
+    0x80, 0x80, 0x70, 0xe0, 0x80, 0x20, 0x07, 0x40, 0x90, 0x03, 0x00, 0x05, 
+    0x5f, 0x41, 0x8c, 0xe3, 0x60, 0x80, 0x00, 0x40, 0x00, 0x00, 0xab, 0xeb, 
+    0x60, 0x6b, 0x41, 0x04, 0xf3, 0x60, 0x96, 0xf7, 0x60, 0x9e, 0xfb, 0x60, 
+    0x82, 0xc0, 0x27, 0x00, 0xd4, 0xeb, 0xff, 0x1f, 0x6e, 0xa3, 0x80, 0x42, 
+    0x94, 0x0b, 0x80, 0x4c, 0x4b, 0x19, 0x88, 0x15, 0x40, 0x12, 0x00, 0x91, 
+    0x42, 0x2a, 0xd1, 0x98, 0x88, 0x4a, 0x4a, 0x00, 0x18, 0xb1, 0x11, 0x88, 
+    0xdb, 0x88, 0x99, 0x42, 0x00, 0x20, 0xd8, 0x46, 0x4e, 0x12, 0x88, 0xf1, 
+    0x88, 0x00, 0x70, 0x88, 0x00, 0x97, 0xc2, 0xeb, 0x01, 0x09, 0x00, 0xb9, 
+    0xf1, 0x40, 0x0f, 0x28, 0xbf, 0x4f, 0xf0, 0x00, 0x40, 0x09, 0x4b, 0x46, 
+    0xdf, 0xf8, 0x00, 0x81, 0x00, 0x00, 0xf0, 0x48, 0xfa, 0x70, 0xb1, 0xb8, 
+    0xf8, 0x00, 0x00, 0x00, 0xf2, 0x88, 0x81, 0x44, 0x1f, 0xfa, 0x00, 0x89, 
+    0xf9, 0x4a, 0x45, 0xa8, 0xf8, 0x00, 0x90, 0x00, 0x07, 0xd8, 0x3a, 0x48, 
+    0x00, 0x21, 0xff, 0xf7, 0x00, 0x6f, 0xfe, 0x02, 0xe0, 0x38, 0x4b, 0x0f, 
+    0x21, 0x10, 0x19, 0x70, 0x38, 0x48, 0xff, 0x40, 0x00, 0x1f, 0xe0, 0x00, 
+    0x37, 0x4d, 0x2d, 0x68, 0x95, 0xb1, 0x36, 0x4e, 0x00, 0x37, 0x88, 0x40, 
+    0x2f, 0x34, 0xbf, 0x3c, 0x46, 0x20, 0x40, 0x24, 0x28, 0x46, 0x21, 0xef, 
+    0x00, 0x5a, 0xfe, 0x00, 0x39, 0x1b, 0x88, 0xb2, 0x30, 0x80, 0x08, 0xb9, 
+    0x00, 0x40, 0x2c, 0x00, 0xd1, 0x28, 0x19, 0x2d, 0x4b, 0x40, 0x18, 0x60, 
+    0x27, 0x49, 0x0a, 0x88, 0xb5, 0x41, 0x04, 0x00, 0xd1, 0x00, 0x20, 0x48, 
+    0x70, 0x2a, 0x4b, 0x89, 0x00, 0x78, 0x19, 0x70, 0x2a, 0x48, 0x01, 0x22, 
+    0x02, 0x10, 0x70, 0x29, 0x4b, 0x08, 0x53, 0x00, 0x61, 0xe6, 0xd9, 0x00, 
+    0x07, 0x1f, 0xd5, 0x25, 0x49, 0x27, 0x4b, 0x20, 0x04, 0x48, 0x02, 0xe5, 
+    0x40, 0x1a, 0x70, 0x25, 0x4b, 0x26, 0x00, 0x4c, 0x18, 0x60, 0x98, 0x60, 
+    0x25, 0x48, 0x1a, 0x00, 0x61, 0xd8, 0x60, 0x9a, 0x61, 0x5c, 0x60, 0x19, 
+    0x04, 0x4b, 0x0d, 0xd3, 0xa0, 0x22, 0x48, 0xff, 0x23, 0x03, 0x00, 0x70, 
+    0x00, 0xf8, 0x08, 0x3c, 0x02, 0x74, 0x20, 0x00, 0x4a, 0x13, 0x70, 0x20, 
+    0x4b, 0x9f, 0x20, 0x01, 0x00, 0x22, 0x18, 0x70, 0x0a, 0x70, 0x18, 0xe0, 
+    0x1a, 0x00, 0x06, 0x05, 0xd5, 0x0f, 0x4a, 0x0d, 0x20, 0x80, 0x80, 0x21, 
+    0x10, 0x70, 0x02, 0xf8, 0x40, 0x1c, 0x79, 0x40, 0x00, 0x00, 0xc2, 0xb2, 
+    0x2a, 0xb1, 0x15, 0x48, 0x01, 0x84, 0x78, 0x02, 0x75, 0xc1, 0xf8, 0x08, 
+    0x2c, 0x03, 0x97, 0xc0, 0x80, 0xd8, 0xb2, 0x10, 0xb1, 0x0b, 0x4a, 0x10, 
+    0xa1, 0x60, 0xc0, 0xbd, 0xe8, 0xfe, 0x83, 0x00, 0xbf, 0x5f, 0x21, 0x53, 
+    0x25, 0xd7, 0x4f, 0x21, 0x6b, 0x25, 0x4f, 0x21, 0x98, 0x87, 0x20, 0x94, 
+    0x13, 0x01, 0x8f, 0x20, 0xad, 0xef, 0x65, 0x08, 0x67, 0x21, 0x77, 0xa0, 
+    0x88, 0xa3, 0x20, 0x8c, 0xa7, 0x20, 0x0a, 0x84, 0xab, 0x20, 0x17, 0xf3, 
+    0xa3, 0x20, 0x18, 0x60, 0x16, 0x04, 0x4b, 0x80, 0x25, 0x20, 0x18, 0x78, 
+    0x14, 0x4a, 0x00, 0x00, 0x06, 0xfb, 0xd4, 0x13, 0x4b, 0x14, 0x49, 0xc3, 
+    0x20, 0xf3, 0x07, 0x20, 0x08, 0x70, 0x05, 0x00, 0x40, 0x08, 0x00, 0x75, 
+    0x1b, 0x0e, 0xff, 0x20, 0x0b, 0x76, 0x01, 0x40, 0xf8, 0x1c, 0x0c, 0x01, 
+    0xf8, 0x14, 0x03, 0x00, 0x8c, 0x12, 0x0c, 0xcb, 0xc0, 0x20, 0x41, 0xbf, 
+    0xc0, 0x00, 0x21, 0x13, 0x01, 0xb5, 0x00, 0x78, 0x0c, 0x09, 0x4b, 0x02, 
+    0xf8, 0x0c, 0x00, 0x1c, 0x08, 0x49, 0x02, 0xf8, 0x88, 0x0c, 0x08, 0x40, 
+    0x22, 0x10, 0x20, 0x1a, 0x60, 0x08, 0x7b, 0xa4, 0x0c, 0xaa, 0x21, 0x0f, 
+    0x43, 0x9c, 0x1b, 0x40, 0x04, 0xd7, 0xa0, 0x08, 0x0f, 0x00, 0x00, 0x04, 
+    0x4b, 0x05, 0x49, 0x18, 0x78, 0x0a, 0x78, 0xc2, 0x90, 0x79, 0x40, 0x40, 
+    0x30, 0x80, 0x1a, 0x57, 0xa1, 0x17, 0xc5, 0x00, 0x08, 0x4b, 0x19, 0x78, 
+    0x08, 0x4b, 0x1a, 0x78, 0x00, 0x91, 0x42, 0x08, 0xd0, 0x50, 0x1c, 0xc2, 
+    0xb2, 0x04, 0x3f, 0x2a, 0xf9, 0xa0, 0x22, 0x05, 0x49, 0x88, 0x5c, 0x02, 
+    0x1a, 0xcd, 0xa0, 0x4f, 0xf0, 0xff, 0x30, 0x70, 0x47, 0x45, 0x43, 0xc5, 
+    0xe2, 0x47, 0xc0, 0x10, 0xb5, 0x30, 0xaf, 0xa0, 0x10, 0x00, 0xf0, 0x30, 
+    0x0f, 0x21, 0xd0, 0x72, 0xb6, 0x2e, 0x01, 0x21, 0xc0, 0x32, 0xb9, 0x0f, 
+    0x39, 0x0b, 0x78, 0x2c, 0x04, 0x4b, 0x40, 0xf7, 0x20, 0x62, 0xb6, 0x16, 
+    0xe0, 0x62, 0x00, 0xb6, 0x2a, 0x4c, 0x2b, 0x48, 0x23, 0x78, 0x00, 0x00, 
+    0x78, 0x2a, 0x49, 0x0c, 0x78, 0x59, 0x1c, 0xc9, 0x08, 0xb2, 0x3f, 0x29, 
+    0x4d, 0xc0, 0x21, 0x81, 0x42, 0x02, 0x00, 0xd0, 0x27, 0x4b, 0x5c, 0x54, 
+    0x0b, 0x46, 0x01, 0x00, 0x3a, 0x12, 0xf0, 0xff, 0x02, 0xef, 0xd1, 0x20, 
+    0x00, 0x48, 0x03, 0x70, 0x23, 0x4a, 0x10, 0x78, 0x41, 0x00, 0xb2, 0x00, 
+    0x29, 0xc2, 0xb2, 0x21, 0xda, 0x19, 0x01, 0x09, 0xc0, 0x03, 0x06, 0x1d, 
+    0xd5, 0x1f, 0x4c, 0x20, 0x00, 0x49, 0x24, 0x78, 0x0b, 0x78, 0xa3, 0x42, 
+    0x0e, 0x00, 0xd0, 0x01, 0x33, 0x14, 0x48, 0xdb, 0xb2, 0x01, 0x08, 0x78, 
+    0x1c, 0x49, 0x93, 0xc3, 0xc8, 0x5c, 0x15, 0x49, 0x00, 0x08, 0x70, 0x0d, 
+    0x31, 0x08, 0x78, 0x07, 0x28, 0x80, 0xee, 0xd9, 0x16, 0x49, 0x0b, 0x70, 
+    0x0c, 0x3f, 0xc0, 0x80, 0x00, 0x06, 0x02, 0xd5, 0x11, 0x4b, 0x7c, 0x79, 
+    0x40, 0x04, 0x02, 0xf0, 0xa2, 0xe0, 0xb2, 0x58, 0xb1, 0x06, 0x49, 0x06, 
+    0x0b, 0x67, 0xa0, 0x0b, 0x01, 0x28, 0xb1, 0x0e, 0x4b, 0x0a, 0x09, 0x9f, 
+    0x40, 0x3c, 0x22, 0x1d, 0x00, 0x70, 0x10, 0xbd, 0x00, 0xd4, 0xbf, 0x04, 
+    0xfb, 0xc0, 0x16, 0xff, 0xc0, 0x11, 0x03, 0xe0, 0x1f, 0xe5, 0x3e, 0x07, 
+    0x0f, 0xe0, 0xdf, 0x01, 0xa7, 0xc1, 0x2b, 0xe5, 0xbb, 0xc5, 0x72, 0xb6, 
+    0x84, 0x04, 0x4b, 0x9b, 0xc4, 0x40, 0x1a, 0x80, 0x18, 0xff, 0xc0, 0x04, 
+    0x70, 0x47, 0xdb, 0xc1, 0x38, 0xb5, 0x42, 0xf2, 0x10, 0x41, 0x8f, 0xe0, 
+    0xad, 0xf9, 0x07, 0x21, 0x2e, 0x21, 0x80, 0xb1, 0x00, 0xf9, 0x0a, 0x20, 
+    0x00, 0xf0, 0xbe, 0xf9, 0x00, 0x00, 0xf0, 0xc4, 0xf9, 0x00, 0x24, 0xff, 
+    0xf7, 0x43, 0x00, 0xff, 0x40, 0xb1, 0xff, 0xf7, 0x4e, 0xff, 0x27, 0x00, 
+    0x4b, 0xe1, 0x5c, 0x88, 0x42, 0x02, 0xd1, 0x01, 0x00, 0x34, 0x07, 0x2c, 
+    0xf3, 0xd1, 0x00, 0xf0, 0xa5, 0x00, 0xf9, 0x07, 0x2c, 0x0b, 0xd0, 0x23, 
+    0x4c, 0x60, 0x00, 0x68, 0xa0, 0xf5, 0x80, 0x52, 0xb2, 0xf5, 0xf8, 0x00, 
+    0x3f, 0x04, 0xd2, 0x20, 0x4d, 0x21, 0x49, 0x2b, 0x00, 0x68, 0x8b, 0x42, 
+    0x27, 0xd1, 0x20, 0x4a, 0x20, 0x00, 0x4c, 0x20, 0x20, 0x4f, 0xf4, 0xa2, 
+    0x75, 0x25, 0x10, 0x60, 0x10, 0x60, 0x42, 0x01, 0x40, 0x00, 0xf0, 0x6e, 
+    0x00, 0xf8, 0xff, 0xf7, 0xe0, 0xfe, 0x00, 0xf0, 0x82, 0x00, 0xf8, 0x07, 
+    0x28, 0x02, 0xd0, 0xff, 0xf7, 0xb6, 0x01, 0x39, 0xe0, 0x14, 0x4b, 0x00, 
+    0x21, 0x19, 0x60, 0x0b, 0x00, 0x24, 0x16, 0x48, 0x20, 0x25, 0x05, 0x60, 
+    0x15, 0x00, 0x4d, 0xff, 0xf7, 0xab, 0xff, 0x01, 0x3d, 0xfb, 0x00, 0xd1, 
+    0x01, 0x3c, 0xf5, 0xd1, 0xff, 0xf7, 0xa5, 0x00, 0xff, 0x72, 0xb6, 0x11, 
+    0x4a, 0x14, 0x70, 0xfe, 0x00, 0xe7, 0x72, 0xb6, 0x10, 0x48, 0x04, 0x60, 
+    0xff, 0x00, 0xf7, 0x9c, 0xff, 0x00, 0x22, 0x2a, 0x60, 0x20, 0x08, 0x68, 
+    0x61, 0x68, 0xd5, 0x20, 0x33, 0x9e, 0x46, 0x85, 0x40, 0x46, 0x08, 0x47, 
+    0x00, 0x20, 0x38, 0x0f, 0x20, 0xc4, 0x01, 0x17, 0x80, 0x00, 0x10, 0x00, 
+    0x00, 0xfc, 0x1f, 0x00, 0x00, 0x20, 0x46, 0x43, 0x62, 0x74, 0x94, 0xf0, 
+    0x0f, 0x40, 0x40, 0x14, 0xb0, 0x04, 0x40, 0x8c, 0x07, 0x00, 0xa0, 0x48, 
+    0x86, 0x01, 0x00, 0x43, 0x41, 0x08, 0xed, 0x4b, 0xe0, 0x06, 0x00, 0x10, 
+    0xb5, 0x20, 0xd5, 0x10, 0xf0, 0x40, 0x04, 0x00, 0x07, 0xd0, 0x0f, 0x48, 
+    0x10, 0x4b, 0x0a, 0x22, 0x00, 0x0e, 0x21, 0x02, 0x70, 0x19, 0x70, 0x00, 
+    0x22, 0x04, 0x13, 0xe0, 0x11, 0x40, 0x02, 0x08, 0xd0, 0x0a, 0x4a, 0x88, 
+    0x0a, 0x4b, 0x0a, 0xd5, 0xc0, 0x0a, 0x49, 0x08, 0x87, 0x60, 0x08, 0x0c, 
+    0x70, 0x09, 0x17, 0x00, 0x01, 0x00, 0x07, 0xd0, 0x88, 0x04, 0x4b, 0x0a, 
+    0x97, 0x60, 0x03, 0x48, 0x01, 0x03, 0x00, 0x80, 0x02, 0x70, 0x01, 0x20, 
+    0x10, 0xbd, 0xcc, 0x8b, 0x80, 0x2a, 0x2d, 0x93, 0xe0, 0x2c, 0x97, 0xe0, 
+    0x09, 0x7f, 0x40, 0x11, 0x06, 0x80, 0xfb, 0xd5, 0x08, 0x48, 0x81, 0x21, 
+    0xff, 0x83, 0x62, 0x40, 0x01, 0x2c, 0x70, 0x21, 0x80, 0x20, 0x21, 0x60, 
+    0x70, 0x1a, 0x02, 0x9b, 0x40, 0x12, 0x1b, 0x00, 0xb3, 0x41, 0x00, 0x00, 
+    0x02, 0x74, 0x40, 0x07, 0x03, 0x00, 0x01, 0x81, 0x40, 0xc3, 0x41, 0x43, 
+    0x01, 0xf0, 0x00, 0xb5, 0x9c, 0x18, 0xb4, 0xf5, 0x80, 0x6f, 0x05, 0x00, 
+    0x9e, 0x01, 0xd8, 0x8c, 0x42, 0x04, 0xd9, 0x26, 0x01, 0x7f, 0x00, 0x19, 
+    0x70, 0x08, 0x22, 0x20, 0xe0, 0x25, 0x00, 0x4d, 0xaa, 0x18, 0x00, 0x25, 
+    0x9d, 0x42, 0x03, 0x00, 0xd0, 0x77, 0x5d, 0x57, 0x55, 0x01, 0x35, 0xf9, 
+    0x40, 0xe7, 0x8c, 0x42, 0x3b, 0xd1, 0x1e, 0xeb, 0x40, 0x02, 0x80, 0x2a, 
+    0x05, 0xd0, 0x05, 0x2a, 0x03, 0xd0, 0x93, 0x01, 0x00, 0x0f, 0x22, 0x0b, 
+    0xe0, 0x1b, 0x49, 0x19, 0x4a, 0x00, 0x0b, 0x78, 0x13, 0xf0, 0x80, 0x0f, 
+    0x02, 0xd0, 0x40, 0x19, 0x4e, 0x33, 0x78, 0x33, 0xb1, 0xc3, 0x01, 0x0e, 
+    0x04, 0x22, 0x17, 0xab, 0x00, 0x00, 0x20, 0xf0, 0xbd, 0x24, 0x00, 0xb9, 
+    0x15, 0x48, 0x06, 0x23, 0x13, 0x70, 0x04, 0x00, 0x70, 0x1b, 0xe0, 0x84, 
+    0x02, 0x13, 0x48, 0x04, 0x00, 0xf5, 0x80, 0x54, 0x04, 0x60, 0x01, 0x25, 
+    0x11, 0x00, 0x48, 0x35, 0x70, 0x09, 0x26, 0x06, 0x70, 0xc4, 0x80, 0xf3, 
+    0x07, 0x46, 0x24, 0x0a, 0xe4, 0xb2, 0xb7, 0x00, 0x00, 0x6c, 0x00, 0xf8, 
+    0x02, 0x4c, 0x00, 0xf8, 0x03, 0x54, 0x3c, 0x70, 0xcd, 0x60, 0x80, 0xd1, 
+    0x60, 0x03, 0xe3, 0xe0, 0x05, 0x0d, 0x83, 0x80, 0x01, 0x47, 0x00, 0xf3, 
+    0x01, 0x00, 0x00, 0x00, 0x14, 0x37, 0xc7, 0x01, 0xf7, 0x01, 0xff, 0x01, 
+    0x28, 0x87, 0x60, 0xd3, 0x01, 0x2c, 0x4a, 0x00, 0xf8, 0xb5, 0x13, 0x78, 
+    0x03, 0x2b, 0x04, 0x46, 0x00, 0x42, 0xd3, 0x04, 0x2b, 0x08, 0xd9, 0x06, 
+    0x2b, 0x00, 0x3e, 0xd1, 0x07, 0x20, 0x10, 0x70, 0x27, 0x4a, 0x00, 0x4f, 
+    0xf4, 0x7a, 0x71, 0x11, 0x60, 0x37, 0xe0, 0x00, 0x26, 0x4d, 0x26, 0x4e, 
+    0x2f, 0x78, 0x30, 0x78, 0x00, 0x01, 0x2f, 0x02, 0xd0, 0x02, 0x2f, 0x24, 
+    0xd1, 0x08, 0x1e, 0xe0, 0x04, 0x73, 0xa0, 0x35, 0xff, 0xf8, 0xb9, 0x00, 
+    0x21, 0x49, 0x22, 0x4a, 0x02, 0x23, 0x2b, 0x70, 0x18, 0x0b, 0x68, 0x0b, 
+    0xaf, 0x80, 0x49, 0x80, 0x41, 0x02, 0xf8, 0x04, 0x01, 0x1c, 0x51, 0x80, 
+    0x21, 0xdb, 0xb2, 0x02, 0xf8, 0x08, 0x02, 0x1c, 0x02, 0x8f, 0x00, 0x1a, 
+    0x4a, 0x80, 0x21, 0x02, 0x17, 0xf1, 0x80, 0x01, 0x0c, 0x70, 0x20, 0x30, 
+    0x70, 0x20, 0x31, 0x70, 0x04, 0xe0, 0x07, 0xb1, 0xa0, 0x16, 0xff, 0x20, 
+    0x00, 0xb9, 0x28, 0x70, 0x0d, 0xff, 0x60, 0x0a, 0x2a, 0x08, 0x06, 0xd0, 
+    0x0d, 0x03, 0xa0, 0x09, 0xb9, 0x05, 0x22, 0x00, 0x00, 0xe0, 0x04, 0x22, 
+    0x1a, 0x70, 0x0f, 0x4b, 0x02, 0x08, 0x35, 0x80, 0x0b, 0x68, 0x06, 0x49, 
+    0x20, 0x70, 0x00, 0x1a, 0x0a, 0x18, 0x0c, 0x63, 0x70, 0x0b, 0x78, 0x02, 
+    0xa2, 0xeb, 0x20, 0xe0, 0x70, 0x23, 0x71, 0x62, 0x71, 0xe8, 0x01, 0x20, 
+    0xf8, 0xc3, 0x22, 0xd0, 0x53, 0xc0, 0xc3, 0x21, 0x9b, 0x21, 0x0d, 0xcb, 
+    0x05, 0x0b, 0xa7, 0x20, 0xdb, 0x21, 0x08, 0x4b, 0x09, 0x48, 0x01, 0x59, 
+    0x01, 0x05, 0xd1, 0x02, 0x22, 0x00, 0x21, 0x01, 0xa1, 0xb1, 0xa0, 0x01, 
+    0x20, 0x70, 0x47, 0x9f, 0x21, 0x0f, 0x9f, 0xa1, 0x07, 0x0b, 0x00, 0xc3, 
+    0x23, 0x07, 0x41, 0x03, 0x4b, 0x04, 0x49, 0x00, 0x30, 0x20, 0x02, 0x22, 
+    0x08, 0x25, 0x04, 0x1f, 0x45, 0x01, 0xb4, 0x80, 0x02, 0x48, 0x84, 0x46, 
+    0x01, 0xbc, 0x60, 0xb3, 0x80, 0x90, 0x61, 0x02, 0x00, 0x00, 0x0f, 0x09, 
+    0x55, 0x03, 0x0f, 0x0b, 0x2a, 0x91, 0x0f, 0x0c, 0xf1, 0x2f, 0x0c, 0x6b, 
+    0x2f, 0x00, 0x00, 0x01, 0xa8, 0x00, 0x00, 0x1c, 0x07, 0xe0, 0x12, 0x88, 
+    0x20, 0x00, 0x4f, 0x00, 0x5a, 0x40, 0x13, 0xe0, 0x1b, 0x0b, 0x01, 0x4b, 
+    0x00, 0xc0, 0x9f, 0x23, 0x00, 0xaa, 0x01, 0x57, 0x00, 0x2e, 0x0b, 0x04, 
+    0x02, 0x63, 0x00, 0x96, 0x17, 0x04, 0x9a, 0xee, 0x6f, 0x00, 0x5c, 0x23, 
+    0x04, 0x03, 0x09, 0x12, 0x01, 0x49, 0x01, 0x00, 0x00, 0x40, 0x50, 0x1d, 
+    0x82, 0x60, 0x01, 0x01, 0x00, 0x01, 0x02, 0x00, 0x01, 0x12, 0x03, 0x73, 
+    0x00, 0x00, 0x63, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x6c, 0x00, 0x00, 0x69, 
+    0x00, 0x6d, 0x00, 0x65, 0x00, 0x09, 0x02, 0x84, 0x1b, 0x00, 0x1a, 0x00, 
+    0x80, 0x32, 0x09, 0x04, 0x02, 0x40, 0x00, 0xfe, 0x01, 0x02, 0x02, 0x09, 
+    0x21, 0x0d, 0x10, 0x00, 0x27, 0x00, 0x04, 0x01, 0x01, 0x00, 0x12, 0x03, 
+    0x00, 0x4d, 0x00, 0x53, 0x00, 0x46, 0x00, 0x54, 0x00, 0x88, 0x31, 0x00, 
+    0x30, 0x01, 0x00, 0x7e, 0x00, 0x28, 0x86, 0x02, 0x06, 0x04, 0xac, 0x01, 
+    0x6c, 0x03, 0x01, 0x57, 0x49, 0x4e, 0x55, 0x44, 0x53, 0x42, 0x79, 0x0d, 
+    0x2a, 0x03, 0x46, 0x65, 0x00, 0x64, 0x03, 0x5f, 0x00, 0x6d, 0x03, 0x64, 
+    0x00, 0x79, 0x00, 0x20, 0x00, 0xa8, 0x42, 0x00, 0x6f, 0x01, 0x00, 0x74, 
+    0x7b, 0x00, 0x6f, 0x1d, 0x04, 0x00, 0x72, 0x00, 0x04, 0x03, 0x09, 0x04, 
+    0x46, 0x43, 0x60, 0x2d, 0x42, 0x6f, 0x6f, 0x74, 0xac, 0x02, 0x59, 0x01, 
+    0xff, 0xff, 0x00, 0x1f, 0x22, 0x1f, 0x44, 0x1f, 0x66, 0x1f, 0x88, 0x1f, 
+    0xaa, 0x1f, 0xcc, 0x1f, 0xee, 0x1f, 0x83, 0x10, 0x28, 0x0b, 0xa1, 0x0d, 
+    0x11, 0x00, 0x00, 0xfb, 0x17, 0xa0, 0x5d, 0x03, 0x0d, 0xf9, 0x03, 0x0c, 
+    0x17, 0x09, 0x2f, 0x01, 0xfd, 0x33, 0x0c, 0x21, 0xe6, 0x44, 0x47, 0x13, 
+    0x13, 0x19, 0x59, 0x1e, 0x33, 0x1f, 0x53, 0x1f, 0xbf, 0x03, 0x0c, 0xb5, 
+    0x16, 0x7f, 0x1f, 0xe7, 0x05, 0xfe, 0xe7, 0xfe, 0xe7, 0x41, 0x73, 0xa0, 
+    0x68, 0x50, 0x1c, 0x18, 0x60, 0x73, 0xa1, 0xe0, 0x00, 0x07, 0x00, 0x20, 
+    0x10, 0xb5, 0x00, 0x23, 0x20, 0x80, 0x4a, 0x21, 0x49, 0x98, 0x18, 0x88, 
+    0x42, 0xa9, 0xc0, 0x00, 0x49, 0x58, 0x58, 0x98, 0x50, 0x04, 0x33, 0xf5, 
+    0x00, 0xe7, 0x1e, 0x48, 0x1f, 0x4c, 0xa0, 0x42, 0x03, 0x00, 0xd2, 0x00, 
+    0x24, 0x40, 0xf8, 0x04, 0x4b, 0xf8, 0x00, 0xe7, 0x1c, 0x4b, 0x4b, 0xf6, 
+    0x7f, 0x32, 0x07, 0x00, 0x20, 0x1a, 0x60, 0x43, 0xf8, 0x04, 0x0c, 0x1a, 
+    0x10, 0x4c, 0x21, 0x78, 0x0a, 0xd5, 0xa0, 0x19, 0x4a, 0x81, 0x29, 0x3b, 
+    0xa0, 0xff, 0x20, 0xd1, 0xa0, 0x23, 0x7f, 0x81, 0x21, 0x70, 0x80, 0x23, 
+    0x70, 0x13, 0x4c, 0x22, 0x78, 0x13, 0xf1, 0xa0, 0x20, 0x13, 0x49, 0x13, 
+    0x48, 0x81, 0x41, 0x01, 0x22, 0x41, 0x00, 0xf8, 0x04, 0x2b, 0xf8, 0xe7, 
+    0x62, 0xb6, 0x00, 0x00, 0xf0, 0x64, 0xf8, 0x0f, 0x4c, 0x10, 0x49, 0x8c, 
+    0x01, 0xb7, 0xa0, 0x54, 0xf8, 0x04, 0x3b, 0x98, 0x47, 0xf8, 0x80, 0xe7, 
+    0x01, 0xf0, 0x3a, 0xf8, 0xfe, 0xe7, 0x8b, 0x03, 0x21, 0x8f, 0x01, 0x00, 
+    0x48, 0x00, 0x00, 0x97, 0x01, 0xec, 0x1c, 0xc0, 0x00, 0x20, 0x14, 0xe0, 
+    0x00, 0xe0, 0x17, 0xc5, 0x5b, 0xa2, 0xe0, 0x08, 0x00, 0x14, 0xfc, 0x47, 
+    0x65, 0xa0, 0x23, 0x00, 0x27, 0xc0, 0x02, 0x68, 0x37, 0xc2, 0xd0, 0x03, 
+    0x40, 0x04, 0x4b, 0x05, 0x00, 0x49, 0x00, 0x22, 0x1a, 0x60, 0x0a, 0x60, 
+    0x04, 0xa0, 0x4a, 0x10, 0x60, 0x10, 0x20, 0xdd, 0x01, 0x14, 0x17, 0x01, 
+    0x03, 0x1b, 0x00, 0x1f, 0x01, 0x00, 0x28, 0x0e, 0xdb, 0x02, 0x02, 0x00, 
+    0x4f, 0xf4, 0x80, 0x73, 0xb2, 0xf5, 0x00, 0x4f, 0x00, 0x06, 0xd3, 0x01, 
+    0x3b, 0x01, 0x2b, 0xc0, 0xeb, 0x00, 0x02, 0x01, 0x01, 0xd0, 0x0a, 0x46, 
+    0xf5, 0xe7, 0x40, 0x10, 0x0a, 0x10, 0xe0, 0x40, 0x42, 0x1f, 0x05, 0x01, 
+    0x01, 0x1f, 0x0e, 0x11, 0x0a, 0xc1, 0xf5, 0x80, 0x70, 0x01, 0x00, 0x3b, 
+    0x02, 0x49, 0x40, 0xea, 0x03, 0x20, 0x08, 0x05, 0x39, 0x20, 0x0c, 0x73, 
+    0x00, 0x10, 0x4b, 0x11, 0x4a, 0x00, 0x00, 0x20, 0x4b, 0xf6, 0xff, 0x71, 
+    0x10, 0xb5, 0x18, 0x00, 0x60, 0x0f, 0x4c, 0x59, 0x60, 0x28, 0x23, 0x13, 
+    0x00, 0x60, 0x93, 0x60, 0x13, 0x61, 0x93, 0x61, 0x13, 0x00, 0x62, 0x93, 
+    0x62, 0x13, 0x63, 0x93, 0x63, 0x09, 0x00, 0x22, 0x22, 0x60, 0x09, 0x4c, 
+    0x20, 0x60, 0x09, 0x00, 0x48, 0x01, 0x60, 0x09, 0x49, 0x0b, 0x60, 0x8b, 
+    0x02, 0x60, 0x0d, 0xe0, 0x60, 0xbd, 0xe8, 0x10, 0x40, 0x00, 0x00, 0xf0, 
+    0x31, 0xbc, 0x00, 0xbf, 0x04, 0x80, 0x03, 0x14, 0x40, 0x0c, 0x03, 0x00, 
+    0x00, 0x07, 0x00, 0x04, 0x90, 0x03, 0xd4, 0x40, 0x08, 0x03, 0x00, 0x0c, 
+    0x07, 0x00, 0x00, 0x0b, 0x00, 0x97, 0x21, 0x00, 0x4f, 0xf4, 0x37, 0x72, 
+    0x42, 0xfa, 0x03, 0xf2, 0x00, 0x91, 0x42, 0x02, 0xd8, 0x01, 0x33, 0x07, 
+    0x2b, 0x10, 0xf6, 0xd1, 0x16, 0x4a, 0x0f, 0x01, 0x02, 0xeb, 0x51, 0x00, 
+    0x02, 0xb2, 0xfb, 0xf1, 0xf1, 0x01, 0x39, 0x4f, 0x00, 0xf6, 0xff, 0x72, 
+    0x91, 0x42, 0x28, 0xbf, 0x11, 0x00, 0x46, 0xc2, 0x1e, 0x01, 0x2a, 0x06, 
+    0xd8, 0x0f, 0x08, 0x4a, 0x0f, 0x4c, 0xd3, 0x20, 0x60, 0x20, 0x60, 0x0e, 
+    0x20, 0x48, 0x0f, 0xe0, 0x42, 0x1f, 0x13, 0x00, 0xd9, 0x09, 0x00, 0x28, 
+    0x04, 0xd0, 0x0a, 0x28, 0x02, 0xd0, 0x14, 0x00, 0x38, 0x03, 0x28, 0x09, 
+    0xd8, 0x09, 0x4a, 0x0a, 0x01, 0x21, 0x04, 0x09, 0x48, 0x43, 0xf0, 0x08, 
+    0x03, 0x01, 0x20, 0x60, 0x13, 0x60, 0x10, 0xbd, 0x7f, 0xe0, 0x6c, 0xdc, 
+    0x5e, 0x02, 0x77, 0x01, 0x87, 0x05, 0x93, 0x02, 0x9f, 0x00, 0x08, 0xa3, 
+    0x00, 0x21, 0x02, 0x28, 0xe3, 0x00, 0xd8, 0x0d, 0x4a, 0x52, 0xf8, 0x30, 
+    0x00, 0x30, 0x93, 0xf8, 0x80, 0x42, 0x3c, 0xb1, 0x01, 0x00, 0x20, 0x11, 
+    0xb1, 0x83, 0xf8, 0x80, 0x00, 0x10, 0x00, 0xbd, 0x83, 0xf8, 0x00, 0x01, 
+    0x10, 0xbd, 0x02, 0x00, 0xeb, 0xc0, 0x00, 0x43, 0x68, 0x1a, 0x68, 0x11, 
+    0x00, 0xb1, 0x42, 0xf0, 0x03, 0x01, 0x01, 0xe0, 0x22, 0x50, 0xf0, 0x02, 
+    0x01, 0x19, 0x57, 0x02, 0xf0, 0x1f, 0x60, 0x21, 0x00, 0x28, 0x05, 0xd8, 
+    0x03, 0x4b, 0x53, 0xf8, 0x30, 0xe0, 0x00, 0x90, 0xf8, 0x00, 0x02, 0xed, 
+    0xe0, 0x29, 0xc0, 0x17, 0x03, 0x10, 0x16, 0xd8, 0x0b, 0x4a, 0x3b, 0x00, 
+    0x03, 0x01, 0x29, 0x04, 0x5b, 0x68, 0x5d, 0x00, 0x20, 0x04, 0xd1, 0x82, 
+    0xf8, 0x00, 0x80, 0x12, 0x4f, 0xf4, 0xa2, 0x71, 0x08, 0xe0, 0x44, 0x00, 
+    0x20, 0x0b, 0x00, 0x02, 0x11, 0xb9, 0xb7, 0x20, 0x71, 0x80, 0x01, 0xe0, 
+    0x40, 0xf2, 0x03, 0x11, 0x19, 0xb5, 0x40, 0x01, 0x4f, 0x01, 0x00, 0x29, 
+    0x10, 0xb5, 0x04, 0x46, 0x01, 0x00, 0xdc, 0x00, 0x21, 0x5e, 0xe0, 0xff, 
+    0x29, 0x01, 0x00, 0xd9, 0x01, 0x21, 0x5a, 0xe0, 0xc2, 0x1e, 0xd3, 0x00, 
+    0xb2, 0x01, 0x2b, 0x94, 0xbf, 0x2f, 0x4b, 0x30, 0x01, 0x19, 0x40, 0x43, 
+    0x1c, 0x4b, 0x43, 0x1b, 0x0a, 0x14, 0x00, 0x2a, 0x49, 0xd8, 0xdf, 0xe8, 
+    0x02, 0xf0, 0x0b, 0x00, 0x11, 0x17, 0x1d, 0x48, 0x48, 0x23, 0x29, 0x48, 
+    0x01, 0x00, 0x05, 0x2f, 0x35, 0x3b, 0x41, 0x00, 0x27, 0x48, 0x00, 0x4f, 
+    0xf4, 0x51, 0x72, 0x03, 0x60, 0x26, 0x48, 0x00, 0x34, 0xe0, 0x26, 0x4a, 
+    0x26, 0x48, 0x13, 0x60, 0x01, 0x0f, 0x01, 0x2e, 0xe0, 0x25, 0x49, 0x25, 
+    0x48, 0x0b, 0x00, 0x60, 0x40, 0xf2, 0x44, 0x42, 0x28, 0xe0, 0x24, 0x02, 
+    0x48, 0x07, 0x01, 0x03, 0x60, 0x23, 0x48, 0x22, 0xe0, 0x18, 0x23, 0x4a, 
+    0x23, 0x23, 0x00, 0x17, 0x01, 0x1c, 0xe0, 0x22, 0x44, 0x49, 0x22, 0x23, 
+    0x04, 0x16, 0xe0, 0x21, 0x23, 0x04, 0x20, 0x40, 0x48, 0x10, 0xe0, 0x20, 
+    0x4a, 0x20, 0x23, 0x04, 0x0a, 0x10, 0xe0, 0x1f, 0x49, 0x1f, 0x47, 0x04, 
+    0x04, 0xe0, 0x1e, 0x14, 0x49, 0x1e, 0x53, 0x04, 0x02, 0x6d, 0x20, 0x7f, 
+    0x29, 0x20, 0x18, 0x46, 0xd4, 0xbf, 0x35, 0xe0, 0xe3, 0xe0, 0x51, 0xff, 
+    0x20, 0x08, 0x46, 0x01, 0x21, 0x13, 0x41, 0xff, 0xf7, 0x77, 0xbf, 0x2c, 
+    0x00, 0xbf, 0x03, 0x41, 0x73, 0x21, 0x10, 0x0f, 0x40, 0x30, 0x90, 0xa8, 
+    0x04, 0x40, 0x18, 0x17, 0x40, 0x34, 0x07, 0x00, 0x48, 0x2b, 0x40, 0x60, 
+    0x1c, 0xc0, 0x04, 0x40, 0x30, 0x1b, 0x01, 0x07, 0x00, 0x20, 0x61, 0x3b, 
+    0x41, 0xb0, 0x04, 0x40, 0x28, 0x2b, 0x01, 0x07, 0x00, 0x38, 0x55, 0x4b, 
+    0x40, 0x14, 0x1f, 0x00, 0x40, 0x53, 0x40, 0x18, 0x27, 0x00, 0x10, 0x1b, 
+    0x53, 0x41, 0x1f, 0x00, 0x18, 0xc3, 0x21, 0x27, 0x00, 0x72, 0xb6, 0x0b, 
+    0x00, 0x4b, 0x0b, 0x48, 0x0c, 0x49, 0x1a, 0x68, 0x03, 0x00, 0x68, 0x08, 
+    0x68, 0x62, 0xb6, 0x41, 0x01, 0x02, 0x00, 0xd5, 0x32, 0x2a, 0x88, 0xbf, 
+    0x01, 0x33, 0xc2, 0x80, 0xf5, 0x3b, 0x42, 0x7f, 0x32, 0x30, 0x21, 0x51, 
+    0x40, 0x00, 0xf2, 0x4f, 0xf4, 0x7a, 0x70, 0x00, 0xfb, 0x03, 0x0d, 0xc9, 
+    0xe0, 0x18, 0x7b, 0x60, 0x1f, 0x81, 0x04, 0xed, 0x00, 0xe0, 0x02, 0x38, 
+    0x6d, 0x20, 0xff, 0xf7, 0xde, 0xff, 0x05, 0x46, 0x00, 0x54, 0xb1, 0xff, 
+    0xf7, 0xda, 0xff, 0x40, 0x1b, 0x00, 0xb0, 0xf5, 0x7a, 0x7f, 0xf9, 0xd3, 
+    0x01, 0x3c, 0x00, 0x02, 0xd0, 0x05, 0xf5, 0x7a, 0x75, 0xf4, 0xe7, 0x00, 
+    0x38, 0xbd, 0x1f, 0xb5, 0x17, 0x4b, 0x17, 0x49, 0x20, 0x22, 0x22, 0x03, 
+    0x20, 0x58, 0xe5, 0xe0, 0x0c, 0x68, 0x00, 0x15, 0x4b, 0x03, 0x94, 0x1a, 
+    0x68, 0x15, 0x48, 0x00, 0x02, 0x92, 0x01, 0x68, 0x14, 0x4c, 0x01, 0x91, 
+    0x00, 0x23, 0x68, 0x00, 0x93, 0x13, 0x4b, 0x00, 0x22, 0x00, 0x1d, 0xf8, 
+    0x02, 0x00, 0x12, 0x49, 0x43, 0x40, 0x00, 0x01, 0x32, 0x4b, 0x43, 0x10, 
+    0x2a, 0xf7, 0xd1, 0x01, 0x11, 0x02, 0x40, 0x0e, 0x48, 0x07, 0x49, 0x63, 
+    0x40, 0x00, 0x43, 0x43, 0x01, 0xeb, 0x42, 0x00, 0x1a, 0x21, 0x00, 0xb3, 
+    0xfb, 0xf1, 0xf4, 0x01, 0xfb, 0x14, 0x31, 0x00, 0x01, 0x32, 0x41, 0x31, 
+    0x10, 0x2a, 0x41, 0x80, 0x10, 0xed, 0xd1, 0x1f, 0xbd, 0xff, 0x61, 0x54, 
+    0x80, 0x04, 0x54, 0x40, 0x58, 0x03, 0x00, 0x5c, 0x07, 0x00, 0x60, 0x0b, 
+    0x00, 0xc5, 0x00, 0x9d, 0x1c, 0x81, 0x93, 0x01, 0x00, 0x01, 0x70, 0x00, 
+    0xb5, 0x13, 0x4c, 0x94, 0xf8, 0x80, 0x20, 0x04, 0x00, 0xf1, 0x40, 0x05, 
+    0x00, 0x2a, 0x08, 0xbf, 0x25, 0x10, 0x46, 0x00, 0x23, 0x8b, 0x63, 0x80, 
+    0xc6, 0x5c, 0xee, 0x00, 0x54, 0x01, 0x33, 0xf9, 0xe7, 0x94, 0xf8, 0x81, 
+    0x00, 0x10, 0x00, 0x29, 0x0c, 0xbf, 0x88, 0x20, 0xc8, 0x02, 0x20, 0xc3, 
+    0x60, 0x43, 0x42, 0xf0, 0x02, 0x05, 0x07, 0x00, 0x48, 0x40, 0xf8, 0x35, 
+    0x30, 0x05, 0x4b, 0x81, 0x00, 0xf0, 0x01, 0x01, 0x82, 0xf0, 0x01, 0x02, 
+    0x83, 0x53, 0x23, 0x00, 0xd1, 0x40, 0x20, 0x70, 0x0b, 0x60, 0xe4, 0x87, 
+    0x81, 0xe0, 0x08, 0xff, 0x1f, 0x70, 0x65, 0x40, 0x12, 0x4e, 0x56, 0xf8, 
+    0x00, 0x34, 0x30, 0x06, 0xeb, 0xc0, 0x05, 0x19, 0x0c, 0x00, 0x68, 0x68, 
+    0x14, 0xd0, 0x20, 0xf8, 0x04, 0x1d, 0x00, 0x00, 0xf0, 0xd8, 0xfd, 0x58, 
+    0xb9, 0x72, 0xb6, 0x00, 0x0c, 0x49, 0x01, 0x20, 0x91, 0xf8, 0x82, 0x30, 
+    0x00, 0x00, 0xfa, 0x04, 0xf4, 0x1c, 0x43, 0x81, 0xf8, 0x10, 0x82, 0x40, 
+    0x62, 0xb6, 0x3f, 0x00, 0xf0, 0x99, 0xfa, 0x00, 0x04, 0x30, 0x68, 0x60, 
+    0x06, 0x4b, 0x06, 0x4a, 0x00, 0x15, 0xf0, 0x08, 0x0f, 0x08, 0xbf, 0x13, 
+    0x46, 0x1e, 0x46, 0x43, 0x00, 0x59, 0x00, 0x53, 0x00, 0x5b, 0x01, 0xc8, 
+    0x00, 0x40, 0x04, 0x00, 0x88, 0x03, 0x00, 0x38, 0xb5, 0x72, 0xb6, 0x08, 
+    0x10, 0x4b, 0x00, 0x25, 0x93, 0x39, 0x00, 0x83, 0xf8, 0x82, 0x00, 0x50, 
+    0x62, 0xb6, 0x3c, 0xb1, 0xe3, 0x07, 0x02, 0x04, 0xd5, 0x28, 0x6d, 0x20, 
+    0xc1, 0xff, 0x01, 0x35, 0x64, 0x0c, 0x08, 0xf6, 0x59, 0x20, 0x8f, 0x03, 
+    0xf8, 0xb5, 0xb7, 0x4a, 0x00, 0x13, 0x78, 0x03, 0xf0, 0x04, 0x01, 0xc8, 
+    0xb2, 0x00, 0x08, 0xb1, 0x04, 0x21, 0x11, 0x70, 0x03, 0xf0, 0x00, 0x08, 
+    0x02, 0xd2, 0xb2, 0x00, 0x2a, 0x00, 0xf0, 0x00, 0xb4, 0x81, 0xb1, 0x48, 
+    0x02, 0x78, 0x11, 0x09, 0x00, 0x0b, 0x46, 0x00, 0x29, 0x40, 0xf0, 0xa2, 
+    0x81, 0x20, 0x90, 0x08, 0xae, 0x4d, 0x55, 0x4d, 0x60, 0x05, 0xeb, 0x00, 
+    0xc0, 0x06, 0xc2, 0xf3, 0x83, 0x02, 0x09, 0x2a, 0x00, 0x76, 0x68, 0x00, 
+    0xf0, 0x6c, 0x81, 0x0d, 0x2a, 0x00, 0x06, 0xd0, 0x01, 0x2a, 0x40, 0xf0, 
+    0x8d, 0x81, 0x00, 0xa7, 0x49, 0x45, 0xf8, 0x30, 0x10, 0x88, 0xe1, 0x00, 
+    0xa6, 0x4c, 0x32, 0x68, 0x76, 0x68, 0xc4, 0xf8, 0x00, 0x8c, 0x20, 0xc4, 
+    0xf8, 0x90, 0x60, 0xa1, 0x4e, 0x10, 0xc4, 0xf8, 0x94, 0x10, 0x19, 0x00, 
+    0x60, 0x01, 0x20, 0x00, 0x84, 0xf8, 0x81, 0x00, 0x92, 0xb2, 0x00, 0xf5, 
+    0x00, 0x68, 0x70, 0x82, 0x42, 0x00, 0xf0, 0xd4, 0x80, 0x00, 0x1a, 0xd8, 
+    0xb2, 0xf5, 0x81, 0x7f, 0x00, 0xf0, 0x00, 0x82, 0x80, 0x07, 0xd8, 0x80, 
+    0x2a, 0x60, 0xd0, 0x20, 0x82, 0x2a, 0x63, 0xd0, 0x21, 0x4b, 0x00, 0xee, 
+    0x80, 0x00, 0xe3, 0xe0, 0xb2, 0xf5, 0xe0, 0x7f, 0xc0, 0xf0, 0x20, 0xe9, 
+    0x80, 0xb2, 0xf5, 0xe1, 0x07, 0x00, 0xa8, 0x80, 0x00, 0x40, 0xf2, 0x02, 
+    0x33, 0x9a, 0x42, 0x40, 0xf0, 0x08, 0xe0, 0x80, 0x7b, 0xb7, 0x60, 0x81, 
+    0x60, 0x82, 0x42, 0x82, 0x0d, 0x3d, 0x00, 0xd0, 0x6f, 0x80, 0xf0, 0x87, 
+    0x23, 0x00, 0x20, 0xa0, 0x6f, 0x00, 0xf0, 0xd7, 0x23, 0x00, 0xa1, 0x53, 
+    0x11, 0x23, 0x01, 0xce, 0x80, 0xb9, 0x3f, 0x00, 0x10, 0x6f, 0x12, 0x04, 
+    0xd0, 0x0a, 0x61, 0x00, 0x08, 0x6f, 0x40, 0xf0, 0xc5, 0x04, 0x80, 0x80, 
+    0xcd, 0x20, 0x98, 0x60, 0x01, 0x23, 0x04, 0x00, 0xf8, 0x83, 0x6f, 0xc8, 
+    0xe0, 0xa2, 0xf5, 0xfd, 0x00, 0x42, 0x40, 0x3a, 0x01, 0x2a, 0x00, 0xf2, 
+    0xb8, 0x00, 0x80, 0x83, 0xe0, 0x94, 0xf8, 0x8e, 0x00, 0x84, 0x00, 0xf8, 
+    0x98, 0x00, 0x2c, 0x6a, 0x20, 0x06, 0x03, 0x00, 0xd5, 0x68, 0x6a, 0x08, 
+    0x38, 0x00, 0xf0, 0x07, 0x00, 0xfa, 0x75, 0x4d, 0x75, 0x4a, 0x2e, 0x78, 
+    0x06, 0x81, 0xcf, 0x80, 0xd9, 0xb2, 0x16, 0x70, 0x61, 0xb1, 0x61, 0x00, 
+    0x00, 0xf9, 0x6d, 0x4c, 0x71, 0x4d, 0x04, 0x30, 0x60, 0x00, 0x62, 0x25, 
+    0x62, 0x00, 0xf0, 0xd0, 0xf9, 0x6a, 0x00, 0x4a, 0x06, 0x1d, 0xe6, 0x62, 
+    0xa2, 0x62, 0x67, 0x00, 0x49, 0x00, 0x23, 0x0b, 0x63, 0x8b, 0x63, 0x95, 
+    0x00, 0xe0, 0x84, 0xf8, 0x83, 0x10, 0x84, 0xf8, 0x84, 0x00, 0x10, 0x92, 
+    0xe0, 0x64, 0x4c, 0xb4, 0xf8, 0x90, 0x00, 0x00, 0x01, 0x28, 0x00, 0xf2, 
+    0x87, 0x80, 0x65, 0x80, 0x4a, 0x86, 0x00, 0x00, 0x25, 0xb3, 0x18, 0x1d, 
+    0x00, 0x02, 0x50, 0x1d, 0x00, 0x50, 0x19, 0x78, 0x01, 0xf0, 0x02, 0x00, 
+    0x00, 0xc5, 0xb2, 0x00, 0x2d, 0x7e, 0xd0, 0x01, 0x42, 0x26, 0x91, 0x01, 
+    0x02, 0x23, 0x7e, 0xe0, 0x2f, 0x01, 0x00, 0x00, 0xf0, 0x7f, 0x02, 0x01, 
+    0x2a, 0x6d, 0xdc, 0xb4, 0x00, 0xf8, 0x8e, 0x30, 0x00, 0x2b, 0x69, 0xd1, 
+    0x57, 0x00, 0x4d, 0x84, 0x00, 0x66, 0x19, 0x31, 0x78, 0x21, 0x00, 0xf0, 
+    0x02, 0x02, 0x10, 0xe0, 0x4f, 0x48, 0xb0, 0x80, 0xf8, 0x90, 0x20, 0x02, 
+    0xf0, 0x7f, 0x01, 0xdb, 0x80, 0x04, 0xdc, 0xb0, 0x23, 0x02, 0x57, 0xd1, 
+    0x4e, 0x4d, 0x94, 0x11, 0x23, 0x00, 0x30, 0x78, 0x40, 0x23, 0x00, 0x32, 
+    0x70, 0x53, 0x11, 0x47, 0x00, 0x8e, 0x20, 0x4a, 0x19, 0xa0, 0x08, 0x4c, 
+    0xa3, 0x00, 0xf1, 0x0c, 0x01, 0x00, 0x2c, 0x46, 0xd0, 0x0c, 0x00, 0x33, 
+    0x33, 0xf8, 0x18, 0x0c, 0x90, 0x42, 0xf4, 0x00, 0xd1, 0x15, 0x0a, 0x03, 
+    0x2d, 0x15, 0xd0, 0x0b, 0x00, 0x89, 0x47, 0xe0, 0x3c, 0x4b, 0xb3, 0xf8, 
+    0x90, 0x00, 0x10, 0x11, 0xb1, 0x01, 0x29, 0x36, 0xd1, 0x3e, 0x00, 0xe0, 
+    0x04, 0x23, 0x3e, 0x4c, 0x3d, 0xe0, 0x37, 0x01, 0x13, 0x02, 0x04, 0x29, 
+    0x01, 0xd1, 0x3c, 0x4c, 0x02, 0x00, 0xe0, 0x05, 0x29, 0x29, 0xd1, 0x3b, 
+    0x4c, 0x23, 0x04, 0x78, 0x31, 0x99, 0x01, 0x30, 0x01, 0x2b, 0x22, 0xd1, 
+    0x48, 0x94, 0xf8, 0x99, 0x27, 0x20, 0x84, 0x30, 0xe5, 0x03, 0x85, 0x15, 
+    0xe9, 0x00, 0x86, 0xed, 0x00, 0x87, 0x3b, 0x20, 0x88, 0x10, 0x06, 0xb0, 
+    0x23, 0x19, 0xe0, 0x27, 0xf3, 0x01, 0x29, 0x00, 0x0d, 0x29, 0x01, 0x22, 
+    0x60, 0x69, 0x21, 0x13, 0xe0, 0x22, 0x67, 0x02, 0x01, 0x29, 0x00, 0x03, 
+    0xd1, 0x83, 0xf8, 0x99, 0x10, 0x00, 0x23, 0x02, 0x03, 0x11, 0x00, 0x0f, 
+    0x21, 0x19, 0x70, 0x2d, 0xe0, 0x00, 0x1c, 0x46, 0x04, 0xe0, 0x02, 0x23, 
+    0x83, 0x34, 0x01, 0xd9, 0xa0, 0x4c, 0x04, 0x23, 0x18, 0x4d, 0xb5, 0xf8, 
+    0x00, 0x92, 0x60, 0xb3, 0x42, 0x38, 0xbf, 0x1e, 0x46, 0x00, 0x40, 0x2e, 
+    0x34, 0xbf, 0x35, 0x46, 0x40, 0x25, 0x08, 0x20, 0x46, 0x29, 0x23, 0x80, 
+    0x3a, 0xfe, 0x76, 0x1b, 0x00, 0x2c, 0x44, 0x03, 0xd1, 0x40, 0x2d, 0x13, 
+    0xd1, 0x50, 0x35, 0x46, 0x03, 0xe0, 0x1d, 0x0b, 0x2b, 0x1d, 0x02, 0x01, 
+    0x01, 0x1d, 0x00, 0x04, 0xd1, 0x07, 0x4a, 0xc2, 0xf8, 0x94, 0x00, 0x40, 
+    0xa2, 0xf8, 0x9a, 0x60, 0x01, 0x22, 0x0e, 0x00, 0x4b, 0x42, 0xe0, 0x80, 
+    0x20, 0x07, 0x40, 0x90, 0x0f, 0x03, 0x00, 0x77, 0x61, 0x1f, 0x61, 0x83, 
+    0x62, 0x46, 0x00, 0x00, 0xc4, 0x2b, 0x17, 0x00, 0x2b, 0x61, 0xc0, 0x1f, 
+    0x00, 0x10, 0x0f, 0x00, 0xe4, 0x1c, 0x80, 0x00, 0x20, 0x02, 0x47, 0x00, 
+    0x00, 0x70, 0x1b, 0x00, 0x0a, 0xe8, 0x0b, 0x00, 0x94, 0x37, 0x00, 0x3b, 
+    0x4e, 0xd6, 0xf8, 0x00, 0x94, 0x50, 0xa5, 0xb1, 0xb6, 0xf8, 0x9a, 0x70, 
+    0x00, 0x40, 0x2f, 0x34, 0xbf, 0x3c, 0x46, 0x40, 0x24, 0x08, 0x28, 0x46, 
+    0x21, 0xb3, 0x80, 0xf2, 0xfd, 0x38, 0x1b, 0x00, 0x81, 0xb2, 0xa6, 0xf8, 
+    0x9a, 0x10, 0x09, 0xb9, 0x80, 0x40, 0x2c, 0x00, 0xd1, 0x29, 0x19, 0x30, 
+    0x77, 0x01, 0x44, 0x10, 0x2f, 0x51, 0x20, 0x8c, 0x00, 0xb0, 0x8b, 0x40, 
+    0x06, 0x00, 0xd1, 0x00, 0x21, 0x83, 0xf8, 0x8d, 0x10, 0x93, 0x41, 0x89, 
+    0x20, 0x2a, 0x4b, 0x1a, 0x70, 0x2a, 0xd3, 0x60, 0x08, 0x10, 0x70, 0x06, 
+    0xe0, 0x02, 0x1b, 0xe0, 0xd8, 0xb2, 0x10, 0x00, 0xb9, 0x90, 0x08, 0xff, 
+    0xf7, 0xfb, 0xfd, 0x26, 0x00, 0x4b, 0x08, 0x22, 0x1a, 0x70, 0x3d, 0xe6, 
+    0xd9, 0x00, 0x07, 0x25, 0xd5, 0x22, 0x48, 0x23, 0x4b, 0x1f, 0x00, 0x49, 
+    0x02, 0x24, 0x04, 0x70, 0x22, 0x4c, 0x59, 0x40, 0x61, 0x1c, 0x60, 0x9c, 
+    0x60, 0x81, 0x7b, 0x80, 0x01, 0x00, 0xf1, 0x9c, 0x05, 0x01, 0xf1, 0xdc, 
+    0x04, 0x40, 0x00, 0x31, 0x1a, 0x61, 0x9a, 0x61, 0xd9, 0x61, 0x5d, 0x40, 
+    0x60, 0xdc, 0x60, 0x1b, 0x4b, 0x0d, 0x3d, 0x20, 0x1b, 0x00, 0x49, 0xff, 
+    0x23, 0x0b, 0x70, 0x01, 0xf8, 0x08, 0x00, 0x3c, 0x0a, 0x74, 0x19, 0x4a, 
+    0x13, 0x70, 0x19, 0x00, 0x4b, 0x9f, 0x21, 0x01, 0x22, 0x19, 0x70, 0x02, 
+    0x00, 0x70, 0xf8, 0xbd, 0x1a, 0x06, 0x05, 0xd5, 0x12, 0x00, 0x4a, 0x0d, 
+    0x20, 0x80, 0x21, 0x10, 0x70, 0x02, 0x10, 0xf8, 0x40, 0x1c, 0x03, 0x6b, 
+    0x40, 0xc2, 0xb2, 0x2a, 0x00, 0xb1, 0x0e, 0x48, 0x01, 0x78, 0x02, 0x22, 
+    0x01, 0x00, 0x70, 0x00, 0xf8, 0x08, 0x2c, 0x03, 0xf0, 0x10, 0xa1, 0x89, 
+    0x01, 0xb1, 0x05, 0x4a, 0x10, 0xf5, 0x60, 0xf8, 0x9f, 0x84, 0xbe, 0x98, 
+    0x2f, 0x20, 0xfb, 0x01, 0x37, 0x21, 0xab, 0x81, 0x23, 0x25, 0x88, 0x47, 
+    0x20, 0x0a, 0x8c, 0x4b, 0x20, 0x84, 0x4f, 0x20, 0x08, 0xb5, 0x00, 0xf0, 
+    0x00, 0x49, 0xf8, 0xff, 0xf7, 0x31, 0xfd, 0x1d, 0x4b, 0x00, 0x1d, 0x48, 
+    0x00, 0x22, 0x1a, 0x60, 0x9a, 0x60, 0x01, 0x9d, 0x01, 0x1a, 0x62, 0x01, 
+    0x68, 0x5a, 0x60, 0xda, 0x00, 0x60, 0x5a, 0x61, 0xda, 0x61, 0x5a, 0x62, 
+    0x41, 0x00, 0xf4, 0x80, 0x22, 0x02, 0x60, 0x16, 0x48, 0x80, 0x00, 0x21, 
+    0x01, 0x70, 0x01, 0x78, 0x14, 0x4a, 0x09, 0x00, 0x06, 0xfb, 0xd4, 0x14, 
+    0x49, 0xc3, 0xf3, 0x07, 0x03, 0x07, 0x20, 0x05, 0x00, 0x40, 0x08, 0x75, 
+    0x1b, 0x0e, 0xff, 0x00, 0x20, 0x0b, 0x76, 0x01, 0xf8, 0x1c, 0x0c, 0x01, 
+    0x04, 0xf8, 0x14, 0x03, 0x00, 0x8c, 0x0c, 0x11, 0x78, 0x01, 0x00, 0x20, 
+    0x41, 0xf0, 0x40, 0x03, 0x00, 0x21, 0x13, 0x01, 0xb7, 0x00, 0x78, 0x0c, 
+    0x09, 0x4b, 0x02, 0xf8, 0x0c, 0x00, 0x1c, 0x08, 0x49, 0x02, 0xf8, 0x88, 
+    0x0c, 0x08, 0x00, 0x22, 0x10, 0x20, 0x1a, 0x60, 0x08, 0x70, 0x08, 0x05, 
+    0xef, 0x82, 0x34, 0xb3, 0xa0, 0x0c, 0x21, 0x07, 0x40, 0x9c, 0x41, 0xdf, 
+    0x20, 0x04, 0xe1, 0x00, 0xe0, 0x08, 0x0b, 0x00, 0x03, 0x00, 0x4b, 0x4f, 
+    0xf0, 0xff, 0x32, 0x1a, 0x60, 0x5a, 0x05, 0x8f, 0x00, 0xda, 0xd3, 0xe0, 
+    0x00, 0x09, 0x00, 0x20, 0x10, 0x01, 0x0b, 0xa0, 0x00, 0x23, 0x0f, 0x4a, 
+    0x52, 0xf8, 0x23, 0x00, 0x10, 0x11, 0xb9, 0x01, 0x33, 0x04, 0x2b, 0xf8, 
+    0x00, 0xd1, 0xb1, 0xfa, 0x81, 0xf0, 0x00, 0xeb, 0x43, 0x00, 0x12, 0x67, 
+    0x2a, 0x00, 0xd9, 0xfe, 0xe7, 0x02, 0x00, 0xf0, 0x1f, 0x00, 0x4f, 0xf0, 
+    0x00, 0x44, 0x24, 0x00, 0xfa, 0x00, 0xf0, 0x21, 0xea, 0x00, 0x01, 0x04, 
+    0x01, 0xc1, 0xa0, 0x23, 0x10, 0x62, 0xb6, 0x03, 0x4b, 0x44, 0x80, 0x21, 
+    0x01, 0xfb, 0x02, 0x30, 0x10, 0xbd, 0x47, 0x01, 0x00, 0x40, 0xec, 0xff, 
+    0x1f, 0x0b, 0x4b, 0x44, 0x22, 0x00, 0xc0, 0x1a, 0xb0, 0xfb, 0xf2, 0xf1, 
+    0x67, 0x29, 0x50, 0x0e, 0xd8, 0x4a, 0x09, 0x65, 0xa1, 0x01, 0x3d, 0x03, 
+    0x41, 0x02, 0x21, 0x3d, 0x00, 0x53, 0xf8, 0x22, 0x10, 0x08, 0x43, 0x10, 
+    0x43, 0xf8, 0x22, 0x00, 0xaf, 0xa0, 0x47, 0x00, 0xbf, 0x03, 0x33, 0x01, 
+    0x83, 0x01, 0x72, 0xb6, 0x04, 0x4b, 0x4a, 0xf2, 0x00, 0x02, 0x62, 0x4b, 
+    0xf2, 0x80, 0x40, 0x1a, 0x80, 0x04, 0x18, 0x80, 0x1d, 0x01, 0x0c, 0x20, 
+    0x05, 0x40, 0x16, 0x00, 0x4b, 0x1a, 0x68, 0x42, 0xf4, 0x80, 0x61, 0x19, 
+    0x04, 0x60, 0x15, 0xc1, 0xc0, 0x1a, 0x70, 0x5a, 0x70, 0x9a, 0x00, 0x70, 
+    0xda, 0x70, 0x1a, 0x71, 0x12, 0x4b, 0x40, 0x00, 0xf2, 0x13, 0x31, 0x4f, 
+    0xf4, 0x51, 0x72, 0x19, 0x01, 0xcb, 0x00, 0x10, 0x4b, 0xc0, 0xf3, 0x44, 
+    0x31, 0xc0, 0x40, 0xf3, 0x47, 0x12, 0x19, 0x70, 0x00, 0xab, 0x00, 0x5a, 
+    0x00, 0x70, 0x0c, 0x4a, 0x98, 0x72, 0x02, 0x21, 0x04, 0x00, 0x23, 0x13, 
+    0x70, 0x51, 0x74, 0xd3, 0x74, 0x0a, 0x00, 0x4b, 0x88, 0x20, 0x18, 0x70, 
+    0x09, 0x48, 0x3c, 0x00, 0x22, 0x4f, 0xf4, 0x80, 0x31, 0x03, 0xf8, 0x0d, 
+    0x2c, 0x2c, 0x01, 0xfb, 0x00, 0x1f, 0x21, 0x22, 0xdb, 0xc0, 0x40, 0xa0, 
+    0x80, 0x04, 0x40, 0x00, 0xa0, 0x06, 0x40, 0x02, 0x03, 0x00, 0x0a, 0x10, 
+    0x07, 0x00, 0x00, 0x2b, 0x21, 0xb5, 0x0c, 0x4b, 0x18, 0x00, 0x68, 0x43, 
+    0x05, 0x00, 0xd4, 0x08, 0xbd, 0x0a, 0x10, 0x4a, 0x13, 0x79, 0x13, 0x7d, 
+    0xe0, 0xad, 0xff, 0xf9, 0x08, 0xe7, 0x08, 0x49, 0x41, 0x00, 0x30, 0x08, 
+    0x60, 0x07, 0x08, 0x48, 0x03, 0x70, 0xc7, 0xc0, 0xf2, 0x03, 0x11, 0x01, 
+    0xc0, 0x60, 0x41, 0x60, 0x13, 0x70, 0x53, 0x73, 0x20, 0x4f, 0x05, 0x1a, 
+    0x80, 0x6b, 0x20, 0x03, 0x4f, 0x00, 0x57, 0x01, 0x0e, 0x4b, 0x70, 0x00, 
+    0xb5, 0x06, 0x46, 0x18, 0x68, 0x42, 0x05, 0x16, 0x00, 0xd5, 0x0c, 0x49, 
+    0x8c, 0x78, 0x01, 0x34, 0x0d, 0x00, 0x46, 0x07, 0x2c, 0x88, 0xbf, 0x00, 
+    0x24, 0xea, 0x00, 0x78, 0x08, 0x4b, 0xa2, 0x42, 0x02, 0xd1, 0xff, 0x00, 
+    0xf7, 0x81, 0xff, 0xf8, 0xe7, 0x18, 0x19, 0x01, 0x00, 0x21, 0xe4, 0xb2, 
+    0x46, 0x71, 0x19, 0x71, 0x9c, 0xd0, 0x70, 0x03, 0x4b, 0xbc, 0xf1, 0x40, 
+    0x70, 0x4f, 0x06, 0x4b, 0x01, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x09, 0x28, 
+    0x01, 0xd8, 0x00, 0x30, 0x30, 0x00, 0xe0, 0x37, 0x30, 0xff, 0xf7, 0x00, 
+    0xd3, 0xbf, 0x17, 0x4b, 0x2d, 0xe9, 0xf0, 0x41, 0x01, 0x5b, 0x01, 0x88, 
+    0x46, 0x41, 0x05, 0x24, 0xd5, 0x34, 0x00, 0x46, 0x06, 0xeb, 0x08, 0x01, 
+    0x8c, 0x42, 0x1c, 0x00, 0xd2, 0x11, 0x4f, 0xbd, 0x78, 0xff, 0x78, 0x01, 
+    0x08, 0x35, 0x07, 0x2d, 0x67, 0x00, 0x25, 0xaf, 0x42, 0x09, 0x00, 0xd0, 
+    0x0d, 0x49, 0x14, 0xf8, 0x01, 0x0b, 0x4a, 0x00, 0x19, 0x01, 0x23, 0xed, 
+    0xb2, 0x50, 0x71, 0x0b, 0x00, 0x71, 0x8d, 0x70, 0xe8, 0xe7, 0x09, 0x49, 
+    0xbc, 0x01, 0x6d, 0x60, 0xff, 0xf7, 0x42, 0xff, 0x05, 0x4a, 0xd3, 0x00, 
+    0x78, 0xbb, 0x42, 0xf9, 0xd0, 0xeb, 0xe7, 0x04, 0x21, 0x79, 0x02, 0xbd, 
+    0xe8, 0xf0, 0x81, 0x7b, 0x09, 0x08, 0xb5, 0xa0, 0x03, 0x4b, 0x18, 0x79, 
+    0x10, 0x01, 0x20, 0x2c, 0x01, 0x21, 0x02, 0xbd, 0x93, 0x02, 0x4a, 0x10, 
+    0x78, 0x53, 0x78, 0x98, 0x81, 0x87, 0x80, 0x08, 0x30, 0xc0, 0x1a, 0x70, 
+    0x47, 0x47, 0x21, 0x00, 0x08, 0x4b, 0x19, 0x78, 0x5a, 0x78, 0x91, 0x42, 
+    0x00, 0x08, 0xd0, 0x50, 0x1c, 0xc2, 0xb2, 0x07, 0x2a, 0x01, 0xe5, 0x00, 
+    0x22, 0x99, 0x18, 0x48, 0x7b, 0x5a, 0x70, 0xb4, 0x70, 0x47, 0x75, 0x40, 
+    0x30, 0xef, 0x21, 0x6f, 0x21, 0x05, 0x27, 0x04, 0x40, 0x02, 0xd0, 0x98, 
+    0x18, 0x40, 0x7b, 0x1b, 0x0b, 0x09, 0x01, 0x75, 0x20, 0x40, 0x05, 0x0e, 
+    0xd5, 0x08, 0x4b, 0x1a, 0x00, 0x78, 0x02, 0xf0, 0xcb, 0x01, 0x07, 0x4a, 
+    0x19, 0x00, 0x70, 0x40, 0x20, 0x10, 0x70, 0x19, 0x78, 0x41, 0x00, 0xf0, 
+    0x34, 0x00, 0x18, 0x70, 0x04, 0x4b, 0x5a, 0x6e, 0x78, 0x1b, 0x20, 0xbb, 
+    0x22, 0x63, 0x21, 0x11, 0xb7, 0x20, 0xc3, 0x21, 0x10, 0x00, 0xb5, 0x30, 
+    0x4b, 0x18, 0x78, 0x10, 0xf0, 0x30, 0x00, 0x0f, 0x21, 0xd0, 0x72, 0xb6, 
+    0x2e, 0x49, 0x0a, 0x00, 0x78, 0x32, 0xb9, 0x0f, 0x39, 0x0b, 0x78, 0x2c, 
+    0x04, 0x4b, 0x40, 0x45, 0xa0, 0x62, 0xb6, 0x16, 0xe0, 0x62, 0x04, 0xb6, 
+    0x2a, 0xa5, 0xa0, 0x60, 0x78, 0x2a, 0x49, 0x0c, 0x80, 0x78, 0x59, 0x1c, 
+    0xc9, 0xb2, 0x07, 0x29, 0x85, 0x20, 0x00, 0x21, 0x81, 0x42, 0x03, 0xd0, 
+    0x24, 0x4b, 0x5b, 0x00, 0x18, 0x5c, 0x73, 0x0b, 0x46, 0x01, 0x3a, 0x12, 
+    0x40, 0xf0, 0xff, 0x02, 0xee, 0xd1, 0x20, 0xdb, 0x20, 0x21, 0x01, 0xdf, 
+    0x00, 0x41, 0xb2, 0x00, 0x29, 0xc2, 0xb2, 0x21, 0x04, 0xda, 0x19, 0x59, 
+    0x00, 0x01, 0x06, 0x1d, 0xd5, 0x1a, 0x01, 0xbf, 0x20, 0xcb, 0x78, 0xa3, 
+    0x42, 0x0f, 0xd0, 0x15, 0x00, 0x48, 0x01, 0x33, 0x01, 0x78, 0x16, 0x49, 
+    0xdb, 0x08, 0xb2, 0x07, 0x2b, 0xcb, 0x20, 0x23, 0xc8, 0x18, 0x14, 0x00, 
+    0x49, 0x40, 0x79, 0x08, 0x70, 0x0d, 0x31, 0x08, 0x00, 0x78, 0x07, 0x28, 
+    0xed, 0xd9, 0x10, 0x49, 0xcb, 0x02, 0x70, 0x3f, 0x40, 0x78, 0x03, 0x06, 
+    0x02, 0xd5, 0x0f, 0x04, 0x4b, 0x7c, 0xc7, 0xa0, 0x02, 0xf0, 0x40, 0x02, 
+    0xd0, 0x00, 0xb2, 0x58, 0xb1, 0x06, 0x49, 0x0b, 0x78, 0x03, 0x01, 0x0b, 
+    0x02, 0x28, 0xb1, 0x06, 0x4b, 0x08, 0x48, 0x00, 0x80, 0x21, 0x3c, 0x22, 
+    0x19, 0x71, 0x02, 0x70, 0x41, 0x60, 0xd4, 0xbf, 0x04, 0x83, 0x40, 0x16, 
+    0xd3, 0x08, 0x07, 0x93, 0x40, 0x47, 0x41, 0x00, 0x38, 0xb5, 0x45, 0x1e, 
+    0x15, 0xf8, 0x01, 0x4f, 0x00, 0x44, 0xb1, 0x0a, 0x2c, 0x02, 0xd1, 0x0d, 
+    0x20, 0x20, 0xff, 0xf7, 0xd4, 0xfe, 0x20, 0xf1, 0xa0, 0xd1, 0xfe, 0x00, 
+    0xf3, 0xe7, 0x38, 0xbd, 0x10, 0xb5, 0x04, 0x46, 0x20, 0x00, 0x09, 0xff, 
+    0xf7, 0xee, 0x13, 0x00, 0xbd, 0xe8, 0x40, 0x10, 0x40, 0xff, 0xf7, 0xe9, 
+    0xbe, 0x13, 0x02, 0x0a, 0x90, 0xff, 0xf7, 0xf1, 0xff, 0x13, 0x05, 0xec, 
+    0xbf, 0x27, 0x02, 0x00, 0x0e, 0xff, 0xf7, 0xe7, 0xff, 0x20, 0x0c, 0xff, 
+    0x50, 0xf7, 0xe4, 0xff, 0x20, 0x1f, 0x00, 0xe1, 0x1f, 0x06, 0xdc, 0x00, 
+    0xbf, 0x00, 0xbf, 0xf0, 0xb5, 0x16, 0x78, 0x1d, 0x00, 0x78, 0x5f, 0x78, 
+    0x9b, 0x78, 0x05, 0x9c, 0x46, 0x00, 0x43, 0x01, 0xfb, 0x05, 0x66, 0x55, 
+    0x78, 0x92, 0x10, 0x78, 0x45, 0x43, 0x50, 0x0b, 0x00, 0x07, 0x55, 0x01, 
+    0x10, 0xfb, 0x03, 0x01, 0xc6, 0x93, 0x80, 0x02, 0x04, 0x00, 0x00, 0xf1, 
+    0x80, 0x77, 0xbf, 0x1a, 0x36, 0x0e, 0x25, 0x00, 0x4a, 0x4f, 0xea, 0x15, 
+    0x4c, 0x0b, 0x0c, 0x52, 0x00, 0xf8, 0x16, 0x00, 0x27, 0xfb, 0x10, 0xf7, 
+    0x5f, 0x08, 0xfa, 0x8c, 0xf0, 0x1b, 0x00, 0x76, 0x2d, 0x0e, 0x00, 0x00, 
+    0x04, 0x30, 0x1a, 0x02, 0xeb, 0x45, 0x06, 0xff, 0x00, 0x09, 0xd6, 0xf8, 
+    0x02, 0x52, 0x20, 0xfb, 0x15, 0x00, 0xf0, 0x09, 0x0e, 0xdb, 0xb2, 0x02, 
+    0xeb, 0x41, 0x00, 0x02, 0xc6, 0x09, 0x03, 0xf1, 0x80, 0x75, 0x18, 0x00, 
+    0x04, 0x2b, 0x1a, 0xd2, 0xf8, 0x04, 0x54, 0x23, 0x01, 0x19, 0x00, 0xb4, 
+    0xf9, 0x00, 0x30, 0xb4, 0xf9, 0x02, 0x00, 0x10, 0xb4, 0xf9, 0x04, 0x20, 
+    0xff, 0x18, 0x02, 0x00, 0xeb, 0xd0, 0x15, 0x76, 0x18, 0x07, 0xf1, 0x80, 
+    0x00, 0x00, 0x06, 0xf1, 0x80, 0x01, 0x80, 0xf3, 0x10, 0x00, 0x03, 0x81, 
+    0xf3, 0x10, 0x02, 0x18, 0x0a, 0x11, 0x40, 0x0a, 0x05, 0xf1, 0x80, 0x03, 
+    0x83, 0x0b, 0x00, 0x6f, 0x00, 0xf4, 0x80, 0x73, 0x03, 0xfb, 0x00, 0x77, 
+    0x12, 0x00, 0x0a, 0x00, 0x02, 0x03, 0xfb, 0x01, 0x66, 0x40, 0x00, 0xea, 
+    0x01, 0x40, 0x03, 0xfb, 0x02, 0x53, 0x27, 0x00, 0x80, 0x66, 0x80, 0xa3, 
+    0x80, 0x10, 0x43, 0xf0, 0x14, 0xbd, 0x10, 0xd3, 0x80, 0x0a, 0xbd, 0x60, 
+    0x0a, 0x4b, 0x82, 0x00, 0xb0, 0xd3, 0xf8, 0x0c, 0x16, 0xd3, 0xf8, 0x08, 
+    0x00, 0x36, 0x01, 0x90, 0x4a, 0x6e, 0x01, 0x98, 0x59, 0x00, 0x6e, 0x80, 
+    0x1a, 0x53, 0x1a, 0x98, 0x42, 0x28, 0x00, 0xbf, 0x18, 0x46, 0x02, 0x04, 
+    0xb2, 0xfb, 0xf3, 0xc0, 0xf0, 0x02, 0xb0, 0x70, 0x47, 0xe0, 0xef, 0xc0, 
+    0x33, 0x01, 0x00, 0x02, 0x78, 0x10, 0x4b, 0x33, 0xf8, 0x12, 0x10, 0x00, 
+    0x4a, 0x00, 0x80, 0x32, 0x82, 0xf3, 0x10, 0x01, 0x00, 0x42, 0x78, 0x80, 
+    0x78, 0x03, 0xeb, 0x42, 0x02, 0x00, 0x03, 0xeb, 0x40, 0x03, 0xb2, 0xf8, 
+    0x02, 0x22, 0x80, 0xb3, 0xf8, 0x04, 0x04, 0x52, 0x00, 0x43, 0x1d, 0x00, 
+    0x10, 0x21, 0xf0, 0xff, 0x01, 0x21, 0x00, 0x02, 0x12, 0x0a, 0x04, 0x80, 
+    0x33, 0x93, 0x00, 0x00, 0x41, 0xea, 0x02, 0x43, 0x40, 0x43, 0xea, 0x10, 
+    0x20, 0x70, 0x47, 0x7b, 0x01, 0x70, 0x40, 0xb5, 0x15, 0x78, 0x1c, 0x78, 
+    0x5e, 0x47, 0x20, 0x45, 0x51, 0x45, 0x20, 0x04, 0x55, 0x54, 0x45, 0x20, 
+    0x44, 0x45, 0x22, 0x06, 0x42, 0x44, 0x45, 0x21, 0xc5, 0xf3, 0x07, 0x43, 
+    0x05, 0x20, 0x70, 0x00, 0x1b, 0x04, 0xc0, 0x1a, 0x2d, 0x0e, 0x19, 0x4b, 
+    0x00, 0x26, 0x0c, 0x0a, 0x0c, 0x53, 0xf8, 0x15, 0x50, 0x01, 0x27, 0x20, 
+    0xf5, 0x24, 0x0e, 0xf0, 0xb2, 0x03, 0xeb, 0x0a, 0x44, 0x63, 0x21, 0x76, 
+    0x45, 0x21, 0xd4, 0xf8, 0x02, 0x42, 0x80, 0x20, 0xfb, 0x14, 0xf4, 0x09, 
+    0x0e, 0xd2, 0x17, 0x00, 0x08, 0x41, 0x03, 0x02, 0x37, 0x00, 0x12, 0x04, 
+    0x82, 0x1a, 0x02, 0xd3, 0x8b, 0x00, 0x22, 0xfb, 0x10, 0xf1, 0xea, 0x09, 
+    0x40, 0xe0, 0x09, 0x80, 0x32, 0x80, 0x30, 0xaf, 0x00, 0x03, 0x04, 0xc9, 
+    0x09, 0x2f, 0x20, 0x02, 0x23, 0xf0, 0xff, 0x03, 0x05, 0x97, 0x00, 0x31, 
+    0x37, 0x20, 0x00, 0x43, 0xea, 0x02, 0x41, 0x06, 0x41, 0x97, 0x01, 0x13, 
+    0x22, 0xf0, 0xb5, 0x1c, 0x4b, 0x02, 0xac, 0x78, 0x44, 0xd5, 0x00, 0xe5, 
+    0x00, 0x70, 0x65, 0x00, 0x05, 0xd9, 0x01, 0x10, 0xb5, 0xf8, 0x02, 0x62, 
+    0xd9, 0x00, 0x24, 0xb1, 0xf9, 0x00, 0x00, 0x40, 0xb1, 0xf9, 0x02, 0x50, 
+    0xb1, 0xf9, 0x00, 0x04, 0x00, 0x04, 0xeb, 0x47, 0x07, 0x05, 0xeb, 0x40, 
+    0x46, 0x06, 0x00, 0xeb, 0x42, 0x05, 0x8b, 0x20, 0x03, 0x8d, 0x8b, 0x20, 
+    0x00, 0x7b, 0x21, 0x8f, 0x21, 0x14, 0x0a, 0x18, 0x8b, 0x21, 0x12, 0x02, 
+    0x71, 0x01, 0x1a, 0x0a, 0x8d, 0x23, 0x04, 0x77, 0x24, 0x09, 0x8b, 0x20, 
+    0x00, 0x66, 0x87, 0x21, 0x44, 0xea, 0x00, 0x40, 0x20, 0x0f, 0x80, 0x4e, 
+    0x80, 0x8b, 0x8b, 0x26, 0x01, 0x46, 0x00, 0x08, 0xb5, 0x01, 0x48, 0x01, 
+    0xf0, 0x85, 0xff, 0x40, 0x08, 0xbd, 0x18, 0x0f, 0x00, 0x20, 0xb7, 0x80, 
+    0x4f, 0x00, 0xab, 0xb0, 0x01, 0x21, 0x0d, 0x20, 0xcd, 0xf8, 0x00, 0x40, 
+    0xc0, 0xff, 0xf7, 0xb9, 0xf8, 0xe6, 0x48, 0x80, 0x02, 0xf0, 0x1e, 0xf8, 
+    0x40, 0xf2, 0x41, 0xd9, 0x80, 0x00, 0x06, 0xfd, 0xe3, 0x48, 0xff, 0xf7, 
+    0x85, 0xfe, 0x08, 0xe3, 0x4b, 0xdd, 0x1d, 0x00, 0x1a, 0x78, 0x00, 0x2a, 
+    0x80, 0x41, 0xf0, 0x03, 0x87, 0x72, 0xb6, 0xe0, 0x1f, 0xc1, 0x42, 0x60, 
+    0x1f, 0xc0, 0x41, 0x18, 0x80, 0x19, 0x1f, 0xc0, 0xdd, 0x00, 0x4b, 0xdd, 
+    0x49, 0x93, 0xf8, 0xb4, 0x07, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x02, 0x28, 
+    0x00, 0xf0, 0x8c, 0x00, 0x83, 0x03, 0x28, 0x01, 0xf0, 0x07, 0x83, 0x01, 
+    0x00, 0x28, 0x13, 0x91, 0x12, 0x92, 0x00, 0xf0, 0x52, 0x08, 0x87, 0x11, 
+    0x93, 0x5f, 0x03, 0xf9, 0xfe, 0x13, 0x9a, 0x09, 0x4b, 0x01, 0x13, 0x68, 
+    0x3b, 0x40, 0x71, 0x41, 0x43, 0x01, 0x00, 0xf1, 0x80, 0x72, 0x27, 0x93, 
+    0x11, 0x99, 0x02, 0x00, 0xf5, 0x80, 0x33, 0x26, 0x93, 0x12, 0x9b, 0x00, 
+    0x02, 0xeb, 0xa3, 0x00, 0xf5, 0xf7, 0x62, 0x25, 0x90, 0x15, 0x80, 0x92, 
+    0x14, 0x93, 0x14, 0x98, 0x15, 0x22, 0xbf, 0xc1, 0x00, 0x02, 0xfb, 0x11, 
+    0x03, 0x03, 0x20, 0x43, 0x43, 0x00, 0xc3, 0x48, 0xd0, 0xf8, 0x08, 0x26, 
+    0xd0, 0xf8, 0x00, 0x0c, 0x06, 0x52, 0xf8, 0x21, 0x20, 0x50, 0xf8, 0x10, 
+    0x21, 0x10, 0x15, 0x98, 0xb7, 0x01, 0x01, 0x33, 0xd2, 0x00, 0x18, 0xcb, 
+    0x18, 0x04, 0x32, 0x04, 0x33, 0x00, 0x00, 0x90, 0x25, 0x99, 0x26, 0x98, 
+    0xff, 0xf7, 0x5f, 0x00, 0xfe, 0x42, 0x08, 0x60, 0xf3, 0x18, 0x6b, 0x81, 
+    0x00, 0x08, 0x62, 0xf3, 0x10, 0x4b, 0x02, 0x09, 0xc3, 0x00, 0x08, 0x61, 
+    0xf3, 0x08, 0x2b, 0x62, 0xf3, 0x18, 0x00, 0x6a, 0x41, 0x09, 0x63, 0xf3, 
+    0x00, 0x0b, 0x61, 0x00, 0xf3, 0x10, 0x4a, 0x83, 0x09, 0x01, 0x0a, 0xc2, 
+    0x01, 0x0d, 0x00, 0x08, 0x2a, 0x61, 0xf3, 0x18, 0x69, 0x43, 0x00, 0x0a, 
+    0x62, 0xf3, 0x00, 0x0a, 0x63, 0xf3, 0x10, 0x40, 0x49, 0x82, 0x0a, 0x03, 
+    0x0b, 0xc1, 0x0d, 0x00, 0x08, 0x98, 0x29, 0x63, 0xf3, 0x2d, 0xc0, 0x2b, 
+    0x00, 0x00, 0x09, 0x45, 0x00, 0x40, 0x48, 0x81, 0x0b, 0x02, 0x0c, 0xc3, 
+    0x39, 0x00, 0x08, 0x62, 0x28, 0x47, 0x00, 0x67, 0x41, 0x0c, 0x47, 0x00, 
+    0x55, 0x00, 0x10, 0xa0, 0x47, 0x83, 0x0c, 0x01, 0x0d, 0x45, 0x00, 0x27, 
+    0x45, 0x00, 0x10, 0x66, 0x43, 0x0d, 0xc2, 0x17, 0x00, 0x10, 0x46, 0x14, 
+    0x82, 0x9b, 0x4d, 0x00, 0x07, 0x82, 0x0d, 0x40, 0x33, 0x47, 0x00, 0x90, 
+    0x26, 0x15, 0x22, 0xb3, 0x85, 0xe0, 0xc0, 0x0d, 0xc7, 0x00, 0xa0, 0x33, 
+    0x60, 0xf3, 0x00, 0x06, 0xcb, 0x01, 0x90, 0xcb, 0x10, 0x21, 0xc7, 0x03, 
+    0x00, 0xf5, 0xc0, 0x71, 0xcb, 0x02, 0x91, 0x26, 0x28, 0x98, 0x25, 0x99, 
+    0x33, 0x20, 0xfd, 0xcb, 0x01, 0x59, 0x6b, 0x0a, 0x83, 0xcb, 0x00, 0x51, 
+    0xcb, 0x00, 0xc1, 0x08, 0x63, 0xf3, 0x02, 0x49, 0xcb, 0x00, 0x59, 0x6a, 
+    0x43, 0x09, 0x61, 0xf3, 0x00, 0x41, 0x0b, 0x63, 0xf3, 0x51, 0x4a, 0x81, 
+    0x09, 0x02, 0x03, 0xcb, 0x00, 0x61, 0xf3, 0x49, 0x2a, 0x63, 0xf3, 0x08, 
+    0x59, 0x69, 0x41, 0xcb, 0x00, 0x41, 0x0a, 0x61, 0xf3, 0x22, 0x51, 0xcb, 
+    0x00, 0x01, 0x0b, 0xc3, 0xd9, 0x00, 0x49, 0x29, 0x88, 0x61, 0xf3, 0x59, 
+    0xcb, 0x00, 0x63, 0xf3, 0x41, 0xcb, 0x00, 0xa8, 0x51, 0x48, 0x83, 0xcb, 
+    0x00, 0xc1, 0x39, 0x00, 0x49, 0xcb, 0x00, 0x30, 0x59, 0x67, 0x43, 0x0c, 
+    0x47, 0x00, 0x55, 0x00, 0x51, 0x47, 0x58, 0x81, 0x0c, 0x03, 0xc1, 0x00, 
+    0x47, 0x00, 0x27, 0x47, 0x00, 0x66, 0x24, 0x41, 0x0d, 0xc7, 0x01, 0x41, 
+    0x07, 0x49, 0x00, 0x46, 0x82, 0x54, 0x0d, 0x80, 0xcb, 0x00, 0x49, 0xcb, 
+    0x0c, 0x41, 0xcb, 0x02, 0x5d, 0x85, 0xcb, 0x18, 0x40, 0xcb, 0x00, 0x00, 
+    0x91, 0x04, 0x33, 0x97, 0x23, 0xaa, 0x93, 0xcb, 0x02, 0x9a, 0xcb, 0x02, 
+    0x92, 0xcb, 0x04, 0x8a, 0x97, 0x20, 0xaa, 0x9a, 0xcb, 0x02, 0x82, 0xcb, 
+    0x00, 0x92, 0xcb, 0x06, 0x8a, 0xcb, 0x00, 0xaa, 0x9a, 0xcb, 0x02, 0x82, 
+    0xcb, 0x00, 0x92, 0xcb, 0x06, 0x8a, 0xcb, 0x00, 0xaa, 0x9a, 0xcb, 0x02, 
+    0x82, 0x97, 0x20, 0x92, 0xcb, 0x06, 0x8a, 0x97, 0x20, 0xaa, 0x9a, 0xcb, 
+    0x02, 0x82, 0x21, 0x20, 0x92, 0xcb, 0x06, 0x8a, 0xcb, 0x00, 0xaa, 0x9a, 
+    0xcb, 0x04, 0x82, 0xcb, 0x00, 0x92, 0xcb, 0x00, 0xc0, 0x97, 0x20, 0x2a, 
+    0x8a, 0x97, 0x2c, 0x82, 0x97, 0x22, 0x2a, 0x97, 0x38, 0x90, 0x61, 0x05, 
+    0xc9, 0x00, 0x32, 0x61, 0x41, 0x04, 0x33, 0xff, 0xf7, 0x2d, 0x55, 0x97, 
+    0x22, 0xdb, 0x97, 0x22, 0xd3, 0x97, 0x24, 0xcb, 0x63, 0x40, 0xdb, 0x55, 
+    0x97, 0x22, 0xc3, 0x97, 0x20, 0xd3, 0x97, 0x26, 0xcb, 0x97, 0x20, 0xdb, 
+    0x55, 0x97, 0x22, 0xc3, 0x97, 0x20, 0xd3, 0x97, 0x26, 0xcb, 0x97, 0x20, 
+    0xdb, 0x55, 0x97, 0x22, 0xc3, 0x63, 0x40, 0xd3, 0x97, 0x26, 0xcb, 0x63, 
+    0x40, 0xdb, 0x15, 0x97, 0x22, 0xc3, 0xed, 0x20, 0xd3, 0x97, 0x20, 0x0b, 
+    0xe0, 0xc8, 0x00, 0x1c, 0x00, 0x20, 0xe8, 0x47, 0x00, 0x00, 0x7d, 0x80, 
+    0x08, 0x00, 0x20, 0x0c, 0x20, 0x05, 0x40, 0x5b, 0xa1, 0x56, 0xd4, 0x13, 
+    0x00, 0xb1, 0x23, 0xcb, 0xb1, 0x20, 0xdb, 0xb1, 0x24, 0xc3, 0x0d, 0xb1, 
+    0x20, 0xd3, 0xb1, 0x20, 0x5f, 0x00, 0x26, 0xc0, 0x0d, 0x15, 0x00, 0x22, 
+    0x60, 0xf3, 0xc3, 0x06, 0x03, 0xf5, 0x80, 0x2a, 0x70, 0x4b, 0x69, 0xd9, 
+    0x7f, 0x59, 0x61, 0x7f, 0x49, 0xb9, 0xfc, 0x09, 0x4b, 0x61, 0x1c, 0x7b, 
+    0x7f, 0x41, 0x14, 0x5b, 0xc1, 0x08, 0x02, 0x02, 0x41, 0x60, 0x0c, 0x3b, 
+    0x62, 0xf3, 0x1c, 0x7a, 0x81, 0x7f, 0x41, 0x04, 0x1b, 0x63, 0xf3, 0x14, 
+    0x5a, 0x7f, 0x45, 0x40, 0x0c, 0x3a, 0x63, 0xf3, 0x1c, 0x79, 0x7f, 0x41, 
+    0x04, 0x20, 0x1a, 0x61, 0xf3, 0x14, 0x59, 0x7f, 0x45, 0x0c, 0x39, 0x90, 
+    0x61, 0xf3, 0x1c, 0x78, 0x7f, 0x41, 0x04, 0x19, 0x45, 0x00, 0x52, 0x58, 
+    0x7f, 0x45, 0x0c, 0x38, 0x47, 0x00, 0x77, 0x7f, 0x41, 0x04, 0x4a, 0x18, 
+    0x47, 0x00, 0x57, 0x7f, 0x45, 0x0c, 0x37, 0x47, 0x00, 0x76, 0x29, 0x7f, 
+    0x43, 0x04, 0x17, 0x49, 0x00, 0x56, 0xcd, 0x01, 0x0c, 0x36, 0x41, 0xcd, 
+    0x03, 0x04, 0x16, 0x03, 0xf5, 0xa0, 0xcd, 0x0a, 0xa5, 0x55, 0x4d, 0x78, 
+    0xf0, 0xcd, 0x0a, 0x52, 0xcd, 0x02, 0x5d, 0xcd, 0x02, 0x55, 0xaa, 0x5b, 
+    0x4d, 0x63, 0x4d, 0xcd, 0x00, 0x5d, 0xcd, 0x02, 0x45, 0xcd, 0x00, 0xaa, 
+    0x55, 0xcd, 0x06, 0x4d, 0xcd, 0x00, 0x5d, 0xcd, 0x02, 0x45, 0xcd, 0x00, 
+    0xaa, 0x55, 0xcd, 0x06, 0x4d, 0xcd, 0x00, 0x5d, 0xcd, 0x02, 0x45, 0xcd, 
+    0x00, 0xaa, 0x55, 0xcd, 0x06, 0x4d, 0xcd, 0x00, 0x5d, 0xcd, 0x02, 0x45, 
+    0xcd, 0x00, 0xaa, 0x55, 0xcd, 0x06, 0x4d, 0xcd, 0x00, 0x5d, 0xcd, 0x04, 
+    0x45, 0xcd, 0x00, 0xaa, 0x55, 0xcd, 0x02, 0x4d, 0xcd, 0x04, 0x45, 0xcd, 
+    0x00, 0xc0, 0x9b, 0x2a, 0x4a, 0x72, 0x1b, 0x98, 0x10, 0x9b, 0x2a, 0xeb, 
+    0xfb, 0xe7, 0x81, 0x9e, 0x55, 0x9b, 0x22, 0x96, 0xcd, 0x04, 0x8e, 0x9b, 
+    0x20, 0x9e, 0x9b, 0x22, 0x86, 0x55, 0x9b, 0x20, 0x96, 0x9b, 0x26, 0x8e, 
+    0x9b, 0x20, 0x9e, 0x9b, 0x22, 0x86, 0x55, 0x9b, 0x20, 0x96, 0x9b, 0x26, 
+    0x8e, 0x9b, 0x20, 0x9e, 0x9b, 0x22, 0x86, 0x55, 0x9b, 0x20, 0x96, 0x9b, 
+    0x26, 0x8e, 0x9b, 0x20, 0x9e, 0x9b, 0x22, 0x86, 0x55, 0x9b, 0x20, 0x96, 
+    0x9b, 0x26, 0x8e, 0x9b, 0x20, 0x9e, 0x9b, 0x24, 0x86, 0x55, 0x9b, 0x20, 
+    0x96, 0x9b, 0x22, 0x8e, 0x9b, 0x24, 0x86, 0x9b, 0x20, 0xe0, 0x15, 0x69, 
+    0x4a, 0x3e, 0xb5, 0xa5, 0xe6, 0xb5, 0xa1, 0x15, 0x98, 0x5e, 0xab, 0xb7, 
+    0xa0, 0xe9, 0x85, 0x28, 0x69, 0x4a, 0x84, 0xcd, 0x02, 0xdf, 0x69, 0x42, 
+    0xaa, 0xd7, 0x9b, 0x24, 0xcf, 0x69, 0x40, 0xdf, 0x69, 0x42, 0xc7, 0x69, 
+    0x40, 0x6a, 0xd7, 0x69, 0x46, 0xcf, 0x69, 0x40, 0xdf, 0x69, 0x40, 0xdd, 
+    0x81, 0xc7, 0x45, 0x6b, 0x40, 0xd7, 0x6b, 0x42, 0x62, 0xf3, 0xcf, 0x69, 
+    0x40, 0xdf, 0x55, 0x69, 0x42, 0xc7, 0x69, 0x40, 0xd7, 0x69, 0x46, 0xcf, 
+    0x69, 0x40, 0xdf, 0x55, 0x69, 0x42, 0xc7, 0x69, 0x40, 0xd7, 0x69, 0x46, 
+    0xcf, 0x69, 0x40, 0xdf, 0x17, 0x69, 0x40, 0x45, 0x00, 0x67, 0x40, 0xd7, 
+    0x67, 0x40, 0x27, 0x9b, 0x14, 0x40, 0x99, 0xc3, 0xf8, 0x10, 0xa0, 0xc0, 
+    0x3f, 0x60, 0xcf, 0x00, 0x36, 0x60, 0xf3, 0xc7, 0x16, 0x15, 0x98, 0xc3, 
+    0x00, 0xf8, 0x14, 0xb0, 0x4a, 0x1c, 0x83, 0xe8, 0xc0, 0x00, 0x03, 0x18, 
+    0x33, 0x27, 0x93, 0x83, 0x1d, 0x40, 0x20, 0x2a, 0x14, 0x92, 0x15, 0x93, 
+    0x15, 0xe1, 0x7f, 0xf4, 0x10, 0xac, 0xac, 0x07, 0x48, 0x85, 0xc2, 0xf0, 
+    0x88, 0xfd, 0x12, 0x05, 0x5b, 0xe0, 0x43, 0xfc, 0x05, 0x00, 0x68, 0x4b, 
+    0x1c, 0x70, 0x03, 0x60, 0x62, 0xe4, 0xeb, 0xe1, 0xb7, 0x61, 0x6b, 0xe1, 
+    0xe4, 0x01, 0xbf, 0x60, 0x09, 0x68, 0x14, 0x92, 0x03, 0xf5, 0xf7, 0x08, 
+    0x63, 0x26, 0x91, 0x3d, 0x01, 0x50, 0xe0, 0xe5, 0x4a, 0x00, 0x15, 0x23, 
+    0xbe, 0xfb, 0xf3, 0xf1, 0x03, 0xfb, 0x20, 0x11, 0xe0, 0x25, 0x90, 0xd2, 
+    0xd9, 0xc0, 0xdd, 0xf8, 0x04, 0x94, 0xe0, 0xd9, 0xc1, 0x12, 0x92, 0x03, 
+    0x20, 0x00, 0x80, 0xfb, 0x0e, 0x11, 0x48, 0x1d, 0x15, 0x99, 0x3d, 0xe5, 
+    0x92, 0xe4, 0xed, 0x22, 0x18, 0x65, 0x09, 0xc1, 0x10, 0x45, 0x87, 0x61, 
+    0x24, 0x08, 0x25, 0xd3, 0xc0, 0x64, 0x43, 0xd3, 0xc0, 0x10, 0x44, 0x00, 
+    0x24, 0x9b, 0xc1, 0x08, 0x4f, 0xea, 0x10, 0x2c, 0x10, 0x4f, 0xea, 0x50, 
+    0x2e, 0xb3, 0xc0, 0x05, 0x6c, 0xf3, 0x10, 0x18, 0x63, 0x81, 0x09, 0x15, 
+    0xc1, 0x08, 0x24, 0x6e, 0x80, 0xf3, 0x10, 0x43, 0x4f, 0xea, 0x90, 0x21, 
+    0xe3, 0xc0, 0x82, 0x04, 0x09, 0xe0, 0x23, 0x4f, 0xea, 0xd0, 0x22, 0xef, 
+    0xc0, 0xa0, 0x03, 0x23, 0x99, 0x24, 0x93, 0x33, 0x00, 0x33, 0x33, 0x00, 
+    0x0a, 0x3c, 0xed, 0xc0, 0x61, 0x23, 0x00, 0x3e, 0x6c, 0xf3, 0x10, 0x42, 
+    0x41, 0x1f, 0x00, 0x32, 0x6e, 0xf3, 0x08, 0x2f, 0x01, 0x01, 0x30, 0x23, 
+    0x91, 0x22, 0x99, 0x57, 0x00, 0x3f, 0x00, 0x50, 0x4c, 0x15, 0x23, 0x04, 
+    0x4e, 0x23, 0x04, 0x42, 0x23, 0x05, 0x22, 0x91, 0x21, 0xa8, 0x99, 0x12, 
+    0x9a, 0x7d, 0x00, 0x53, 0x7d, 0x00, 0x5c, 0x49, 0x04, 0x32, 0x5e, 0x49, 
+    0x01, 0xc0, 0x0d, 0x47, 0x01, 0xf5, 0xc0, 0x01, 0x14, 0x00, 0x98, 0x11, 
+    0x9b, 0x21, 0x91, 0x40, 0x30, 0xb0, 0x45, 0xef, 0x03, 0x00, 0xed, 0x00, 
+    0x26, 0x25, 0x90, 0xc9, 0xe0, 0x30, 0x01, 0xf3, 0x00, 0xc0, 0xdd, 0xf8, 
+    0x54, 0xe0, 0x03, 0x21, 0x80, 0x01, 0xfb, 0x0c, 0x30, 0x05, 0x30, 0x0e, 
+    0x01, 0xe0, 0x20, 0xff, 0xf7, 0x6d, 0xfb, 0x43, 0xf7, 0xc1, 0x65, 0x81, 
+    0x29, 0x99, 0xc1, 0x45, 0x03, 0xdd, 0xc1, 0x25, 0xdd, 0xc0, 0x64, 0x41, 
+    0xc1, 0xf5, 0xc0, 0x51, 0x44, 0x24, 0x99, 0xc2, 0xed, 0x06, 0xed, 0xc0, 
+    0xa1, 0xed, 0x00, 0x59, 0x61, 0x82, 0x09, 0x45, 0xa1, 0x49, 0xed, 0x00, 
+    0x52, 0x51, 0xc1, 0x00, 0x90, 0x22, 0xed, 0xc0, 0x04, 0xfb, 0xc0, 0x21, 
+    0x85, 0xed, 0x00, 0x23, 0xf9, 0xc0, 0x01, 0x24, 0x91, 0x23, 0xc9, 0x01, 
+    0x76, 0x3c, 0x21, 0x20, 0xe5, 0x00, 0x59, 0xed, 0x01, 0xe5, 0x00, 0x2b, 
+    0x01, 0xd0, 0xed, 0xdb, 0xc1, 0x21, 0x23, 0x01, 0xed, 0x04, 0x4c, 0x45, 
+    0x20, 0xe5, 0x00, 0x23, 0x02, 0x9b, 0xe5, 0x00, 0x23, 0x02, 0x43, 0x23, 
+    0x05, 0xed, 0x01, 0x11, 0x9b, 0x6b, 0x20, 0x6e, 0x5c, 0x6b, 0x20, 0xe5, 
+    0x00, 0x49, 0x02, 0x52, 0x75, 0x01, 0x33, 0x41, 0x49, 0x05, 0xed, 0x00, 
+    0x41, 0xed, 0x00, 0x12, 0x9a, 0x21, 0x91, 0x80, 0x4b, 0xed, 0x1f, 0xed, 
+    0x00, 0x40, 0xed, 0x00, 0xf6, 0xfa, 0xed, 0x01, 0x9a, 0x55, 0xed, 0x02, 
+    0x92, 0xed, 0x02, 0x8a, 0xed, 0x00, 0x9a, 0xed, 0x02, 0x92, 0x35, 0xed, 
+    0x0c, 0x82, 0xdb, 0x20, 0x9a, 0xed, 0x00, 0x0b, 0xe0, 0x24, 0xc3, 0xc2, 
+    0x09, 0xe9, 0x01, 0x6e, 0xf3, 0x92, 0x41, 0x0f, 0xe0, 0xed, 0x00, 0xaa, 
+    0x8a, 0xed, 0x04, 0x82, 0xed, 0x0c, 0x9a, 0xed, 0x04, 0x92, 0xed, 0x04, 
+    0xfa, 0x8a, 0xed, 0x00, 0x82, 0xed, 0x0c, 0x23, 0x02, 0xd3, 0x20, 0x23, 
+    0x02, 0xed, 0x00, 0xaf, 0x23, 0x03, 0xed, 0x0d, 0x49, 0x02, 0xed, 0x00, 
+    0x92, 0xed, 0x02, 0x8a, 0xdb, 0x20, 0x1a, 0x82, 0xed, 0x04, 0xc0, 0xdb, 
+    0x3f, 0xdb, 0x20, 0x90, 0x61, 0xff, 0x54, 0xf7, 0x7f, 0xed, 0x02, 0xdb, 
+    0xdb, 0x22, 0xd3, 0xdb, 0x22, 0xcb, 0x55, 0xdb, 0x20, 0xdb, 0xdb, 0x22, 
+    0xd3, 0xdb, 0x2c, 0xc3, 0xc9, 0x40, 0xdb, 0x55, 0xdb, 0x24, 0xcb, 0xc9, 
+    0x40, 0xd3, 0xdb, 0x24, 0xc3, 0xdb, 0x20, 0xcb, 0x75, 0xdb, 0x24, 0xc3, 
+    0xdb, 0x2c, 0xdb, 0xdb, 0x24, 0x2b, 0x01, 0xdb, 0x21, 0xcb, 0xfd, 0xdb, 
+    0x20, 0xc3, 0xdb, 0x2c, 0x23, 0x02, 0xc1, 0x40, 0x23, 0x02, 0xdb, 0x20, 
+    0x23, 0x03, 0xb9, 0xc9, 0x41, 0x01, 0xe0, 0x5b, 0xe1, 0xe1, 0x29, 0x4f, 
+    0x02, 0x52, 0xb1, 0x60, 0x96, 0xc0, 0x7f, 0x01, 0x19, 0x81, 0xcb, 0xd3, 
+    0x40, 0xc3, 0x01, 0xe3, 0x21, 0x56, 0x0c, 0x59, 0xe2, 0xd3, 0x50, 0xe0, 
+    0xd3, 0x40, 0xc0, 0xd3, 0x41, 0x0e, 0x45, 0xd3, 0x40, 0x0c, 0x55, 0xe0, 
+    0xff, 0xf7, 0x03, 0xe5, 0x22, 0x1c, 0x92, 0x75, 0xd3, 0x41, 0x14, 0x55, 
+    0xd3, 0x41, 0x0c, 0x35, 0x31, 0xe0, 0x20, 0x74, 0x41, 0x09, 0xc2, 0x08, 
+    0x2f, 0xe0, 0x54, 0x24, 0x13, 0x69, 0x61, 0xcf, 0x40, 0x04, 0x15, 0xcb, 
+    0x43, 0x0c, 0x34, 0x6e, 0x98, 0xf3, 0x1c, 0x71, 0xd1, 0x60, 0xcb, 0x40, 
+    0x04, 0x14, 0x7f, 0xe0, 0x16, 0x51, 0xc5, 0x60, 0xbd, 0x61, 0x2c, 0x83, 
+    0xe0, 0x31, 0x6c, 0xf3, 0x74, 0x04, 0x11, 0xd3, 0x44, 0x3e, 0xf5, 0x60, 
+    0xb1, 0x60, 0x2b, 0x01, 0x90, 0xbb, 0xcb, 0x40, 0x27, 0x01, 0xd0, 0xd1, 
+    0x60, 0x23, 0x03, 0xc1, 0x64, 0x4e, 0x19, 0x80, 0xff, 0xb1, 0x60, 0x23, 
+    0x02, 0xcb, 0x40, 0x23, 0x02, 0xd1, 0x60, 0x47, 0x03, 0xc1, 0x61, 0xdf, 
+    0x01, 0x5d, 0x41, 0x80, 0x5e, 0x41, 0x80, 0xcd, 0x40, 0x4b, 0x02, 0x53, 
+    0x73, 0x01, 0xc0, 0x42, 0x0d, 0x6d, 0x01, 0x11, 0x9b, 0x12, 0x9a, 0x7b, 
+    0xe0, 0x11, 0x52, 0x0c, 0x7b, 0xe0, 0x21, 0x91, 0xf1, 0x1f, 0x0c, 0x79, 
+    0xe0, 0xff, 0xa8, 0xf7, 0x8a, 0xf9, 0xc5, 0x61, 0x5d, 0xf1, 0x02, 0x55, 
+    0xf1, 0x00, 0x75, 0xe7, 0x01, 0x4d, 0xf3, 0x00, 0x5d, 0xf3, 0x00, 0x53, 
+    0xe0, 0xf1, 0x06, 0x45, 0x55, 0xf1, 0x04, 0x4d, 0xf1, 0x00, 0x5d, 0xf1, 
+    0x04, 0x45, 0xf1, 0x00, 0x55, 0xf5, 0xf1, 0x08, 0x4d, 0xf1, 0x00, 0x45, 
+    0xf1, 0x0c, 0x2b, 0x01, 0xf1, 0x01, 0x27, 0x01, 0xff, 0xf1, 0x01, 0x23, 
+    0x03, 0xf1, 0x0b, 0x23, 0x02, 0xbd, 0x60, 0x23, 0x02, 0xc3, 0x80, 0x47, 
+    0x03, 0x57, 0xf1, 0x0f, 0x4b, 0x02, 0xf1, 0x00, 0x55, 0xf1, 0x02, 0x4d, 
+    0xf1, 0x04, 0x45, 0xad, 0xf1, 0x00, 0xc0, 0xf1, 0x1f, 0xe3, 0x22, 0x10, 
+    0xdb, 0x40, 0x11, 0xf1, 0x02, 0xaa, 0x9e, 0xe3, 0x22, 0x96, 0xe3, 0x22, 
+    0x8e, 0xe3, 0x20, 0x9e, 0xe3, 0x24, 0xaa, 0x96, 0xe3, 0x26, 0x86, 0xe3, 
+    0x24, 0x8e, 0xe3, 0x20, 0x9e, 0xe3, 0x24, 0xaa, 0x86, 0xe3, 0x20, 0x96, 
+    0xe3, 0x28, 0x8e, 0xe3, 0x20, 0x86, 0xe3, 0x2c, 0xff, 0x2b, 0x01, 0xe3, 
+    0x21, 0x27, 0x01, 0xe3, 0x21, 0x23, 0x03, 0xe3, 0x2b, 0x23, 0x02, 0xaf, 
+    0x80, 0xbf, 0x23, 0x02, 0xb5, 0xa0, 0x47, 0x03, 0xe3, 0x2f, 0x4b, 0x02, 
+    0xe3, 0x20, 0x96, 0xe3, 0x22, 0x44, 0x8e, 0x31, 0xbf, 0xe0, 0x11, 0x12, 
+    0x9a, 0xa7, 0xa1, 0x0c, 0x08, 0xf5, 0xe0, 0x71, 0x8f, 0xc1, 0xb1, 0xfb, 
+    0xf3, 0xf2, 0x00, 0x03, 0xfb, 0x12, 0x13, 0x50, 0xf8, 0x22, 0x00, 0x01, 
+    0x9f, 0xa1, 0x03, 0x02, 0x15, 0x9b, 0x50, 0x1d, 0x03, 0x41, 0xb9, 0xe0, 
+    0xff, 0xf7, 0x9c, 0xf8, 0x41, 0xaf, 0xe1, 0x75, 0x82, 0x82, 0xbb, 0x40, 
+    0xd7, 0x55, 0x01, 0x09, 0xc3, 0xb7, 0xe0, 0x24, 0xcf, 0x35, 0x7f, 0xe0, 
+    0x74, 0x42, 0x9b, 0xc0, 0xc7, 0x15, 0x21, 0xc5, 0xe0, 0x54, 0x83, 0x09, 
+    0xc1, 0xa7, 0xc0, 0xcf, 0x34, 0x09, 0xbf, 0xe0, 0x14, 0x24, 0x61, 0x40, 
+    0x40, 0xc0, 0x02, 0x0a, 0x92, 0x43, 0xb3, 0xe0, 0xdf, 0x71, 0xcd, 0xe0, 
+    0x51, 0x82, 0xbf, 0xe2, 0x04, 0xcf, 0x31, 0xad, 0xe0, 0x11, 0x23, 0x9a, 
+    0x24, 0x91, 0x50, 0x01, 0x0b, 0x43, 0x0b, 0xbf, 0xe0, 0x72, 0xe9, 0xe0, 
+    0x52, 0x48, 0x81, 0x0b, 0xc3, 0x0b, 0x00, 0xcf, 0x32, 0xc9, 0xe0, 0x12, 
+    0x40, 0x22, 0x99, 0x23, 0x92, 0x02, 0x0c, 0x35, 0x01, 0x43, 0x18, 0x0c, 
+    0x82, 0x0c, 0x39, 0x01, 0x35, 0x01, 0xc3, 0x0c, 0x21, 0x8a, 0x9a, 0x39, 
+    0x01, 0x03, 0x9f, 0x40, 0xdf, 0x72, 0x43, 0xa5, 0x40, 0x08, 0xd7, 0x52, 
+    0x83, 0xab, 0x40, 0xcf, 0x32, 0xc0, 0x0d, 0x10, 0x26, 0x9b, 0x22, 0x91, 
+    0xbb, 0xe0, 0x12, 0x1a, 0x60, 0x10, 0x59, 0x60, 0x21, 0x92, 0xe7, 0xc0, 
+    0x9a, 0x99, 0x60, 0x00, 0xda, 0x60, 0x14, 0x98, 0x1c, 0x61, 0x5d, 0x61, 
+    0x00, 0x18, 0x33, 0x26, 0x93, 0x15, 0x9b, 0x41, 0x1c, 0x00, 0x9a, 0x1d, 
+    0x40, 0x29, 0x14, 0x91, 0x15, 0x92, 0x40, 0x7f, 0xf4, 0x39, 0xac, 0x1c, 
+    0xe4, 0xc3, 0xe1, 0xfe, 0x10, 0xf7, 0xa8, 0xff, 0x13, 0xa5, 0x02, 0x0a, 
+    0x68, 0x6f, 0x00, 0xf4, 0x80, 0x73, 0x43, 0x43, 0x03, 0xf1, 0x80, 0x00, 
+    0x71, 0x12, 0x9b, 0x25, 0x92, 0x00, 0xeb, 0x00, 0x00, 0x20, 0x01, 0xf5, 
+    0x80, 0x32, 0x15, 0x92, 0x26, 0x04, 0x90, 0x14, 0xbb, 0xe2, 0x15, 0x22, 
+    0xbe, 0xfb, 0xf2, 0x04, 0xf1, 0x02, 0xb9, 0xe0, 0x03, 0x23, 0x58, 0x43, 
+    0x43, 0x00, 0x1c, 0xde, 0x48, 0xd0, 0xf8, 0x08, 0x26, 0xd0, 0x4b, 0xc3, 
+    0xe0, 0xd3, 0xc0, 0x20, 0xc3, 0xe1, 0x15, 0x98, 0xb7, 0xe1, 0xd2, 0x00, 
+    0x18, 0xcb, 0x18, 0x04, 0x32, 0x04, 0x33, 0x26, 0x80, 0x99, 0xfe, 0xf7, 
+    0xb7, 0xff, 0x20, 0x9a, 0x33, 0x21, 0x48, 0x18, 0x62, 0x83, 0xef, 0x60, 
+    0x10, 0x42, 0xc1, 0xe0, 0x22, 0x02, 0xc1, 0xf9, 0x60, 0x00, 0x02, 0x20, 
+    0x92, 0x1f, 0x9a, 0xc8, 0x03, 0x09, 0x41, 0xd3, 0xe0, 0x18, 0x62, 0x19, 
+    0x01, 0x37, 0x23, 0x84, 0x08, 0x22, 0x1b, 0x01, 0x1e, 0x99, 0x1f, 0x92, 
+    0x35, 0x23, 0x54, 0x18, 0x61, 0xe9, 0xe0, 0x41, 0x35, 0x23, 0x08, 0xaf, 
+    0xc0, 0x00, 0x90, 0x01, 0x1d, 0x9a, 0x1e, 0x35, 0x24, 0x18, 0x62, 0x1b, 
+    0x00, 0x0a, 0x42, 0x35, 0x23, 0x08, 0xfb, 0xc0, 0x00, 0x02, 0x1c, 0x99, 
+    0x9a, 0x1d, 0x35, 0x20, 0x43, 0x37, 0x20, 0x37, 0x04, 0x0c, 0xc3, 0x43, 
+    0x20, 0x01, 0x37, 0x03, 0x1b, 0x9a, 0x1c, 0x91, 0x01, 0x0d, 0x43, 0x86, 
+    0x0d, 0x37, 0x06, 0x09, 0x00, 0x08, 0x22, 0xc0, 0x0d, 0xa9, 0xe0, 0x00, 
+    0x02, 0x1b, 0x92, 0x14, 0x9a, 0x4f, 0xf0, 0x15, 0x00, 0x0c, 0x40, 0x32, 
+    0xb2, 0xfb, 0xfc, 0xf1, 0x0c, 0x00, 0xfb, 0x11, 0x23, 0x03, 0x20, 0x43, 
+    0x43, 0xa6, 0xa9, 0xdf, 0x10, 0x01, 0x33, 0xdd, 0x09, 0x48, 0xdd, 0x04, 
+    0x59, 0xdd, 0x02, 0xaa, 0x51, 0xdd, 0x00, 0x49, 0xdd, 0x02, 0x41, 0xdd, 
+    0x08, 0x59, 0xdd, 0x00, 0xaa, 0x51, 0xdd, 0x04, 0x49, 0xdd, 0x00, 0x41, 
+    0xdd, 0x08, 0x59, 0xdd, 0x00, 0xae, 0x51, 0xdd, 0x04, 0x8d, 0xe3, 0xdd, 
+    0x07, 0x59, 0xdd, 0x00, 0x51, 0xdd, 0x04, 0xfe, 0x49, 0xd9, 0xe1, 0xdd, 
+    0x08, 0x37, 0x04, 0xdd, 0x02, 0xc5, 0xe3, 0xdd, 0x07, 0x37, 0x04, 0x95, 
+    0xe7, 0x00, 0x49, 0xdd, 0x02, 0x41, 0xdd, 0x05, 0x0e, 0x80, 0xdd, 0x00, 
+    0x28, 0xfe, 0xf1, 0x0e, 0xdd, 0x04, 0x6f, 0xdd, 0x18, 0x26, 0x99, 0x40, 
+    0x04, 0x33, 0xfe, 0xf7, 0xd9, 0xfe, 0xbb, 0x23, 0x9a, 0x55, 0xbb, 0x22, 
+    0x92, 0xbb, 0x20, 0x8a, 0xbb, 0x22, 0x82, 0xbb, 0x28, 0x9a, 0x55, 0xbb, 
+    0x20, 0x92, 0xbb, 0x24, 0x8a, 0xbb, 0x20, 0x82, 0xbb, 0x28, 0x9a, 0x5d, 
+    0xbb, 0x20, 0x92, 0xbb, 0x24, 0x7d, 0xe3, 0xbb, 0x27, 0x9a, 0xbb, 0x20, 
+    0x92, 0xf5, 0xbb, 0x24, 0x8a, 0xdb, 0xc0, 0x82, 0xbb, 0x28, 0x37, 0x04, 
+    0xbb, 0x22, 0xb5, 0xe3, 0x57, 0xbb, 0x27, 0x37, 0x04, 0xc5, 0x20, 0x8a, 
+    0xbb, 0x22, 0x82, 0xbb, 0x26, 0xc0, 0x75, 0xbb, 0x2a, 0x37, 0xbb, 0x3e, 
+    0x6a, 0xdd, 0x00, 0xd5, 0x41, 0xd1, 0x61, 0xdb, 0x55, 0x9d, 0x42, 0xd3, 
+    0x9d, 0x40, 0xcb, 0x9d, 0x42, 0xc3, 0x9d, 0x48, 0xdb, 0x55, 0x9d, 0x40, 
+    0xd3, 0x9d, 0x44, 0xcb, 0x9d, 0x40, 0xc3, 0x9d, 0x48, 0xdb, 0x5d, 0x9d, 
+    0x40, 0xd3, 0x9d, 0x44, 0x71, 0xe3, 0x9d, 0x47, 0xdb, 0x9d, 0x40, 0xd3, 
+    0xfd, 0x9d, 0x44, 0xcb, 0xbd, 0xe1, 0x9d, 0x48, 0x37, 0x04, 0x9d, 0x42, 
+    0xa9, 0xe3, 0x9d, 0x47, 0x0b, 0x37, 0x04, 0xa7, 0x40, 0xcb, 0x9d, 0x42, 
+    0xc3, 0x02, 0x15, 0x23, 0x80, 0x1b, 0x92, 0x0e, 0xf5, 0x80, 0x72, 0xb2, 
+    0x73, 0xe3, 0xa8, 0x20, 0x03, 0x22, 0xaf, 0xe3, 0x50, 0x83, 0x60, 0xdd, 
+    0x83, 0x70, 0x29, 0x7f, 0x69, 0xf7, 0xfd, 0xe5, 0x02, 0xc0, 0xb7, 0x81, 
+    0x1c, 0x72, 0x29, 0x83, 0x61, 0x14, 0x52, 0x49, 0xe0, 0x32, 0x83, 0x61, 
+    0x04, 0x12, 0xe9, 0x83, 0x67, 0x1c, 0x72, 0x19, 0x01, 0x83, 0xc5, 0x80, 
+    0x1b, 0x00, 0xa5, 0xe0, 0x54, 0x04, 0x12, 0x83, 0x67, 0x1c, 0xb9, 0x80, 
+    0x14, 0xb9, 0x84, 0x0c, 0xa9, 0xb9, 0x80, 0x04, 0x11, 0x83, 0x67, 0x1c, 
+    0xb9, 0x80, 0x14, 0xb9, 0x84, 0xf2, 0x0c, 0xb9, 0x80, 0x04, 0x12, 0x83, 
+    0x67, 0x37, 0x04, 0x83, 0x62, 0x37, 0x03, 0xb7, 0x83, 0x67, 0x37, 0x04, 
+    0x8d, 0x60, 0x0c, 0xbb, 0x80, 0x65, 0xe0, 0x12, 0xe5, 0x01, 0xd7, 0x69, 
+    0xe0, 0xe5, 0x08, 0xdf, 0x01, 0xa5, 0xdf, 0x1c, 0x87, 0xdf, 0x03, 0xc5, 
+    0x22, 0xaa, 0x5d, 0xdf, 0x02, 0x55, 0xdf, 0x00, 0x4d, 0xdf, 0x02, 0x45, 
+    0xdf, 0x08, 0x9a, 0x5d, 0xdf, 0x00, 0x55, 0xdf, 0x00, 0x9b, 0xa1, 0x4d, 
+    0x32, 0x1b, 0x01, 0x65, 0x63, 0x83, 0x62, 0x7b, 0xe0, 0x43, 0x0a, 0xa9, 
+    0xe0, 0x99, 0xa4, 0x4d, 0x55, 0x99, 0xa0, 0x45, 0xdf, 0x08, 0x5d, 0x99, 
+    0xa0, 0x55, 0x99, 0xa4, 0x4d, 0xf5, 0x99, 0xa0, 0x45, 0xdf, 0x08, 0x5d, 
+    0xd1, 0xa0, 0x37, 0x00, 0x63, 0x82, 0x37, 0x03, 0x57, 0x63, 0x87, 0x37, 
+    0x04, 0x6d, 0x80, 0x4d, 0xdf, 0x02, 0x45, 0xdf, 0x02, 0x0e, 0x54, 0xf5, 
+    0xc0, 0xdf, 0x0c, 0x6d, 0xbf, 0x3c, 0x17, 0xbf, 0x28, 0x9e, 0x55, 0xbf, 
+    0x22, 0x96, 0xbf, 0x20, 0x8e, 0xbf, 0x22, 0x86, 0xbf, 0x28, 0x9e, 0x55, 
+    0xbf, 0x20, 0x96, 0xdf, 0x04, 0x8e, 0xdf, 0x00, 0x86, 0xbf, 0x28, 0x9e, 
+    0x55, 0x79, 0xc0, 0x96, 0x79, 0xc4, 0x8e, 0x79, 0xc0, 0x86, 0xbf, 0x24, 
+    0x61, 0xa1, 0x51, 0x00, 0x43, 0x0b, 0x81, 0x0b, 0xb5, 0xe0, 0x52, 0xb3, 
+    0xe0, 0xf4, 0x32, 0xc3, 0x09, 0x00, 0x86, 0xbf, 0x28, 0x37, 0x04, 0x43, 
+    0xa2, 0x37, 0x03, 0x55, 0x43, 0xa7, 0x9e, 0xb1, 0xc0, 0x96, 0xbf, 0x22, 
+    0x8e, 0xbf, 0x22, 0x86, 0x55, 0xbf, 0x24, 0xe0, 0xbf, 0x2c, 0x35, 0x23, 
+    0xc5, 0xe6, 0x23, 0xc1, 0x5e, 0xa9, 0x9f, 0x4e, 0xa7, 0xfc, 0x85, 0x61, 
+    0x40, 0x9f, 0x42, 0xdf, 0x9f, 0x42, 0xaa, 0xd7, 0x9f, 0x40, 0xcf, 0x9f, 
+    0x42, 0xc7, 0x9f, 0x48, 0xdf, 0x9f, 0x40, 0xf7, 0xeb, 0xc0, 0x5b, 0xe3, 
+    0xbf, 0x20, 0xc7, 0x9f, 0x48, 0x59, 0xef, 0x23, 0xc7, 0x59, 0xe5, 0x3b, 
+    0x57, 0xe1, 0xdf, 0x01, 0xc7, 0x9f, 0x48, 0x91, 0xe4, 0x23, 0xc2, 0xcf, 
+    0x31, 0x02, 0x1b, 0x59, 0xf4, 0x25, 0x9b, 0x1c, 0x91, 0xc0, 0x0d, 0x10, 
+    0x59, 0x60, 0x1d, 0x99, 0x5d, 0xe3, 0x99, 0x60, 0x1b, 0x02, 0x92, 0x7f, 
+    0x63, 0x1f, 0x98, 0x1e, 0x9a, 0x20, 0x99, 0x20, 0xda, 0x60, 0x18, 0x61, 
+    0x59, 0x61, 0xe0, 0x25, 0x93, 0x80, 0x14, 0x9b, 0x5a, 0x1c, 0x40, 0x2a, 
+    0x14, 0x5d, 0xe0, 0x00, 0x68, 0xac, 0xff, 0xf7, 0x6d, 0xb8, 0x0b, 0x68, 
+    0x30, 0x14, 0x92, 0xe2, 0x48, 0x39, 0xe1, 0x23, 0xe0, 0x16, 0x15, 0x08, 
+    0x22, 0x15, 0x91, 0x3f, 0xe5, 0x25, 0x90, 0x15, 0x98, 0x10, 0xdd, 0xf8, 
+    0x94, 0xe0, 0x33, 0xe1, 0x12, 0x92, 0x03, 0x00, 0x20, 0x00, 0xfb, 0x0e, 
+    0x11, 0x48, 0x1d, 0x11, 0x02, 0x93, 0x91, 0xe3, 0xf9, 0xfb, 0x1a, 0x9b, 
+    0x19, 0x99, 0x10, 0x4f, 0xea, 0x50, 0x02, 0x37, 0xe0, 0x63, 0x4f, 0xea, 
+    0x02, 0x90, 0xcf, 0xc0, 0x10, 0x43, 0x4f, 0xea, 0xd0, 0x0e, 0x00, 0x6c, 
+    0xf3, 0x08, 0x23, 0x6e, 0xf3, 0x00, 0x03, 0x40, 0x1a, 0x93, 0x4f, 0xea, 
+    0x10, 0x13, 0x21, 0x00, 0x12, 0x55, 0x3d, 0xe0, 0x61, 0x21, 0x00, 0x1c, 
+    0x21, 0x00, 0x41, 0x21, 0x00, 0x1e, 0x85, 0x21, 0x00, 0x21, 0x21, 0x00, 
+    0x01, 0x19, 0x91, 0x18, 0x41, 0x00, 0x5c, 0x10, 0x23, 0x45, 0x00, 0x19, 
+    0xe0, 0x23, 0x02, 0x2c, 0x23, 0x04, 0x2e, 0xd1, 0x23, 0x05, 0x18, 0x91, 
+    0x17, 0x23, 0x01, 0x33, 0x69, 0x00, 0xb9, 0x60, 0x15, 0x47, 0x02, 0x3c, 
+    0x47, 0x04, 0x3e, 0x47, 0x05, 0x17, 0x91, 0x16, 0x5b, 0x47, 0x01, 0x7d, 
+    0x00, 0x50, 0xbb, 0xe0, 0x6b, 0x02, 0x4c, 0x6b, 0x04, 0x4e, 0x93, 0x6b, 
+    0x01, 0xbb, 0x21, 0x03, 0x0d, 0x71, 0x01, 0x16, 0x91, 0xc9, 0xe0, 0x10, 
+    0x6c, 0x41, 0x0d, 0x82, 0x61, 0xe0, 0x10, 0x4c, 0x14, 0x02, 0x9b, 0xaf, 
+    0xe0, 0x2c, 0x12, 0x9a, 0x40, 0x33, 0xb3, 0x0b, 0xf3, 0x00, 0x65, 0xe2, 
+    0x0c, 0xf9, 0x00, 0x30, 0x15, 0x9b, 0x25, 0x1c, 0x90, 0x53, 0x4d, 0xe0, 
+    0xfd, 0x01, 0xed, 0x01, 0x03, 0x21, 0x01, 0x00, 0xfb, 0x0e, 0x20, 0x05, 
+    0x30, 0xfe, 0xf7, 0x7e, 0xe8, 0xfb, 0x1a, 0x9a, 0xf3, 0x00, 0x0c, 0x4d, 
+    0xe1, 0xf3, 0x00, 0xeb, 0x00, 0x24, 0x51, 0x42, 0xf3, 0x00, 0x01, 0x6e, 
+    0x35, 0xe4, 0x1a, 0x92, 0xf6, 0x19, 0x1f, 0x00, 0xf5, 0x02, 0x1c, 0x55, 
+    0xe1, 0x17, 0x20, 0xed, 0x00, 0x23, 0x02, 0x62, 0x11, 0x23, 0x05, 0x19, 
+    0x92, 0x18, 0x23, 0x01, 0xf5, 0x01, 0x2c, 0x1f, 0x23, 0x04, 0xed, 0x00, 
+    0x47, 0x02, 0x15, 0x20, 0x7d, 0xe3, 0x18, 0x92, 0x17, 0xbb, 0x47, 0x01, 
+    0xf5, 0x01, 0x3c, 0x47, 0x04, 0xed, 0x00, 0x6b, 0x02, 0x31, 0x6b, 0x05, 
+    0xd8, 0x17, 0x92, 0x16, 0x6b, 0x01, 0xf5, 0x01, 0x4c, 0x6b, 0x04, 0xed, 
+    0x00, 0x9d, 0x8f, 0x02, 0x41, 0x8f, 0x01, 0xf5, 0x03, 0xe7, 0xe1, 0x16, 
+    0x92, 0xe1, 0xe0, 0x08, 0x6c, 0x42, 0x0d, 0xef, 0x01, 0x51, 0x4c, 0x12, 
+    0x9a, 0xa0, 0x81, 0x0d, 0x80, 0x33, 0xc0, 0x7b, 0xe1, 0x2c, 0xf7, 0x01, 
+    0xab, 0x7d, 0xe0, 0xf5, 0x1c, 0x03, 0xf5, 0x06, 0x9a, 0xf5, 0x04, 0x92, 
+    0xf5, 0x04, 0xff, 0x4d, 0xe3, 0xf5, 0x0b, 0x23, 0x02, 0xe3, 0x20, 0x23, 
+    0x02, 0xf5, 0x00, 0x71, 0xe3, 0xf5, 0x0b, 0xff, 0x47, 0x02, 0xe3, 0x20, 
+    0x47, 0x02, 0x0b, 0x40, 0x95, 0xe3, 0xf5, 0x0b, 0x6b, 0x02, 0xe3, 0x20, 
+    0x7f, 0x6b, 0x02, 0xf5, 0x00, 0xb9, 0xe3, 0xf5, 0x0b, 0x8f, 0x02, 0xe3, 
+    0x20, 0x8f, 0x02, 0x41, 0x57, 0xa3, 0x61, 0x93, 0x01, 0xf5, 0x01, 0x82, 
+    0xf5, 0x02, 0x9a, 0xf5, 0x04, 0x92, 0x55, 0xf5, 0x02, 0xc0, 0xf5, 0x02, 
+    0x8a, 0xf5, 0x04, 0x82, 0xeb, 0x3c, 0x88, 0xea, 0xfa, 0xeb, 0x25, 0xdb, 
+    0xeb, 0x24, 0xd3, 0xeb, 0x24, 0x61, 0xe3, 0xeb, 0x2b, 0xff, 0x23, 0x02, 
+    0xd9, 0x40, 0x23, 0x02, 0xeb, 0x20, 0x85, 0xe3, 0xeb, 0x2b, 0x47, 0x02, 
+    0xd9, 0x40, 0xff, 0x47, 0x02, 0x01, 0x60, 0xa9, 0xe3, 0xeb, 0x29, 0x33, 
+    0xe3, 0x4d, 0x04, 0xdf, 0x40, 0x71, 0x02, 0x7f, 0xf1, 0x20, 0xd3, 0xe3, 
+    0xf1, 0x2b, 0x95, 0x02, 0xdf, 0x40, 0x95, 0x02, 0xfb, 0x04, 0xcb, 0x55, 
+    0xfb, 0x02, 0xc3, 0xf1, 0x22, 0xdb, 0xf1, 0x20, 0x81, 0xf3, 0x22, 0xd3, 
+    0xa0, 0x4c, 0xc0, 0x0d, 0x12, 0x9a, 0xe1, 0xe0, 0x2c, 0xa9, 0xe0, 0x40, 
+    0x0c, 0x03, 0xf5, 0x80, 0x70, 0xb0, 0xe3, 0x63, 0x03, 0x30, 0x15, 0x98, 
+    0x25, 0x93, 0x8f, 0xe0, 0xe9, 0x4b, 0x23, 0x58, 0x90, 0x1d, 0xfe, 0xf7, 
+    0x09, 0xfd, 0x06, 0x1c, 0x72, 0xe9, 0x43, 0x94, 0x14, 0x52, 0xe9, 0x43, 
+    0x0c, 0x99, 0xc0, 0x04, 0x12, 0xe9, 0x4b, 0xff, 0x23, 0x02, 0xd7, 0x60, 
+    0x23, 0x02, 0xe9, 0x40, 0x23, 0x03, 0xe9, 0x4b, 0x47, 0x02, 0xd7, 0x60, 
+    0xff, 0x47, 0x02, 0xff, 0x60, 0x47, 0x03, 0xe9, 0x4b, 0x6b, 0x02, 0xd7, 
+    0x60, 0x6b, 0x02, 0xe9, 0x40, 0x7f, 0x6b, 0x03, 0xe9, 0x4b, 0x8f, 0x02, 
+    0xd7, 0x60, 0x8f, 0x02, 0xe9, 0x40, 0x8f, 0x03, 0x16, 0x4a, 0x92, 0xe5, 
+    0x63, 0x42, 0x1b, 0xa0, 0x1c, 0x7c, 0xf7, 0x03, 0x14, 0x12, 0x5c, 0xf7, 
+    0x03, 0x0c, 0x3c, 0xbb, 0xe0, 0x1c, 0x03, 0xf5, 0xa2, 0xa0, 0xf7, 0x1f, 
+    0xf7, 0x8d, 0xf9, 0xe1, 0x65, 0x5d, 0xf7, 0x04, 0xfe, 0x55, 0xf7, 0x04, 
+    0x91, 0xe3, 0xe1, 0x6b, 0x23, 0x02, 0xcf, 0x80, 0x23, 0x02, 0xe1, 0x60, 
+    0xff, 0xb5, 0xe3, 0xe1, 0x6b, 0x47, 0x02, 0xcf, 0x80, 0x47, 0x02, 0xf7, 
+    0x80, 0xd9, 0xe3, 0xe1, 0x6b, 0xff, 0x6b, 0x02, 0xcf, 0x80, 0x6b, 0x02, 
+    0xe1, 0x60, 0xfd, 0xe3, 0xe1, 0x6b, 0x8f, 0x02, 0xcf, 0x80, 0xd3, 0x8f, 
+    0x02, 0xeb, 0x44, 0x4d, 0x32, 0xe1, 0x61, 0x45, 0xfd, 0x00, 0x8b, 0x00, 
+    0xaa, 0x7c, 0xef, 0x25, 0x55, 0xf7, 0x04, 0x4d, 0xf7, 0x00, 0x45, 0xf7, 
+    0x00, 0x52, 0xc0, 0xef, 0x3f, 0xf7, 0x11, 0xf7, 0x06, 0x9e, 0xef, 0x24, 
+    0x96, 0xff, 0xef, 0x24, 0xa9, 0xe3, 0xd9, 0x8b, 0x23, 0x02, 0xc7, 0xa0, 
+    0x23, 0x02, 0xd9, 0x80, 0xcd, 0xe3, 0xff, 0xd9, 0x8b, 0x47, 0x02, 0xc7, 
+    0xa0, 0x47, 0x02, 0xef, 0xa0, 0xf1, 0xe3, 0xd9, 0x8b, 0x6b, 0x02, 0xff, 
+    0xc7, 0xa0, 0x6b, 0x02, 0xd9, 0x80, 0x6b, 0x03, 0xd9, 0x8b, 0x8f, 0x02, 
+    0xc7, 0xa0, 0x8f, 0x02, 0xa9, 0xd9, 0x80, 0x8e, 0x32, 0xd9, 0x85, 0x86, 
+    0xf7, 0x02, 0x9e, 0xf7, 0x06, 0xaa, 0x96, 0xef, 0x24, 0x8e, 0xef, 0x20, 
+    0x86, 0xef, 0x20, 0xe0, 0xe7, 0x48, 0x03, 0xe5, 0x41, 0xb9, 0xc1, 0x4f, 
+    0xf0, 0x03, 0x0e, 0x0e, 0xfb, 0x08, 0x03, 0x21, 0x48, 0xe3, 0x40, 0x97, 
+    0xf8, 0x1a, 0x9b, 0x05, 0xd7, 0xe1, 0x42, 0xd7, 0xe1, 0x73, 0x81, 0x08, 
+    0x62, 0xf3, 0x24, 0xd7, 0x53, 0x83, 0xe0, 0x33, 0xc2, 0x09, 0x00, 0xc7, 
+    0x13, 0x80, 0x19, 0x99, 0x1a, 0x93, 0x03, 0x09, 0x42, 0xd7, 0xe1, 0x42, 
+    0x71, 0x19, 0x00, 0x51, 0x83, 0x09, 0xc2, 0xd7, 0xe1, 0x31, 0x85, 0x1b, 
+    0x00, 0x11, 0xb9, 0xc1, 0x03, 0x0a, 0x42, 0x0a, 0x1b, 0x06, 0x5c, 0x0a, 
+    0xc2, 0x0b, 0x00, 0x1b, 0x03, 0xb1, 0xc1, 0x03, 0xc5, 0xe0, 0xdf, 0x60, 
+    0x71, 0x42, 0x0b, 0x83, 0x0b, 0x39, 0x01, 0x35, 0x01, 0xc2, 0x09, 0x09, 
+    0x00, 0xc7, 0x11, 0xa9, 0xc1, 0x03, 0x0c, 0x42, 0x0c, 0x09, 0x53, 0x06, 
+    0x0c, 0xc2, 0x0b, 0x00, 0xcf, 0x31, 0x03, 0x0d, 0x97, 0x55, 0x01, 0xd5, 
+    0xe0, 0xc3, 0x20, 0x83, 0x0b, 0x00, 0xd7, 0x5c, 0xd5, 0xe0, 0x00, 0x3c, 
+    0x11, 0x9b, 0x18, 0x9a, 0x59, 0x60, 0xc0, 0x24, 0x0d, 0x16, 0x03, 0xe0, 
+    0xda, 0x60, 0xd9, 0xe0, 0x1c, 0x14, 0x00, 0x9a, 0x19, 0x98, 0x99, 0x60, 
+    0x1a, 0x99, 0x18, 0x80, 0x61, 0x50, 0x1c, 0xc3, 0xf8, 0x00, 0xc0, 0xd3, 
+    0xe1, 0x00, 0x40, 0x28, 0x14, 0x90, 0x7f, 0xf4, 0x1d, 0xac, 0x00, 0xfe, 
+    0xf7, 0x86, 0xbc, 0x0e, 0x4c, 0x0e, 0x48, 0x00, 0x25, 0x68, 0x0e, 0x49, 
+    0x29, 0x95, 0x29, 0x9c, 0x00, 0x08, 0x60, 0x0a, 0x34, 0x0a, 0x4e, 0x37, 
+    0x68, 0x00, 0x28, 0x97, 0x28, 0x9b, 0x72, 0xb6, 0xa3, 0x42, 0x00, 0x08, 
+    0xd2, 0x09, 0x4d, 0x4a, 0xf2, 0x02, 0x61, 0x00, 0x4b, 0xf2, 0x80, 0x46, 
+    0x29, 0x80, 0x2e, 0x80, 0x00, 0x62, 0xb6, 0xef, 0xe7, 0x06, 0x48, 0x00, 
+    0x22, 0x00, 0x02, 0x70, 0xfe, 0xe7, 0x00, 0xbf, 0xe0, 0x07, 0x00, 0x00, 
+    0x20, 0x46, 0x43, 0x62, 0x74, 0xfc, 0x1f, 0x00, 0x00, 0x20, 0x0c, 0x20, 
+    0x05, 0x40, 0x08, 0x21, 0x00, 0x07, 0x40, 0x2d, 0xe9, 0xf0, 0x41, 0x11, 
+    0x4d, 0x00, 0x05, 0xf5, 0xc1, 0x64, 0x04, 0xf1, 0x0c, 0x08, 0x00, 0x04, 
+    0xf1, 0x74, 0x07, 0x40, 0x46, 0x00, 0xf0, 0x80, 0x20, 0xf8, 0x04, 0xf1, 
+    0xdc, 0x06, 0x38, 0x09, 0x00, 0x08, 0x1b, 0xf8, 0x30, 0x0f, 0x00, 0x18, 
+    0xf8, 0x04, 0xf5, 0x00, 0xa2, 0x70, 0x00, 0xf0, 0x14, 0xf8, 0x07, 0x48, 
+    0x00, 0x08, 0x4a, 0xc5, 0xf8, 0x08, 0x86, 0x40, 0x21, 0x00, 0x00, 0x23, 
+    0xc5, 0xf8, 0x0c, 0x76, 0xc5, 0xf8, 0x00, 0x10, 0x66, 0xbd, 0xe8, 0xf0, 
+    0x41, 0x00, 0xf0, 0x04, 0xb4, 0xb8, 0xd7, 0x81, 0xc8, 0x1c, 0x00, 0x20, 
+    0x40, 0x00, 0xe0, 0xff, 0x1f, 0x38, 0xb5, 0x05, 0x46, 0x00, 0x00, 0x24, 
+    0xfd, 0xf7, 0x53, 0xfd, 0x00, 0x23, 0xc2, 0x00, 0x18, 0x01, 0x33, 0x00, 
+    0x21, 0x40, 0x2b, 0x11, 0x00, 0x71, 0xf9, 0xd1, 0x28, 0x51, 0x04, 0x34, 
+    0x64, 0x00, 0x2c, 0xf2, 0xd1, 0x28, 0x46, 0x38, 0xbd, 0x38, 0x20, 0xb5, 
+    0x04, 0x46, 0x08, 0x79, 0x6d, 0x00, 0x05, 0x00, 0x00, 0xf0, 0x1f, 0x03, 
+    0x00, 0xf0, 0xc0, 0x00, 0x40, 0x00, 0x28, 0xed, 0xb2, 0x14, 0xd0, 0x80, 
+    0x28, 0x22, 0x00, 0xd0, 0x20, 0xbb, 0x94, 0xf8, 0xae, 0x21, 0x3a, 0x00, 
+    0xbb, 0xa2, 0x68, 0x18, 0x2b, 0x9a, 0xbf, 0x52, 0x00, 0xf8, 0x23, 0x00, 
+    0x42, 0xf8, 0x23, 0x10, 0x08, 0x00, 0x46, 0xfd, 0xf7, 0x50, 0xfd, 0xcd, 
+    0xb1, 0x01, 0x00, 0x21, 0x84, 0xf8, 0xae, 0x11, 0x15, 0xe0, 0x18, 0x00, 
+    0x2b, 0x97, 0xbf, 0x04, 0xeb, 0x83, 0x03, 0x08, 0x00, 0x46, 0xd3, 0xf8, 
+    0x44, 0x01, 0xc3, 0xf8, 0x44, 0x00, 0x11, 0xfd, 0xf7, 0x40, 0xfd, 0x4d, 
+    0xb1, 0x01, 0x00, 0x23, 0x84, 0xf8, 0xaf, 0x31, 0x05, 0xe0, 0x48, 0x20, 
+    0x79, 0x84, 0xf8, 0xac, 0x01, 0x35, 0x01, 0x35, 0xfd, 0x00, 0x01, 0x20, 
+    0x84, 0xf8, 0xad, 0x01, 0x38, 0xbd, 0x00, 0x09, 0x4a, 0x83, 0x68, 0x12, 
+    0x68, 0x01, 0x68, 0x00, 0x82, 0xb0, 0x01, 0x92, 0x01, 0x9a, 0x5a, 0x66, 
+    0x00, 0x42, 0x68, 0x81, 0x60, 0x80, 0xe8, 0x0c, 0x00, 0x00, 0x04, 0x4b, 
+    0x18, 0x68, 0x41, 0x1c, 0x19, 0x60, 0x50, 0x02, 0xb0, 0x70, 0x47, 0x2b, 
+    0x23, 0xe8, 0xcb, 0x00, 0x10, 0x00, 0xb5, 0x00, 0x23, 0x1f, 0x21, 0xb3, 
+    0xfb, 0xf1, 0x00, 0xf2, 0x00, 0xeb, 0x82, 0x04, 0x01, 0xfb, 0x12, 0x00, 
+    0x31, 0xd4, 0xf8, 0x44, 0x41, 0x04, 0xeb, 0x41, 0x00, 0x02, 0xd1, 0x88, 
+    0x04, 0x4a, 0x49, 0x08, 0x22, 0x00, 0xf8, 0x13, 0x10, 0x01, 0x33, 0x40, 
+    0xf2, 0x03, 0x80, 0x31, 0x8b, 0x42, 0xea, 0xd1, 0x10, 0xbd, 0xdb, 0xa1, 
+    0x00, 0x38, 0xb5, 0x90, 0xf8, 0xac, 0x31, 0x03, 0xf0, 0x00, 0x04, 0x02, 
+    0x04, 0x46, 0xd0, 0xb2, 0x18, 0xb1, 0x00, 0x03, 0xf0, 0x08, 0x05, 0xe9, 
+    0xb2, 0x01, 0xe0, 0x00, 0x94, 0xf8, 0xad, 0x11, 0x20, 0x23, 0x09, 0xb1, 
+    0x40, 0x0d, 0x4a, 0x00, 0xe0, 0x0d, 0x4a, 0xdf, 0x00, 0x01, 0x10, 0x13, 
+    0x60, 0x00, 0x25, 0x95, 0x00, 0x51, 0x20, 0xb1, 0x40, 0x20, 0x46, 0xff, 
+    0xf7, 0xb2, 0xff, 0xd5, 0x00, 0x51, 0x20, 0x94, 0xf8, 0xaf, 0x11, 0x29, 
+    0x0f, 0x02, 0xc1, 0xff, 0x02, 0x00, 0xc7, 0x02, 0xbd, 0xe8, 0x38, 0x40, 
+    0xfd, 0xf7, 0x80, 0x28, 0xba, 0x84, 0xf0, 0x0f, 0x40, 0x88, 0x03, 0x00, 
+    0x00, 0x30, 0xb5, 0x04, 0x4c, 0x18, 0x25, 0x21, 0x80, 0x00, 0x05, 0xfb, 
+    0x01, 0x21, 0x62, 0x60, 0xa1, 0x60, 0x20, 0x23, 0x73, 0x30, 0xbd, 0xcc, 
+    0x77, 0x20, 0xf8, 0xb5, 0x00, 0x5b, 0x4b, 0x19, 0x88, 0x18, 0x26, 0x4e, 
+    0x43, 0x00, 0x00, 0x24, 0xb4, 0x42, 0x07, 0xd0, 0x57, 0x4f, 0x00, 0x7d, 
+    0x68, 0x00, 0x20, 0x28, 0x55, 0xbb, 0x68, 0x00, 0x18, 0x55, 0x01, 0x34, 
+    0xf5, 0xe7, 0x54, 0x4e, 0x00, 0xff, 0x20, 0x01, 0x21, 0x30, 0x60, 0x02, 
+    0x20, 0x20, 0xfd, 0xf7, 0x81, 0xf8, 0x0e, 0x0b, 0x00, 0xfd, 0xf7, 0x88, 
+    0x7d, 0xf8, 0x07, 0x07, 0x02, 0x79, 0xf8, 0x08, 0x0f, 0x02, 0x88, 0x75, 
+    0xf8, 0x06, 0x17, 0x02, 0x71, 0xf8, 0x14, 0x1f, 0x02, 0x88, 0x6d, 0xf8, 
+    0x15, 0x27, 0x02, 0x69, 0xf8, 0x05, 0x2f, 0x02, 0x00, 0x65, 0xf8, 0x42, 
+    0x4a, 0x43, 0x4b, 0x15, 0x7b, 0x00, 0x43, 0x48, 0x05, 0xf0, 0x10, 0x07, 
+    0xf9, 0xb2, 0x00, 0x00, 0x29, 0x0c, 0xbf, 0x05, 0x46, 0x1d, 0x46, 0x00, 
+    0x29, 0x46, 0x03, 0x20, 0xfc, 0xf7, 0xe4, 0xff, 0x00, 0x04, 0x20, 0x29, 
+    0x46, 0xfc, 0xf7, 0xe0, 0xff, 0x08, 0x3c, 0x21, 0x03, 0x65, 0x00, 0x6a, 
+    0xf8, 0x04, 0x20, 0x02, 0xb0, 0x65, 0x00, 0x66, 0xf8, 0x38, 0x4f, 0x39, 
+    0x4a, 0x80, 0x39, 0x4d, 0x3a, 0x60, 0x03, 0x20, 0x02, 0x75, 0x00, 0x20, 
+    0x42, 0xf8, 0x0f, 0x20, 0x00, 0x7d, 0x00, 0x3e, 0xf8, 0x00, 0x35, 0x49, 
+    0x36, 0x4b, 0x36, 0x4f, 0x19, 0x60, 0x00, 0x01, 0xf5, 0x00, 0x70, 0x28, 
+    0x60, 0x3a, 0x68, 0x00, 0x34, 0x4d, 0xdf, 0xf8, 0xf8, 0xc0, 0x42, 0xf0, 
+    0x00, 0x20, 0x01, 0x39, 0x60, 0x57, 0xf8, 0x04, 0x3c, 0x00, 0x31, 0x4a, 
+    0x43, 0xf0, 0x02, 0x00, 0x47, 0xf8, 0x00, 0x04, 0x0c, 0x30, 0x4f, 0x30, 
+    0x48, 0x00, 0x23, 0x00, 0x01, 0x21, 0x2b, 0x60, 0xeb, 0x60, 0x17, 0x60, 
+    0x00, 0x93, 0x80, 0xd3, 0x80, 0x91, 0x60, 0xd3, 0x60, 0x00, 0x10, 0x61, 
+    0x2c, 0x48, 0x93, 0x82, 0xa2, 0xb2, 0x00, 0x02, 0x80, 0xc0, 0xf8, 0x02, 
+    0x30, 0x08, 0x20, 0x80, 0xac, 0xf8, 0x00, 0x00, 0xac, 0xf8, 0x02, 0x07, 
+    0x00, 0x00, 0x08, 0x10, 0xac, 0xf8, 0x0a, 0x30, 0xcc, 0xf8, 0x00, 0x0c, 
+    0x10, 0xc4, 0xf1, 0x00, 0x0c, 0x23, 0x4c, 0x02, 0xc4, 0x4b, 0x60, 0xdf, 
+    0xf8, 0xa0, 0xc0, 0xc4, 0xf8, 0x00, 0x04, 0xc0, 0x23, 0x81, 0x62, 0x81, 
+    0xe3, 0x60, 0x00, 0x20, 0x82, 0x62, 0x82, 0x67, 0x61, 0x23, 0x83, 0x00, 
+    0x63, 0x83, 0xe1, 0x61, 0x1c, 0x49, 0x1d, 0x46, 0x00, 0x0b, 0x60, 0x4e, 
+    0x60, 0x0b, 0x81, 0x4a, 0x81, 0x00, 0xcb, 0x60, 0x1a, 0x4b, 0x0a, 0x21, 
+    0x19, 0x80, 0x00, 0x19, 0x49, 0x5a, 0x80, 0xb2, 0x22, 0x0d, 0x70, 0x00, 
+    0xb3, 0x23, 0x0a, 0x70, 0xb1, 0x22, 0x4d, 0x70, 0x00, 0x4b, 0x70, 0x8d, 
+    0x70, 0x8a, 0x70, 0x15, 0x49, 0x00, 0x1c, 0x34, 0x08, 0x60, 0xf8, 0xbd, 
+    0x00, 0xbf, 0x05, 0x73, 0x21, 0xc8, 0x93, 0x20, 0x80, 0x1a, 0x06, 0x00, 
+    0x00, 0x00, 0x35, 0x0c, 0x00, 0x00, 0xa0, 0x04, 0x40, 0x00, 0x20, 0x03, 
+    0x01, 0x00, 0x34, 0x90, 0x07, 0x00, 0x01, 0x02, 0x80, 0x00, 0x00, 0xb0, 
+    0x04, 0x40, 0x40, 0x80, 0x13, 0x00, 0x00, 0x80, 0x00, 0x40, 0x20, 0x90, 
+    0x00, 0x40, 0xfa, 0x50, 0x47, 0x00, 0x00, 0xc4, 0xc3, 0x20, 0x36, 0x0b, 
+    0x00, 0x4c, 0x15, 0x0f, 0x00, 0x6c, 0x13, 0x00, 0x7c, 0x17, 0x00, 0x01, 
+    0x10, 0x02, 0x40, 0x40, 0x00, 0xe1, 0x00, 0xe0, 0x3c, 0x23, 0x00, 0xc0, 
+    0x01, 0xe3, 0x20, 0x08, 0xb5, 0x05, 0x4b, 0x03, 0x22, 0x1a, 0x00, 0x70, 
+    0xfd, 0xf7, 0x64, 0xf8, 0x03, 0x49, 0x08, 0x40, 0x61, 0x00, 0x20, 0x08, 
+    0x75, 0x08, 0x6f, 0x00, 0x1f, 0x03, 0x47, 0x00, 0xe7, 0x21, 0x10, 0xb5, 
+    0x07, 0x4c, 0x23, 0x7d, 0x00, 0x43, 0xb9, 0xfd, 0xf7, 0x54, 0xf8, 0x21, 
+    0x69, 0x00, 0x40, 0x1a, 0x31, 0x28, 0x8c, 0xbf, 0x00, 0x20, 0x30, 0x01, 
+    0x20, 0x10, 0xbd, 0x03, 0x01, 0x97, 0x03, 0x08, 0xb5, 0x00, 0x1b, 0x4b, 
+    0x1a, 0x7d, 0x00, 0x2a, 0xfb, 0xd1, 0x00, 0x98, 0x68, 0x59, 0x68, 0x58, 
+    0x60, 0x99, 0x60, 0x00, 0x18, 0x4b, 0x18, 0x60, 0xfd, 0xf7, 0x3b, 0xf8, 
+    0x08, 0x15, 0x4a, 0x11, 0x33, 0x02, 0xf8, 0xd9, 0x14, 0x4b, 0x00, 0x19, 
+    0x68, 0x18, 0x33, 0x1b, 0x68, 0x72, 0xb6, 0x01, 0x3b, 0x00, 0x75, 0x12, 
+    0x4a, 0x10, 0x68, 0x98, 0x42, 0x24, 0xfb, 0xd9, 0x05, 0x01, 0xfc, 0xd8, 
+    0x05, 0x02, 0xd3, 0x0c, 0x00, 0x4b, 0x0d, 0x48, 0x01, 0xf0, 0xe7, 0x02, 
+    0x1a, 0x00, 0x60, 0x01, 0x22, 0x02, 0x60, 0x00, 0xf5, 0x80, 0x00, 0x50, 
+    0x02, 0x60, 0x0a, 0x4a, 0x4f, 0xf4, 0x00, 0x00, 0x50, 0x10, 0x60, 0x09, 
+    0x4a, 0x0e, 0x20, 0x10, 0x60, 0x60, 0x19, 0x60, 0x62, 0xb6, 0x9b, 0x01, 
+    0x7f, 0x41, 0x40, 0x41, 0xe3, 0x00, 0x00, 0x90, 0x03, 0x40, 0x04, 0x03, 
+    0x00, 0xa0, 0x15, 0x0b, 0x20, 0xa0, 0x07, 0x20, 0x0c, 0xfb, 0x00, 0x40, 
+    0x08, 0xfe, 0x54, 0x43, 0x40, 0x1b, 0x20, 0x44, 0x07, 0x00, 0x44, 0x23, 
+    0x21, 0x18, 0x00, 0xfe, 0x43, 0x00, 0xc0, 0x04, 0x40, 0x30, 0x00, 0x68, 
+    0xfe, 0x43, 0x30, 0x2b, 0x20, 0x34, 0x07, 0x00, 0x33, 0x21, 0x1c, 0x55, 
+    0x17, 0x00, 0x1c, 0x17, 0x00, 0x10, 0x1f, 0x00, 0x10, 0x1f, 0x00, 0x08, 
+    0x55, 0x27, 0x00, 0x08, 0x27, 0x00, 0x0c, 0x2f, 0x00, 0x0c, 0x07, 0x01, 
+    0x10, 0xab, 0x07, 0x00, 0x53, 0x20, 0x10, 0x07, 0x00, 0x10, 0x5b, 0x20, 
+    0x18, 0x0f, 0x00, 0xaa, 0x18, 0x63, 0x20, 0x1c, 0x17, 0x00, 0x1c, 0x6b, 
+    0x20, 0x14, 0x1f, 0x00, 0xaa, 0x14, 0x73, 0x20, 0x04, 0x5f, 0x00, 0x04, 
+    0x5f, 0x00, 0x00, 0x2f, 0x00, 0xad, 0x83, 0x21, 0x00, 0x7f, 0x00, 0x9b, 
+    0x21, 0x04, 0x87, 0x00, 0x04, 0xa3, 0x20, 0xaa, 0x0c, 0x8f, 0x00, 0x0c, 
+    0xab, 0x20, 0x08, 0x97, 0x00, 0x08, 0xb3, 0x20, 0xaa, 0x14, 0x8f, 0x00, 
+    0x14, 0x8f, 0x00, 0x18, 0x97, 0x00, 0x18, 0x97, 0x00, 0xaa, 0x04, 0x67, 
+    0x00, 0x04, 0xbb, 0x20, 0x08, 0x6f, 0x00, 0x08, 0x57, 0x01, 0x55, 0xa7, 
+    0x00, 0x14, 0xd3, 0x20, 0x4c, 0xc7, 0x00, 0x4c, 0x47, 0x01, 0x20, 0xa1, 
+    0x5f, 0x00, 0xd0, 0x04, 0x40, 0x24, 0x8f, 0x00, 0x24, 0xe3, 0x20, 0xaa, 
+    0x20, 0x97, 0x00, 0x20, 0xeb, 0x20, 0x28, 0x9f, 0x00, 0x28, 0xf3, 0x20, 
+    0x5a, 0x2c, 0xa7, 0x00, 0x2c, 0x77, 0x01, 0x27, 0x00, 0x00, 0x27, 0x00, 
+    0x48, 0x55, 0xff, 0x00, 0x48, 0x1b, 0x40, 0x10, 0xef, 0x00, 0x10, 0x1b, 
+    0x40, 0x19, 0x42, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x42, 0x0f, 0x40, 
+    0x12, 0x2b, 0x0b, 0x01, 0x2a, 0x40, 0x54, 0x1b, 0x40, 0x2b, 0x17, 0x01, 
+    0x03, 0x00, 0x5c, 0x00, 0x80, 0x27, 0x40, 0x22, 0x02, 0x0b, 0x00, 0x84, 
+    0x0b, 0x04, 0x02, 0xb5, 0x17, 0x00, 0x96, 0x17, 0x04, 0x03, 0x23, 0x00, 
+    0x42, 0x00, 0x14, 0x46, 0x01, 0xaa, 0x04, 0x2f, 0x00, 0xaa, 0x2f, 0x04, 
+    0xee, 0x3b, 0x00, 0xd4, 0x3b, 0x04, 0x55, 0x05, 0x09, 0x92, 0x6f, 0x02, 
+    0x05, 0x72, 0x00, 0x88, 0x79, 0x00, 0x07, 0x01, 0x7d, 0x00, 0x2a, 0x00, 
+    0x44, 0x00, 0x65, 0x00, 0x76, 0x10, 0x00, 0x69, 0x00, 0x63, 0x07, 0x00, 
+    0x49, 0x00, 0x6e, 0x04, 0x00, 0x74, 0x0f, 0x00, 0x72, 0x00, 0x66, 0x00, 
+    0x61, 0x11, 0x11, 0x02, 0x47, 0x00, 0x55, 0x15, 0x00, 0x44, 0x00, 0x73, 
+    0x05, 0xa9, 0x00, 0x50, 0xad, 0x00, 0x7b, 0x00, 0x36, 0x00, 0x32, 0x41, 
+    0x1d, 0x00, 0x64, 0x00, 0x34, 0x00, 0x31, 0x09, 0x00, 0x33, 0xc0, 0x00, 
+    0x2d, 0x00, 0x38, 0x00, 0x37, 0x43, 0x00, 0x09, 0x01, 0x8a, 0x34, 0x09, 
+    0x00, 0x66, 0x4f, 0x00, 0x2d, 0x00, 0x39, 0x1f, 0x00, 0xaa, 0x36, 0x43, 
+    0x00, 0x2d, 0x5d, 0x00, 0x30, 0x2b, 0x00, 0x34, 0x51, 0x00, 0xaa, 0x33, 
+    0x3b, 0x00, 0x66, 0x3d, 0x02, 0x62, 0x37, 0x00, 0x7d, 0xda, 0x02, 0x1a, 
+    0x40, 0x01, 0x22, 0x04, 0xf8, 0x01, 0xea, 0x04, 0x57, 0x49, 0x4e, 0x28, 
+    0x55, 0x53, 0x42, 0xbb, 0x0d, 0x01, 0x17, 0x14, 0x12, 0x01, 0x01, 0x3a, 
+    0x02, 0x40, 0x50, 0x1d, 0x7a, 0x60, 0x07, 0x01, 0x00, 0x01, 0x02, 0x03, 
+    0x01, 0x09, 0x02, 0x2b, 0x00, 0x80, 0x02, 0x01, 0x00, 0x80, 0x32, 0x09, 
+    0x04, 0x5b, 0x20, 0x12, 0xff, 0xe7, 0x01, 0x05, 0x01, 0x56, 0x60, 0x00, 
+    0x09, 0x04, 0x01, 0x69, 0x20, 0xfe, 0x01, 0x01, 0x04, 0x09, 0x21, 0x0d, 
+    0x40, 0x10, 0x27, 0x00, 0x04, 0x01, 0x01, 0x33, 0x20, 0x09, 0x50, 0x04, 
+    0x12, 0x03, 0x73, 0xfb, 0x00, 0x61, 0xf9, 0x00, 0x6c, 0x45, 0x05, 0x20, 
+    0x6d, 0x0d, 0x20, 0x14, 0x03, 0x46, 0xfd, 0x00, 0x64, 0x83, 0x17, 0x20, 
+    0x17, 0x03, 0x64, 0x00, 0x79, 0x00, 0x2a, 0x13, 0x10, 0xa0, 0x20, 0x00, 
+    0x42, 0x00, 0x6f, 0x01, 0x00, 0x74, 0x39, 0x00, 0x02, 0x6f, 0x31, 0x04, 
+    0x72, 0x00, 0x12, 0x03, 0x4d, 0x00, 0xa0, 0x53, 0x00, 0x46, 0x00, 0x54, 
+    0x1f, 0x20, 0x30, 0xfb, 0x00, 0x02, 0x7e, 0xe3, 0x20, 0x46, 0x61, 0x64, 
+    0x65, 0x63, 0x61, 0x00, 0x6e, 0x64, 0x79, 0x20, 0x76, 0x31, 0x2e, 0x30, 
+    0x80, 0x37, 0x0d, 0x0a, 0x00, 0xff, 0xff, 0x8d, 0xfa, 0x00, 
 };
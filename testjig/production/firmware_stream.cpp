@@ -0,0 +1,102 @@
+/*
+ * Streaming LZSS decoder for the compressed firmware image embedded in the
+ * testjig. See firmware_stream.h for the stream format.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "firmware_stream.h"
+
+FirmwareStream::FirmwareStream(const uint8_t *compressed, unsigned compressedSize)
+    : compressed(compressed), compressedSize(compressedSize)
+{
+    restart();
+}
+
+void FirmwareStream::restart()
+{
+    pos = 0;
+    sectorsProduced = 0;
+    flags = 0;
+    flagBits = 0;
+    matchPos = 0;
+    matchRemaining = 0;
+    windowPos = 0;
+}
+
+bool FirmwareStream::outputByte(uint8_t &b)
+{
+    if (matchRemaining) {
+        // Continue an in-progress match, possibly spanning sector boundaries
+        b = window[matchPos++ & (WINDOW_SIZE - 1)];
+        matchRemaining--;
+
+    } else {
+        if (!flagBits) {
+            if (pos >= compressedSize)
+                return false;
+            flags = compressed[pos++];
+            flagBits = 8;
+        }
+
+        bool isMatch = flags & 1;
+        flags >>= 1;
+        flagBits--;
+
+        if (isMatch) {
+            if (pos + 2 > compressedSize)
+                return false;
+            uint8_t lo = compressed[pos++];
+            uint8_t hi = compressed[pos++];
+            unsigned distance = (lo | ((hi & 0xE0) << 3)) + 1;
+            matchPos = windowPos - distance;
+            matchRemaining = (hi & 0x1F) + MIN_MATCH;
+
+            b = window[matchPos++ & (WINDOW_SIZE - 1)];
+            matchRemaining--;
+
+        } else {
+            if (pos >= compressedSize)
+                return false;
+            b = compressed[pos++];
+        }
+    }
+
+    window[windowPos++ & (WINDOW_SIZE - 1)] = b;
+    return true;
+}
+
+bool FirmwareStream::getSector(unsigned sector, uint32_t *data)
+{
+    if (sector < sectorsProduced)
+        restart();
+
+    // Decode forward until the requested sector lands in the caller's buffer
+    while (sectorsProduced <= sector) {
+        uint8_t *out = (uint8_t *) data;
+        for (unsigned i = 0; i < ARMKinetisDebug::FLASH_SECTOR_SIZE; i++) {
+            if (!outputByte(out[i]))
+                return false;
+        }
+        sectorsProduced++;
+    }
+
+    return true;
+}
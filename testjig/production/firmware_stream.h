@@ -0,0 +1,62 @@
+/*
+ * Streaming LZSS decoder for the compressed firmware image embedded in the
+ * testjig. Decompresses one flash sector at a time, on demand, so the full
+ * image never needs to exist in jig RAM or flash.
+ *
+ * The stream format is produced by firmwareprep.py: flag bytes consumed LSB
+ * first, each bit introducing either a literal byte or a two-byte match
+ * token. Match tokens hold the low 8 bits of (distance - 1), then the top 3
+ * bits of (distance - 1) alongside (length - 3) in the low 5 bits.
+ *
+ * Copyright (c) 2013 Micah Elizabeth Scott
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+#include <stdint.h>
+#include "arm_kinetis_debug.h"
+
+class FirmwareStream : public ARMKinetisDebug::FlashProgrammer::ImageSource
+{
+public:
+    FirmwareStream(const uint8_t *compressed, unsigned compressedSize);
+
+    // Decompress the indicated sector. Asking for an earlier sector than the
+    // last one produced restarts the stream, so each FlashProgrammer pass
+    // (program, then verify) decodes the image front to back.
+    virtual bool getSector(unsigned sector, uint32_t *data);
+
+private:
+    static const unsigned WINDOW_SIZE = 2048;
+    static const unsigned MIN_MATCH = 3;
+
+    void restart();
+    bool outputByte(uint8_t &b);
+
+    const uint8_t *compressed;
+    unsigned compressedSize;
+    unsigned pos;               // Read position in the compressed stream
+    unsigned sectorsProduced;   // Sectors already emitted since restart()
+    uint8_t flags;              // Remaining bits of the current flag byte
+    unsigned flagBits;
+    unsigned matchPos;          // Window position of an in-progress match
+    unsigned matchRemaining;    // Bytes left to copy from that match
+    unsigned windowPos;
+    uint8_t window[WINDOW_SIZE];
+};
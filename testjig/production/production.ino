@@ -2,6 +2,11 @@
  * Fadecandy testjig firmware for production.
  * This loads an initial bootloader/firmware image on the device, and runs electrical tests.
  *
+ * Supports gang fixtures: up to 'gangSlots' boards, each on its own SWD
+ * pin pair, are flash-programmed concurrently and tested in turn, so
+ * station throughput scales with fixture slots. A single-board fixture
+ * is simply a gang with three empty slots.
+ *
  * Communicates with the PC for debug purposes using USB-Serial.
  * Final OK / Error status shows up on WS2811 LEDs attached to the DUT.
  */
@@ -10,11 +15,60 @@
 #include "arm_kinetis_reg.h"
 #include "fc_remote.h"
 #include "electrical_test.h"
+#include "firmware_stream.h"
+#include "firmware_data.h"
 #include "testjig.h"
 
-ARMKinetisDebug target(swclkPin, swdioPin);
-FcRemote remote(target);
-ElectricalTest etest(target);
+ARMKinetisDebug target0(gangSwclkPin[0], gangSwdioPin[0]);
+ARMKinetisDebug target1(gangSwclkPin[1], gangSwdioPin[1]);
+ARMKinetisDebug target2(gangSwclkPin[2], gangSwdioPin[2]);
+ARMKinetisDebug target3(gangSwclkPin[3], gangSwdioPin[3]);
+ARMKinetisDebug *targets[gangSlots] = { &target0, &target1, &target2, &target3 };
+
+FcRemote remote0(target0);
+FcRemote remote1(target1);
+FcRemote remote2(target2);
+FcRemote remote3(target3);
+FcRemote *remotes[gangSlots] = { &remote0, &remote1, &remote2, &remote3 };
+
+ElectricalTest etest0(target0);
+ElectricalTest etest1(target1);
+ElectricalTest etest2(target2);
+ElectricalTest etest3(target3);
+ElectricalTest *etests[gangSlots] = { &etest0, &etest1, &etest2, &etest3 };
+
+// Slot state for the current run. A slot drops out of 'present' at its
+// first failure and the rest of the gang carries on.
+bool slotPresent[gangSlots];
+bool slotPassed[gangSlots];
+
+/*
+ * Shared sector decoder for gang programming. Every slot programs the
+ * same image and the programming loop walks sectors in lockstep, so one
+ * decompressor window serves the whole gang: each sector is decoded
+ * once, then replayed from the cache for the other slots.
+ */
+class SectorCache : public ARMKinetisDebug::FlashProgrammer::ImageSource
+{
+public:
+    SectorCache(FirmwareStream &inner) : inner(inner), cachedSector(-1U) {}
+
+    virtual bool getSector(unsigned sector, uint32_t *data)
+    {
+        if (sector != cachedSector) {
+            if (!inner.getSector(sector, cache))
+                return false;
+            cachedSector = sector;
+        }
+        memcpy(data, cache, sizeof cache);
+        return true;
+    }
+
+private:
+    FirmwareStream &inner;
+    unsigned cachedSector;
+    uint32_t cache[ARMKinetisDebug::FLASH_SECTOR_SIZE / 4];
+};
 
 void setup()
 {
@@ -43,65 +97,185 @@ void waitForButton()
     digitalWrite(ledPin, HIGH);
 }
 
+bool gangInstallFirmware()
+{
+    /*
+     * Program every present board concurrently. Each target's RAM-resident
+     * stub programs a queued sector while the jig streams the next sector
+     * to another board over its own SWD port, so the per-sector flash
+     * wait -- the slow part of programming -- overlaps across the gang.
+     * A slot that fails drops out; the others keep going.
+     */
+
+    static FirmwareStream image(fw_compressedData, sizeof fw_compressedData);
+    static SectorCache cache(image);
+
+    ARMKinetisDebug::FlashProgrammer prog0(target0, cache, fw_sectorCount);
+    ARMKinetisDebug::FlashProgrammer prog1(target1, cache, fw_sectorCount);
+    ARMKinetisDebug::FlashProgrammer prog2(target2, cache, fw_sectorCount);
+    ARMKinetisDebug::FlashProgrammer prog3(target3, cache, fw_sectorCount);
+    ARMKinetisDebug::FlashProgrammer *progs[gangSlots] = { &prog0, &prog1, &prog2, &prog3 };
+
+    for (unsigned i = 0; i < gangSlots; i++) {
+        if (slotPresent[i] && !progs[i]->begin()) {
+            slotPresent[i] = false;
+        }
+    }
+
+    bool blink = false;
+    for (;;) {
+        bool working = false;
+        blink = !blink;
+        digitalWrite(ledPin, blink);
+
+        for (unsigned i = 0; i < gangSlots; i++) {
+            if (!slotPresent[i] || progs[i]->isComplete()) {
+                continue;
+            }
+            if (progs[i]->next()) {
+                working = true;
+            } else {
+                slotPresent[i] = false;
+            }
+        }
+
+        if (!working) {
+            break;
+        }
+    }
+
+    for (unsigned i = 0; i < gangSlots; i++) {
+        if (slotPresent[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool testBoard(unsigned slot)
+{
+    // Boot, configure, and frame-rate test one programmed board.
+    FcRemote &remote = *remotes[slot];
+
+    // Boot the target
+    if (!remote.boot())
+        return false;
+
+    // Disable interpolation, since we only update fbNext
+    if (!remote.setFlags(CFLAG_NO_INTERPOLATION))
+        return false;
+
+    // Set a default color lookup table
+    if (!remote.initLUT())
+        return false;
+
+    // Pixel pattern to display while running the frame rate test (white / green)
+    if (!remote.setPixel(0, 16, 16, 16)) return false;
+    if (!remote.setPixel(1, 0, 24, 0)) return false;
+
+    // Check the frame rate; make sure the firmware is going fast enough
+    return remote.testFrameRate();
+}
+
 void success()
 {
     Serial.println("");
     Serial.println("#### Tests Passed! ####");
     Serial.println("");
 
-    // Green and blue throbbing means success!
+    // Green and blue throbbing on every passing board means success!
+    // Return (back to power-off) once no board answers any more.
     while (1) {
         float x = sin(millis() * 0.008);
-        if (!remote.setPixel(0, 0, 0xc + 0x10 * x, 0)) return;
-        if (!remote.setPixel(1, 0, 0, 0xc - 0x10 * x)) return;
+        bool any = false;
+
+        for (unsigned i = 0; i < gangSlots; i++) {
+            if (!slotPassed[i]) {
+                continue;
+            }
+            if (remotes[i]->setPixel(0, 0, 0xc + 0x10 * x, 0) &&
+                remotes[i]->setPixel(1, 0, 0, 0xc - 0x10 * x)) {
+                any = true;
+            } else {
+                slotPassed[i] = false;
+            }
+        }
+
+        if (!any) {
+            return;
+        }
     }
 }
 
 void loop()
 {
-    // Keep target power supply off when we're not using it
-    etest.powerOff();
+    // Keep target power supply off when we're not using it.
+    // One shared supply powers every slot.
+    etest0.powerOff();
 
     // Button press starts the test
     waitForButton();
 
     // Turn on the target power supply
-    if (!etest.powerOn())
-        return;
-
-    // Start debugging the target
-    if (!target.begin())
-        return;
-    if (!target.startup())
-        return;
-
-    // Run an electrical test, to verify that the target board is okay
-    if (!etest.runAll())
+    if (!etest0.powerOn())
         return;
 
-    // Program firmware, blinking both LEDs in unison for status.
-    if (!remote.installFirmware())
+    // Find the boards. An empty slot fails SWD detection and sits the run out.
+    unsigned present = 0;
+    for (unsigned i = 0; i < gangSlots; i++) {
+        slotPassed[i] = false;
+        slotPresent[i] = targets[i]->begin() && targets[i]->startup();
+        if (slotPresent[i]) {
+            present++;
+        } else {
+            Serial.print("Slot ");
+            Serial.print(i);
+            Serial.println(": no board detected");
+        }
+    }
+    Serial.print(present);
+    Serial.println(" board(s) in this run");
+    if (!present)
         return;
 
-    // Boot the target
-    if (!remote.boot())
-        return;
-    
-    // Disable interpolation, since we only update fbNext
-    if (!remote.setFlags(CFLAG_NO_INTERPOLATION))
-        return;
+    /*
+     * Electrical tests run one slot at a time: the analog sense nets and
+     * serial loopback are shared fixture wiring, routed to the slot
+     * under test.
+     */
+    for (unsigned i = 0; i < gangSlots; i++) {
+        if (slotPresent[i] && !etests[i]->runAll()) {
+            slotPresent[i] = false;
+        }
+    }
 
-    // Set a default color lookup table
-    if (!remote.initLUT())
+    // Program firmware into all surviving boards concurrently
+    if (!gangInstallFirmware())
         return;
 
-    // Pixel pattern to display while running the frame rate test (white / green)
-    if (!remote.setPixel(0, 16, 16, 16)) return;
-    if (!remote.setPixel(1, 0, 24, 0)) return;
+    /*
+     * Boot and test each surviving board in turn. The LED data feedback
+     * line is shared fixture wiring too, so the frame rate check needs
+     * the fixture to route the active slot's data line to it.
+     */
+    for (unsigned i = 0; i < gangSlots; i++) {
+        if (slotPresent[i]) {
+            slotPassed[i] = testBoard(i);
+        }
+    }
 
-    // Check the frame rate; make sure the firmware is going fast enough
-    if (!remote.testFrameRate())
-        return;
+    // Per-slot verdict for the operator's log
+    Serial.println("");
+    for (unsigned i = 0; i < gangSlots; i++) {
+        Serial.print("Slot ");
+        Serial.print(i);
+        Serial.println(slotPassed[i] ? ": PASS" : ": FAIL / empty");
+    }
 
-    success();
+    for (unsigned i = 0; i < gangSlots; i++) {
+        if (slotPassed[i]) {
+            success();
+            return;
+        }
+    }
 }
@@ -10,6 +10,22 @@ static const unsigned ledPin = 13;
 static const unsigned swclkPin = 3;
 static const unsigned swdioPin = 4;
 
+/*
+ * Gang programming: one SWD pin pair per fixture slot. Slot 0 is the
+ * classic single-board wiring above; the extra pairs use the Teensy's
+ * underside pads, which are unused by the single-board jig. A slot with
+ * no board clipped in fails SWD detection at the start of a run and is
+ * skipped, so a single-board fixture is just a gang with empty slots.
+ *
+ * The power supply, analog sense dividers, serial loopback, and LED
+ * data feedback line are shared fixture wiring: a gang fixture must
+ * route them to one slot at a time (the phases that use them run
+ * per-slot, in slot order), while each slot's SWD port is dedicated.
+ */
+static const unsigned gangSlots = 4;
+static const unsigned gangSwclkPin[gangSlots] = { 3, 24, 26, 28 };
+static const unsigned gangSwdioPin[gangSlots] = { 4, 25, 27, 29 };
+
 // Electrical testing
 static const unsigned fcTXPin = 0;
 static const unsigned fcRXPin = 1;